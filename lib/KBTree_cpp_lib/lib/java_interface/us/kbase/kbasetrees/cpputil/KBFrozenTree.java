@@ -0,0 +1,155 @@
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (http://www.swig.org).
+ * Version 2.0.8
+ *
+ * Do not make changes to this file unless you know what you are doing--modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package us.kbase.kbasetrees.cpputil;
+
+public class KBFrozenTree {
+  private long swigCPtr;
+  protected boolean swigCMemOwn;
+
+  protected KBFrozenTree(long cPtr, boolean cMemoryOwn) {
+    swigCMemOwn = cMemoryOwn;
+    swigCPtr = cPtr;
+  }
+
+  protected static long getCPtr(KBFrozenTree obj) {
+    return (obj == null) ? 0 : obj.swigCPtr;
+  }
+
+  protected void finalize() {
+    delete();
+  }
+
+  public synchronized void delete() {
+    if (swigCPtr != 0) {
+      if (swigCMemOwn) {
+        swigCMemOwn = false;
+        KBTreeUtilJNI.delete_KBFrozenTree(swigCPtr);
+      }
+      swigCPtr = 0;
+    }
+  }
+
+  public KBFrozenTree(KBTree tree) {
+    this(KBTreeUtilJNI.new_KBFrozenTree__SWIG_0(KBTree.getCPtr(tree), tree), true);
+  }
+
+  public KBFrozenTree(String newickString, boolean assumeBootstrapNames) {
+    this(KBTreeUtilJNI.new_KBFrozenTree__SWIG_1(newickString, assumeBootstrapNames), true);
+  }
+
+  public KBFrozenTree(String newickString) {
+    this(KBTreeUtilJNI.new_KBFrozenTree__SWIG_2(newickString), true);
+  }
+
+  public boolean isSameSnapshot(KBFrozenTree other) {
+    return KBTreeUtilJNI.KBFrozenTree_isSameSnapshot(swigCPtr, this, KBFrozenTree.getCPtr(other), other);
+  }
+
+  public long getNodeCount() {
+    return KBTreeUtilJNI.KBFrozenTree_getNodeCount(swigCPtr, this);
+  }
+
+  public long getLeafCount() {
+    return KBTreeUtilJNI.KBFrozenTree_getLeafCount(swigCPtr, this);
+  }
+
+  public long getMemoryUsage() {
+    return KBTreeUtilJNI.KBFrozenTree_getMemoryUsage(swigCPtr, this);
+  }
+
+  public String getAllLeafNames() {
+    return KBTreeUtilJNI.KBFrozenTree_getAllLeafNames(swigCPtr, this);
+  }
+
+  public String getAllNodeNames() {
+    return KBTreeUtilJNI.KBFrozenTree_getAllNodeNames(swigCPtr, this);
+  }
+
+  public boolean hasNode(String name) {
+    return KBTreeUtilJNI.KBFrozenTree_hasNode(swigCPtr, this, name);
+  }
+
+  public String getPathToRoot(String name) {
+    return KBTreeUtilJNI.KBFrozenTree_getPathToRoot(swigCPtr, this, name);
+  }
+
+  public int getDepth(String name) {
+    return KBTreeUtilJNI.KBFrozenTree_getDepth(swigCPtr, this, name);
+  }
+
+  public long getSubtreeSize(String name) {
+    return KBTreeUtilJNI.KBFrozenTree_getSubtreeSize(swigCPtr, this, name);
+  }
+
+  public long getCladeLeafCount(String name) {
+    return KBTreeUtilJNI.KBFrozenTree_getCladeLeafCount(swigCPtr, this, name);
+  }
+
+  public double getDistanceToRoot(String name) {
+    return KBTreeUtilJNI.KBFrozenTree_getDistanceToRoot(swigCPtr, this, name);
+  }
+
+  public String getLowestCommonAncestorNames(String namePairs) {
+    return KBTreeUtilJNI.KBFrozenTree_getLowestCommonAncestorNames(swigCPtr, this, namePairs);
+  }
+
+  public boolean isMonophyletic(String leafNames) {
+    return KBTreeUtilJNI.KBFrozenTree_isMonophyletic(swigCPtr, this, leafNames);
+  }
+
+  public double getPatristicDistance(String nameA, String nameB) {
+    return KBTreeUtilJNI.KBFrozenTree_getPatristicDistance(swigCPtr, this, nameA, nameB);
+  }
+
+  public boolean writePatristicDistancesToFile(String filename, String names, long format, long threadCount) {
+    return KBTreeUtilJNI.KBFrozenTree_writePatristicDistancesToFile__SWIG_0(swigCPtr, this, filename, names, format, threadCount);
+  }
+
+  public boolean writePatristicDistancesToFile(String filename, String names, long format) {
+    return KBTreeUtilJNI.KBFrozenTree_writePatristicDistancesToFile__SWIG_1(swigCPtr, this, filename, names, format);
+  }
+
+  public boolean writePatristicDistancesToFile(String filename, String names) {
+    return KBTreeUtilJNI.KBFrozenTree_writePatristicDistancesToFile__SWIG_2(swigCPtr, this, filename, names);
+  }
+
+  public boolean writePatristicDistancesToFile(String filename) {
+    return KBTreeUtilJNI.KBFrozenTree_writePatristicDistancesToFile__SWIG_3(swigCPtr, this, filename);
+  }
+
+  public String toNewick() {
+    return KBTreeUtilJNI.KBFrozenTree_toNewick__SWIG_0(swigCPtr, this);
+  }
+
+  public String toNewick(long style) {
+    return KBTreeUtilJNI.KBFrozenTree_toNewick__SWIG_1(swigCPtr, this, style);
+  }
+
+  public boolean writeNewickToFile(String filename) {
+    return KBTreeUtilJNI.KBFrozenTree_writeNewickToFile__SWIG_0(swigCPtr, this, filename);
+  }
+
+  public boolean writeNewickToFile(String filename, long style) {
+    return KBTreeUtilJNI.KBFrozenTree_writeNewickToFile__SWIG_1(swigCPtr, this, filename, style);
+  }
+
+  public KBTree toKBTree() {
+    long cPtr = KBTreeUtilJNI.KBFrozenTree_toKBTree(swigCPtr, this);
+    return (cPtr == 0) ? null : new KBTree(cPtr, true);
+  }
+
+  public KBFrozenTree removeNodesByNameAndSimplify(String nodeNames) {
+    return new KBFrozenTree(KBTreeUtilJNI.KBFrozenTree_removeNodesByNameAndSimplify(swigCPtr, this, nodeNames), true);
+  }
+
+  public KBFrozenTree replaceNodeNames(String replacements) {
+    return new KBFrozenTree(KBTreeUtilJNI.KBFrozenTree_replaceNodeNames(swigCPtr, this, replacements), true);
+  }
+
+}
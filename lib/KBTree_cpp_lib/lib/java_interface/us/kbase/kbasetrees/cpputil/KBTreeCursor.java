@@ -0,0 +1,95 @@
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (http://www.swig.org).
+ * Version 2.0.8
+ *
+ * Do not make changes to this file unless you know what you are doing--modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package us.kbase.kbasetrees.cpputil;
+
+public class KBTreeCursor {
+  private long swigCPtr;
+  protected boolean swigCMemOwn;
+
+  protected KBTreeCursor(long cPtr, boolean cMemoryOwn) {
+    swigCMemOwn = cMemoryOwn;
+    swigCPtr = cPtr;
+  }
+
+  protected static long getCPtr(KBTreeCursor obj) {
+    return (obj == null) ? 0 : obj.swigCPtr;
+  }
+
+  protected void finalize() {
+    delete();
+  }
+
+  public synchronized void delete() {
+    if (swigCPtr != 0) {
+      if (swigCMemOwn) {
+        swigCMemOwn = false;
+        KBTreeUtilJNI.delete_KBTreeCursor(swigCPtr);
+      }
+      swigCPtr = 0;
+    }
+  }
+
+  private KBTree treeReference;
+
+  public final static long PREORDER = KBTreeUtilJNI.KBTreeCursor_PREORDER_get();
+  public final static long POSTORDER = KBTreeUtilJNI.KBTreeCursor_POSTORDER_get();
+  public final static long BREADTH_FIRST = KBTreeUtilJNI.KBTreeCursor_BREADTH_FIRST_get();
+  public final static long LEAVES = KBTreeUtilJNI.KBTreeCursor_LEAVES_get();
+
+  public KBTreeCursor(KBTree tree, long order) {
+    this(KBTreeUtilJNI.new_KBTreeCursor__SWIG_0(KBTree.getCPtr(tree), tree, order), true);
+    treeReference = tree;
+  }
+
+  public KBTreeCursor(KBTree tree) {
+    this(KBTreeUtilJNI.new_KBTreeCursor__SWIG_1(KBTree.getCPtr(tree), tree), true);
+    treeReference = tree;
+  }
+
+  public long getOrder() {
+    return KBTreeUtilJNI.KBTreeCursor_getOrder(swigCPtr, this);
+  }
+
+  public void reset() {
+    KBTreeUtilJNI.KBTreeCursor_reset(swigCPtr, this);
+  }
+
+  public boolean next() {
+    return KBTreeUtilJNI.KBTreeCursor_next(swigCPtr, this);
+  }
+
+  public boolean isAtEnd() {
+    return KBTreeUtilJNI.KBTreeCursor_isAtEnd(swigCPtr, this);
+  }
+
+  public String getName() {
+    return KBTreeUtilJNI.KBTreeCursor_getName(swigCPtr, this);
+  }
+
+  public String getParentName() {
+    return KBTreeUtilJNI.KBTreeCursor_getParentName(swigCPtr, this);
+  }
+
+  public double getDistanceToParent() {
+    return KBTreeUtilJNI.KBTreeCursor_getDistanceToParent(swigCPtr, this);
+  }
+
+  public double getBootstrapValue() {
+    return KBTreeUtilJNI.KBTreeCursor_getBootstrapValue(swigCPtr, this);
+  }
+
+  public boolean isLeaf() {
+    return KBTreeUtilJNI.KBTreeCursor_isLeaf(swigCPtr, this);
+  }
+
+  public long getNodeId() {
+    return KBTreeUtilJNI.KBTreeCursor_getNodeId(swigCPtr, this);
+  }
+
+}
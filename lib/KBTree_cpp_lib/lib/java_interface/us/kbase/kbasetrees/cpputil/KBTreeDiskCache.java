@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (http://www.swig.org).
+ * Version 2.0.8
+ *
+ * Do not make changes to this file unless you know what you are doing--modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package us.kbase.kbasetrees.cpputil;
+
+public class KBTreeDiskCache {
+  private long swigCPtr;
+  protected boolean swigCMemOwn;
+
+  protected KBTreeDiskCache(long cPtr, boolean cMemoryOwn) {
+    swigCMemOwn = cMemoryOwn;
+    swigCPtr = cPtr;
+  }
+
+  protected static long getCPtr(KBTreeDiskCache obj) {
+    return (obj == null) ? 0 : obj.swigCPtr;
+  }
+
+  protected void finalize() {
+    delete();
+  }
+
+  public synchronized void delete() {
+    if (swigCPtr != 0) {
+      if (swigCMemOwn) {
+        swigCMemOwn = false;
+        KBTreeUtilJNI.delete_KBTreeDiskCache(swigCPtr);
+      }
+      swigCPtr = 0;
+    }
+  }
+
+  public KBTreeDiskCache(String directory, java.math.BigInteger sizeLimit) {
+    this(KBTreeUtilJNI.new_KBTreeDiskCache__SWIG_0(directory, sizeLimit), true);
+  }
+
+  public KBTreeDiskCache(String directory) {
+    this(KBTreeUtilJNI.new_KBTreeDiskCache__SWIG_1(directory), true);
+  }
+
+  public KBTree get(String newickString, boolean assumeBootstrapNames) {
+    long cPtr = KBTreeUtilJNI.KBTreeDiskCache_get__SWIG_0(swigCPtr, this, newickString, assumeBootstrapNames);
+    return (cPtr == 0) ? null : new KBTree(cPtr, true);
+  }
+
+  public KBTree get(String newickString) {
+    long cPtr = KBTreeUtilJNI.KBTreeDiskCache_get__SWIG_1(swigCPtr, this, newickString);
+    return (cPtr == 0) ? null : new KBTree(cPtr, true);
+  }
+
+  public boolean contains(String newickString, boolean assumeBootstrapNames) {
+    return KBTreeUtilJNI.KBTreeDiskCache_contains__SWIG_0(swigCPtr, this, newickString, assumeBootstrapNames);
+  }
+
+  public boolean contains(String newickString) {
+    return KBTreeUtilJNI.KBTreeDiskCache_contains__SWIG_1(swigCPtr, this, newickString);
+  }
+
+  public String getImagePath(String newickString, boolean assumeBootstrapNames) {
+    return KBTreeUtilJNI.KBTreeDiskCache_getImagePath__SWIG_0(swigCPtr, this, newickString, assumeBootstrapNames);
+  }
+
+  public String getImagePath(String newickString) {
+    return KBTreeUtilJNI.KBTreeDiskCache_getImagePath__SWIG_1(swigCPtr, this, newickString);
+  }
+
+  public void trim() {
+    KBTreeUtilJNI.KBTreeDiskCache_trim(swigCPtr, this);
+  }
+
+  public void clear() {
+    KBTreeUtilJNI.KBTreeDiskCache_clear(swigCPtr, this);
+  }
+
+  public void setSizeLimit(java.math.BigInteger bytes) {
+    KBTreeUtilJNI.KBTreeDiskCache_setSizeLimit(swigCPtr, this, bytes);
+  }
+
+  public java.math.BigInteger getSizeLimit() {
+    return KBTreeUtilJNI.KBTreeDiskCache_getSizeLimit(swigCPtr, this);
+  }
+
+  public java.math.BigInteger getDiskUsage() {
+    return KBTreeUtilJNI.KBTreeDiskCache_getDiskUsage(swigCPtr, this);
+  }
+
+  public java.math.BigInteger getHitCount() {
+    return KBTreeUtilJNI.KBTreeDiskCache_getHitCount(swigCPtr, this);
+  }
+
+  public java.math.BigInteger getMissCount() {
+    return KBTreeUtilJNI.KBTreeDiskCache_getMissCount(swigCPtr, this);
+  }
+
+  public java.math.BigInteger getEvictionCount() {
+    return KBTreeUtilJNI.KBTreeDiskCache_getEvictionCount(swigCPtr, this);
+  }
+
+  public void resetCounters() {
+    KBTreeUtilJNI.KBTreeDiskCache_resetCounters(swigCPtr, this);
+  }
+
+}
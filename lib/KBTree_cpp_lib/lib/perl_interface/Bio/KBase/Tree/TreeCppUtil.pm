@@ -51,6 +51,48 @@ package Bio::KBase::Tree::TreeCppUtil;
 
 *translateToProt = *Bio::KBase::Tree::TreeCppUtilc::translateToProt;
 
+############# Class : Bio::KBase::Tree::TreeCppUtil::KBTreeStatistics ##############
+
+package Bio::KBase::Tree::TreeCppUtil::KBTreeStatistics;
+use vars qw(@ISA %OWNER %ITERATORS %BLESSEDMEMBERS);
+@ISA = qw( Bio::KBase::Tree::TreeCppUtil );
+%OWNER = ();
+%ITERATORS = ();
+*getNodeCount = *Bio::KBase::Tree::TreeCppUtilc::KBTreeStatistics_getNodeCount;
+*getLeafCount = *Bio::KBase::Tree::TreeCppUtilc::KBTreeStatistics_getLeafCount;
+*getMaxDepth = *Bio::KBase::Tree::TreeCppUtilc::KBTreeStatistics_getMaxDepth;
+*hasBranchLengths = *Bio::KBase::Tree::TreeCppUtilc::KBTreeStatistics_hasBranchLengths;
+*hasBootstrapValues = *Bio::KBase::Tree::TreeCppUtilc::KBTreeStatistics_hasBootstrapValues;
+sub new {
+    my $pkg = shift;
+    my $self = Bio::KBase::Tree::TreeCppUtilc::new_KBTreeStatistics(@_);
+    bless $self, $pkg if defined($self);
+}
+
+sub DESTROY {
+    return unless $_[0]->isa('HASH');
+    my $self = tied(%{$_[0]});
+    return unless defined $self;
+    delete $ITERATORS{$self};
+    if (exists $OWNER{$self}) {
+        Bio::KBase::Tree::TreeCppUtilc::delete_KBTreeStatistics($self);
+        delete $OWNER{$self};
+    }
+}
+
+sub DISOWN {
+    my $self = shift;
+    my $ptr = tied(%$self);
+    delete $OWNER{$ptr};
+}
+
+sub ACQUIRE {
+    my $self = shift;
+    my $ptr = tied(%$self);
+    $OWNER{$ptr} = 1;
+}
+
+
 ############# Class : Bio::KBase::Tree::TreeCppUtil::KBTree ##############
 
 package Bio::KBase::Tree::TreeCppUtil::KBTree;
@@ -75,22 +117,44 @@ sub DESTROY {
     }
 }
 
+*fromFile = *Bio::KBase::Tree::TreeCppUtilc::KBTree_fromFile;
+*toBinary = *Bio::KBase::Tree::TreeCppUtilc::KBTree_toBinary;
+*writeBinaryToFile = *Bio::KBase::Tree::TreeCppUtilc::KBTree_writeBinaryToFile;
+*fromBinary = *Bio::KBase::Tree::TreeCppUtilc::KBTree_fromBinary;
+*fromBinaryFile = *Bio::KBase::Tree::TreeCppUtilc::KBTree_fromBinaryFile;
+*scanStatistics = *Bio::KBase::Tree::TreeCppUtilc::KBTree_scanStatistics;
 *setOutputFlagLabel = *Bio::KBase::Tree::TreeCppUtilc::KBTree_setOutputFlagLabel;
 *setOutputFlagDistances = *Bio::KBase::Tree::TreeCppUtilc::KBTree_setOutputFlagDistances;
 *setOutputFlagComments = *Bio::KBase::Tree::TreeCppUtilc::KBTree_setOutputFlagComments;
 *setOutputFlagBootstrapValuesAsLabels = *Bio::KBase::Tree::TreeCppUtilc::KBTree_setOutputFlagBootstrapValuesAsLabels;
+*setOutputPrecision = *Bio::KBase::Tree::TreeCppUtilc::KBTree_setOutputPrecision;
+*setOutputThreadCount = *Bio::KBase::Tree::TreeCppUtilc::KBTree_setOutputThreadCount;
 *toNewick = *Bio::KBase::Tree::TreeCppUtilc::KBTree_toNewick;
 *writeNewickToFile = *Bio::KBase::Tree::TreeCppUtilc::KBTree_writeNewickToFile;
 *removeNodesByNameAndSimplify = *Bio::KBase::Tree::TreeCppUtilc::KBTree_removeNodesByNameAndSimplify;
+*removeNodeByNameAndSimplify = *Bio::KBase::Tree::TreeCppUtilc::KBTree_removeNodeByNameAndSimplify;
 *mergeZeroDistLeaves = *Bio::KBase::Tree::TreeCppUtilc::KBTree_mergeZeroDistLeaves;
 *replaceNodeNames = *Bio::KBase::Tree::TreeCppUtilc::KBTree_replaceNodeNames;
 *replaceNodeNamesOrMakeBlank = *Bio::KBase::Tree::TreeCppUtilc::KBTree_replaceNodeNamesOrMakeBlank;
+*replaceNodeName = *Bio::KBase::Tree::TreeCppUtilc::KBTree_replaceNodeName;
+*getPathToRoot = *Bio::KBase::Tree::TreeCppUtilc::KBTree_getPathToRoot;
+*getAllDescendantNames = *Bio::KBase::Tree::TreeCppUtilc::KBTree_getAllDescendantNames;
+*getDepth = *Bio::KBase::Tree::TreeCppUtilc::KBTree_getDepth;
+*getSubtreeSize = *Bio::KBase::Tree::TreeCppUtilc::KBTree_getSubtreeSize;
+*getCladeLeafCount = *Bio::KBase::Tree::TreeCppUtilc::KBTree_getCladeLeafCount;
+*getDistanceToRoot = *Bio::KBase::Tree::TreeCppUtilc::KBTree_getDistanceToRoot;
+*extractInducedSubtree = *Bio::KBase::Tree::TreeCppUtilc::KBTree_extractInducedSubtree;
+*PHYLIP_MATRIX = *Bio::KBase::Tree::TreeCppUtilc::KBTree_PHYLIP_MATRIX;
+*TSV_MATRIX = *Bio::KBase::Tree::TreeCppUtilc::KBTree_TSV_MATRIX;
+*writePatristicDistancesToFile = *Bio::KBase::Tree::TreeCppUtilc::KBTree_writePatristicDistancesToFile;
 *stripReservedCharsFromLabels = *Bio::KBase::Tree::TreeCppUtilc::KBTree_stripReservedCharsFromLabels;
 *printTree = *Bio::KBase::Tree::TreeCppUtilc::KBTree_printTree;
 *printSimpleTreeToString = *Bio::KBase::Tree::TreeCppUtilc::KBTree_printSimpleTreeToString;
 *printTreeToString = *Bio::KBase::Tree::TreeCppUtilc::KBTree_printTreeToString;
 *getNodeCount = *Bio::KBase::Tree::TreeCppUtilc::KBTree_getNodeCount;
 *getLeafCount = *Bio::KBase::Tree::TreeCppUtilc::KBTree_getLeafCount;
+*getMemoryUsage = *Bio::KBase::Tree::TreeCppUtilc::KBTree_getMemoryUsage;
+*freeze = *Bio::KBase::Tree::TreeCppUtilc::KBTree_freeze;
 *getAllLeafNames = *Bio::KBase::Tree::TreeCppUtilc::KBTree_getAllLeafNames;
 *getAllNodeNames = *Bio::KBase::Tree::TreeCppUtilc::KBTree_getAllNodeNames;
 *resetBreadthFirstIterToRoot = *Bio::KBase::Tree::TreeCppUtilc::KBTree_resetBreadthFirstIterToRoot;
@@ -102,6 +166,281 @@ sub DESTROY {
 *breadthFirstIterGetParentName = *Bio::KBase::Tree::TreeCppUtilc::KBTree_breadthFirstIterGetParentName;
 *breadthFirstIterGetAllChildrenNames = *Bio::KBase::Tree::TreeCppUtilc::KBTree_breadthFirstIterGetAllChildrenNames;
 *breadthFirstIterGetAllDescendantNames = *Bio::KBase::Tree::TreeCppUtilc::KBTree_breadthFirstIterGetAllDescendantNames;
+*NO_NODE_ID = *Bio::KBase::Tree::TreeCppUtilc::KBTree_NO_NODE_ID;
+*buildNodeIds = *Bio::KBase::Tree::TreeCppUtilc::KBTree_buildNodeIds;
+*hasNodeIds = *Bio::KBase::Tree::TreeCppUtilc::KBTree_hasNodeIds;
+*getNodeIdLimit = *Bio::KBase::Tree::TreeCppUtilc::KBTree_getNodeIdLimit;
+*isValidNodeId = *Bio::KBase::Tree::TreeCppUtilc::KBTree_isValidNodeId;
+*getNodeId = *Bio::KBase::Tree::TreeCppUtilc::KBTree_getNodeId;
+*getParentId = *Bio::KBase::Tree::TreeCppUtilc::KBTree_getParentId;
+*getSubtreeEndId = *Bio::KBase::Tree::TreeCppUtilc::KBTree_getSubtreeEndId;
+*isDescendantOf = *Bio::KBase::Tree::TreeCppUtilc::KBTree_isDescendantOf;
+*getNameById = *Bio::KBase::Tree::TreeCppUtilc::KBTree_getNameById;
+*getChildNamesById = *Bio::KBase::Tree::TreeCppUtilc::KBTree_getChildNamesById;
+*getDescendantNamesById = *Bio::KBase::Tree::TreeCppUtilc::KBTree_getDescendantNamesById;
+*getPathToRootById = *Bio::KBase::Tree::TreeCppUtilc::KBTree_getPathToRootById;
+sub DISOWN {
+    my $self = shift;
+    my $ptr = tied(%$self);
+    delete $OWNER{$ptr};
+}
+
+sub ACQUIRE {
+    my $self = shift;
+    my $ptr = tied(%$self);
+    $OWNER{$ptr} = 1;
+}
+
+
+############# Class : Bio::KBase::Tree::TreeCppUtil::KBAncestorIndex ##############
+
+package Bio::KBase::Tree::TreeCppUtil::KBAncestorIndex;
+use vars qw(@ISA %OWNER %ITERATORS %BLESSEDMEMBERS);
+@ISA = qw( Bio::KBase::Tree::TreeCppUtil );
+%OWNER = ();
+%ITERATORS = ();
+*NONE = *Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_NONE;
+sub new {
+    my $pkg = shift;
+    my $self = Bio::KBase::Tree::TreeCppUtilc::new_KBAncestorIndex(@_);
+    bless $self, $pkg if defined($self);
+}
+
+sub DESTROY {
+    return unless $_[0]->isa('HASH');
+    my $self = tied(%{$_[0]});
+    return unless defined $self;
+    delete $ITERATORS{$self};
+    if (exists $OWNER{$self}) {
+        Bio::KBase::Tree::TreeCppUtilc::delete_KBAncestorIndex($self);
+        delete $OWNER{$self};
+    }
+}
+
+*getNodeCount = *Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_getNodeCount;
+*getParent = *Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_getParent;
+*getDepth = *Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_getDepth;
+*getSubtreeSize = *Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_getSubtreeSize;
+*getLeafCount = *Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_getLeafCount;
+*isLeaf = *Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_isLeaf;
+*getDistanceToRoot = *Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_getDistanceToRoot;
+*getNode = *Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_getNode;
+*isAncestor = *Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_isAncestor;
+*getLowestCommonAncestor = *Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_getLowestCommonAncestor;
+*getLowestCommonAncestorNames = *Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_getLowestCommonAncestorNames;
+*isMonophyletic = *Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_isMonophyletic;
+sub DISOWN {
+    my $self = shift;
+    my $ptr = tied(%$self);
+    delete $OWNER{$ptr};
+}
+
+sub ACQUIRE {
+    my $self = shift;
+    my $ptr = tied(%$self);
+    $OWNER{$ptr} = 1;
+}
+
+
+############# Class : Bio::KBase::Tree::TreeCppUtil::KBTreeCursor ##############
+
+package Bio::KBase::Tree::TreeCppUtil::KBTreeCursor;
+use vars qw(@ISA %OWNER %ITERATORS %BLESSEDMEMBERS);
+@ISA = qw( Bio::KBase::Tree::TreeCppUtil );
+%OWNER = ();
+%ITERATORS = ();
+*PREORDER = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCursor_PREORDER;
+*POSTORDER = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCursor_POSTORDER;
+*BREADTH_FIRST = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCursor_BREADTH_FIRST;
+*LEAVES = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCursor_LEAVES;
+use vars qw(%TREES);
+sub new {
+    my $pkg = shift;
+    my $self = Bio::KBase::Tree::TreeCppUtilc::new_KBTreeCursor(@_);
+    return undef unless defined($self);
+    bless $self, $pkg;
+    $TREES{tied(%$self)} = $_[0];
+    return $self;
+}
+
+sub DESTROY {
+    return unless $_[0]->isa('HASH');
+    my $self = tied(%{$_[0]});
+    return unless defined $self;
+    delete $ITERATORS{$self};
+    if (exists $OWNER{$self}) {
+        Bio::KBase::Tree::TreeCppUtilc::delete_KBTreeCursor($self);
+        delete $OWNER{$self};
+    }
+    delete $TREES{$self};
+}
+
+*getOrder = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCursor_getOrder;
+*reset = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCursor_reset;
+*next = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCursor_next;
+*isAtEnd = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCursor_isAtEnd;
+*getName = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCursor_getName;
+*getParentName = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCursor_getParentName;
+*getDistanceToParent = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCursor_getDistanceToParent;
+*getBootstrapValue = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCursor_getBootstrapValue;
+*isLeaf = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCursor_isLeaf;
+*getNodeId = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCursor_getNodeId;
+sub DISOWN {
+    my $self = shift;
+    my $ptr = tied(%$self);
+    delete $OWNER{$ptr};
+}
+
+sub ACQUIRE {
+    my $self = shift;
+    my $ptr = tied(%$self);
+    $OWNER{$ptr} = 1;
+}
+
+
+############# Class : Bio::KBase::Tree::TreeCppUtil::KBFrozenTree ##############
+
+package Bio::KBase::Tree::TreeCppUtil::KBFrozenTree;
+use vars qw(@ISA %OWNER %ITERATORS %BLESSEDMEMBERS);
+@ISA = qw( Bio::KBase::Tree::TreeCppUtil );
+%OWNER = ();
+%ITERATORS = ();
+sub new {
+    my $pkg = shift;
+    my $self = Bio::KBase::Tree::TreeCppUtilc::new_KBFrozenTree(@_);
+    bless $self, $pkg if defined($self);
+}
+
+sub DESTROY {
+    return unless $_[0]->isa('HASH');
+    my $self = tied(%{$_[0]});
+    return unless defined $self;
+    delete $ITERATORS{$self};
+    if (exists $OWNER{$self}) {
+        Bio::KBase::Tree::TreeCppUtilc::delete_KBFrozenTree($self);
+        delete $OWNER{$self};
+    }
+}
+
+*isSameSnapshot = *Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_isSameSnapshot;
+*getNodeCount = *Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_getNodeCount;
+*getLeafCount = *Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_getLeafCount;
+*getMemoryUsage = *Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_getMemoryUsage;
+*getAllLeafNames = *Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_getAllLeafNames;
+*getAllNodeNames = *Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_getAllNodeNames;
+*hasNode = *Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_hasNode;
+*getPathToRoot = *Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_getPathToRoot;
+*getDepth = *Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_getDepth;
+*getSubtreeSize = *Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_getSubtreeSize;
+*getCladeLeafCount = *Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_getCladeLeafCount;
+*getDistanceToRoot = *Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_getDistanceToRoot;
+*getLowestCommonAncestorNames = *Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_getLowestCommonAncestorNames;
+*isMonophyletic = *Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_isMonophyletic;
+*getPatristicDistance = *Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_getPatristicDistance;
+*writePatristicDistancesToFile = *Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_writePatristicDistancesToFile;
+*toNewick = *Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_toNewick;
+*writeNewickToFile = *Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_writeNewickToFile;
+*toKBTree = *Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_toKBTree;
+*removeNodesByNameAndSimplify = *Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_removeNodesByNameAndSimplify;
+*replaceNodeNames = *Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_replaceNodeNames;
+sub DISOWN {
+    my $self = shift;
+    my $ptr = tied(%$self);
+    delete $OWNER{$ptr};
+}
+
+sub ACQUIRE {
+    my $self = shift;
+    my $ptr = tied(%$self);
+    $OWNER{$ptr} = 1;
+}
+
+
+############# Class : Bio::KBase::Tree::TreeCppUtil::KBTreeCache ##############
+
+package Bio::KBase::Tree::TreeCppUtil::KBTreeCache;
+use vars qw(@ISA %OWNER %ITERATORS %BLESSEDMEMBERS);
+@ISA = qw( Bio::KBase::Tree::TreeCppUtil );
+%OWNER = ();
+%ITERATORS = ();
+sub new {
+    my $pkg = shift;
+    my $self = Bio::KBase::Tree::TreeCppUtilc::new_KBTreeCache(@_);
+    bless $self, $pkg if defined($self);
+}
+
+sub DESTROY {
+    return unless $_[0]->isa('HASH');
+    my $self = tied(%{$_[0]});
+    return unless defined $self;
+    delete $ITERATORS{$self};
+    if (exists $OWNER{$self}) {
+        Bio::KBase::Tree::TreeCppUtilc::delete_KBTreeCache($self);
+        delete $OWNER{$self};
+    }
+}
+
+*getShared = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCache_getShared;
+*get = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCache_get;
+*contains = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCache_contains;
+*clear = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCache_clear;
+*setMemoryBudget = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCache_setMemoryBudget;
+*getMemoryBudget = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCache_getMemoryBudget;
+*getMemoryUsage = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCache_getMemoryUsage;
+*getTreeCount = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCache_getTreeCount;
+*getHitCount = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCache_getHitCount;
+*getMissCount = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCache_getMissCount;
+*getEvictionCount = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCache_getEvictionCount;
+*resetCounters = *Bio::KBase::Tree::TreeCppUtilc::KBTreeCache_resetCounters;
+sub DISOWN {
+    my $self = shift;
+    my $ptr = tied(%$self);
+    delete $OWNER{$ptr};
+}
+
+sub ACQUIRE {
+    my $self = shift;
+    my $ptr = tied(%$self);
+    $OWNER{$ptr} = 1;
+}
+
+
+############# Class : Bio::KBase::Tree::TreeCppUtil::KBTreeDiskCache ##############
+
+package Bio::KBase::Tree::TreeCppUtil::KBTreeDiskCache;
+use vars qw(@ISA %OWNER %ITERATORS %BLESSEDMEMBERS);
+@ISA = qw( Bio::KBase::Tree::TreeCppUtil );
+%OWNER = ();
+%ITERATORS = ();
+sub new {
+    my $pkg = shift;
+    my $self = Bio::KBase::Tree::TreeCppUtilc::new_KBTreeDiskCache(@_);
+    bless $self, $pkg if defined($self);
+}
+
+sub DESTROY {
+    return unless $_[0]->isa('HASH');
+    my $self = tied(%{$_[0]});
+    return unless defined $self;
+    delete $ITERATORS{$self};
+    if (exists $OWNER{$self}) {
+        Bio::KBase::Tree::TreeCppUtilc::delete_KBTreeDiskCache($self);
+        delete $OWNER{$self};
+    }
+}
+
+*get = *Bio::KBase::Tree::TreeCppUtilc::KBTreeDiskCache_get;
+*contains = *Bio::KBase::Tree::TreeCppUtilc::KBTreeDiskCache_contains;
+*getImagePath = *Bio::KBase::Tree::TreeCppUtilc::KBTreeDiskCache_getImagePath;
+*trim = *Bio::KBase::Tree::TreeCppUtilc::KBTreeDiskCache_trim;
+*clear = *Bio::KBase::Tree::TreeCppUtilc::KBTreeDiskCache_clear;
+*setSizeLimit = *Bio::KBase::Tree::TreeCppUtilc::KBTreeDiskCache_setSizeLimit;
+*getSizeLimit = *Bio::KBase::Tree::TreeCppUtilc::KBTreeDiskCache_getSizeLimit;
+*getDiskUsage = *Bio::KBase::Tree::TreeCppUtilc::KBTreeDiskCache_getDiskUsage;
+*getHitCount = *Bio::KBase::Tree::TreeCppUtilc::KBTreeDiskCache_getHitCount;
+*getMissCount = *Bio::KBase::Tree::TreeCppUtilc::KBTreeDiskCache_getMissCount;
+*getEvictionCount = *Bio::KBase::Tree::TreeCppUtilc::KBTreeDiskCache_getEvictionCount;
+*resetCounters = *Bio::KBase::Tree::TreeCppUtilc::KBTreeDiskCache_resetCounters;
 sub DISOWN {
     my $self = shift;
     my $ptr = tied(%$self);
@@ -0,0 +1,640 @@
+/**
+ * @file kbtree_benchmark.cpp
+ * @brief Throughput benchmark for the KBTree library
+ *
+ * Build with "make benchmark" and run as
+ *     lib/benchmark/kbtree_benchmark [newick file]
+ * If no file is given, a random tree with a few hundred thousand leaves (in the style of KBase
+ * feature ids, e.g. kb|g.1234.peg.567:0.0123) is generated.  Each test is repeated and the best
+ * time is reported as MB/s of Newick text.
+ */
+
+#include "../kbtree/kbtree.hh"
+#include "../kbtree/kbstructural.hh"
+#include "../kbtree/kbcompact.hh"
+#include "../kbtree/kbsuccinct.hh"
+#include "../kbtree/kbancestor.hh"
+#include "../kbtree/kbcursor.hh"
+#include "../kbtree/kbfrozen.hh"
+#include "../kbtree/kbcache.hh"
+#include "../kbtree/kbdiskcache.hh"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <random>
+#include <set>
+#include <thread>
+#include <unistd.h>
+
+using namespace std;
+using namespace KBTreeLib;
+
+
+/** gives access to the character by character parser, for comparison */
+class LegacyParseTree : public KBTree {
+	public:
+		LegacyParseTree(std::string_view newickText, std::shared_ptr<const void> owner)
+			: KBTree(newickText,owner,false,false,false) { };
+};
+
+
+static double bestTime(unsigned int repeats, std::function<void()> test) {
+	double best = -1;
+	for(unsigned int r=0; r<repeats; r++) {
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		test();
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+		if(best<0 || seconds<best) { best=seconds; }
+	}
+	return best;
+}
+
+/** as bestTime, but before each repeat the untimed setup is run, to time only the first call on a new tree */
+static double bestTimeAfter(unsigned int repeats, std::function<void()> setup, std::function<void()> test) {
+	double best = -1;
+	for(unsigned int r=0; r<repeats; r++) {
+		setup();
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		test();
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+		if(best<0 || seconds<best) { best=seconds; }
+	}
+	return best;
+}
+
+static void report(const std::string &name, size_t bytes, double seconds) {
+	printf("  %-36s %10.3f ms %8.3f GB/s\n",name.c_str(),seconds*1000.0,(bytes/1.0e9)/seconds);
+}
+
+static void generateSubtree(std::mt19937 &rng, unsigned int leaves, std::string &out) {
+	std::uniform_real_distribution<double> dist(0.0,0.2);
+	char buf[64];
+	if(leaves<=1) {
+		snprintf(buf,sizeof(buf),"kb|g.%u.peg.%u:%.6g",(unsigned int)(rng()%100000),(unsigned int)(rng()%10000),dist(rng));
+		out+=buf;
+		return;
+	}
+	unsigned int left = 1+rng()%(leaves-1);
+	out+='(';
+	generateSubtree(rng,left,out);
+	out+=',';
+	generateSubtree(rng,leaves-left,out);
+	snprintf(buf,sizeof(buf),")%u:%.6g",(unsigned int)(rng()%101),dist(rng));
+	out+=buf;
+}
+
+static std::string generateTree(unsigned int leaves) {
+	std::mt19937 rng(2012);
+	std::string newick;
+	generateSubtree(rng,leaves,newick);
+	newick+=';';
+	return newick;
+}
+
+
+static void benchmarkParsing(const std::shared_ptr<std::string> &text, unsigned int repeats) {
+	const size_t bytes = text->size();
+	cout<<"structural index (stage 1 only)"<<endl;
+	const char *names[] = { "scalar", "sse2", "avx2" };
+	KBStructuralIndex::Implementation best = KBStructuralIndex::getBestImplementation();
+	for(int impl=KBStructuralIndex::SCALAR; impl<=KBStructuralIndex::AVX2; impl++) {
+		if(impl>best) { printf("  %-36s not supported by this cpu\n",names[impl]); continue; }
+		KBStructuralIndex structure;
+		double seconds = bestTime(repeats,[&]() { structure.build(*text,(KBStructuralIndex::Implementation)impl); });
+		report(names[impl],bytes,seconds);
+	}
+
+	cout<<"full parse"<<endl;
+	unsigned int nodes = 0;
+	double seconds = bestTime(repeats,[&]() {
+		LegacyParseTree t(*text,text);
+		nodes = t.getNodeCount();
+	});
+	report("character by character",bytes,seconds);
+	KBAllocationStatistics pool;
+	seconds = bestTime(repeats,[&]() {
+		KBTree t(*text,false,false);
+		nodes = t.getNodeCount();
+		pool = t.getAllocationStatistics();
+	});
+	report(std::string("structural index (")+names[best]+")",bytes,seconds);
+	printf("  (node pool: %zu nodes in %zu slabs, %.1f MB)\n",pool.nodesInUse,pool.slabCount,pool.bytesReserved/1e6);
+	unsigned int leaves = 0;
+	seconds = bestTime(repeats,[&]() {
+		KBTree t(*text,false,false,1,true);
+		leaves = t.getLeafCount();
+	});
+	report("lazy labels, then count leaves",bytes,seconds);
+	cout<<"  ("<<nodes<<" nodes, "<<leaves<<" leaves)"<<endl;
+
+	cout<<"statistics scan (no tree)"<<endl;
+	KBTreeStatistics stats;
+	seconds = bestTime(repeats,[&]() { stats = KBTree::scanStatistics(*text); });
+	report("node and leaf counts, depth",bytes,seconds);
+	cout<<"  ("<<stats.getNodeCount()<<" nodes, "<<stats.getLeafCount()<<" leaves, depth "<<stats.getMaxDepth()<<")"<<endl;
+
+	cout<<"parallel parse of top level clades"<<endl;
+	for(unsigned int threads=2; threads<=8; threads*=2) {
+		seconds = bestTime(repeats,[&]() { KBTree t(*text,false,false,threads); });
+		report(std::to_string(threads)+" threads",bytes,seconds);
+	}
+	cout<<"  ("<<std::thread::hardware_concurrency()<<" cores available)"<<endl;
+}
+
+static void benchmarkLabelStorage(const std::shared_ptr<std::string> &text, unsigned int repeats) {
+	const size_t bytes = text->size();
+	struct StorageMode { const char *name; bool lazyLabels; bool keepOriginalLabels; };
+	const StorageMode modes[] = {
+		{ "all labels", false, true },
+		{ "lazy labels", true, true },
+		{ "without original labels", false, false },
+	};
+	cout<<"label storage"<<endl;
+	for(const StorageMode &mode : modes) {
+		size_t memory = 0;
+		unsigned int nodes = 0;
+		double seconds = bestTime(repeats,[&]() {
+			KBTree t(*text,false,false,1,mode.lazyLabels,mode.keepOriginalLabels);
+			memory = t.getMemoryUsage();
+			nodes = t.getNodeCount();
+		});
+		report(mode.name,bytes,seconds);
+		printf("  (%.1f MB, %.1f bytes per node, without the newick text)\n",memory/1e6,memory/(double)nodes);
+	}
+}
+
+static void benchmarkCompactTree(const std::shared_ptr<std::string> &text, unsigned int repeats) {
+	const size_t bytes = text->size();
+	KBTree tree(*text,false,false);
+	KBCompactTree compact(tree);
+	cout<<"compact tree"<<endl;
+	double seconds = bestTime(repeats,[&]() { KBCompactTree c(tree); });
+	report("build from KBTree",bytes,seconds);
+	printf("  %-36s %8.1f MB (without the newick text)\n","KBTree memory",tree.getMemoryUsage()/1e6);
+	printf("  %-36s %8.1f MB (including names)\n","KBCompactTree memory",compact.getMemoryUsage()/1e6);
+
+	std::string names;
+	seconds = bestTime(repeats,[&]() { names = tree.getAllNodeNames(); });
+	report("KBTree getAllNodeNames",bytes,seconds);
+	seconds = bestTime(repeats,[&]() { names = compact.getAllNodeNames(); });
+	report("KBCompactTree getAllNodeNames",bytes,seconds);
+	std::string newick;
+	seconds = bestTime(repeats,[&]() { newick = tree.toNewick(); });
+	report("KBTree toNewick",bytes,seconds);
+	seconds = bestTime(repeats,[&]() { newick = compact.toNewick(); });
+	report("KBCompactTree toNewick",bytes,seconds);
+}
+
+static void benchmarkOutput(const std::shared_ptr<std::string> &text, unsigned int repeats) {
+	KBTree tree(*text,false,false);
+	cout<<"newick output"<<endl;
+	std::string newick;
+	double seconds = bestTime(repeats,[&]() { newick = tree.toNewick(); });
+	report("toNewick into one string",newick.size(),seconds);
+	size_t written = 0;
+	seconds = bestTime(repeats,[&]() {
+		written = 0;
+		KBOutputSink out([&written](const char *, size_t length) { written+=length; });
+		tree.writeNewick(out);
+		out.flush();
+	});
+	report("writeNewick through a buffer",written,seconds);
+	seconds = bestTime(repeats,[&]() { tree.writeNewickToFile("/dev/null"); });
+	report("writeNewickToFile /dev/null",written,seconds);
+	for(unsigned int threads=2; threads<=8; threads*=2) {
+		tree.setOutputThreadCount(threads);
+		seconds = bestTime(repeats,[&]() {
+			KBOutputSink out([](const char *, size_t) { });
+			tree.writeNewick(out);
+			out.flush();
+		});
+		report("writeNewick on "+std::to_string(threads)+" threads",written,seconds);
+	}
+	tree.setOutputThreadCount(1);
+}
+
+static void benchmarkBinary(const std::shared_ptr<std::string> &text, unsigned int repeats) {
+	const size_t bytes = text->size();
+	KBTree tree(*text,false,false);
+	cout<<"binary format"<<endl;
+	double seconds = bestTime(repeats,[&]() { KBTree t(*text,false,false); });
+	report("parse the newick text",bytes,seconds);
+	std::string binary;
+	seconds = bestTime(repeats,[&]() { binary = tree.toBinary(); });
+	report("toBinary",binary.size(),seconds);
+	seconds = bestTime(repeats,[&]() { delete KBTree::fromBinary(binary); });
+	report("fromBinary",binary.size(),seconds);
+	printf("  (%.1f MB binary, %.1f MB newick)\n",binary.size()/1e6,bytes/1e6);
+}
+
+static void benchmarkSuccinctTree(const std::shared_ptr<std::string> &text, unsigned int repeats) {
+	const size_t bytes = text->size();
+	KBTree tree(*text,false,false);
+	KBCompactTree compact(tree);
+	KBSuccinctTree succinct(tree);
+	const KBSuccinctTopology &topology = succinct.getTopology();
+	const unsigned int nodes = topology.getNodeCount();
+	cout<<"succinct tree"<<endl;
+	double seconds = bestTime(repeats,[&]() { KBSuccinctTree s(tree); });
+	report("build from KBTree",bytes,seconds);
+	printf("  %-36s %8.1f MB (%.2f bits per node)\n","topology memory",topology.getMemoryUsage()/1e6,topology.getMemoryUsage()*8.0/nodes);
+	printf("  %-36s %8.1f MB (including names)\n","KBSuccinctTree memory",succinct.getMemoryUsage()/1e6);
+	std::string names;
+	seconds = bestTime(repeats,[&]() { names = succinct.getAllNodeNames(); });
+	report("getAllNodeNames",bytes,seconds);
+	seconds = bestTime(repeats,[&]() {
+		succinct.resetBreadthFirstIterToRoot();
+		while(succinct.breadthFirstIterNext()) { }
+	});
+	printf("  %-36s %10.3f ms %8.1f ns per node\n","breadth first walk",seconds*1000.0,seconds*1e9/nodes);
+
+	// random queries, each answered by the topology and by following the parent links of the compact tree
+	const unsigned int queries = 1000000;
+	std::mt19937 rng(7);
+	std::vector<uint32_t> a(queries), b(queries);
+	for(unsigned int q=0; q<queries; q++) { a[q]=rng()%nodes; b[q]=rng()%nodes; }
+	uint64_t checksum = 0;
+	seconds = bestTime(repeats,[&]() { for(unsigned int q=0; q<queries; q++) { checksum+=topology.getParent(a[q]); } });
+	printf("  %-36s %10.3f ms %8.1f ns per query\n","parent",seconds*1000.0,seconds*1e9/queries);
+	seconds = bestTime(repeats,[&]() { for(unsigned int q=0; q<queries; q++) { checksum+=topology.getSubtreeSize(a[q]); } });
+	printf("  %-36s %10.3f ms %8.1f ns per query\n","subtree size",seconds*1000.0,seconds*1e9/queries);
+	seconds = bestTime(repeats,[&]() { for(unsigned int q=0; q<queries; q++) { checksum+=topology.getDepth(a[q]); } });
+	printf("  %-36s %10.3f ms %8.1f ns per query\n","depth",seconds*1000.0,seconds*1e9/queries);
+	seconds = bestTime(repeats,[&]() { for(unsigned int q=0; q<queries; q++) { checksum+=topology.getLowestCommonAncestor(a[q],b[q]); } });
+	printf("  %-36s %10.3f ms %8.1f ns per query\n","lowest common ancestor",seconds*1000.0,seconds*1e9/queries);
+	seconds = bestTime(repeats,[&]() {
+		std::vector<uint32_t> path;
+		for(unsigned int q=0; q<queries; q++) {
+			// walk both nodes up to the root, then find where the paths meet
+			path.clear();
+			for(uint32_t n=a[q]; n!=KBCompactTree::NONE; n=compact.getParent(n)) { path.push_back(n); }
+			uint32_t n = b[q];
+			while(n!=KBCompactTree::NONE && std::find(path.begin(),path.end(),n)==path.end()) { n=compact.getParent(n); }
+			checksum+=n;
+		}
+	});
+	printf("  %-36s %10.3f ms %8.1f ns per query\n","KBCompactTree lowest common ancestor",seconds*1000.0,seconds*1e9/queries);
+	if(checksum==1) { cout<<endl; }
+}
+
+
+static void benchmarkNameIndex(const std::shared_ptr<std::string> &text, unsigned int repeats) {
+	KBTree tree(*text,false,false);
+	std::vector<std::string> leaves;
+	tree.getAllLeafNames(leaves);
+	const unsigned int lookups = std::min<size_t>(1000,leaves.size());
+	std::mt19937 rng(11);
+	std::map<std::string,std::string> renames;
+	std::vector<std::string> names;
+	std::shuffle(leaves.begin(),leaves.end(),rng);
+	for(unsigned int n=0; n<lookups; n++) {
+		names.push_back(leaves[n]);
+		renames[names.back()]=names.back();
+	}
+	cout<<"name index ("<<lookups<<" names)"<<endl;
+	std::string info;
+	std::unique_ptr<KBTree> fresh;
+	double seconds = bestTimeAfter(repeats,[&]() { fresh.reset(); fresh.reset(new KBTree(*text,false,false)); },[&]() { fresh->areAllLabelsUnique(info); });
+	printf("  %-36s %10.3f ms\n","build the index",seconds*1000.0);
+	// renaming each node to its own name leaves the tree as it was for the next repeat
+	seconds = bestTime(repeats,[&]() { tree.replaceNodeNames(renames,false); });
+	printf("  %-36s %10.3f ms\n","replaceNodeNames",seconds*1000.0);
+	seconds = bestTime(repeats,[&]() { for(unsigned int n=0; n<lookups; n++) { tree.replaceNodeName(names[n],names[n]); } });
+	printf("  %-36s %10.3f ms %8.1f ns per name\n","replaceNodeName",seconds*1000.0,seconds*1e9/lookups);
+	size_t length = 0;
+	seconds = bestTime(repeats,[&]() { for(unsigned int n=0; n<lookups; n++) { length+=tree.getPathToRoot(names[n]).size(); } });
+	printf("  %-36s %10.3f ms %8.1f ns per name\n","getPathToRoot",seconds*1000.0,seconds*1e9/lookups);
+	seconds = bestTime(repeats,[&]() { tree.areAllLabelsUnique(info); });
+	printf("  %-36s %10.3f ms\n","areAllLabelsUnique",seconds*1000.0);
+	std::string removals;
+	for(unsigned int n=0; n<lookups; n++) { removals+=names[n]+";"; }
+	seconds = bestTime(repeats,[&]() { KBTree t(*text,false,false); t.removeNodesByNameAndSimplify(removals); });
+	printf("  %-36s %10.3f ms\n","parse, removeNodesByNameAndSimplify",seconds*1000.0);
+	seconds = bestTime(repeats,[&]() { KBTree t(*text,false,false); for(unsigned int n=0; n<lookups; n++) { t.removeNodeByNameAndSimplify(names[n]); } });
+	printf("  %-36s %10.3f ms\n","parse, removeNodeByNameAndSimplify",seconds*1000.0);
+	if(length==1) { cout<<endl; }
+}
+
+static void benchmarkDerivedProperties(const std::shared_ptr<std::string> &text, unsigned int repeats) {
+	KBTree tree(*text,false,false);
+	std::vector<std::string> leaves;
+	tree.getAllLeafNames(leaves);
+	cout<<"derived properties"<<endl;
+	std::unique_ptr<KBTree> fresh;
+	unsigned int count = 0;
+	double seconds = bestTimeAfter(repeats,[&]() { fresh.reset(); fresh.reset(new KBTree(*text,false,false)); },[&]() { count+=fresh->getLeafCount(); });
+	printf("  %-36s %10.3f ms\n","getLeafCount (walking the leaves)",seconds*1000.0);
+	seconds = bestTimeAfter(repeats,[&]() { fresh.reset(); fresh.reset(new KBTree(*text,false,false)); fresh->getPathToRoot(leaves[0]); },[&]() { count+=fresh->getDepth(leaves[0]); });
+	printf("  %-36s %10.3f ms\n","compute (first getDepth)",seconds*1000.0);
+	tree.getDepth(leaves[0]);
+	seconds = bestTime(repeats,[&]() { count+=tree.getLeafCount(); });
+	printf("  %-36s %10.6f ms\n","getLeafCount (computed)",seconds*1000.0);
+	const unsigned int lookups = std::min<size_t>(100000,leaves.size());
+	double distance = 0;
+	seconds = bestTime(repeats,[&]() {
+		for(unsigned int n=0; n<lookups; n++) { distance+=tree.getDepth(leaves[n])+tree.getDistanceToRoot(leaves[n]); }
+	});
+	printf("  %-36s %10.3f ms %8.1f ns per name\n","getDepth and getDistanceToRoot",seconds*1000.0,seconds*1e9/lookups);
+	std::string printed;
+	seconds = bestTime(repeats,[&]() { printed = tree.printSimpleTreeToString(); });
+	printf("  %-36s %10.3f ms\n","printSimpleTreeToString",seconds*1000.0);
+	if(count==1 || distance==1) { cout<<endl; }
+}
+static void benchmarkNodeIds(const std::shared_ptr<std::string> &text, unsigned int repeats) {
+	KBTree tree(*text,false,false);
+	cout<<"node IDs"<<endl;
+	std::unique_ptr<KBTree> fresh;
+	double seconds = bestTimeAfter(repeats,[&]() { fresh.reset(); fresh.reset(new KBTree(*text,false,false)); },[&]() { fresh->buildNodeIds(); });
+	printf("  %-36s %10.3f ms\n","buildNodeIds",seconds*1000.0);
+	tree.buildNodeIds();
+	std::vector<unsigned int> markers;
+	seconds = bestTime(repeats,[&]() {
+		markers.clear();
+		tree.resetBreadthFirstIterToRoot();
+		do { markers.push_back(tree.breadthFirstIterMarkNode()); } while(tree.breadthFirstIterNext());
+	});
+	printf("  %-36s %10.3f ms %8.1f ns per node\n","breadth first walk, marking nodes",seconds*1000.0,seconds*1e9/markers.size());
+	const unsigned int queries = std::min<size_t>(100000,markers.size());
+	std::mt19937 rng(5);
+	std::vector<unsigned int> a(queries), b(queries);
+	for(unsigned int q=0; q<queries; q++) { a[q]=markers[rng()%markers.size()]; b[q]=markers[rng()%markers.size()]; }
+	size_t length = 0;
+	seconds = bestTime(repeats,[&]() {
+		for(unsigned int q=0; q<queries; q++) { length+=tree.getPathToRootById(a[q]).size()+tree.getChildNamesById(a[q]).size(); }
+	});
+	printf("  %-36s %10.3f ms %8.1f ns per node\n","path to root and child names",seconds*1000.0,seconds*1e9/queries);
+	seconds = bestTime(repeats,[&]() { for(unsigned int q=0; q<queries; q++) { length+=tree.isDescendantOf(a[q],b[q]); } });
+	printf("  %-36s %10.3f ms %8.1f ns per pair\n","isDescendantOf",seconds*1000.0,seconds*1e9/queries);
+	// every node is below the root
+	seconds = bestTime(repeats,[&]() { length+=tree.getDescendantNamesById(0).size(); });
+	printf("  %-36s %10.3f ms\n","descendants of the root (preorder)",seconds*1000.0);
+	seconds = bestTime(repeats,[&]() { length+=tree.breadthFirstIterGetAllDescendantNames(0).size(); });
+	printf("  %-36s %10.3f ms\n","descendants of the root (by level)",seconds*1000.0);
+	if(length==1) { cout<<endl; }
+}
+
+static void benchmarkCursors(const std::shared_ptr<std::string> &text, unsigned int repeats) {
+	KBTree tree(*text,false,false);
+	const unsigned int nodes = tree.getNodeCount();
+	cout<<"traversal cursors"<<endl;
+	size_t length = 0;
+	const char *orders[] = { "preorder cursor", "postorder cursor", "breadth first cursor", "leaf cursor" };
+	for(unsigned int order=KBTreeCursor::PREORDER; order<=KBTreeCursor::LEAVES; order++) {
+		double seconds = bestTime(repeats,[&]() {
+			KBTreeCursor cursor(tree,order);
+			if(!cursor.isAtEnd()) { do { length+=cursor.getName().size(); } while(cursor.next()); }
+		});
+		printf("  %-36s %10.3f ms %8.1f ns per node\n",orders[order],seconds*1000.0,seconds*1e9/nodes);
+	}
+	// a service that cannot share the iterator of one tree parses its own copy for each request
+	double seconds = bestTime(repeats,[&]() {
+		KBTree copy(*text,false,false);
+		do { length+=copy.breadthFirstIterGetName().size(); } while(copy.breadthFirstIterNext());
+	});
+	printf("  %-36s %10.3f ms\n","parse a copy, breadthFirstIter walk",seconds*1000.0);
+	const unsigned int threads = std::max(1u,std::thread::hardware_concurrency());
+	seconds = bestTime(repeats,[&]() {
+		std::vector<std::thread> walkers;
+		std::vector<size_t> lengths(threads,0);
+		for(unsigned int t=0; t<threads; t++) {
+			walkers.push_back(std::thread([&,t]() {
+				KBTreeCursor cursor(tree,KBTreeCursor::BREADTH_FIRST);
+				if(!cursor.isAtEnd()) { do { lengths[t]+=cursor.getName().size(); } while(cursor.next()); }
+			}));
+		}
+		for(unsigned int t=0; t<threads; t++) { walkers[t].join(); length+=lengths[t]; }
+	});
+	printf("  %-36s %10.3f ms (%u threads)\n","breadth first cursors, one tree",seconds*1000.0,threads);
+	if(length==1) { cout<<endl; }
+}
+
+static void benchmarkFrozenTree(const std::shared_ptr<std::string> &text, unsigned int repeats) {
+	KBTree tree(*text,false,false);
+	std::vector<std::string> leaves;
+	tree.getAllLeafNames(leaves);
+	cout<<"frozen trees"<<endl;
+	double seconds = bestTime(repeats,[&]() { KBFrozenTree frozen=tree.freeze(); });
+	printf("  %-36s %10.3f ms\n","freeze",seconds*1000.0);
+	const KBFrozenTree frozen = tree.freeze();
+	printf("  %-36s %10.1f MB (KBTree %.1f MB)\n","snapshot memory",frozen.getMemoryUsage()/1.0e6,tree.getMemoryUsage()/1.0e6);
+	// every thread asks for the distance and depth of random leaves; a KBTree must be locked for the queries
+	const unsigned int threads = std::max(1u,std::thread::hardware_concurrency());
+	const unsigned int queries = 100000;
+	std::mutex lock;
+	for(unsigned int shared=0; shared<2; shared++) {
+		double total = 0;
+		seconds = bestTime(repeats,[&]() {
+			std::vector<std::thread> readers;
+			std::vector<double> sums(threads,0);
+			for(unsigned int t=0; t<threads; t++) {
+				readers.push_back(std::thread([&,t]() {
+					KBFrozenTree handle = frozen;
+					std::mt19937 rng(t);
+					for(unsigned int q=0; q<queries; q++) {
+						const std::string &a = leaves[rng()%leaves.size()], &b = leaves[rng()%leaves.size()];
+						if(shared==0) {
+							sums[t] += handle.getPatristicDistance(a,b)+handle.getDepth(a);
+						} else {
+							std::lock_guard<std::mutex> guard(lock);
+							sums[t] += tree.getDistanceToRoot(a)+tree.getDistanceToRoot(b)+tree.getDepth(a);
+						}
+					}
+				}));
+			}
+			for(unsigned int t=0; t<threads; t++) { readers[t].join(); total+=sums[t]; }
+		});
+		printf("  %-36s %10.3f ms %8.1f ns per query (%u threads)\n",shared==0 ? "frozen, no locking" : "KBTree behind a mutex",
+			seconds*1000.0,seconds*1e9/(queries*(double)threads),threads);
+		if(total==1) { cout<<endl; }
+	}
+}
+
+static void benchmarkTreeCache(const std::shared_ptr<std::string> &text, unsigned int repeats) {
+	cout<<"tree cache"<<endl;
+	unsigned int nodes = 0;
+	double seconds = bestTime(repeats,[&]() { KBTree tree(*text,false,false); nodes+=tree.getNodeCount(); });
+	report("parse a KBTree",text->size(),seconds);
+	KBTreeCache cache;
+	seconds = bestTime(repeats,[&]() { cache.clear(); nodes+=cache.get(*text).getNodeCount(); });
+	report("miss: parse and freeze",text->size(),seconds);
+	seconds = bestTime(repeats,[&]() { nodes+=cache.get(*text).getNodeCount(); });
+	report("hit: hash the text",text->size(),seconds);
+	printf("  %-36s %10llu hits %llu misses\n","counters",(unsigned long long)cache.getHitCount(),(unsigned long long)cache.getMissCount());
+	if(nodes==1) { cout<<endl; }
+}
+
+static void benchmarkDiskCache(const std::shared_ptr<std::string> &text, unsigned int repeats) {
+	char directory[] = "/tmp/kbtree_benchmark_XXXXXX";
+	if(mkdtemp(directory)==NULL) { return; }
+	cout<<"tree image cache"<<endl;
+	unsigned int nodes = 0;
+	KBTreeDiskCache cache(directory);
+	double seconds = bestTime(repeats,[&]() { cache.clear(); KBTree *tree=cache.get(*text); nodes+=tree->getNodeCount(); delete tree; });
+	report("miss: parse and store the image",text->size(),seconds);
+	seconds = bestTime(repeats,[&]() { KBTree *tree=cache.get(*text); nodes+=tree->getNodeCount(); delete tree; });
+	report("hit: hash and load the image",text->size(),seconds);
+	const KBTextHash hash = hashText(*text);
+	seconds = bestTime(repeats,[&]() { nodes+=hashText(*text).low==hash.low; });
+	report("of which hashing the text",text->size(),seconds);
+	printf("  %-36s %10.1f MB\n","image size",cache.getDiskUsage()/1.0e6);
+	cache.clear();
+	rmdir(directory);
+	if(nodes==1) { cout<<endl; }
+}
+
+static void benchmarkPatristicDistances(const std::shared_ptr<std::string> &text, unsigned int repeats) {
+	KBTree tree(*text,false,false);
+	KBAncestorIndex index(tree);
+	std::vector<uint32_t> leaves;
+	for(uint32_t node=0; node<index.getNodeCount(); node++) {
+		if(index.isLeaf(node)) { leaves.push_back(node); }
+	}
+	// a random sample of leaves, both in preorder and shuffled
+	const size_t count = std::min<size_t>(8000,leaves.size());
+	std::mt19937 rng(17);
+	std::shuffle(leaves.begin(),leaves.end(),rng);
+	std::vector<uint32_t> shuffled(leaves.begin(),leaves.begin()+count);
+	std::vector<uint32_t> sorted(shuffled);
+	std::sort(sorted.begin(),sorted.end());
+	const size_t entries = count*count;
+	std::vector<double> matrix(entries);
+	cout<<"patristic distances ("<<count<<" leaves)"<<endl;
+	double seconds = bestTime(repeats,[&]() {
+		for(size_t i=0; i<count; i++) {
+			for(size_t j=0; j<count; j++) { matrix[i*count+j]=index.getPatristicDistance(sorted[i],sorted[j]); }
+		}
+	});
+	printf("  %-36s %10.3f ms %8.2f ns per entry\n","getPatristicDistance per pair",seconds*1000.0,seconds*1e9/entries);
+	seconds = bestTime(repeats,[&]() { index.getPatristicDistances(sorted,matrix.data(),1); });
+	printf("  %-36s %10.3f ms %8.2f ns per entry\n","matrix, preorder, 1 thread",seconds*1000.0,seconds*1e9/entries);
+	seconds = bestTime(repeats,[&]() { index.getPatristicDistances(sorted,matrix.data()); });
+	printf("  %-36s %10.3f ms %8.2f ns per entry\n","matrix, preorder, all cores",seconds*1000.0,seconds*1e9/entries);
+	seconds = bestTime(repeats,[&]() { index.getPatristicDistances(shuffled,matrix.data()); });
+	printf("  %-36s %10.3f ms %8.2f ns per entry\n","matrix, shuffled, all cores",seconds*1000.0,seconds*1e9/entries);
+	size_t bytes = 0;
+	KBOutputSink sink([&bytes](const char *, size_t length) { bytes+=length; });
+	seconds = bestTime(repeats,[&]() { index.writePatristicDistances(sorted,sink,KBTree::PHYLIP_MATRIX,6,1); sink.flush(); });
+	printf("  %-36s %10.3f ms %8.2f ns per entry\n","write PHYLIP, 1 thread",seconds*1000.0,seconds*1e9/entries);
+	seconds = bestTime(repeats,[&]() { index.writePatristicDistances(sorted,sink,KBTree::PHYLIP_MATRIX,6); sink.flush(); });
+	printf("  %-36s %10.3f ms %8.2f ns per entry\n","write PHYLIP, all cores",seconds*1000.0,seconds*1e9/entries);
+	if(bytes==1) { cout<<endl; }
+}
+
+static void benchmarkInducedSubtree(const std::shared_ptr<std::string> &text, unsigned int repeats) {
+	KBTree tree(*text,false,false);
+	std::vector<std::string> leaves;
+	tree.getAllLeafNames(leaves);
+	std::mt19937 rng(19);
+	std::shuffle(leaves.begin(),leaves.end(),rng);
+	const size_t count = std::min<size_t>(200,leaves.size());
+	// the generated names are not all distinct, so each is listed only once
+	std::string keep, removals;
+	std::set<std::string> listed(leaves.begin(),leaves.begin()+count);
+	for(size_t n=0; n<count; n++) { keep+=leaves[n]+";"; }
+	for(size_t n=count; n<leaves.size(); n++) {
+		if(listed.insert(leaves[n]).second) { removals+=leaves[n]+";"; }
+	}
+	cout<<"induced subtree ("<<count<<" leaves)"<<endl;
+	delete tree.extractInducedSubtree(keep);
+	unsigned int nodes = 0;
+	double seconds = bestTime(repeats,[&]() { KBTree *subtree=tree.extractInducedSubtree(keep); nodes+=subtree->getNodeCount(); delete subtree; });
+	printf("  %-36s %10.3f ms\n","extractInducedSubtree",seconds*1000.0);
+	std::unique_ptr<KBTree> fresh;
+	seconds = bestTimeAfter(repeats,[&]() { fresh.reset(); fresh.reset(new KBTree(*text,false,false)); },[&]() { fresh->removeNodesByNameAndSimplify(removals); });
+	printf("  %-36s %10.3f ms\n","removeNodesByNameAndSimplify",seconds*1000.0);
+	if(nodes==1) { cout<<endl; }
+}
+
+/** the lowest common ancestor index is measured on its own tree of a million leaves */
+static void benchmarkAncestorIndex(unsigned int repeats) {
+	const std::string text = generateTree(1000000);
+	KBTree tree(text,false,false);
+	KBCompactTree compact(tree);
+	cout<<"ancestor index (1000000 leaves)"<<endl;
+	double seconds = bestTime(repeats,[&]() { KBAncestorIndex i(tree); });
+	printf("  %-36s %10.3f ms\n","build from KBTree",seconds*1000.0);
+	KBAncestorIndex index(tree);
+	const unsigned int nodes = index.getNodeCount();
+	printf("  %-36s %8.1f MB (%.1f bytes per node, including names)\n","memory",index.getMemoryUsage()/1e6,(double)index.getMemoryUsage()/nodes);
+
+	const unsigned int queries = 10000000;
+	std::mt19937 rng(13);
+	std::vector<uint32_t> a(queries), b(queries), ancestors(queries);
+	for(unsigned int q=0; q<queries; q++) { a[q]=rng()%nodes; b[q]=rng()%nodes; }
+	seconds = bestTime(repeats,[&]() { index.getLowestCommonAncestors(a.data(),b.data(),queries,ancestors.data()); });
+	printf("  %-36s %10.3f ms %8.1f ns per query\n","lowest common ancestor of node ids",seconds*1000.0,seconds*1e9/queries);
+
+	// the same pairs by name, for the leaves only, so that the names are mostly distinct
+	std::vector<std::string> leaves;
+	tree.getAllLeafNames(leaves);
+	const unsigned int namedQueries = 1000000;
+	std::vector<std::string> nameA(namedQueries), nameB(namedQueries);
+	for(unsigned int q=0; q<namedQueries; q++) { nameA[q]=leaves[rng()%leaves.size()]; nameB[q]=leaves[rng()%leaves.size()]; }
+	seconds = bestTime(repeats,[&]() { index.getLowestCommonAncestors(nameA,nameB,ancestors); });
+	printf("  %-36s %10.3f ms %8.1f ns per query\n","lowest common ancestor of names",seconds*1000.0,seconds*1e9/namedQueries);
+
+	// clades of about 20 leaves, half of them with one leaf taken out
+	const unsigned int clades = 10000;
+	std::vector<std::vector<std::string> > leafSets(clades);
+	for(unsigned int c=0; c<clades; c++) {
+		uint32_t node = rng()%nodes;
+		while(index.getLeafCount(node)<20 && index.getParent(node)!=KBAncestorIndex::NONE) { node=index.getParent(node); }
+		for(uint32_t n=node; n<node+index.getSubtreeSize(node); n++) {
+			if(index.isLeaf(n)) { leafSets[c].push_back(std::string(index.getName(n))); }
+		}
+		if(c%2==1) { leafSets[c].erase(leafSets[c].begin()+rng()%leafSets[c].size()); }
+	}
+	unsigned int monophyletic = 0;
+	seconds = bestTime(repeats,[&]() { for(unsigned int c=0; c<clades; c++) { monophyletic+=index.isMonophyletic(leafSets[c]); } });
+	printf("  %-36s %10.3f ms %8.1f ns per set\n","isMonophyletic",seconds*1000.0,seconds*1e9/clades);
+
+	// following the parent links of the compact tree, on a tenth of the queries
+	uint64_t checksum = 0;
+	seconds = bestTime(repeats,[&]() {
+		std::vector<uint32_t> path;
+		for(unsigned int q=0; q<queries/10; q++) {
+			path.clear();
+			for(uint32_t n=a[q]; n!=KBCompactTree::NONE; n=compact.getParent(n)) { path.push_back(n); }
+			uint32_t n = b[q];
+			while(n!=KBCompactTree::NONE && std::find(path.begin(),path.end(),n)==path.end()) { n=compact.getParent(n); }
+			checksum+=n;
+		}
+	});
+	printf("  %-36s %10.3f ms %8.1f ns per query\n","KBCompactTree lowest common ancestor",seconds*1000.0,seconds*1e9/(queries/10));
+	if(checksum==1 || monophyletic==1) { cout<<endl; }
+}
+
+
+int main(int argc, char **argv) {
+	std::shared_ptr<std::string> text = std::make_shared<std::string>();
+	if(argc>1) {
+		KBMappedFile file(argv[1]);
+		text->assign(file.getText());
+	} else {
+		*text = generateTree(300000);
+	}
+	cout<<"newick text: "<<text->size()<<" bytes"<<endl;
+	const unsigned int repeats = 5;
+	benchmarkParsing(text,repeats);
+	benchmarkLabelStorage(text,repeats);
+	benchmarkCompactTree(text,repeats);
+	benchmarkSuccinctTree(text,repeats);
+	benchmarkOutput(text,repeats);
+	benchmarkBinary(text,repeats);
+	benchmarkNameIndex(text,repeats);
+	benchmarkDerivedProperties(text,repeats);
+	benchmarkNodeIds(text,repeats);
+	benchmarkCursors(text,repeats);
+	benchmarkFrozenTree(text,repeats);
+	benchmarkTreeCache(text,repeats);
+	benchmarkDiskCache(text,repeats);
+	benchmarkInducedSubtree(text,repeats);
+	benchmarkAncestorIndex(repeats);
+	benchmarkPatristicDistances(text,repeats);
+	return 0;
+}
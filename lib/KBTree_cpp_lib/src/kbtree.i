@@ -1,9 +1,15 @@
 %module KBTreeUtil
 %include "std_string.i"
 %include "std_map.i"
+%include "stdint.i"
 
 %{
 #include "kbtree/kbtree.hh"
+#include "kbtree/kbancestor.hh"
+#include "kbtree/kbcursor.hh"
+#include "kbtree/kbfrozen.hh"
+#include "kbtree/kbcache.hh"
+#include "kbtree/kbdiskcache.hh"
 std::string translateToProt(const std::string &dna);
 %}
 
@@ -11,14 +17,110 @@ std::string translateToProt(const std::string &dna);
 
 namespace KBTreeLib {
 
+    %newobject KBTree::fromFile;
+    %newobject KBTree::fromBinary;
+    %newobject KBTree::fromBinaryFile;
+    %newobject KBTree::extractInducedSubtree;
+    %newobject KBFrozenTree::toKBTree;
+    %newobject KBTreeDiskCache::get;
+
+    /* Naming the root in a removal throws ParseException, which is raised as an error of the calling language
+    (a die in Perl, a RuntimeException in Java) rather than being left to end the process. */
+#ifdef SWIGJAVA
+    %typemap(throws) ParseException %{
+    SWIG_JavaThrowException(jenv, SWIG_JavaRuntimeException, $1.what().c_str());
+    return $null;
+  %}
+#else
+    %typemap(throws) ParseException %{
+      SWIG_croak($1.what().c_str());
+  %}
+#endif
+    %catches(ParseException) KBTree::removeNodesByNameAndSimplify;
+    %catches(ParseException) KBTree::removeNodeByNameAndSimplify;
+    %catches(ParseException) KBFrozenTree::removeNodesByNameAndSimplify;
+
+    /* A cursor only refers to its tree, so each proxy keeps a reference to the tree's proxy, which stops the
+    tree from being collected (and deleted) while the cursor is still in use. */
+    %typemap(javacode) KBTreeCursor %{
+  private KBTree treeReference;
+%}
+    %typemap(javaconstruct) KBTreeCursor {
+    this($imcall, true);
+    treeReference = tree;
+  }
+    %feature("shadow") KBTreeCursor::KBTreeCursor %{
+use vars qw(%TREES);
+sub new {
+    my $pkg = shift;
+    my $self = Bio::KBase::Tree::TreeCppUtilc::new_KBTreeCursor(@_);
+    return undef unless defined($self);
+    bless $self, $pkg;
+    $TREES{tied(%$self)} = $_[0];
+    return $self;
+}
+%}
+    %feature("shadow") KBTreeCursor::~KBTreeCursor %{
+sub DESTROY {
+    return unless $_[0]->isa('HASH');
+    my $self = tied(%{$_[0]});
+    return unless defined $self;
+    delete $ITERATORS{$self};
+    if (exists $OWNER{$self}) {
+        Bio::KBase::Tree::TreeCppUtilc::delete_KBTreeCursor($self);
+        delete $OWNER{$self};
+    }
+    delete $TREES{$self};
+}
+%}
+    
+    class KBFrozenTree;
+    
+    /* Summary of a newick tree, from KBTree::scanStatistics */
+    class KBTreeStatistics {
+        public:
+            unsigned int getNodeCount() const;
+            unsigned int getLeafCount() const;
+            /* number of edges on the longest path from the root to a leaf */
+            unsigned int getMaxDepth() const;
+            /* true if any node has a distance to its parent */
+            bool hasBranchLengths() const;
+            /* true if internal nodes are named, and all of those names are numbers */
+            bool hasBootstrapValues() const;
+    };
     
     class KBTree {
         public:
             KBTree(const std::string &newickString);
             KBTree(const std::string &newickString, bool verbose);
             KBTree(const std::string &newickString, bool verbose, bool assumeBootstrapNames);
+            /* Parses large newick strings on up to threadCount threads (0 for one per core); the resulting
+            tree is the same as with a single thread.  With lazyLabels, plain node labels are only split into
+            names and distances when they are first needed, which makes building a tree just to count its
+            nodes or leaves much cheaper.  Without keepOriginalLabels, the full text of each node label is not
+            kept, which saves memory; toNewick in the ORIGINAL_LABEL style then writes all label components. */
+            KBTree(const std::string &newickString, bool verbose, bool assumeBootstrapNames, unsigned int threadCount, bool lazyLabels=false, bool keepOriginalLabels=true);
             ~KBTree();
             
+            /* Creates a tree directly from a newick file.  The file is memory mapped and parsed in place,
+            so the newick text does not have to be read into a string first.  Returns null/undef if the
+            file cannot be read. */
+            static KBTree *fromFile(const std::string &filename, bool verbose=false, bool assumeBootstrapNames=false, unsigned int threadCount=1, bool lazyLabels=false, bool keepOriginalLabels=true);
+            
+            /* A binary form of the tree that is deserialized without parsing any text: the nodes are still
+            built, but fromBinaryFile uses the label text in the mapped file in place.  Both throw an error if
+            the data is not a binary tree of a supported version, and fromBinaryFile returns null/undef if the
+            file cannot be read.  The binary string holds arbitrary bytes, so from Java use the file versions. */
+            std::string toBinary();
+            bool writeBinaryToFile(const std::string &filename);
+            static KBTree *fromBinary(const std::string &binary);
+            static KBTree *fromBinaryFile(const std::string &filename);
+            
+            /* Computes the node and leaf counts, maximum depth, and whether there are branch lengths and
+            bootstrap values in a newick string in a single scan, without building the tree.  Use this
+            instead of creating a KBTree when only these numbers are needed. */
+            static KBTreeStatistics scanStatistics(const std::string &newickString);
+            
             /*  Returns a newick string representation of the tree, in a style set by the various setOutputFlag methods */
 	    std::string toNewick();
 			
@@ -26,6 +128,14 @@ namespace KBTreeLib {
 	    void setOutputFlagDistances(bool flag);
 	    void setOutputFlagComments(bool flag);
 	    void setOutputFlagBootstrapValuesAsLabels(bool flag);
+	    
+	    /* number of significant digits for distances and bootstrap values (default 6); 0 writes the
+	    shortest text that reads back as exactly the same number */
+	    void setOutputPrecision(int precision);
+	    
+	    /* write trees with more than about 65,000 nodes on up to threadCount threads (0 for one per core);
+	    the text is the same as with a single thread, which is the default */
+	    void setOutputThreadCount(unsigned int threadCount);
 			
 			
             
@@ -40,9 +150,15 @@ namespace KBTreeLib {
 	    removes any node with an exact matching name from the tree, then simplifies the
 	    tree by removing any internal nodes with a single child and any leaf nodes without
 	    a name.  Distances are recomputed so that the distance between existing nodes
-	    in the original tree and the final tree are conserved. */
+	    in the original tree and the final tree are conserved.  Naming the root is an error, and leaves the tree
+	    as it was. */
 	    void removeNodesByNameAndSimplify(const std::string &nodeNames);
 	    
+	    /* removes every node with exactly this name as removeNodesByNameAndSimplify does, but finds them with an
+	    index of the node names instead of a walk over the tree, and only simplifies the nodes left behind by the
+	    removal.  Returns the number of nodes removed.  As above, naming the root is an error. */
+	    unsigned int removeNodeByNameAndSimplify(const std::string &name);
+	    
             /* merge leaves that have zero distance between each other, keeping an arbitrary leaf */
             void mergeZeroDistLeaves();
             
@@ -54,6 +170,40 @@ namespace KBTreeLib {
 			
 	    void replaceNodeNamesOrMakeBlank(const std::string &replacements);
 	    
+	    /* renames every node with exactly this name, returning the number of nodes renamed */
+	    unsigned int replaceNodeName(const std::string &name, const std::string &newName);
+	    
+	    /* the same lists as breadthFirstIterGetPathToRoot and breadthFirstIterGetAllDescendantNames, for the node
+	    with this name (the first in post order if several share it), or the empty string if no node has the name.
+	    The first call after the tree is built or edited indexes the node names, so it is NOT THREAD SAFE. */
+	    std::string getPathToRoot(const std::string &name);
+	    std::string getAllDescendantNames(const std::string &name);
+	    
+	    /* the depth (0 for the root, -1 if no node has the name), number of nodes in the subtree, number of leaves
+	    in the clade, and distance from the root (missing branch lengths count as 0) of the node with this name.
+	    These are computed for every node when first needed, and kept up to date by removeNodeByNameAndSimplify. */
+	    int getDepth(const std::string &name);
+	    unsigned int getSubtreeSize(const std::string &name);
+	    unsigned int getCladeLeafCount(const std::string &name);
+	    double getDistanceToRoot(const std::string &name);
+	    
+	    /* a new tree of the nodes named name1;name2;..., as removeNodesByNameAndSimplify would leave after removing
+	    every other leaf and every other named node that none of them is below (so keeping their lowest common
+	    ancestors, the named nodes between them and the top of the tree, with the branch lengths along each path
+	    summed), or NULL if none of the names is found.  The first call indexes the whole tree in linear time;
+	    later calls take O(k log k) for k names, plus the lengths of the paths whose branch lengths are summed. */
+	    KBTree *extractInducedSubtree(const std::string &names);
+	    
+	    /* Writes the patristic (path length) distances between every pair of the nodes named name1;name2;...,
+	    or of every leaf if names is empty, to the file, replacing it.  The format is PHYLIP_MATRIX (the row
+	    count, then each row as the name and its distances separated by spaces) or TSV_MATRIX (tab separated,
+	    with a header line of the names).  Rows are computed on up to threadCount threads (0 for one per core)
+	    and written as they are done, so the whole matrix is never held in memory.  Returns false if a name is
+	    not found or the file cannot be written. */
+	    static const unsigned int PHYLIP_MATRIX = 0;
+	    static const unsigned int TSV_MATRIX = 1;
+	    bool writePatristicDistancesToFile(const std::string &filename, const std::string &names="", unsigned int format=PHYLIP_MATRIX, unsigned int threadCount=0);
+	    
 	    /*
 	    TODO: implement a function that removes and replaces specific occurences of special characters from
 	    the tree that are used as input... right now the replacements are hard-coded.
@@ -77,6 +227,13 @@ namespace KBTreeLib {
             /* returns the total number of leaf nodes (aka tips) in the tree */			
             unsigned int getLeafCount();
             
+            /* returns the number of bytes held by the tree's nodes and labels, not counting the newick text */
+            size_t getMemoryUsage() const;
+            
+            /* returns an immutable snapshot of the tree that many service calls can query at once; the tree
+            itself can be edited or deleted afterwards */
+            KBFrozenTree freeze();
+            
             /* returns a string of all the leaf node names, concatenated as name1;name2;name3; */
             std::string getAllLeafNames();
             
@@ -104,7 +261,7 @@ namespace KBTreeLib {
 			
 	    /* NOT THREAD SAFE!  USE IN SERVICES WITH CAUTION!
             mark the current position of the iterator and return a handle so that you can always
-	    reset to that node again. */
+	    reset to that node again.  The handle is the node ID (see buildNodeIds). */
 	    unsigned int breadthFirstIterMarkNode();
 			
 	    /* NOT THREAD SAFE!  USE IN SERVICES WITH CAUTION!
@@ -141,10 +298,184 @@ namespace KBTreeLib {
 	    at the the node marker.  Returns an empty string if the marker is not valid or the node has
 	    no children/descendants.  This function is safe to run concurrently by multiple service calls. */
 	    std::string breadthFirstIterGetAllDescendantNames(unsigned int nodeMarker);
+	    
+	    
+	    /* NOT THREAD SAFE!  USE IN SERVICES WITH CAUTION!
+	    number the nodes 0,1,2,... in preorder, so that the nodes below a node are the IDs after its own up to
+	    getSubtreeEndId.  The IDs are kept when nodes are renamed or removed by name (a removed node's ID is no
+	    longer valid); any other edit drops them until this is called again.  The methods below that take IDs
+	    are safe to run concurrently by multiple service calls, and give NO_NODE_ID, false or the empty string
+	    for an invalid ID (every ID before the IDs are built). */
+	    static const unsigned int NO_NODE_ID = 0xffffffff;
+	    void buildNodeIds();
+	    bool hasNodeIds() const;
+	    /* one more than the largest ID */
+	    unsigned int getNodeIdLimit() const;
+	    bool isValidNodeId(unsigned int id) const;
+	    /* the ID of the node with the name, the first in post order if several share it */
+	    unsigned int getNodeId(const std::string &name) const;
+	    unsigned int getParentId(unsigned int id) const;
+	    unsigned int getSubtreeEndId(unsigned int id) const;
+	    /* true if the node is below (and not the same as) the ancestor */
+	    bool isDescendantOf(unsigned int id, unsigned int ancestorId) const;
+	    std::string getNameById(unsigned int id) const;
+	    /* name1;name2;... of the children of the node, of the nodes below it in preorder, and of its ancestors
+	    from its parent up to the top of its tree */
+	    std::string getChildNamesById(unsigned int id) const;
+	    std::string getDescendantNamesById(unsigned int id) const;
+	    std::string getPathToRootById(unsigned int id) const;
 			
 			
             
     };
     
+    /* Answers lowest common ancestor queries in constant time.  Nodes are numbered in preorder from
+    the root, node 0; NONE (4294967295) stands for no node.  The index is a copy, so the KBTree can be
+    changed or deleted afterwards. */
+    class KBAncestorIndex {
+        public:
+            static const unsigned int NONE = 0xffffffff;
+            KBAncestorIndex(KBTree &tree);
+            ~KBAncestorIndex();
+            
+            unsigned int getNodeCount() const;
+            unsigned int getParent(unsigned int node) const;
+            unsigned int getDepth(unsigned int node) const;
+            unsigned int getSubtreeSize(unsigned int node) const;
+            unsigned int getLeafCount(unsigned int node) const;
+            bool isLeaf(unsigned int node) const;
+            double getDistanceToRoot(unsigned int node) const;
+            /* the node with the given name, or NONE; the first in post order if several share it */
+            unsigned int getNode(const std::string &name) const;
+            bool isAncestor(unsigned int ancestor, unsigned int node) const;
+            unsigned int getLowestCommonAncestor(unsigned int a, unsigned int b) const;
+            
+            /* Pairs of names given as "a1;b1;a2;b2;" give the names of their lowest common ancestors
+            as "ancestor1;ancestor2;", with an empty name where the ancestor is unnamed or a name is
+            not found. */
+            std::string getLowestCommonAncestorNames(const std::string &namePairs) const;
+            /* true if the leaves named in "name1;name2;name3;" are exactly the leaves of one clade */
+            bool isMonophyletic(const std::string &leafNames) const;
+    };
+    
+    /* A walk over a KBTree that keeps its own position, so that many service calls can traverse one tree at
+    the same time, unlike the breadthFirstIter methods of the tree.  The order is PREORDER, POSTORDER (the
+    order of getAllNodeNames), BREADTH_FIRST (the order of breadthFirstIterNext) or LEAVES.  A cursor starts
+    at the first node, and only reads the tree, which must not be changed while it is in use.  The cursor keeps
+    the tree from being collected, but calling delete() on the tree while a cursor uses it is still an error. */
+    class KBTreeCursor {
+        public:
+            static const unsigned int PREORDER = 0;
+            static const unsigned int POSTORDER = 1;
+            static const unsigned int BREADTH_FIRST = 2;
+            static const unsigned int LEAVES = 3;
+            KBTreeCursor(const KBTree &tree, unsigned int order=PREORDER);
+            ~KBTreeCursor();
+            
+            unsigned int getOrder() const;
+            /* go back to the first node */
+            void reset();
+            /* move to the next node, returning false if there is none */
+            bool next();
+            bool isAtEnd() const;
+            
+            /* the node at the cursor; at the end these give the empty string, NaN, false or NO_NODE_ID */
+            std::string getName() const;
+            std::string getParentName() const;
+            double getDistanceToParent() const;
+            double getBootstrapValue() const;
+            bool isLeaf() const;
+            /* the ID of the node, or NO_NODE_ID if the tree has not built its node IDs */
+            unsigned int getNodeId() const;
+    };
+    
+    /* An immutable snapshot of a tree, from KBTree::freeze, that any number of service calls can query at
+    the same time with no locking.  Copies share the snapshot.  The queries by name are the same as those of
+    KBTree; the edits return a new snapshot and leave this one as it is. */
+    class KBFrozenTree {
+        public:
+            KBFrozenTree(KBTree &tree);
+            KBFrozenTree(const std::string &newickString, bool assumeBootstrapNames=false);
+            ~KBFrozenTree();
+            
+            /* true if both share one snapshot */
+            bool isSameSnapshot(const KBFrozenTree &other) const;
+            unsigned int getNodeCount() const;
+            unsigned int getLeafCount() const;
+            size_t getMemoryUsage() const;
+            std::string getAllLeafNames() const;
+            std::string getAllNodeNames() const;
+            
+            bool hasNode(const std::string &name) const;
+            std::string getPathToRoot(const std::string &name) const;
+            int getDepth(const std::string &name) const;
+            unsigned int getSubtreeSize(const std::string &name) const;
+            unsigned int getCladeLeafCount(const std::string &name) const;
+            double getDistanceToRoot(const std::string &name) const;
+            std::string getLowestCommonAncestorNames(const std::string &namePairs) const;
+            bool isMonophyletic(const std::string &leafNames) const;
+            /* NaN if either name is not found */
+            double getPatristicDistance(const std::string &nameA, const std::string &nameB) const;
+            bool writePatristicDistancesToFile(const std::string &filename, const std::string &names="", unsigned int format=KBTree::PHYLIP_MATRIX, unsigned int threadCount=0) const;
+            
+            std::string toNewick() const;
+            std::string toNewick(unsigned int style) const;
+            bool writeNewickToFile(const std::string &filename) const;
+            bool writeNewickToFile(const std::string &filename, unsigned int style) const;
+            
+            /* an editable copy of the tree */
+            KBTree *toKBTree() const;
+            KBFrozenTree removeNodesByNameAndSimplify(const std::string &nodeNames) const;
+            KBFrozenTree replaceNodeNames(const std::string &replacements) const;
+    };
+    
+    /* Frozen trees kept by a hash of their newick text, so that a service asked about the same stored tree
+    again and again parses it only once.  KBTreeCache::getShared() is the cache of the whole process; the
+    least recently used trees are dropped to keep within the memory budget, in bytes. */
+    class KBTreeCache {
+        public:
+            KBTreeCache(size_t memoryBudget=268435456);
+            ~KBTreeCache();
+            static KBTreeCache &getShared();
+            
+            /* the tree of the newick string, parsed only if it is not cached */
+            KBFrozenTree get(const std::string &newickString, bool assumeBootstrapNames=false);
+            bool contains(const std::string &newickString, bool assumeBootstrapNames=false) const;
+            void clear();
+            
+            void setMemoryBudget(size_t bytes);
+            size_t getMemoryBudget() const;
+            size_t getMemoryUsage() const;
+            size_t getTreeCount() const;
+            uint64_t getHitCount() const;
+            uint64_t getMissCount() const;
+            uint64_t getEvictionCount() const;
+            void resetCounters();
+    };
+    
+    /* A directory of binary tree images kept by a hash of their newick text, which any number of processes
+    can share, so that a restarted service loads each stored tree from its memory mapped image instead of
+    parsing it again.  Images are written atomically, and the least recently used are removed when they add
+    up to more than the size limit, in bytes. */
+    class KBTreeDiskCache {
+        public:
+            KBTreeDiskCache(const std::string &directory, uint64_t sizeLimit=1073741824);
+            ~KBTreeDiskCache();
+            
+            /* the tree of the newick string, loaded from its image or else parsed and its image stored */
+            KBTree *get(const std::string &newickString, bool assumeBootstrapNames=false);
+            bool contains(const std::string &newickString, bool assumeBootstrapNames=false) const;
+            std::string getImagePath(const std::string &newickString, bool assumeBootstrapNames=false) const;
+            void trim();
+            void clear();
+            
+            void setSizeLimit(uint64_t bytes);
+            uint64_t getSizeLimit() const;
+            uint64_t getDiskUsage() const;
+            uint64_t getHitCount() const;
+            uint64_t getMissCount() const;
+            uint64_t getEvictionCount() const;
+            void resetCounters();
+    };
+    
 };
-
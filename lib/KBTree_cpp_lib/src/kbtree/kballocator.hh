@@ -0,0 +1,191 @@
+/**
+ * @file kballocator.hh
+ * @brief Pool allocator for the nodes of a KBTree
+ *
+ * tree.hh allocates every node through its tree_node_allocator parameter, one node at a time.  With
+ * std::allocator that is one malloc and one free per node.  KBPoolAllocator instead carves nodes out of
+ * large slabs owned by the tree, keeps freed nodes on a list for reuse, and gives all of the slabs back at
+ * once when the tree is destroyed.
+ */
+
+#ifndef KBALLOCATOR_HH_
+#define KBALLOCATOR_HH_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace KBTreeLib {
+
+	/*! Allocation counts of a KBPoolAllocator */
+	struct KBAllocationStatistics {
+		size_t slabCount;          /*!< slabs reserved from the system  */
+		size_t bytesReserved;      /*!< total size of those slabs  */
+		size_t totalAllocations;   /*!< nodes handed out since the pool was created  */
+		size_t totalFrees;         /*!< nodes given back since the pool was created  */
+		size_t nodesInUse;         /*!< nodes currently handed out  */
+		size_t peakNodesInUse;     /*!< most nodes handed out at any one time  */
+	};
+
+	/*! Allocator for the nodes of a single tree.
+	 * Each allocator owns its pool, so it must not be shared: a copy starts out with an empty pool of its
+	 * own, and assignment leaves the pool alone (tree.hh copies trees node by node).  Requests for more than
+	 * one object at a time go straight to operator new.
+	 *
+	 * The pool is not thread safe, except between setConcurrent(true) and setConcurrent(false): threads then
+	 * take nodes from a chunk of the pool reserved for them, and only lock the pool to get a new chunk.  Every
+	 * thread that allocated must call releaseThreadCache() before concurrent allocation is switched off.
+	 */
+	template <class T>
+	class KBPoolAllocator
+	{
+		public:
+			typedef T value_type;
+			typedef T *pointer;
+			typedef const T *const_pointer;
+			typedef T &reference;
+			typedef const T &const_reference;
+			typedef size_t size_type;
+			typedef ptrdiff_t difference_type;
+
+			KBPoolAllocator() { initialize(); };
+			KBPoolAllocator(const KBPoolAllocator &) { initialize(); };
+			KBPoolAllocator &operator=(const KBPoolAllocator &) { return *this; };
+			~KBPoolAllocator() {
+				for(size_t s=0; s<slabs.size(); s++) { ::operator delete(slabs[s]); }
+			};
+
+			T *allocate(size_t n, const void * =0) {
+				if(n!=1) { return static_cast<T *>(::operator new(n*sizeof(T))); }
+				if(concurrent) { return allocateConcurrently(); }
+				stats.totalAllocations++;
+				if(++stats.nodesInUse>stats.peakNodesInUse) { stats.peakNodesInUse=stats.nodesInUse; }
+				if(freeList!=NULL) {
+					FreeSlot *slot = freeList;
+					freeList = slot->next;
+					return reinterpret_cast<T *>(slot);
+				}
+				if(next==end) { addSlab(); }
+				return next++;
+			};
+
+			void deallocate(T *p, size_t n) {
+				if(n!=1) { ::operator delete(p); return; }
+				std::unique_lock<std::mutex> guard(lock,std::defer_lock);
+				if(concurrent) { guard.lock(); }
+				FreeSlot *slot = reinterpret_cast<FreeSlot *>(p);
+				slot->next = freeList;
+				freeList = slot;
+				stats.totalFrees++;
+				stats.nodesInUse--;
+			};
+
+			void construct(T *p, const T &value) { new(p) T(value); };
+			void destroy(T *p) { p->~T(); };
+
+			/** switch the pool between single threaded use (the default) and concurrent allocation */
+			void setConcurrent(bool flag) {
+				concurrent = flag;
+				// any chunk a thread failed to release is abandoned (it is still freed with the pool)
+				if(!flag) { id = nextId++; }
+			};
+
+			/** give back the rest of this thread's chunk and record its allocations; call on every thread
+			 * that allocated while the pool was concurrent */
+			void releaseThreadCache() {
+				ThreadCache &cache = threadCache;
+				if(cache.owner!=id) { return; }
+				std::lock_guard<std::mutex> guard(lock);
+				recordChunk(cache);
+				for(; cache.next<cache.end; cache.next++) {
+					FreeSlot *slot = reinterpret_cast<FreeSlot *>(cache.next);
+					slot->next = freeList;
+					freeList = slot;
+				}
+				cache.owner = 0;
+			};
+
+			KBAllocationStatistics getStatistics() const { return stats; };
+
+		private:
+			/** nodes in the first slab; each new slab is twice the size of the last, up to MAX_SLAB_NODES */
+			static const size_t MIN_SLAB_NODES = 32;
+			static const size_t MAX_SLAB_NODES = 1<<16;
+			/** nodes a thread takes from the pool at once when allocating concurrently */
+			static const size_t CHUNK_NODES = 256;
+
+			struct FreeSlot { FreeSlot *next; };
+			static_assert(sizeof(T)>=sizeof(FreeSlot), "pool objects must be able to hold a free list link");
+
+			/** the chunk of the pool a thread is allocating from; owner is the id of the pool it belongs to */
+			struct ThreadCache {
+				uint64_t owner;
+				T *next;
+				T *end;
+				size_t allocated;
+			};
+
+			void initialize() {
+				concurrent = false;
+				id = nextId++;
+				next = end = NULL;
+				freeList = NULL;
+				slabNodes = MIN_SLAB_NODES;
+				stats = KBAllocationStatistics{0,0,0,0,0,0};
+			};
+
+			void addSlab() {
+				T *slab = static_cast<T *>(::operator new(slabNodes*sizeof(T)));
+				slabs.push_back(slab);
+				next = slab;
+				end = slab+slabNodes;
+				stats.slabCount++;
+				stats.bytesReserved += slabNodes*sizeof(T);
+				if(slabNodes<MAX_SLAB_NODES) { slabNodes*=2; }
+			};
+
+			/** add the allocations from a thread's chunk to the statistics; the pool must be locked */
+			void recordChunk(const ThreadCache &cache) {
+				stats.totalAllocations += cache.allocated;
+				stats.nodesInUse += cache.allocated;
+				if(stats.nodesInUse>stats.peakNodesInUse) { stats.peakNodesInUse=stats.nodesInUse; }
+			};
+
+			T *allocateConcurrently() {
+				ThreadCache &cache = threadCache;
+				if(cache.owner!=id || cache.next==cache.end) {
+					std::lock_guard<std::mutex> guard(lock);
+					if(cache.owner==id) { recordChunk(cache); }
+					if(next==end) { addSlab(); }
+					size_t chunk = (size_t)(end-next)<CHUNK_NODES ? (size_t)(end-next) : CHUNK_NODES;
+					cache.owner = id;
+					cache.next = next;
+					cache.end = next+chunk;
+					cache.allocated = 0;
+					next += chunk;
+				}
+				cache.allocated++;
+				return cache.next++;
+			};
+
+			std::vector<T *> slabs;
+			T *next;              // the unused part of the newest slab is [next,end)
+			T *end;
+			FreeSlot *freeList;
+			size_t slabNodes;     // size of the next slab
+			KBAllocationStatistics stats;
+
+			bool concurrent;
+			uint64_t id;          // identifies this pool (until concurrent allocation ends) to the thread caches
+			std::mutex lock;
+
+			static inline std::atomic<uint64_t> nextId{1};
+			static inline thread_local ThreadCache threadCache{0,NULL,NULL,0};
+	};
+
+};
+
+#endif /* KBALLOCATOR_HH_ */
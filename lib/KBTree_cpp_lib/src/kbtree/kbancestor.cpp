@@ -0,0 +1,256 @@
+/**
+ * @file kbancestor.cpp
+ * @brief Constant time lowest common ancestor queries
+ */
+
+#include "kbancestor.hh"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+using namespace std;
+using namespace KBTreeLib;
+
+
+KBAncestorIndex::KBAncestorIndex(KBTree &source) {
+	const size_t n = source.tr->size();
+	if(n>=NONE) { throw ParseException("Tree has too many nodes for a KBAncestorIndex.","KBAncestorIndex::KBAncestorIndex()"); }
+	parents.reserve(n);
+	nameOffsets.reserve(n+1);
+	nameOffsets.push_back(0);
+	std::vector<double> distances;
+	distances.reserve(n);
+	// the ancestors of the current node are kept on a stack, so the parent of each node is found by popping back to it
+	typedef tree_node_<KBNode> TreeNode;
+	std::vector<std::pair<const TreeNode *,uint32_t> > ancestors;
+	for(KBNodeTree::pre_order_iterator it=source.tr->begin(); it!=source.tr->end(); ++it) {
+		const TreeNode *node = it.node;
+		while(!ancestors.empty() && ancestors.back().first!=node->parent) { ancestors.pop_back(); }
+		const uint32_t index = (uint32_t)parents.size();
+		parents.push_back(ancestors.empty() ? NONE : ancestors.back().second);
+		if(node->first_child!=NULL) { ancestors.push_back(std::pair<const TreeNode *,uint32_t>(node,index)); }
+		const KBLabelText label = node->data.getLabelText(source.labelTable);
+		distances.push_back(label.distanceToParent);
+		namePool.append(label.name);
+		if(namePool.size()>=NONE) { throw ParseException("Tree has too much name text for a KBAncestorIndex.","KBAncestorIndex::KBAncestorIndex()"); }
+		nameOffsets.push_back((uint32_t)namePool.size());
+	}
+	build(distances);
+}
+
+KBAncestorIndex::KBAncestorIndex(const KBCompactTree &source) {
+	const uint32_t n = source.getNodeCount();
+	parents.reserve(n);
+	nameOffsets.reserve(n+1);
+	nameOffsets.push_back(0);
+	std::vector<double> distances;
+	distances.reserve(n);
+	for(uint32_t node=0; node<n; node++) {
+		parents.push_back(source.getParent(node));
+		distances.push_back(source.getDistanceToParent(node));
+		namePool.append(source.getName(node));
+		nameOffsets.push_back((uint32_t)namePool.size());
+	}
+	build(distances);
+}
+
+KBAncestorIndex::~KBAncestorIndex() { }
+
+void KBAncestorIndex::build(const std::vector<double> &distances)
+{
+	namePool.shrink_to_fit();
+	const uint32_t n = (uint32_t)parents.size();
+
+	// parents come before their children, so depths and distances are summed down in one pass, and subtree
+	// totals added up in another pass back
+	std::vector<uint32_t> depths(n);
+	distancesToRoot.resize(n);
+	subtreeSizes.assign(n,1);
+	leafCounts.assign(n,0);
+	for(uint32_t node=0; node<n; node++) {
+		const uint32_t parent = parents[node];
+		if(parent==NONE) {
+			depths[node] = 0;
+			distancesToRoot[node] = 0;
+		} else {
+			depths[node] = depths[parent]+1;
+			distancesToRoot[node] = distancesToRoot[parent]+(isnan(distances[node]) ? 0 : distances[node]);
+		}
+	}
+	for(uint32_t node=n; node-->0; ) {
+		if(subtreeSizes[node]==1) { leafCounts[node]=1; }
+		const uint32_t parent = parents[node];
+		if(parent==NONE) { continue; }
+		subtreeSizes[parent] += subtreeSizes[node];
+		leafCounts[parent] += leafCounts[node];
+	}
+
+	// a node's rank in post order is its rank in preorder, less its ancestors, plus the nodes below it
+	nodesByName.reserve(n);
+	for(uint32_t node=0; node<n; node++) {
+		std::string_view name = getName(node);
+		if(name.empty()) { continue; }
+		std::pair<std::unordered_map<std::string_view,uint32_t>::iterator,bool> added = nodesByName.emplace(name,node);
+		if(!added.second) {
+			const uint32_t other = added.first->second;
+			if(node+subtreeSizes[node]-depths[node] < other+subtreeSizes[other]-depths[other]) { added.first->second=node; }
+		}
+	}
+	depthMinima.build(depths);
+}
+
+void KBDepthMinima::build(std::vector<uint32_t> &nodeDepths)
+{
+	depths.swap(nodeDepths);
+	nodeDepths.clear();
+	const uint32_t n = (uint32_t)depths.size();
+	shallowerMasks.clear();
+	blockMinima.clear();
+
+	// The nodes of each block that are shallower than every later node up to p form a stack: a node joins it
+	// at p, and leaves when a node at least as shallow joins.  The mask of p is the stack at p.  An unused node
+	// is as deep as can be, so it leaves the stack at the next node, and is the shallowest only of itself.
+	shallowerMasks.resize(n);
+	uint64_t stack = 0;
+	for(uint32_t p=0; p<n; p++) {
+		const uint32_t offset = p&63;
+		if(offset==0) { stack=0; }
+		const uint32_t blockStart = p-offset;
+		while(stack!=0 && depths[blockStart+63-__builtin_clzll(stack)]>=depths[p]) {
+			stack &= ~(1ULL<<(63-__builtin_clzll(stack)));
+		}
+		stack |= 1ULL<<offset;
+		shallowerMasks[p] = stack;
+	}
+
+	// level 0 of the sparse table is the shallowest node of each block, and level k+1 the shallower of two
+	// runs of level k
+	blockCount = ((size_t)n+63)>>BLOCK_SHIFT;
+	unsigned int levels = 0;
+	while(((size_t)1<<levels)<=blockCount) { levels++; }
+	blockMinima.resize(levels*blockCount);
+	for(size_t block=0; block<blockCount; block++) {
+		const uint32_t start = (uint32_t)(block<<BLOCK_SHIFT);
+		blockMinima[block] = findShallowestInBlock(start,std::min<uint32_t>(start+63,n-1));
+	}
+	for(unsigned int level=1; level<levels; level++) {
+		const size_t half = (size_t)1<<(level-1);
+		uint32_t *row = &blockMinima[level*blockCount];
+		const uint32_t *previous = &blockMinima[(level-1)*blockCount];
+		for(size_t block=0; block+2*half<=blockCount; block++) {
+			const uint32_t a = previous[block], b = previous[block+half];
+			row[block] = depths[b]<depths[a] ? b : a;
+		}
+	}
+}
+
+size_t KBDepthMinima::getMemoryUsage() const
+{
+	return (depths.capacity()+blockMinima.capacity())*sizeof(uint32_t) + shallowerMasks.capacity()*sizeof(uint64_t);
+}
+
+size_t KBAncestorIndex::getMemoryUsage() const
+{
+	return sizeof(KBAncestorIndex) + (parents.capacity()+subtreeSizes.capacity()+leafCounts.capacity())*sizeof(uint32_t) +
+		distancesToRoot.capacity()*sizeof(double) + depthMinima.getMemoryUsage() +
+		nameOffsets.capacity()*sizeof(uint32_t) + namePool.capacity() +
+		nodesByName.bucket_count()*sizeof(void *) + nodesByName.size()*(sizeof(std::string_view)+sizeof(uint32_t)+2*sizeof(void *));
+}
+
+uint32_t KBAncestorIndex::getNode(std::string_view name) const
+{
+	std::unordered_map<std::string_view,uint32_t>::const_iterator found = nodesByName.find(name);
+	return found==nodesByName.end() ? NONE : found->second;
+}
+
+bool KBAncestorIndex::getNodes(const std::vector<std::string> &names, std::vector<uint32_t> &nodes) const
+{
+	nodes.reserve(nodes.size()+names.size());
+	for(size_t i=0; i<names.size(); i++) {
+		const uint32_t node = getNode(names[i]);
+		if(node==NONE) {
+			cerr<<"!!KBTREE ERROR-- CANNOT FIND NODE NAMED: '"<<names[i]<<"'"<<endl;
+			return false;
+		}
+		nodes.push_back(node);
+	}
+	return true;
+}
+
+void KBAncestorIndex::getLeaves(std::vector<uint32_t> &leaves) const
+{
+	for(uint32_t node=0; node<getNodeCount(); node++) {
+		if(isLeaf(node)) { leaves.push_back(node); }
+	}
+}
+
+uint32_t KBAncestorIndex::getLowestCommonAncestor(const std::vector<uint32_t> &nodes) const
+{
+	// the ancestor of the first and last of the nodes in preorder is an ancestor of every node between them
+	if(nodes.empty()) { return NONE; }
+	std::pair<std::vector<uint32_t>::const_iterator,std::vector<uint32_t>::const_iterator> range = std::minmax_element(nodes.begin(),nodes.end());
+	return getLowestCommonAncestor(*range.first,*range.second);
+}
+
+void KBAncestorIndex::getLowestCommonAncestors(const uint32_t *a, const uint32_t *b, size_t count, uint32_t *ancestors) const
+{
+	for(size_t i=0; i<count; i++) { ancestors[i] = getLowestCommonAncestor(a[i],b[i]); }
+}
+
+void KBAncestorIndex::getLowestCommonAncestors(const std::vector<uint32_t> &a, const std::vector<uint32_t> &b, std::vector<uint32_t> &ancestors) const
+{
+	const size_t count = std::min(a.size(),b.size());
+	ancestors.resize(count);
+	getLowestCommonAncestors(a.data(),b.data(),count,ancestors.data());
+}
+
+void KBAncestorIndex::getLowestCommonAncestors(const std::vector<std::string> &a, const std::vector<std::string> &b, std::vector<uint32_t> &ancestors) const
+{
+	const size_t count = std::min(a.size(),b.size());
+	ancestors.resize(count);
+	for(size_t i=0; i<count; i++) {
+		const uint32_t nodeA = getNode(a[i]), nodeB = getNode(b[i]);
+		ancestors[i] = (nodeA==NONE || nodeB==NONE) ? NONE : getLowestCommonAncestor(nodeA,nodeB);
+	}
+}
+
+std::string KBAncestorIndex::getLowestCommonAncestorNames(const std::string &namePairs) const
+{
+	std::vector<std::string> names, a, b;
+	splitNames(namePairs,names);
+	for(size_t i=0; i+1<names.size(); i+=2) {
+		a.push_back(names[i]);
+		b.push_back(names[i+1]);
+	}
+	std::vector<uint32_t> ancestors;
+	getLowestCommonAncestors(a,b,ancestors);
+	std::string result = "";
+	for(size_t i=0; i<ancestors.size(); i++) {
+		if(ancestors[i]!=NONE) { result += getName(ancestors[i]); }
+		result += ";";
+	}
+	return result;
+}
+
+bool KBAncestorIndex::isMonophyletic(const std::vector<std::string> &leafNames) const
+{
+	std::vector<uint32_t> leaves;
+	leaves.reserve(leafNames.size());
+	for(size_t i=0; i<leafNames.size(); i++) {
+		const uint32_t node = getNode(leafNames[i]);
+		if(node==NONE || !isLeaf(node)) { return false; }
+		leaves.push_back(node);
+	}
+	if(leaves.empty()) { return false; }
+	std::sort(leaves.begin(),leaves.end());
+	leaves.erase(std::unique(leaves.begin(),leaves.end()),leaves.end());
+	const uint32_t ancestor = getLowestCommonAncestor(leaves.front(),leaves.back());
+	return ancestor!=NONE && leafCounts[ancestor]==leaves.size();
+}
+
+bool KBAncestorIndex::isMonophyletic(const std::string &leafNames) const
+{
+	std::vector<std::string> names;
+	splitNames(leafNames,names);
+	return isMonophyletic(names);
+}
@@ -0,0 +1,190 @@
+/**
+ * @file kbancestor.hh
+ * @brief Constant time lowest common ancestor queries
+ *
+ * The usual way to answer lowest common ancestor queries in constant time is to write down the depth of
+ * every node visited on an Euler tour of the tree and find the shallowest node between the two nodes with
+ * a sparse table of range minima.  A KBAncestorIndex uses the equivalent preorder form, which is half the
+ * length: the nodes numbered in preorder, the lowest common ancestor of nodes a and b (a before b) is the
+ * parent of the shallowest node after a up to and including b.
+ *
+ * A sparse table over every position of a million leaf tree would need over a hundred megabytes, so the
+ * depths are split into blocks of 64.  The sparse table holds the shallowest node of every run of a power
+ * of two blocks, and for each position a 64 bit mask marks the nodes of its block, up to that position,
+ * that are shallower than every node after them; the shallowest node from any start in the block is then
+ * the lowest marked bit.  A query looks at no more than two masks and two entries of the table, and the
+ * whole index is built in time and space linear in the number of nodes.  The masks and the table are a
+ * KBDepthMinima, which a KBTree also builds over its own node IDs (see KBTree::extractInducedSubtree).
+ *
+ * The index also keeps the parent, depth, subtree size, leaf count and distance from the root of every
+ * node, and finds nodes by name, so that most questions about the clades of a tree can be answered
+ * without going back to it.
+ */
+
+#ifndef KBANCESTOR_HH_
+#define KBANCESTOR_HH_
+
+#include "kbtree.hh"
+#include "kbcompact.hh"
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+
+namespace KBTreeLib {
+
+	/** The shallowest node in any range of nodes numbered in preorder, in constant time, from their depths */
+	class KBDepthMinima
+	{
+		public:
+			/** the depth of a node number that is not used, which is never the shallowest of a range with a node */
+			static constexpr uint32_t UNUSED = 0xffffffff;
+
+			KBDepthMinima() : blockCount(0) { };
+			/** index the depths, which are taken from the vector, leaving it empty */
+			void build(std::vector<uint32_t> &nodeDepths);
+
+			uint32_t getDepth(uint32_t node) const { return depths[node]; };
+			/** the shallowest node in [from,to] (the first of them, if several are as shallow) */
+			uint32_t findShallowest(uint32_t from, uint32_t to) const {
+				uint32_t fromBlock = from>>BLOCK_SHIFT, toBlock = to>>BLOCK_SHIFT;
+				if(fromBlock==toBlock) { return findShallowestInBlock(from,to); }
+				uint32_t best = findShallowestInBlock(from,(fromBlock<<BLOCK_SHIFT)|63);
+				uint32_t last = findShallowestInBlock(toBlock<<BLOCK_SHIFT,to);
+				if(depths[last]<depths[best]) { best=last; }
+				if(fromBlock+1<toBlock) {
+					uint32_t middle = findShallowestInBlocks(fromBlock+1,toBlock-1);
+					if(depths[middle]<depths[best]) { best=middle; }
+				}
+				return best;
+			};
+			/** bytes held, not counting the object itself */
+			size_t getMemoryUsage() const;
+
+		private:
+			static const unsigned int BLOCK_SHIFT = 6;
+
+			uint32_t findShallowestInBlock(uint32_t from, uint32_t to) const {
+				return (to&~63u)+(uint32_t)__builtin_ctzll(shallowerMasks[to]&(~0ULL<<(from&63)));
+			};
+			uint32_t findShallowestInBlocks(uint32_t fromBlock, uint32_t toBlock) const {
+				unsigned int level = 31-__builtin_clz(toBlock-fromBlock+1);
+				uint32_t a = blockMinima[level*blockCount+fromBlock], b = blockMinima[level*blockCount+toBlock+1-(1u<<level)];
+				return depths[b]<depths[a] ? b : a;
+			};
+
+			std::vector<uint32_t> depths;
+			std::vector<uint64_t> shallowerMasks;  // bit j of mask p marks node j of p's block as shallower than every node after it up to p
+			size_t blockCount;
+			std::vector<uint32_t> blockMinima;     // level k holds the shallowest node of blocks [b,b+2^k), for each block b
+	};
+
+	class KBAncestorIndex
+	{
+		public:
+			/** node returned when a node has no parent or a name is not found */
+			static constexpr uint32_t NONE = 0xffffffff;
+
+			/** index the tree; the KBTree can be edited or deleted afterwards */
+			KBAncestorIndex(KBTree &tree);
+			/** index the compact tree, with the same node numbering */
+			explicit KBAncestorIndex(const KBCompactTree &tree);
+			~KBAncestorIndex();
+
+			unsigned int getNodeCount() const { return (unsigned int)parents.size(); };
+			/** bytes held by the index, including its names */
+			size_t getMemoryUsage() const;
+
+			// Nodes are numbered in preorder, as in a KBCompactTree; the root is node 0, and any other nodes
+			// without a parent are its siblings.
+			uint32_t getParent(uint32_t node) const { return parents[node]; };
+			/** number of ancestors of the node; 0 for the root */
+			uint32_t getDepth(uint32_t node) const { return depthMinima.getDepth(node); };
+			/** number of nodes in the subtree below and including the node */
+			uint32_t getSubtreeSize(uint32_t node) const { return subtreeSizes[node]; };
+			/** number of leaves in the clade of the node (1 for a leaf) */
+			uint32_t getLeafCount(uint32_t node) const { return leafCounts[node]; };
+			bool isLeaf(uint32_t node) const { return subtreeSizes[node]==1; };
+			/** sum of the branch lengths from the top of the tree to the node, a missing length counting as 0 */
+			double getDistanceToRoot(uint32_t node) const { return distancesToRoot[node]; };
+			std::string_view getName(uint32_t node) const {
+				return std::string_view(namePool.data()+nameOffsets[node],nameOffsets[node+1]-nameOffsets[node]);
+			};
+			/** the node with the name, or NONE; if several nodes share the name, the first of them in post
+			 * order, as for the queries by name of KBTree */
+			uint32_t getNode(std::string_view name) const;
+			/** append the node with each name to nodes, as getNode does; returns false, after reporting the first
+			 * name that is not found, if any is missing */
+			bool getNodes(const std::vector<std::string> &names, std::vector<uint32_t> &nodes) const;
+			/** append every leaf, named or not, to leaves in preorder */
+			void getLeaves(std::vector<uint32_t> &leaves) const;
+			/** true if ancestor is node or one of its ancestors */
+			bool isAncestor(uint32_t ancestor, uint32_t node) const {
+				return ancestor<=node && node-ancestor<subtreeSizes[ancestor];
+			};
+
+			/** the lowest common ancestor of the two nodes, or NONE if they are in different top level trees */
+			uint32_t getLowestCommonAncestor(uint32_t a, uint32_t b) const {
+				if(a==b) { return a; }
+				if(a>b) { uint32_t swap=a; a=b; b=swap; }
+				return parents[depthMinima.findShallowest(a+1,b)];
+			};
+			/** the lowest common ancestor of all of the nodes (NONE if there are none) */
+			uint32_t getLowestCommonAncestor(const std::vector<uint32_t> &nodes) const;
+			/** ancestors[i] = getLowestCommonAncestor(a[i],b[i]) for each of the count pairs */
+			void getLowestCommonAncestors(const uint32_t *a, const uint32_t *b, size_t count, uint32_t *ancestors) const;
+			void getLowestCommonAncestors(const std::vector<uint32_t> &a, const std::vector<uint32_t> &b, std::vector<uint32_t> &ancestors) const;
+			/** the same for pairs of names; the ancestor is NONE where either name is not found */
+			void getLowestCommonAncestors(const std::vector<std::string> &a, const std::vector<std::string> &b, std::vector<uint32_t> &ancestors) const;
+			/** pairs of names given as a1;b1;a2;b2;... give the names of their lowest common ancestors as
+			 * ancestor1;ancestor2;... (an empty name where the ancestor is unnamed or a name is not found) */
+			std::string getLowestCommonAncestorNames(const std::string &namePairs) const;
+
+			/** the patristic distance between the nodes: the sum of the branch lengths on the path from one to the
+			 * other, a missing length counting as 0.  NaN if they are in different top level trees. */
+			double getPatristicDistance(uint32_t a, uint32_t b) const {
+				uint32_t ancestor = getLowestCommonAncestor(a,b);
+				if(ancestor==NONE) { return NAN; }
+				return distancesToRoot[a]+distancesToRoot[b]-2*distancesToRoot[ancestor];
+			};
+			/** distances[i*n+j] = getPatristicDistance(nodes[i],nodes[j]) for every pair, where n = nodes.size(),
+			 * computed on up to threadCount threads (0 for one per core) */
+			void getPatristicDistances(const std::vector<uint32_t> &nodes, double *distances, unsigned int threadCount=0) const;
+			/** write the same matrix to the sink as a KBTree::PHYLIP_MATRIX or KBTree::TSV_MATRIX, with the rows
+			 * labelled by the names of the nodes and the distances written to precision (see formatDouble).  Only
+			 * a few rows are held at a time; the sink is not flushed.  Returns out.good(). */
+			bool writePatristicDistances(const std::vector<uint32_t> &nodes, KBOutputSink &out, unsigned int format, int precision, unsigned int threadCount=0) const;
+			/** the same for the nodes named name1;name2;..., or for every leaf if names is empty, as
+			 * KBTree::writePatristicDistances; returns false if a name is not found, after reporting it */
+			bool writePatristicDistances(KBOutputSink &out, const std::string &names, unsigned int format, int precision, unsigned int threadCount=0) const;
+			/** as writePatristicDistances, to the file (replacing it), reporting any error */
+			bool writePatristicDistancesToFile(const std::string &filename, const std::string &names, unsigned int format, int precision, unsigned int threadCount=0) const;
+
+			/** true if the leaves with the names are exactly the leaves of one clade: the leaves below their lowest
+			 * common ancestor.  False if any name is not found or is not the name of a leaf. */
+			bool isMonophyletic(const std::vector<std::string> &leafNames) const;
+			/** the same, for names given as name1;name2;name3;... */
+			bool isMonophyletic(const std::string &leafNames) const;
+
+		private:
+			KBAncestorIndex(const KBAncestorIndex &);
+			KBAncestorIndex &operator=(const KBAncestorIndex &);
+
+			/** the nodes named name1;name2;..., or every leaf if names is empty; false if a name is not found,
+			 * after reporting it */
+			bool getNamedNodesOrLeaves(const std::string &names, std::vector<uint32_t> &nodes) const;
+			/** fill in everything else from the parents, branch lengths and names */
+			void build(const std::vector<double> &distances);
+
+			std::vector<uint32_t> parents;
+			KBDepthMinima depthMinima;
+			std::vector<uint32_t> subtreeSizes;
+			std::vector<uint32_t> leafCounts;
+			std::vector<double> distancesToRoot;
+			std::vector<uint32_t> nameOffsets;     // the name of node i is namePool[nameOffsets[i],nameOffsets[i+1])
+			std::string namePool;
+			std::unordered_map<std::string_view,uint32_t> nodesByName;
+	};
+
+};
+
+#endif /* KBANCESTOR_HH_ */
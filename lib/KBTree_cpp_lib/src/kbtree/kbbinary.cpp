@@ -0,0 +1,376 @@
+/**
+ * @file kbbinary.cpp
+ * @brief Binary serialization of a KBTree
+ *
+ * Loading the binary form is deserialization, not use in place: the nodes of the KBTree are still created
+ * one by one, but from arrays indexed by the preorder rank of each node, in a single pass with no text to
+ * scan.  Only the label text is used in place: it sits in one string table at the end, and a tree loaded
+ * from a memory mapped file keeps views of it, the way fromFile keeps views of the mapped Newick text.  (A
+ * tree that is only read is smaller and quicker to build as a KBCompactTree or KBFrozenTree.)
+ *
+ * Numbers are written in the byte order of the machine, and all sections start at a multiple of 8 bytes:
+ *
+ *     header          magic "KBTREEBN", then uint32 version, byte order mark 0x01020304, flags, node count,
+ *                     comment count, string count, distance count, bootstrap count, bytes of string text,
+ *                     and 0 (48 bytes)
+ *     parents         uint32 per node: the preorder rank of its parent, or NONE at the top level
+ *     distance bits   one bit per node, set if it has a distance: node i is bit i%8 of byte i/8 (only if the
+ *                     distance count is not 0)
+ *     distances       double per node that has one, in preorder
+ *     bootstrap bits  as the distance bits, for the bootstrap values
+ *     bootstraps      double per node that has one, in preorder
+ *     names           uint32 per node: the string holding its name, or, with FLAG_ORIGINAL_LABELS, NAME_IS_PREFIX
+ *                     plus the length of the name if it is the start of the original label (as it usually is)
+ *     originals       uint32 per node: the string holding its original label (only with FLAG_ORIGINAL_LABELS)
+ *     comments        for each node with any comments, in preorder: uint32 node, then the strings holding its
+ *                     pre name, post name, pre distance and post distance comments
+ *     string offsets  uint32 per string plus one: string i is text[offsets[i],offsets[i+1])
+ *     text            the strings, back to back; string 0 is always the empty string
+ *
+ * A change to this layout must come with a new version number; older versions are rejected on loading.
+ */
+
+#include "kbtree.hh"
+#include <cmath>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <unistd.h>
+
+using namespace std;
+using namespace KBTreeLib;
+
+
+static const char BINARY_MAGIC[8] = { 'K','B','T','R','E','E','B','N' };
+static const uint32_t BINARY_VERSION = 2;
+static const uint32_t BYTE_ORDER_MARK = 0x01020304;
+static const uint32_t FLAG_ORIGINAL_LABELS = 1;
+static const uint32_t NONE = 0xffffffff;
+static const uint32_t NAME_IS_PREFIX = 0x80000000;
+static const size_t HEADER_BYTES = 48;
+
+static inline uint64_t padded(uint64_t bytes) { return (bytes+7) & ~(uint64_t)7; }
+/** bytes of the bits marking the nodes that have a value, if any of them do */
+static inline uint64_t bitsBytes(uint64_t nodeCount, uint64_t valueCount) { return valueCount==0 ? 0 : padded((nodeCount+7)/8); }
+
+/** the position and size of every section, from the counts in the header */
+struct BinaryLayout {
+	uint64_t parents, distanceBits, distances, bootstrapBits, bootstraps, names, originals, comments, offsets, text, end;
+
+	BinaryLayout(uint64_t nodeCount, uint64_t commentCount, uint64_t stringCount, uint64_t distanceCount, uint64_t bootstrapCount,
+	             uint64_t textBytes, bool withOriginals) {
+		parents = HEADER_BYTES;
+		distanceBits = parents + padded(4*nodeCount);
+		distances = distanceBits + bitsBytes(nodeCount,distanceCount);
+		bootstrapBits = distances + 8*distanceCount;
+		bootstraps = bootstrapBits + bitsBytes(nodeCount,bootstrapCount);
+		names = bootstraps + 8*bootstrapCount;
+		originals = names + padded(4*nodeCount);
+		comments = originals + (withOriginals ? padded(4*nodeCount) : 0);
+		offsets = comments + padded(20*commentCount);
+		text = offsets + padded(4*(stringCount+1));
+		end = text + textBytes;
+	}
+};
+
+// values are read with memcpy, which does not depend on how the data is aligned in memory
+static inline uint32_t readU32(const char *p) { uint32_t x; memcpy(&x,p,4); return x; }
+static inline uint64_t readU64(const char *p) { uint64_t x; memcpy(&x,p,8); return x; }
+static inline double readDouble(const char *p) { double x; memcpy(&x,p,8); return x; }
+
+static inline void writeU32(KBOutputSink &out, uint32_t x) { out.write((const char *)&x,4); }
+static inline void writeU64(KBOutputSink &out, uint64_t x) { out.write((const char *)&x,8); }
+static inline void writeDouble(KBOutputSink &out, double x) { out.write((const char *)&x,8); }
+static inline void writePadding(KBOutputSink &out, uint64_t bytes) {
+	for(uint64_t k=bytes; k<padded(bytes); k++) { out.put(0); }
+}
+static inline void writeArray(KBOutputSink &out, const std::vector<uint32_t> &values) {
+	if(!values.empty()) { out.write((const char *)values.data(),4*values.size()); }
+	writePadding(out,4*(uint64_t)values.size());
+}
+/** the bits marking the values that are not NAN, then those values; nothing at all if every value is NAN */
+static void writeOptionalValues(KBOutputSink &out, const std::vector<double> &values, uint32_t valueCount) {
+	if(valueCount==0) { return; }
+	std::string bits(padded((values.size()+7)/8),'\0');
+	for(size_t i=0; i<values.size(); i++) {
+		if(!std::isnan(values[i])) { bits[i/8] |= (char)(1<<(i%8)); }
+	}
+	out.write(bits);
+	for(size_t i=0; i<values.size(); i++) {
+		if(!std::isnan(values[i])) { writeDouble(out,values[i]); }
+	}
+}
+static uint32_t countValues(const std::vector<double> &values) {
+	uint32_t count = 0;
+	for(size_t i=0; i<values.size(); i++) { if(!std::isnan(values[i])) { count++; } }
+	return count;
+}
+
+
+/** numbers the label strings in the order they are added; all empty strings share string 0 */
+class BinaryStrings {
+	public:
+		BinaryStrings() : textBytes(0) { strings.push_back(std::string_view()); }
+		uint32_t add(std::string_view text) {
+			if(text.empty()) { return 0; }
+			strings.push_back(text);
+			textBytes+=text.size();
+			return (uint32_t)(strings.size()-1);
+		}
+		std::vector<std::string_view> strings;
+		uint64_t textBytes;
+};
+
+
+bool KBTree::writeBinary(KBOutputSink &out)
+{
+	// gather the arrays in preorder; the walk keeps the ranks of the ancestors of the current node
+	std::vector<uint32_t> parents, names, originals, comments;
+	std::vector<double> distances, bootstraps;
+	parents.reserve(nodeCount); names.reserve(nodeCount);
+	distances.reserve(nodeCount); bootstraps.reserve(nodeCount);
+	if(keepOriginalLabels) { originals.reserve(nodeCount); }
+	BinaryStrings strings;
+	std::vector<uint32_t> ancestors;
+	tree_node_<KBNode> *end = tr->end().node;
+	tree_node_<KBNode> *node = tr->begin().node;
+	while(node!=end) {
+		KBLabelText label = node->data.getLabelText(labelTable);
+		uint32_t rank = (uint32_t)parents.size();
+		parents.push_back(ancestors.empty() ? NONE : ancestors.back());
+		distances.push_back(label.distanceToParent);
+		bootstraps.push_back(label.bootstrapValue);
+		if(keepOriginalLabels) {
+			// the original label (the name followed by a distance, say) holds the text of the name as well
+			originals.push_back(strings.add(label.original_label));
+			const std::string_view &original = label.original_label;
+			if(!label.name.empty() && label.name.size()<NAME_IS_PREFIX && original.compare(0,label.name.size(),label.name)==0) {
+				names.push_back(NAME_IS_PREFIX|(uint32_t)label.name.size());
+			} else {
+				names.push_back(strings.add(label.name));
+			}
+		} else {
+			names.push_back(strings.add(label.name));
+		}
+		if(!label.pre_name_decoration.empty() || !label.post_name_decoration.empty() ||
+		   !label.pre_dist_decoration.empty() || !label.post_dist_decoration.empty()) {
+			comments.push_back(rank);
+			comments.push_back(strings.add(label.pre_name_decoration));
+			comments.push_back(strings.add(label.post_name_decoration));
+			comments.push_back(strings.add(label.pre_dist_decoration));
+			comments.push_back(strings.add(label.post_dist_decoration));
+		}
+		if(node->first_child!=NULL) {
+			ancestors.push_back(rank);
+			node = node->first_child;
+			continue;
+		}
+		// at the top level the next sibling is the end of the tree, never null
+		while(node->next_sibling==NULL) {
+			node = node->parent;
+			ancestors.pop_back();
+		}
+		node = node->next_sibling;
+	}
+
+	if(strings.textBytes>=NONE || strings.strings.size()>=NAME_IS_PREFIX) {
+		cerr<<"!!KBTREE ERROR-- THE LABELS OF THIS TREE ARE TOO LONG FOR THE BINARY FORM"<<endl;
+		return false;
+	}
+	const uint32_t count = (uint32_t)parents.size();
+	const uint32_t commentCount = (uint32_t)(comments.size()/5);
+	const uint32_t distanceCount = countValues(distances), bootstrapCount = countValues(bootstraps);
+	out.write(BINARY_MAGIC,sizeof(BINARY_MAGIC));
+	writeU32(out,BINARY_VERSION);
+	writeU32(out,BYTE_ORDER_MARK);
+	writeU32(out,keepOriginalLabels ? FLAG_ORIGINAL_LABELS : 0);
+	writeU32(out,count);
+	writeU32(out,commentCount);
+	writeU32(out,(uint32_t)strings.strings.size());
+	writeU32(out,distanceCount);
+	writeU32(out,bootstrapCount);
+	writeU32(out,(uint32_t)strings.textBytes);
+	writeU32(out,0);
+	writeArray(out,parents);
+	writeOptionalValues(out,distances,distanceCount);
+	writeOptionalValues(out,bootstraps,bootstrapCount);
+	writeArray(out,names);
+	if(keepOriginalLabels) { writeArray(out,originals); }
+	writeArray(out,comments);
+	std::vector<uint32_t> offsets;
+	offsets.reserve(strings.strings.size()+1);
+	offsets.push_back(0);
+	for(size_t s=0; s<strings.strings.size(); s++) { offsets.push_back(offsets.back()+(uint32_t)strings.strings[s].size()); }
+	writeArray(out,offsets);
+	// string 0 is empty, and has no text to write
+	for(size_t s=1; s<strings.strings.size(); s++) { out.write(strings.strings[s]); }
+	return true;
+}
+
+std::string KBTree::toBinary()
+{
+	std::string binary;
+	KBOutputSink out([&binary](const char *data, size_t length) { binary.append(data,length); });
+	if(!writeBinary(out)) { return ""; }
+	out.flush();
+	return binary;
+}
+
+bool KBTree::writeBinaryToFile(const std::string &filename)
+{
+	int fd = open(filename.c_str(),O_WRONLY|O_CREAT|O_TRUNC,0666);
+	if(fd<0) {
+		cerr<<"!!KBTREE ERROR-- CANNOT OPEN OUTPUT STREAM TO FILE: '"<<filename<<"'"<<endl;
+		return false;
+	}
+	KBOutputSink out(fd);
+	if(!writeBinary(out)) {
+		close(fd);
+		return false;
+	}
+	bool written = out.flush();
+	if(close(fd)!=0) { written=false; }
+	if(!written) {
+		cerr<<"!!KBTREE ERROR-- CANNOT WRITE TO FILE: '"<<filename<<"'"<<endl;
+	}
+	return written;
+}
+
+
+KBTree *KBTree::fromBinary(const std::string &binary)
+{
+	// the tree keeps a copy of the data, which its labels then point into
+	std::shared_ptr<std::string> copy = std::make_shared<std::string>(binary);
+	return fromBinaryData(*copy,copy);
+}
+
+KBTree *KBTree::fromBinaryFile(const std::string &filename)
+{
+	std::shared_ptr<KBMappedFile> file;
+	try {
+		file = std::make_shared<KBMappedFile>(filename);
+	} catch (ParseException& e) {
+		cerr<<"!!KBTREE ERROR-- "<<e.what()<<endl;
+		return NULL;
+	}
+	return fromBinaryData(file->getText(),file);
+}
+
+static void malformed(const std::string &problem) {
+	throw ParseException("Malformed binary tree: "+problem+".","KBTree::fromBinary()");
+}
+
+KBTree *KBTree::fromBinaryData(std::string_view data, std::shared_ptr<const void> owner)
+{
+	const char *buf = data.data();
+	if(data.size()<HEADER_BYTES || memcmp(buf,BINARY_MAGIC,sizeof(BINARY_MAGIC))!=0) { malformed("not a binary tree"); }
+	uint32_t version = readU32(buf+8);
+	if(readU32(buf+12)!=BYTE_ORDER_MARK) { malformed("written on a machine of a different byte order"); }
+	if(version!=BINARY_VERSION) { malformed("unsupported version "+std::to_string(version)); }
+	uint32_t flags = readU32(buf+16);
+	uint32_t count = readU32(buf+20);
+	uint32_t commentCount = readU32(buf+24);
+	uint32_t stringCount = readU32(buf+28);
+	uint32_t distanceCount = readU32(buf+32);
+	uint32_t bootstrapCount = readU32(buf+36);
+	uint32_t textBytes = readU32(buf+40);
+	bool withOriginals = (flags & FLAG_ORIGINAL_LABELS)!=0;
+	if((flags & ~FLAG_ORIGINAL_LABELS)!=0) { malformed("unknown flags"); }
+	if(count==NONE || stringCount==0 || stringCount>=NAME_IS_PREFIX || distanceCount>count || bootstrapCount>count || readU32(buf+44)!=0) {
+		malformed("bad counts");
+	}
+	BinaryLayout layout(count,commentCount,stringCount,distanceCount,bootstrapCount,textBytes,withOriginals);
+	if(layout.end!=data.size()) { malformed("the size does not match the header"); }
+
+	// check every string before anything refers to it, so that views of it stay within the data
+	std::vector<std::string_view> strings(stringCount);
+	uint32_t previous = readU32(buf+layout.offsets);
+	if(previous!=0) { malformed("bad string offsets"); }
+	for(uint32_t s=0; s<stringCount; s++) {
+		uint32_t next = readU32(buf+layout.offsets+4*((uint64_t)s+1));
+		if(next<previous || next>textBytes) { malformed("bad string offsets"); }
+		strings[s] = std::string_view(buf+layout.text+previous,next-previous);
+		previous = next;
+	}
+	if(previous!=textBytes || !strings[0].empty()) { malformed("bad string offsets"); }
+
+	KBTree *result = new KBTree();
+	try {
+		result->newickTextOwner = owner;
+		result->keepOriginalLabels = withOriginals;
+		// string s of the data becomes handle handles[s] of the label table, as a view of the data
+		std::vector<uint32_t> handles(stringCount);
+		handles[0] = KBStringTable::EMPTY;
+		result->labelTable.reserve(stringCount-1+(withOriginals ? count : 0));
+		for(uint32_t s=1; s<stringCount; s++) { handles[s] = result->labelTable.add(strings[s]); }
+		auto handleAt = [&](uint64_t position) {
+			uint32_t s = readU32(buf+position);
+			if(s>=stringCount) { malformed("a string number is out of range"); }
+			return handles[s];
+		};
+
+		// the next of the values that are present; a node without one keeps the NAN of a new KBNode
+		uint64_t nextDistance = 0, nextBootstrap = 0;
+		auto hasValue = [&](uint64_t bits, uint64_t valueCount, uint32_t i) {
+			return valueCount!=0 && (buf[bits+i/8] & (1<<(i%8)))!=0;
+		};
+
+		std::vector<KBNodeTree::iterator> nodes(count);
+		KBNodeTree::iterator lastTopLevel;
+		uint64_t nextComment = 0;
+		for(uint32_t i=0; i<count; i++) {
+			KBNode node(result->labelTable);
+			if(hasValue(layout.distanceBits,distanceCount,i)) {
+				if(nextDistance==distanceCount) { malformed("more distances are marked than stored"); }
+				node.distanceToParent = readDouble(buf+layout.distances+8*nextDistance++);
+			}
+			if(hasValue(layout.bootstrapBits,bootstrapCount,i)) {
+				if(nextBootstrap==bootstrapCount) { malformed("more bootstrap values are marked than stored"); }
+				node.bootstrapValue = readDouble(buf+layout.bootstraps+8*nextBootstrap++);
+			}
+			if(withOriginals) {
+				const uint32_t original = readU32(buf+layout.originals+4*(uint64_t)i);
+				node.original_label = handleAt(layout.originals+4*(uint64_t)i);
+				const uint32_t name = readU32(buf+layout.names+4*(uint64_t)i);
+				const uint32_t length = name & ~NAME_IS_PREFIX;
+				if((name & NAME_IS_PREFIX)==0) {
+					node.name = handleAt(layout.names+4*(uint64_t)i);
+				} else if(length==0 || length>strings[original].size()) {
+					malformed("a name is not the start of its original label");
+				} else if(length==strings[original].size()) {
+					node.name = node.original_label;
+				} else {
+					node.name = result->labelTable.add(strings[original].substr(0,length));
+				}
+			} else {
+				node.name = handleAt(layout.names+4*(uint64_t)i);
+			}
+			if(nextComment<commentCount && readU32(buf+layout.comments+20*nextComment)==i) {
+				uint64_t c = layout.comments+20*nextComment+4;
+				node.pre_name_decoration = handleAt(c);
+				node.post_name_decoration = handleAt(c+4);
+				node.pre_dist_decoration = handleAt(c+8);
+				node.post_dist_decoration = handleAt(c+12);
+				nextComment++;
+			}
+			// a parent always comes before its children, and appending keeps the sibling order
+			uint32_t parent = readU32(buf+layout.parents+4*(uint64_t)i);
+			if(parent!=NONE) {
+				if(parent>=i) { malformed("a node comes before its parent"); }
+				nodes[i] = result->tr->append_child(nodes[parent],node);
+			} else if(i==0) {
+				nodes[i] = lastTopLevel = result->tr->set_head(node);
+			} else {
+				nodes[i] = lastTopLevel = result->tr->insert_after(lastTopLevel,node);
+			}
+		}
+		if(nextComment!=commentCount) { malformed("comments are out of order"); }
+		if(nextDistance!=distanceCount || nextBootstrap!=bootstrapCount) { malformed("fewer values are marked than stored"); }
+		result->nodeCount = count;
+		result->resetBreadthFirstIterToRoot();
+	} catch (ParseException&) {
+		delete result;
+		throw;
+	}
+	return result;
+}
@@ -0,0 +1,175 @@
+/**
+ * @file kbcache.cpp
+ * @brief A bounded cache of frozen trees, keyed by a hash of their Newick text
+ */
+
+#include "kbcache.hh"
+#include <cstring>
+
+using namespace std;
+using namespace KBTreeLib;
+
+
+static inline uint64_t rotateLeft(uint64_t x, int bits) { return (x<<bits)|(x>>(64-bits)); }
+
+static inline uint64_t finalMix(uint64_t k) {
+	k ^= k>>33; k *= 0xff51afd7ed558ccdULL;
+	k ^= k>>33; k *= 0xc4ceb9fe1a85ec53ULL;
+	k ^= k>>33;
+	return k;
+}
+
+KBTextHash KBTreeLib::hashText(std::string_view text) {
+	const uint64_t c1 = 0x87c37b91114253d5ULL, c2 = 0x4cf5ad432745937fULL;
+	const unsigned char *data = (const unsigned char *)text.data();
+	const size_t length = text.size(), blocks = length/16;
+	uint64_t h1 = 0, h2 = 0;
+	for(size_t b=0; b<blocks; b++) {
+		uint64_t k1, k2;
+		memcpy(&k1,data+b*16,8);
+		memcpy(&k2,data+b*16+8,8);
+		k1 *= c1; k1 = rotateLeft(k1,31); k1 *= c2; h1 ^= k1;
+		h1 = rotateLeft(h1,27); h1 += h2; h1 = h1*5+0x52dce729;
+		k2 *= c2; k2 = rotateLeft(k2,33); k2 *= c1; h2 ^= k2;
+		h2 = rotateLeft(h2,31); h2 += h1; h2 = h2*5+0x38495ab5;
+	}
+	// the last 0 to 15 bytes, little endian
+	const unsigned char *tail = data+blocks*16;
+	const size_t rest = length&15;
+	uint64_t k1 = 0, k2 = 0;
+	for(size_t i=rest; i>8; i--) { k2 = (k2<<8)|tail[i-1]; }
+	for(size_t i=rest<8 ? rest : 8; i>0; i--) { k1 = (k1<<8)|tail[i-1]; }
+	if(rest>8) { k2 *= c2; k2 = rotateLeft(k2,33); k2 *= c1; h2 ^= k2; }
+	if(rest>0) { k1 *= c1; k1 = rotateLeft(k1,31); k1 *= c2; h1 ^= k1; }
+	h1 ^= length; h2 ^= length;
+	h1 += h2; h2 += h1;
+	h1 = finalMix(h1); h2 = finalMix(h2);
+	h1 += h2; h2 += h1;
+	KBTextHash hash;
+	hash.low = h1;
+	hash.high = h2;
+	return hash;
+}
+
+std::string KBTextHash::toString() const {
+	static const char digits[] = "0123456789abcdef";
+	std::string text(32,'0');
+	for(int i=0; i<16; i++) {
+		text[15-i] = digits[(high>>(4*i))&15];
+		text[31-i] = digits[(low>>(4*i))&15];
+	}
+	return text;
+}
+
+
+KBTreeCache::KBTreeCache(size_t memoryBudget) : memoryBudget(memoryBudget), memoryUsage(0), hits(0), misses(0), evictions(0) { }
+
+KBTreeCache::~KBTreeCache() { }
+
+KBTreeCache &KBTreeCache::getShared() {
+	static KBTreeCache shared;
+	return shared;
+}
+
+KBTreeCache::Key KBTreeCache::makeKey(const std::string &newickString, bool assumeBootstrapNames) {
+	Key key;
+	key.hash = hashText(newickString);
+	key.length = newickString.size();
+	key.assumeBootstrapNames = assumeBootstrapNames;
+	return key;
+}
+
+KBFrozenTree KBTreeCache::get(const std::string &newickString, bool assumeBootstrapNames) {
+	const Key key = makeKey(newickString,assumeBootstrapNames);
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		std::unordered_map<Key,std::list<Entry>::iterator,KeyHash>::iterator found = entriesByKey.find(key);
+		if(found!=entriesByKey.end()) {
+			hits++;
+			entries.splice(entries.begin(),entries,found->second);
+			return found->second->tree;
+		}
+		misses++;
+	}
+	KBFrozenTree tree(newickString,assumeBootstrapNames);
+	const size_t bytes = tree.getMemoryUsage();
+	std::lock_guard<std::mutex> guard(lock);
+	// another thread may have parsed the same text in the meantime
+	std::unordered_map<Key,std::list<Entry>::iterator,KeyHash>::iterator found = entriesByKey.find(key);
+	if(found!=entriesByKey.end()) {
+		entries.splice(entries.begin(),entries,found->second);
+		return found->second->tree;
+	}
+	if(bytes>memoryBudget) { return tree; }
+	evict(bytes);
+	Entry entry = { key, tree, bytes };
+	entries.push_front(entry);
+	entriesByKey[key] = entries.begin();
+	memoryUsage += bytes;
+	return tree;
+}
+
+bool KBTreeCache::contains(const std::string &newickString, bool assumeBootstrapNames) const {
+	const Key key = makeKey(newickString,assumeBootstrapNames);
+	std::lock_guard<std::mutex> guard(lock);
+	return entriesByKey.find(key)!=entriesByKey.end();
+}
+
+void KBTreeCache::evict(size_t bytes) {
+	while(!entries.empty() && memoryUsage+bytes>memoryBudget) {
+		memoryUsage -= entries.back().bytes;
+		entriesByKey.erase(entries.back().key);
+		entries.pop_back();
+		evictions++;
+	}
+}
+
+void KBTreeCache::clear() {
+	std::lock_guard<std::mutex> guard(lock);
+	entries.clear();
+	entriesByKey.clear();
+	memoryUsage = 0;
+}
+
+void KBTreeCache::setMemoryBudget(size_t bytes) {
+	std::lock_guard<std::mutex> guard(lock);
+	memoryBudget = bytes;
+	evict(0);
+}
+
+size_t KBTreeCache::getMemoryBudget() const {
+	std::lock_guard<std::mutex> guard(lock);
+	return memoryBudget;
+}
+
+size_t KBTreeCache::getMemoryUsage() const {
+	std::lock_guard<std::mutex> guard(lock);
+	return memoryUsage;
+}
+
+size_t KBTreeCache::getTreeCount() const {
+	std::lock_guard<std::mutex> guard(lock);
+	return entries.size();
+}
+
+uint64_t KBTreeCache::getHitCount() const {
+	std::lock_guard<std::mutex> guard(lock);
+	return hits;
+}
+
+uint64_t KBTreeCache::getMissCount() const {
+	std::lock_guard<std::mutex> guard(lock);
+	return misses;
+}
+
+uint64_t KBTreeCache::getEvictionCount() const {
+	std::lock_guard<std::mutex> guard(lock);
+	return evictions;
+}
+
+void KBTreeCache::resetCounters() {
+	std::lock_guard<std::mutex> guard(lock);
+	hits = 0;
+	misses = 0;
+	evictions = 0;
+}
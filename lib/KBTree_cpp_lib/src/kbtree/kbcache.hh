@@ -0,0 +1,117 @@
+/**
+ * @file kbcache.hh
+ * @brief A bounded cache of frozen trees, keyed by a hash of their Newick text
+ *
+ * A service that is asked about the same stored trees again and again spends most of its time parsing the
+ * same Newick text.  A KBTreeCache keeps the trees it has parsed as KBFrozenTree snapshots, looked up by a
+ * 128 bit hash of the text and the parse flags, so a repeated request costs one pass of the hash over the
+ * text instead of a parse.  The snapshots are immutable and shared, so the same tree can be handed to any
+ * number of threads at once.
+ *
+ * The cache holds at most its memory budget of snapshots (as measured by KBFrozenTree::getMemoryUsage),
+ * dropping the least recently used when a new one does not fit; a tree that is over the budget by itself
+ * is parsed and returned, but not kept.  A dropped snapshot lives on for as long as someone holds a handle
+ * to it.  Every method may be called from any thread.  Parsing is done outside of the lock, so one slow parse
+ * holds up no other lookups; if two threads miss on the same text at once, both parse it, and the second
+ * to finish gets the snapshot of the first.
+ *
+ * The text is not kept, so two texts with the same length and hash would share a tree; with a 128 bit hash
+ * that is too unlikely to matter.
+ */
+
+#ifndef KBCACHE_HH_
+#define KBCACHE_HH_
+
+#include "kbfrozen.hh"
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace KBTreeLib {
+
+	/** a 128 bit hash of some text (MurmurHash3, x64 128 bit variant, seed 0) */
+	struct KBTextHash {
+		uint64_t low;
+		uint64_t high;
+
+		bool operator==(const KBTextHash &other) const { return low==other.low && high==other.high; };
+		bool operator!=(const KBTextHash &other) const { return !(*this==other); };
+		/** 32 lower case hexadecimal digits, high half first */
+		std::string toString() const;
+	};
+	KBTextHash hashText(std::string_view text);
+
+	class KBTreeCache
+	{
+		public:
+			static const size_t DEFAULT_MEMORY_BUDGET = (size_t)256<<20;
+
+			explicit KBTreeCache(size_t memoryBudget=DEFAULT_MEMORY_BUDGET);
+			~KBTreeCache();
+
+			/** the cache shared by the whole process, created with the default budget on first use */
+			static KBTreeCache &getShared();
+
+			/** the tree of the Newick string, parsed as KBFrozenTree(newickString,assumeBootstrapNames) if it is
+			 * not cached.  A parse error is thrown as by the KBTree constructor, and nothing is cached. */
+			KBFrozenTree get(const std::string &newickString, bool assumeBootstrapNames=false);
+			/** true if the tree is cached, without counting a hit or miss or changing the order of use */
+			bool contains(const std::string &newickString, bool assumeBootstrapNames=false) const;
+			/** drop every tree; the counters are kept */
+			void clear();
+
+			/** change the budget, dropping the least recently used trees until the rest fit */
+			void setMemoryBudget(size_t bytes);
+			size_t getMemoryBudget() const;
+			/** bytes of the cached snapshots */
+			size_t getMemoryUsage() const;
+			size_t getTreeCount() const;
+
+			// lookups that found a cached tree, lookups that parsed one, and trees dropped to fit the budget
+			uint64_t getHitCount() const;
+			uint64_t getMissCount() const;
+			uint64_t getEvictionCount() const;
+			void resetCounters();
+
+		private:
+			KBTreeCache(const KBTreeCache &);
+			KBTreeCache &operator=(const KBTreeCache &);
+
+			struct Key {
+				KBTextHash hash;
+				size_t length;
+				bool assumeBootstrapNames;
+
+				bool operator==(const Key &other) const {
+					return hash==other.hash && length==other.length && assumeBootstrapNames==other.assumeBootstrapNames;
+				};
+			};
+			struct KeyHash {
+				size_t operator()(const Key &key) const { return (size_t)key.hash.low; };
+			};
+			struct Entry {
+				Key key;
+				KBFrozenTree tree;
+				size_t bytes;
+			};
+
+			static Key makeKey(const std::string &newickString, bool assumeBootstrapNames);
+			/** drop the least recently used trees until bytes more fit; the lock must be held */
+			void evict(size_t bytes);
+
+			mutable std::mutex lock;
+			/** most recently used first */
+			std::list<Entry> entries;
+			std::unordered_map<Key,std::list<Entry>::iterator,KeyHash> entriesByKey;
+			size_t memoryBudget;
+			size_t memoryUsage;
+			uint64_t hits;
+			uint64_t misses;
+			uint64_t evictions;
+	};
+
+};
+
+#endif /* KBCACHE_HH_ */
@@ -0,0 +1,252 @@
+/**
+ * @file kbcompact.cpp
+ * @brief Compact, array based representation of a KBTree
+ */
+
+#include "kbcompact.hh"
+#include <algorithm>
+
+using namespace std;
+using namespace KBTreeLib;
+
+
+KBCompactTree::KBCompactTree(KBTree &source, bool keepOriginalLabels) {
+	build(source,keepOriginalLabels && source.keepOriginalLabels);
+}
+
+KBCompactTree::KBCompactTree(const std::string &newickString, bool assumeBootstrapNames, bool keepOriginalLabels) {
+	// only the structure is built up front; each label is decoded once, as it is copied out
+	KBTree source(newickString,false,assumeBootstrapNames,1,true,keepOriginalLabels);
+	build(source,keepOriginalLabels);
+}
+
+KBCompactTree::~KBCompactTree() { }
+
+void KBCompactTree::build(KBTree &source, bool keepOriginalLabels)
+{
+	this->with_labels=true;
+	this->with_distances=true;
+	this->with_comments=true;
+	this->with_bootstrap_values_as_labels=true;
+	this->output_precision=DEFAULT_OUTPUT_PRECISION;
+	this->leafCount=0;
+
+	const size_t n = source.tr->size();
+	if(n>=NONE) { throw ParseException("Tree has too many nodes for a KBCompactTree.","KBCompactTree::KBCompactTree()"); }
+	parents.reserve(n);
+	firstChildren.reserve(n);
+	nextSiblings.reserve(n);
+	distances.reserve(n);
+	bootstrapValues.reserve(n);
+	nameOffsets.reserve(n+1);
+	nameOffsets.push_back(0);
+	if(keepOriginalLabels) {
+		originalOffsets.reserve(n+1);
+		originalOffsets.push_back(0);
+	}
+
+	// The preorder walk numbers the nodes.  The ancestors of the current node are kept on a stack, so the
+	// parent of each node is found by popping back to it, and the last child seen of every ancestor is
+	// remembered so that it can be linked to its next sibling.
+	typedef tree_node_<KBNode> TreeNode;
+	struct Ancestor { const TreeNode *node; uint32_t index; uint32_t lastChild; };
+	std::vector<Ancestor> ancestors;
+	uint32_t lastTopLevel = NONE;
+	for(KBNodeTree::pre_order_iterator it=source.tr->begin(); it!=source.tr->end(); ++it) {
+		const TreeNode *node = it.node;
+		while(!ancestors.empty() && ancestors.back().node!=node->parent) { ancestors.pop_back(); }
+		const uint32_t index = (uint32_t)parents.size();
+		uint32_t &previousSibling = ancestors.empty() ? lastTopLevel : ancestors.back().lastChild;
+		if(previousSibling!=NONE) { nextSiblings[previousSibling]=index; }
+		else if(!ancestors.empty()) { firstChildren[ancestors.back().index]=index; }
+		previousSibling = index;
+
+		parents.push_back(ancestors.empty() ? NONE : ancestors.back().index);
+		firstChildren.push_back(NONE);
+		nextSiblings.push_back(NONE);
+		if(node->first_child==NULL) { leafCount++; }
+		else { ancestors.push_back(Ancestor{ node, index, NONE }); }
+
+		const KBLabelText label = node->data.getLabelText(source.labelTable);
+		distances.push_back(label.distanceToParent);
+		bootstrapValues.push_back(label.bootstrapValue);
+		namePool.append(label.name);
+		if(namePool.size()>=NONE) { throw ParseException("Tree has too much name text for a KBCompactTree.","KBCompactTree::KBCompactTree()"); }
+		nameOffsets.push_back((uint32_t)namePool.size());
+		if(keepOriginalLabels) {
+			originalPool.append(label.original_label);
+			if(originalPool.size()>=NONE) { throw ParseException("Tree has too much label text for a KBCompactTree.","KBCompactTree::KBCompactTree()"); }
+			originalOffsets.push_back((uint32_t)originalPool.size());
+		}
+		if(!label.pre_name_decoration.empty() || !label.post_name_decoration.empty() ||
+		   !label.pre_dist_decoration.empty() || !label.post_dist_decoration.empty()) {
+			comments.push_back(NodeComments{ index, std::string(label.pre_name_decoration), std::string(label.post_name_decoration),
+				std::string(label.pre_dist_decoration), std::string(label.post_dist_decoration) });
+		}
+	}
+	namePool.shrink_to_fit();
+	originalPool.shrink_to_fit();
+}
+
+size_t KBCompactTree::getMemoryUsage() const
+{
+	size_t bytes = sizeof(KBCompactTree);
+	bytes += parents.capacity()*sizeof(uint32_t) + firstChildren.capacity()*sizeof(uint32_t) + nextSiblings.capacity()*sizeof(uint32_t);
+	bytes += distances.capacity()*sizeof(double) + bootstrapValues.capacity()*sizeof(double);
+	bytes += nameOffsets.capacity()*sizeof(uint32_t) + namePool.capacity();
+	bytes += originalOffsets.capacity()*sizeof(uint32_t) + originalPool.capacity();
+	bytes += comments.capacity()*sizeof(NodeComments);
+	for(size_t c=0; c<comments.size(); c++) {
+		bytes += comments[c].preName.capacity() + comments[c].postName.capacity() + comments[c].preDist.capacity() + comments[c].postDist.capacity();
+	}
+	return bytes;
+}
+
+void KBCompactTree::getLabel(uint32_t node, KBLabelText &label) const
+{
+	label.original_label = getOriginalLabel(node);
+	label.name = getName(node);
+	label.distanceToParent = distances[node];
+	label.bootstrapValue = bootstrapValues[node];
+	std::vector<NodeComments>::const_iterator c = std::lower_bound(comments.begin(),comments.end(),node,
+		[](const NodeComments &entry, uint32_t node) { return entry.node<node; });
+	if(c!=comments.end() && c->node==node) {
+		label.pre_name_decoration = c->preName;
+		label.post_name_decoration = c->postName;
+		label.pre_dist_decoration = c->preDist;
+		label.post_dist_decoration = c->postDist;
+	} else {
+		label.pre_name_decoration = std::string_view();
+		label.post_name_decoration = std::string_view();
+		label.pre_dist_decoration = std::string_view();
+		label.post_dist_decoration = std::string_view();
+	}
+}
+
+
+KBTree *KBCompactTree::toKBTree() const
+{
+	KBTree *result = new KBTree();
+	std::vector<KBNodeTree::iterator> nodes(parents.size());
+	KBNodeTree::iterator lastTopLevel;
+	for(uint32_t i=0; i<parents.size(); i++) {
+		// the new tree owns copies of all label text
+		KBLabelText text;
+		getLabel(i,text);
+		KBStringTable &labels = result->labelTable;
+		KBLabelArena &arena = result->labelArena;
+		KBNode label(labels);
+		label.original_label = labels.intern(text.original_label,arena);
+		label.name = labels.intern(text.name,arena);
+		label.distanceToParent = text.distanceToParent;
+		label.bootstrapValue = text.bootstrapValue;
+		label.pre_name_decoration = labels.intern(text.pre_name_decoration,arena);
+		label.post_name_decoration = labels.intern(text.post_name_decoration,arena);
+		label.pre_dist_decoration = labels.intern(text.pre_dist_decoration,arena);
+		label.post_dist_decoration = labels.intern(text.post_dist_decoration,arena);
+		// children come after their parent and their elder siblings, so appending keeps sibling order
+		if(parents[i]!=NONE) { nodes[i] = result->tr->append_child(nodes[parents[i]],label); }
+		else if(i==0) { nodes[i] = lastTopLevel = result->tr->set_head(label); }
+		else { nodes[i] = lastTopLevel = result->tr->insert_after(lastTopLevel,label); }
+	}
+	result->nodeCount = (unsigned int)parents.size();
+	result->keepOriginalLabels = keepsOriginalLabels();
+	result->resetBreadthFirstIterToRoot();
+	return result;
+}
+
+
+std::string KBCompactTree::getAllLeafNames() const
+{
+	std::string leafNames="";
+	for(uint32_t i=0; i<parents.size(); i++) {
+		if(isLeaf(i) && nameOffsets[i+1]>nameOffsets[i]) { leafNames += getName(i); leafNames+=";"; }
+	}
+	return leafNames;
+}
+void KBCompactTree::getAllLeafNames(std::vector<std::string> &names) const {
+	names.reserve(leafCount);
+	for(uint32_t i=0; i<parents.size(); i++) {
+		if(isLeaf(i) && nameOffsets[i+1]>nameOffsets[i]) { names.push_back(std::string(getName(i))); }
+	}
+}
+
+/** visit the nodes in post order, which needs no stack: after a node comes the deepest first descendant of its
+ * next sibling, or if there is none, its parent */
+template <class Visitor>
+static void visitPostOrder(const KBCompactTree &compact, Visitor visit) {
+	if(compact.getNodeCount()==0) { return; }
+	uint32_t node = 0;
+	while(!compact.isLeaf(node)) { node=compact.getFirstChild(node); }
+	while(true) {
+		visit(node);
+		if(compact.getNextSibling(node)!=KBCompactTree::NONE) {
+			node = compact.getNextSibling(node);
+			while(!compact.isLeaf(node)) { node=compact.getFirstChild(node); }
+		} else if(compact.getParent(node)!=KBCompactTree::NONE) {
+			node = compact.getParent(node);
+		} else {
+			return;
+		}
+	}
+}
+
+std::string KBCompactTree::getAllNodeNames() const
+{
+	std::string nodeNames="";
+	visitPostOrder(*this,[&](uint32_t node) {
+		std::string_view name = getName(node);
+		if(name.size()>0) { nodeNames += name; nodeNames+=";"; }
+	});
+	return nodeNames;
+}
+void KBCompactTree::getAllNodeNames(std::vector<std::string> &names) const {
+	names.reserve(parents.size());
+	visitPostOrder(*this,[&](uint32_t node) {
+		std::string_view name = getName(node);
+		if(name.size()>0) { names.push_back(std::string(name)); }
+	});
+}
+
+
+std::string KBCompactTree::toNewick() const {
+	std::string newickString;
+	KBOutputSink out([&newickString](const char *data, size_t length) { newickString.append(data,length); });
+	writeNewick(out,false,0);
+	out.flush();
+	return newickString;
+}
+
+std::string KBCompactTree::toNewick(unsigned int style) const {
+	std::string newickString;
+	KBOutputSink out([&newickString](const char *data, size_t length) { newickString.append(data,length); });
+	writeNewick(out,style);
+	out.flush();
+	return newickString;
+}
+
+void KBCompactTree::writeNewick(KBOutputSink &out) const { writeNewick(out,false,0); }
+void KBCompactTree::writeNewick(KBOutputSink &out, unsigned int style) const {
+	if(style==KBNode::ORIGINAL_LABEL && !keepsOriginalLabels()) { style=KBNode::NAME_DISTANCE_AND_COMMENTS; }
+	writeNewick(out,true,style);
+}
+
+void KBCompactTree::writeNewick(KBOutputSink &out, bool useStyle, unsigned int style) const
+{
+	// the same walk as KBTree::writeNewick, over the index arrays instead of the node links
+	if(parents.empty()) { return; }
+	KBLabelText label;
+	uint32_t node = 0;
+	while(true) {
+		while(!isLeaf(node)) { out.put('('); node=firstChildren[node]; }
+		while(true) {
+			getLabel(node,label);
+			if(useStyle) { KBNode::writeLabel(out,label,style,output_precision); }
+			else { KBNode::writeLabel(out,label,with_labels,with_distances,with_comments,with_bootstrap_values_as_labels,output_precision); }
+			if(nextSiblings[node]!=NONE) { out.put(','); node=nextSiblings[node]; break; }
+			if(parents[node]==NONE) { out.put(';'); return; }
+			out.put(')');
+			node = parents[node];
+		}
+	}
+}
@@ -0,0 +1,136 @@
+/**
+ * @file kbcompact.hh
+ * @brief Compact, array based representation of a KBTree
+ *
+ * A KBTree keeps every node in a tree.hh node: five pointers for the tree structure plus a
+ * KBNode, which is mostly handles into the tree's label string table, for close to 90 bytes per node
+ * before the table itself, linked by pointers.
+ * A KBCompactTree stores the same tree as a handful of parallel arrays indexed by the preorder rank of
+ * each node - 32 bit parent, first child and next sibling indices, dense distance and bootstrap value
+ * arrays, and offsets into a single pool holding all of the names - for about 32 bytes per node plus the
+ * name text.  Traversals then walk contiguous memory.
+ *
+ * The original label text of each node is only kept if asked for, in a second pool of the same kind.
+ */
+
+#ifndef KBCOMPACT_HH_
+#define KBCOMPACT_HH_
+
+#include "kbtree.hh"
+#include <cstdint>
+
+namespace KBTreeLib {
+
+	/**
+	 * Read only, array based copy of a KBTree, for holding and querying many or large trees in less memory.
+	 * It is not a storage backend of KBTree: KBTree methods still work on tree.hh nodes, and a compact tree
+	 * answers only the queries and output declared here.  The editing operations of KBTree (removing,
+	 * renaming and merging nodes) are not available on it.  To edit one, toKBTree() builds a complete KBTree
+	 * again, interning every label into a new string table; that takes time linear in the number of nodes
+	 * and, until the compact tree is deleted, the memory of both forms.  After the edits, the KBCompactTree
+	 * constructor copies the result back, which is another linear pass.  Trees that are edited often are
+	 * best kept as KBTree objects.
+	 */
+	class KBCompactTree
+	{
+		public:
+			/** index returned when a node has no parent, child or sibling */
+			static constexpr uint32_t NONE = 0xffffffff;
+
+			/** copy the tree into compact form; the KBTree can be deleted afterwards.  With keepOriginalLabels, the
+			 * original labels are copied as well, if the tree keeps them */
+			KBCompactTree(KBTree &tree, bool keepOriginalLabels=false);
+			/** parse the Newick string (as KBTree(newickString,false,assumeBootstrapNames) would) into compact form */
+			KBCompactTree(const std::string &newickString, bool assumeBootstrapNames=false, bool keepOriginalLabels=false);
+			~KBCompactTree();
+
+			/** create an editable KBTree with the same nodes; the caller owns (and must delete) the returned tree.
+			 * It keeps the original labels if this tree does */
+			KBTree *toKBTree() const;
+
+			unsigned int getNodeCount() const { return (unsigned int)parents.size(); };
+			unsigned int getLeafCount() const { return leafCount; };
+			/** bytes held by this tree, including its name pool and comments */
+			size_t getMemoryUsage() const;
+
+			// Nodes are identified by their preorder index; the root is node 0.  A malformed Newick string can
+			// give the root siblings, which are then the other nodes without a parent.
+			uint32_t getParent(uint32_t node) const { return parents[node]; };
+			uint32_t getFirstChild(uint32_t node) const { return firstChildren[node]; };
+			uint32_t getNextSibling(uint32_t node) const { return nextSiblings[node]; };
+			bool isLeaf(uint32_t node) const { return firstChildren[node]==NONE; };
+			std::string_view getName(uint32_t node) const {
+				return std::string_view(namePool.data()+nameOffsets[node],nameOffsets[node+1]-nameOffsets[node]);
+			};
+			/** true if the original label text of the nodes is kept */
+			bool keepsOriginalLabels() const { return !originalOffsets.empty(); };
+			/** the label of the node as it was parsed, or an empty string if original labels are not kept */
+			std::string_view getOriginalLabel(uint32_t node) const {
+				if(originalOffsets.empty()) { return std::string_view(); }
+				return std::string_view(originalPool.data()+originalOffsets[node],originalOffsets[node+1]-originalOffsets[node]);
+			};
+			double getDistanceToParent(uint32_t node) const { return distances[node]; };
+			double getBootstrapValue(uint32_t node) const { return bootstrapValues[node]; };
+
+			/** same as KBTree::getAllLeafNames, leaves in the same order */
+			std::string getAllLeafNames() const;
+			void getAllLeafNames(std::vector<std::string> &names) const;
+			/** same as KBTree::getAllNodeNames, nodes in the same (post) order */
+			std::string getAllNodeNames() const;
+			void getAllNodeNames(std::vector<std::string> &names) const;
+
+			void setOutputFlagLabel(bool flag) { with_labels=flag; };
+			void setOutputFlagDistances(bool flag) { with_distances=flag; };
+			void setOutputFlagComments(bool flag) { with_comments=flag; };
+			void setOutputFlagBootstrapValuesAsLabels(bool flag) { with_bootstrap_values_as_labels=flag; };
+			void setOutputPrecision(int precision) { output_precision=precision; };
+
+			/** same output as KBTree::toNewick() with the same output flags */
+			std::string toNewick() const;
+			/** same output as KBTree::toNewick(style); if original labels are not kept, ORIGINAL_LABEL writes
+			 * NAME_DISTANCE_AND_COMMENTS, as for a KBTree that does not keep them */
+			std::string toNewick(unsigned int style) const;
+			/** as KBTree::writeNewick, the same text as toNewick() and toNewick(style) written to the sink */
+			void writeNewick(KBOutputSink &out) const;
+			void writeNewick(KBOutputSink &out, unsigned int style) const;
+
+		private:
+			KBCompactTree(const KBCompactTree &);
+			KBCompactTree &operator=(const KBCompactTree &);
+
+			/** the comments of one node; most nodes have none, so these are kept apart, ordered by node */
+			struct NodeComments {
+				uint32_t node;
+				std::string preName;
+				std::string postName;
+				std::string preDist;
+				std::string postDist;
+			};
+
+			void build(KBTree &tree, bool keepOriginalLabels);
+			void writeNewick(KBOutputSink &out, bool useStyle, unsigned int style) const;
+			/** the node's label, for writing it with KBNode::writeLabel */
+			void getLabel(uint32_t node, KBLabelText &label) const;
+
+			std::vector<uint32_t> parents;
+			std::vector<uint32_t> firstChildren;
+			std::vector<uint32_t> nextSiblings;
+			std::vector<double> distances;
+			std::vector<double> bootstrapValues;
+			std::vector<uint32_t> nameOffsets;  // the name of node i is namePool[nameOffsets[i],nameOffsets[i+1])
+			std::string namePool;
+			std::vector<uint32_t> originalOffsets;  // as nameOffsets, for the original labels; empty if they are not kept
+			std::string originalPool;
+			std::vector<NodeComments> comments;
+			unsigned int leafCount;
+
+			bool with_labels;
+			bool with_distances;
+			bool with_comments;
+			bool with_bootstrap_values_as_labels;
+			int output_precision;
+	};
+
+};
+
+#endif /* KBCOMPACT_HH_ */
@@ -0,0 +1,114 @@
+/**
+ * @file kbcursor.cpp
+ * @brief Traversal cursors that keep their own position in a KBTree
+ */
+
+#include "kbcursor.hh"
+#include <cmath>
+
+using namespace std;
+using namespace KBTreeLib;
+
+
+KBTreeCursor::KBTreeCursor(const KBTree &tree, unsigned int order) : tree(tree), order(order), node(NULL), head(0) {
+	if(order>LEAVES) {
+		cerr<<"!!KBTREE ERROR-- UNKNOWN TRAVERSAL ORDER: "<<order<<endl;
+		return;
+	}
+	reset();
+}
+
+KBTreeCursor::~KBTreeCursor() { }
+
+void KBTreeCursor::reset() {
+	const KBNodeTree *tr = tree.tr.get();
+	node = NULL;
+	queue.clear();
+	head = 0;
+	if(tr->begin()==tr->end()) { return; }
+	switch(order) {
+		case PREORDER: node = tr->begin().node; break;
+		case POSTORDER: node = tr->begin_post().node; break;
+		case LEAVES: node = tr->begin_leaf().node; break;
+		case BREADTH_FIRST:
+			node = tr->begin().node;
+			for(TreeNode *child=node->first_child; child!=NULL; child=child->next_sibling) { queue.push_back(child); }
+			break;
+	}
+}
+
+bool KBTreeCursor::next() {
+	if(node==NULL) { return false; }
+	const KBNodeTree *tr = tree.tr.get();
+	switch(order) {
+		case PREORDER: {
+			KBNodeTree::pre_order_iterator it(node);
+			++it;
+			node = it==tr->end() ? NULL : it.node;
+			break;
+		}
+		case POSTORDER: {
+			KBNodeTree::post_order_iterator it(node);
+			++it;
+			node = it==tr->end_post() ? NULL : it.node;
+			break;
+		}
+		case LEAVES: {
+			KBNodeTree::leaf_iterator it(node);
+			++it;
+			node = it==tr->end_leaf() ? NULL : it.node;
+			break;
+		}
+		case BREADTH_FIRST:
+			if(head==queue.size()) {
+				node = NULL;
+				break;
+			}
+			node = queue[head++];
+			// drop the visited front of the queue once it is the larger part, so it holds about two levels
+			if(head>=1024 && 2*head>=queue.size()) {
+				queue.erase(queue.begin(),queue.begin()+head);
+				head = 0;
+			}
+			for(TreeNode *child=node->first_child; child!=NULL; child=child->next_sibling) { queue.push_back(child); }
+			break;
+	}
+	return node!=NULL;
+}
+
+std::string KBTreeCursor::getName() const {
+	if(node==NULL) { return ""; }
+	KBLabelText label;
+	node->data.readLabelText(tree.labelTable,label);
+	return std::string(label.name);
+}
+
+std::string KBTreeCursor::getParentName() const {
+	if(node==NULL || node->parent==NULL) { return ""; }
+	KBLabelText label;
+	node->parent->data.readLabelText(tree.labelTable,label);
+	return std::string(label.name);
+}
+
+double KBTreeCursor::getDistanceToParent() const {
+	if(node==NULL) { return NAN; }
+	KBLabelText label;
+	node->data.readLabelText(tree.labelTable,label);
+	return label.distanceToParent;
+}
+
+double KBTreeCursor::getBootstrapValue() const {
+	if(node==NULL) { return NAN; }
+	KBLabelText label;
+	node->data.readLabelText(tree.labelTable,label);
+	return label.bootstrapValue;
+}
+
+bool KBTreeCursor::isLeaf() const {
+	return node!=NULL && node->first_child==NULL;
+}
+
+unsigned int KBTreeCursor::getNodeId() const {
+	if(node==NULL || !tree.isValidNodeId(node->data.derivedIndex)) { return KBTree::NO_NODE_ID; }
+	return node->data.derivedIndex;
+}
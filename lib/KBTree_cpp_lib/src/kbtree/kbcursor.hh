@@ -0,0 +1,72 @@
+/**
+ * @file kbcursor.hh
+ * @brief Traversal cursors that keep their own position in a KBTree
+ *
+ * The breadth first iterator of a KBTree is part of the tree, so only one caller at a time can use it.  A
+ * KBTreeCursor holds its position itself, and only ever reads the tree: any number of cursors, on any
+ * number of threads, can walk one tree at once without locks, as long as nothing edits the tree (or calls
+ * one of its methods that may change it, such as the first name lookup, which builds the name index)
+ * while they do.  Labels that have not been decoded yet are read without storing the result, so a tree
+ * parsed with lazy labels can be shared too.
+ *
+ * A preorder, postorder or leaf cursor is a single node pointer, and moves as the iterators of the tree
+ * do.  A breadth first cursor also keeps its own queue of the nodes it has still to visit (at most about
+ * two levels of the tree), and walks the first top level tree as breadthFirstIterNext does.
+ */
+
+#ifndef KBCURSOR_HH_
+#define KBCURSOR_HH_
+
+#include "kbtree.hh"
+#include <cstdint>
+#include <vector>
+
+namespace KBTreeLib {
+
+	class KBTreeCursor
+	{
+		public:
+			/** orders of a cursor: every node before its children; every node after its children (the order
+			 * of getAllNodeNames); every node of the first top level tree level by level; only the leaves */
+			static const unsigned int PREORDER = 0;
+			static const unsigned int POSTORDER = 1;
+			static const unsigned int BREADTH_FIRST = 2;
+			static const unsigned int LEAVES = 3;
+
+			/** a cursor at the first node of the tree in the order, which must outlive it; an unknown order is
+			 * reported, and gives a cursor that is always at the end */
+			KBTreeCursor(const KBTree &tree, unsigned int order=PREORDER);
+			~KBTreeCursor();
+
+			unsigned int getOrder() const { return order; };
+			/** go back to the first node */
+			void reset();
+			/** move to the next node, returning false (and staying at the end) if there is none */
+			bool next();
+			bool isAtEnd() const { return node==NULL; };
+
+			// the node of the cursor; at the end these give the empty string, NAN, false and NO_NODE_ID
+			std::string getName() const;
+			/** the name of the parent, or the empty string for a top level node */
+			std::string getParentName() const;
+			double getDistanceToParent() const;
+			double getBootstrapValue() const;
+			bool isLeaf() const;
+			/** the ID of the node (see KBTree::buildNodeIds), or KBTree::NO_NODE_ID if the IDs are not built */
+			unsigned int getNodeId() const;
+
+		private:
+			typedef tree_node_<KBNode> TreeNode;
+
+			const KBTree &tree;
+			unsigned int order;
+			/** NULL at the end; the node tree is never changed through it */
+			TreeNode *node;
+			/** breadth first only: the nodes still to visit after node are queue[head...] */
+			std::vector<TreeNode *> queue;
+			size_t head;
+	};
+
+};
+
+#endif /* KBCURSOR_HH_ */
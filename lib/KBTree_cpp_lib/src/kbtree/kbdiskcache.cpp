@@ -0,0 +1,223 @@
+/**
+ * @file kbdiskcache.cpp
+ * @brief A directory of binary tree images, keyed by a hash of their Newick text
+ */
+
+#include "kbdiskcache.hh"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <vector>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+using namespace KBTreeLib;
+
+
+const char *const KBTreeDiskCache::IMAGE_SUFFIX = ".kbtree";
+static const char *const TEMPORARY_SUFFIX = ".tmp";
+/** a temporary file this old was left by a writer that died */
+static const time_t ABANDONED_SECONDS = 3600;
+
+static bool endsWith(const std::string &text, const char *suffix) {
+	const size_t length = strlen(suffix);
+	return text.size()>length && text.compare(text.size()-length,length,suffix)==0;
+}
+
+/** a file in the cache directory */
+struct ImageFile {
+	std::string path;
+	uint64_t bytes;
+	struct timespec modified;
+
+	bool operator<(const ImageFile &other) const {
+		if(modified.tv_sec!=other.modified.tv_sec) { return modified.tv_sec<other.modified.tv_sec; }
+		return modified.tv_nsec<other.modified.tv_nsec;
+	};
+};
+
+/** the images in the directory; abandoned temporary files are removed on the way if asked */
+static void listImages(const std::string &directory, std::vector<ImageFile> &images, bool removeAbandoned) {
+	DIR *dir = opendir(directory.c_str());
+	if(dir==NULL) { return; }
+	const time_t now = time(NULL);
+	for(struct dirent *entry=readdir(dir); entry!=NULL; entry=readdir(dir)) {
+		const std::string name = entry->d_name;
+		const bool image = endsWith(name,KBTreeDiskCache::IMAGE_SUFFIX);
+		if(!image && !(removeAbandoned && endsWith(name,TEMPORARY_SUFFIX))) { continue; }
+		ImageFile file;
+		file.path = directory+"/"+name;
+		struct stat status;
+		// another process may have removed it already
+		if(stat(file.path.c_str(),&status)!=0 || !S_ISREG(status.st_mode)) { continue; }
+		if(!image) {
+			if(now-status.st_mtime>ABANDONED_SECONDS) { unlink(file.path.c_str()); }
+			continue;
+		}
+		file.bytes = (uint64_t)status.st_size;
+		file.modified = status.st_mtim;
+		images.push_back(file);
+	}
+	closedir(dir);
+}
+
+
+KBTreeDiskCache::KBTreeDiskCache(const std::string &directory, uint64_t sizeLimit) :
+	directory(directory), usable(true), sizeLimit(sizeLimit), diskUsage(0), hits(0), misses(0), evictions(0), temporaryCount(0)
+{
+	struct stat status;
+	if(mkdir(directory.c_str(),0777)!=0 && errno!=EEXIST) { usable=false; }
+	else if(stat(directory.c_str(),&status)!=0 || !S_ISDIR(status.st_mode)) { usable=false; }
+	if(!usable) {
+		cerr<<"!!KBTREE ERROR-- CANNOT CREATE CACHE DIRECTORY: '"<<directory<<"'"<<endl;
+		return;
+	}
+	diskUsage = getDiskUsage();
+}
+
+KBTreeDiskCache::~KBTreeDiskCache() { }
+
+std::string KBTreeDiskCache::getImagePath(const std::string &newickString, bool assumeBootstrapNames) const {
+	return directory+"/"+hashText(newickString).toString()+"-"+std::to_string(newickString.size())+(assumeBootstrapNames ? "-b" : "-n")+IMAGE_SUFFIX;
+}
+
+bool KBTreeDiskCache::contains(const std::string &newickString, bool assumeBootstrapNames) const {
+	struct stat status;
+	return usable && stat(getImagePath(newickString,assumeBootstrapNames).c_str(),&status)==0;
+}
+
+KBTree *KBTreeDiskCache::get(const std::string &newickString, bool assumeBootstrapNames) {
+	const std::string path = usable ? getImagePath(newickString,assumeBootstrapNames) : "";
+	struct stat status;
+	if(usable && stat(path.c_str(),&status)==0) {
+		KBTree *tree = NULL;
+		try {
+			tree = KBTree::fromBinaryFile(path);
+		} catch (ParseException& e) {
+			cout<<"++KBTREE WARNING--   REMOVING UNREADABLE TREE IMAGE: '"<<path<<"' ("<<e.what()<<")"<<endl;
+			unlink(path.c_str());
+		}
+		if(tree!=NULL) {
+			// mark it as recently used
+			utimensat(AT_FDCWD,path.c_str(),NULL,0);
+			std::lock_guard<std::mutex> guard(lock);
+			hits++;
+			return tree;
+		}
+	}
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		misses++;
+	}
+	KBTree *tree = new KBTree(newickString,false,assumeBootstrapNames);
+	if(usable && store(*tree,path)) {
+		bool over;
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			over = diskUsage>sizeLimit;
+		}
+		if(over) { removeImages(getSizeLimit()); }
+	}
+	return tree;
+}
+
+bool KBTreeDiskCache::store(KBTree &tree, const std::string &path) {
+	uint64_t count;
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		count = temporaryCount++;
+	}
+	const std::string temporary = path+"."+std::to_string(getpid())+"."+std::to_string(count)+TEMPORARY_SUFFIX;
+	int fd = open(temporary.c_str(),O_WRONLY|O_CREAT|O_EXCL,0666);
+	if(fd<0) {
+		cerr<<"!!KBTREE ERROR-- CANNOT OPEN OUTPUT STREAM TO FILE: '"<<temporary<<"'"<<endl;
+		return false;
+	}
+	KBOutputSink out(fd);
+	bool written = tree.writeBinary(out) && out.flush();
+	const uint64_t bytes = out.getBytesWritten();
+	if(close(fd)!=0) { written=false; }
+	// the rename replaces any image another process stored meanwhile, which is the same tree
+	if(!written || rename(temporary.c_str(),path.c_str())!=0) {
+		cerr<<"!!KBTREE ERROR-- CANNOT WRITE TO FILE: '"<<path<<"'"<<endl;
+		unlink(temporary.c_str());
+		return false;
+	}
+	std::lock_guard<std::mutex> guard(lock);
+	diskUsage += bytes;
+	return true;
+}
+
+void KBTreeDiskCache::removeImages(uint64_t limit) {
+	std::vector<ImageFile> images;
+	listImages(directory,images,true);
+	std::sort(images.begin(),images.end());
+	uint64_t total = 0;
+	for(size_t i=0; i<images.size(); i++) { total+=images[i].bytes; }
+	uint64_t removed = 0;
+	for(size_t i=0; i<images.size() && total>limit; i++) {
+		// another process may be removing the same images
+		if(unlink(images[i].path.c_str())==0) { removed++; }
+		total -= images[i].bytes;
+	}
+	std::lock_guard<std::mutex> guard(lock);
+	diskUsage = total;
+	if(limit>0) { evictions += removed; }
+}
+
+void KBTreeDiskCache::trim() {
+	if(usable) { removeImages(getSizeLimit()); }
+}
+
+void KBTreeDiskCache::clear() {
+	if(usable) { removeImages(0); }
+}
+
+void KBTreeDiskCache::setSizeLimit(uint64_t bytes) {
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		sizeLimit = bytes;
+	}
+	trim();
+}
+
+uint64_t KBTreeDiskCache::getSizeLimit() const {
+	std::lock_guard<std::mutex> guard(lock);
+	return sizeLimit;
+}
+
+uint64_t KBTreeDiskCache::getDiskUsage() const {
+	std::vector<ImageFile> images;
+	listImages(directory,images,false);
+	uint64_t total = 0;
+	for(size_t i=0; i<images.size(); i++) { total+=images[i].bytes; }
+	return total;
+}
+
+uint64_t KBTreeDiskCache::getHitCount() const {
+	std::lock_guard<std::mutex> guard(lock);
+	return hits;
+}
+
+uint64_t KBTreeDiskCache::getMissCount() const {
+	std::lock_guard<std::mutex> guard(lock);
+	return misses;
+}
+
+uint64_t KBTreeDiskCache::getEvictionCount() const {
+	std::lock_guard<std::mutex> guard(lock);
+	return evictions;
+}
+
+void KBTreeDiskCache::resetCounters() {
+	std::lock_guard<std::mutex> guard(lock);
+	hits = 0;
+	misses = 0;
+	evictions = 0;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file kbdiskcache.hh
+ * @brief A directory of binary tree images, keyed by a hash of their Newick text
+ *
+ * A worker that restarts loses its KBTreeCache, and parses every stored tree again.  A KBTreeDiskCache keeps
+ * the binary form of each tree it parses (see KBTree::toBinary) in a directory, named by the hash of the
+ * Newick text and the parse flags, so that a later process, or the same one, loads the tree with
+ * KBTree::fromBinaryFile: the image is memory mapped and deserialized, which builds the nodes without
+ * parsing any text, and the labels use the text of the mapped file in place.
+ *
+ * Any number of threads and processes can share one directory.  An image is written to a temporary file and
+ * renamed into place, so no one ever sees a partial image; a file that still cannot be loaded (written by
+ * another version, say, or damaged) is removed and the tree parsed again.  The modification time of an image
+ * is set whenever it is loaded, and when the images add up to more than the size limit the least recently
+ * used are removed until they fit.  Removing an image that another process has mapped does not disturb it.
+ *
+ * As for KBTreeCache, the text is not kept, only its 128 bit hash and length.
+ */
+
+#ifndef KBDISKCACHE_HH_
+#define KBDISKCACHE_HH_
+
+#include "kbtree.hh"
+#include "kbcache.hh"
+#include <cstdint>
+#include <mutex>
+
+namespace KBTreeLib {
+
+	class KBTreeDiskCache
+	{
+		public:
+			static const uint64_t DEFAULT_SIZE_LIMIT = (uint64_t)1<<30;
+			/** suffix of the image files; any other files in the directory are left alone, except for
+			 * temporary files abandoned by a writer, which are removed once they are an hour old */
+			static const char *const IMAGE_SUFFIX;
+
+			/** use the directory, creating it if it does not exist.  If it cannot be created, that is reported,
+			 * and every tree is parsed and nothing stored. */
+			KBTreeDiskCache(const std::string &directory, uint64_t sizeLimit=DEFAULT_SIZE_LIMIT);
+			~KBTreeDiskCache();
+
+			/** the tree of the Newick string: loaded from its image if there is one, and otherwise parsed as
+			 * KBTree(newickString,false,assumeBootstrapNames) and its image stored.  A parse error is thrown as by
+			 * that constructor, and nothing is stored.  The caller owns (and must delete) the returned tree. */
+			KBTree *get(const std::string &newickString, bool assumeBootstrapNames=false);
+			/** true if the directory holds an image of the tree */
+			bool contains(const std::string &newickString, bool assumeBootstrapNames=false) const;
+			/** the file the image of the tree is (or would be) stored in */
+			std::string getImagePath(const std::string &newickString, bool assumeBootstrapNames=false) const;
+
+			/** remove the least recently used images until the rest fit in the size limit */
+			void trim();
+			/** remove every image */
+			void clear();
+
+			const std::string &getDirectory() const { return directory; };
+			void setSizeLimit(uint64_t bytes);
+			uint64_t getSizeLimit() const;
+			/** bytes of the images in the directory, counted afresh */
+			uint64_t getDiskUsage() const;
+
+			// lookups that loaded an image, lookups that parsed the text, and images removed by this cache to
+			// keep within the size limit
+			uint64_t getHitCount() const;
+			uint64_t getMissCount() const;
+			uint64_t getEvictionCount() const;
+			void resetCounters();
+
+		private:
+			KBTreeDiskCache(const KBTreeDiskCache &);
+			KBTreeDiskCache &operator=(const KBTreeDiskCache &);
+
+			/** write the image of the tree to the file through a temporary file; false if it could not be */
+			bool store(KBTree &tree, const std::string &path);
+			/** remove images, oldest first, until they fit in the limit, and old temporary files; the lock must
+			 * not be held */
+			void removeImages(uint64_t limit);
+
+			std::string directory;
+			bool usable;
+			mutable std::mutex lock;
+			uint64_t sizeLimit;
+			/** bytes of images in the directory as last counted, plus those stored since; other processes may
+			 * have added more, so the directory is counted again whenever this passes the limit */
+			uint64_t diskUsage;
+			uint64_t hits;
+			uint64_t misses;
+			uint64_t evictions;
+			/** makes the names of temporary files unique within the process */
+			uint64_t temporaryCount;
+	};
+
+};
+
+#endif /* KBDISKCACHE_HH_ */
@@ -0,0 +1,364 @@
+/**
+ * @file kbdistance.cpp
+ * @brief Patristic distance matrices
+ *
+ * The patristic distance between nodes a and b is rootDistance(a)+rootDistance(b)-2*rootDistance(c), where c
+ * is their lowest common ancestor.  Rather than look up the ancestor of every pair, the nodes of a matrix
+ * are sorted into preorder, s[0],s[1],...,s[k-1], and the ancestor of each neighbouring pair, the link
+ * between them, is found once.  The ancestor of s[i] and s[j] (i<j) is then the shallowest of the links
+ * i,...,j-1, so a row of the matrix is a running minimum over the links on either side of its node.
+ *
+ * The rows are computed in blocks of consecutive rows.  The links to the left of a block are reduced once
+ * into suffix minima, and those to the right into prefix minima, which every row of the block shares.  An
+ * entry of a row outside the block is then the shallower of one of those and a value fixed for the row: a
+ * compare, a select and three additions per entry, with no dependence from one entry to the next, which the
+ * compiler vectorizes.  The columns are taken in tiles, small enough that the minima and root distances of
+ * a tile stay in the cache while every row of the block is filled in.  The blocks are shared out between
+ * threads, and only the entries within a block, a small square, are filled in one at a time.
+ *
+ * When the matrix is written out, rows are formatted on all of the threads in batches, and each batch is
+ * written in order while the next is formatted, so only two batches are held at a time.
+ */
+
+#include "kbancestor.hh"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <thread>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace std;
+using namespace KBTreeLib;
+
+
+/** a block has at most this many rows, and at most this many entries */
+static const size_t MAX_BLOCK_ROWS = 64;
+static const size_t MAX_BLOCK_ENTRIES = 1<<18;
+/** columns of a tile; its minima and root distances take 24 bytes a column */
+static const size_t TILE_COLUMNS = 1<<11;
+/** below this many entries the threads cost more than they save */
+static const size_t PARALLEL_MIN_ENTRIES = 1<<16;
+/** entries formatted in each batch of output */
+static const size_t WRITE_BATCH_ENTRIES = 1<<20;
+
+/** run task(0) ... task(threadCount-1) concurrently, the first on the calling thread */
+static void runOnThreads(unsigned int threadCount, const std::function<void(unsigned int)> &task) {
+	std::vector<std::thread> threads;
+	for(unsigned int t=1; t<threadCount; t++) { threads.push_back(std::thread(task,t)); }
+	task(0);
+	for(size_t t=0; t<threads.size(); t++) { threads[t].join(); }
+}
+
+static unsigned int getThreadCount(unsigned int threadCount, size_t entries, size_t blocks) {
+	if(threadCount==0) { threadCount=std::thread::hardware_concurrency(); }
+	if(threadCount==0 || entries<PARALLEL_MIN_ENTRIES) { threadCount=1; }
+	return (unsigned int)std::min<size_t>(threadCount,std::max<size_t>(blocks,1));
+}
+
+
+/** the nodes of a matrix sorted into preorder, and the links between neighbours */
+struct PatristicOrder {
+	size_t count;
+	bool sorted;                        // the nodes were given in preorder, so rows need no reordering
+	std::vector<size_t> order;          // the index in the given nodes of each sorted node
+	std::vector<size_t> position;       // the sorted position of each given node
+	std::vector<double> rootDistances;  // of each sorted node
+	std::vector<double> linkDepths;     // depth of the ancestor of sorted nodes i and i+1, -1 if there is none
+	std::vector<double> linkRoots;      // its distance from the root, NaN if there is none
+
+	PatristicOrder(const KBAncestorIndex &index, const std::vector<uint32_t> &nodes) {
+		count = nodes.size();
+		sorted = std::is_sorted(nodes.begin(),nodes.end());
+		order.resize(count);
+		for(size_t i=0; i<count; i++) { order[i]=i; }
+		if(!sorted) {
+			std::sort(order.begin(),order.end(),[&nodes](size_t a, size_t b) { return nodes[a]<nodes[b] || (nodes[a]==nodes[b] && a<b); });
+			position.resize(count);
+			for(size_t s=0; s<count; s++) { position[order[s]]=s; }
+		}
+		rootDistances.resize(count);
+		linkDepths.resize(count);
+		linkRoots.resize(count);
+		for(size_t s=0; s<count; s++) {
+			const uint32_t node = nodes[order[s]];
+			rootDistances[s] = index.getDistanceToRoot(node);
+			if(s+1==count) { break; }
+			const uint32_t link = index.getLowestCommonAncestor(node,nodes[order[s+1]]);
+			linkDepths[s] = link==KBAncestorIndex::NONE ? -1.0 : (double)index.getDepth(link);
+			linkRoots[s] = link==KBAncestorIndex::NONE ? NAN : index.getDistanceToRoot(link);
+		}
+	};
+};
+
+/** space for one thread to compute blocks in */
+struct PatristicWorkspace {
+	std::vector<double> minDepths;   // the least link depth from each column to the block
+	std::vector<double> minRoots;    // and the root distance of that link
+	std::vector<double> rows;        // rows of a block, when they cannot go straight to their destination
+
+	PatristicWorkspace(size_t count, size_t rowCount) : minDepths(count), minRoots(count), rows(rowCount*count) { };
+};
+
+/** the rows of the sorted nodes [first,last), in sorted order, to rows[(s-first)*count] */
+static void computeBlock(const PatristicOrder &o, size_t first, size_t last, PatristicWorkspace &w, double *rows)
+{
+	const size_t count = o.count;
+	const double *rootDistances = o.rootDistances.data();
+	const double *linkDepths = o.linkDepths.data();
+	const double *linkRoots = o.linkRoots.data();
+	double *minDepths = w.minDepths.data();
+	double *minRoots = w.minRoots.data();
+
+	// the shallowest link between each column and the block, and between each row and the edges of the block
+	double depth = INFINITY, root = NAN;
+	for(size_t t=first; t-->0; ) {
+		if(linkDepths[t]<depth) { depth=linkDepths[t]; root=linkRoots[t]; }
+		minDepths[t]=depth; minRoots[t]=root;
+	}
+	depth = INFINITY;
+	for(size_t t=last; t<count; t++) {
+		if(linkDepths[t-1]<depth) { depth=linkDepths[t-1]; root=linkRoots[t-1]; }
+		minDepths[t]=depth; minRoots[t]=root;
+	}
+	double leftDepths[MAX_BLOCK_ROWS], leftRoots[MAX_BLOCK_ROWS], rightDepths[MAX_BLOCK_ROWS], rightRoots[MAX_BLOCK_ROWS];
+	depth = INFINITY;
+	for(size_t s=first; s<last; s++) {
+		leftDepths[s-first]=depth; leftRoots[s-first]=root;
+		if(s+1<last && linkDepths[s]<depth) { depth=linkDepths[s]; root=linkRoots[s]; }
+	}
+	depth = INFINITY;
+	for(size_t s=last; s-->first; ) {
+		rightDepths[s-first]=depth; rightRoots[s-first]=root;
+		if(s>first && linkDepths[s-1]<depth) { depth=linkDepths[s-1]; root=linkRoots[s-1]; }
+	}
+
+	// columns outside of the block, a tile at a time
+	for(size_t tile=0; tile<count; tile+=TILE_COLUMNS) {
+		const size_t tileEnd = std::min(count,tile+TILE_COLUMNS);
+		const size_t leftEnd = std::min(tileEnd,first);
+		const size_t rightBegin = std::max(tile,last);
+		// both minima are loaded before the select, so that the compiler sees no branch to keep
+		for(size_t s=first; s<last; s++) {
+			double *row = rows+(s-first)*count;
+			const double rowRoot = rootDistances[s];
+			const double leftDepth = leftDepths[s-first], leftRoot = leftRoots[s-first];
+			for(size_t t=tile; t<leftEnd; t++) {
+				const double minDepth = minDepths[t], minRoot = minRoots[t];
+				row[t] = rowRoot+rootDistances[t]-2*(minDepth<leftDepth ? minRoot : leftRoot);
+			}
+			const double rightDepth = rightDepths[s-first], rightRoot = rightRoots[s-first];
+			for(size_t t=rightBegin; t<tileEnd; t++) {
+				const double minDepth = minDepths[t], minRoot = minRoots[t];
+				row[t] = rowRoot+rootDistances[t]-2*(minDepth<rightDepth ? minRoot : rightRoot);
+			}
+		}
+	}
+
+	// columns within the block
+	for(size_t s=first; s<last; s++) {
+		double *row = rows+(s-first)*count;
+		const double rowRoot = rootDistances[s];
+		row[s] = 0;
+		depth = INFINITY;
+		for(size_t t=s; t-->first; ) {
+			if(linkDepths[t]<depth) { depth=linkDepths[t]; root=linkRoots[t]; }
+			row[t] = rowRoot+rootDistances[t]-2*root;
+		}
+		depth = INFINITY;
+		for(size_t t=s+1; t<last; t++) {
+			if(linkDepths[t-1]<depth) { depth=linkDepths[t-1]; root=linkRoots[t-1]; }
+			row[t] = rowRoot+rootDistances[t]-2*root;
+		}
+	}
+}
+
+/** copy a row in sorted order into the order of the given nodes */
+static void unsortRow(const PatristicOrder &o, const double *row, double *destination)
+{
+	const size_t *position = o.position.data();
+	for(size_t j=0; j<o.count; j++) { destination[j]=row[position[j]]; }
+}
+
+
+void KBAncestorIndex::getPatristicDistances(const std::vector<uint32_t> &nodes, double *distances, unsigned int threadCount) const
+{
+	if(nodes.empty()) { return; }
+	const PatristicOrder o(*this,nodes);
+	const size_t count = o.count;
+	const size_t blockRows = std::max<size_t>(1,std::min(MAX_BLOCK_ROWS,MAX_BLOCK_ENTRIES/count));
+	const size_t blocks = (count+blockRows-1)/blockRows;
+	threadCount = getThreadCount(threadCount,count*count,blocks);
+	// the workspaces are made here, so that running out of memory is reported to the caller
+	std::vector<PatristicWorkspace> workspaces;
+	workspaces.reserve(threadCount);
+	for(unsigned int t=0; t<threadCount; t++) { workspaces.push_back(PatristicWorkspace(count,o.sorted ? 0 : blockRows)); }
+	std::atomic<size_t> nextBlock(0);
+	runOnThreads(threadCount,[&](unsigned int thread) {
+		PatristicWorkspace &w = workspaces[thread];
+		for(size_t block=nextBlock++; block<blocks; block=nextBlock++) {
+			const size_t first = block*blockRows, last = std::min(count,first+blockRows);
+			if(o.sorted) {
+				computeBlock(o,first,last,w,distances+first*count);
+			} else {
+				computeBlock(o,first,last,w,w.rows.data());
+				for(size_t s=first; s<last; s++) { unsortRow(o,w.rows.data()+(s-first)*count,distances+o.order[s]*count); }
+			}
+		}
+	});
+}
+
+bool KBAncestorIndex::writePatristicDistances(const std::vector<uint32_t> &nodes, KBOutputSink &out, unsigned int format, int precision, unsigned int threadCount) const
+{
+	const size_t count = nodes.size();
+	const char separator = format==KBTree::TSV_MATRIX ? '\t' : ' ';
+	if(format==KBTree::TSV_MATRIX) {
+		for(size_t i=0; i<count; i++) { out.put('\t'); out.write(getName(nodes[i])); }
+	} else {
+		out.write(std::to_string(count));
+	}
+	out.put('\n');
+	if(count==0) { return out.good(); }
+
+	// Rows are written in the order of the given nodes.  If that is not preorder, each row is computed on its
+	// own, which costs little next to formatting it.
+	const PatristicOrder o(*this,nodes);
+	const size_t blockRows = o.sorted ? std::max<size_t>(1,std::min(MAX_BLOCK_ROWS,MAX_BLOCK_ENTRIES/count)) : 1;
+	const size_t blocks = (count+blockRows-1)/blockRows;
+	threadCount = getThreadCount(threadCount,count*count,blocks);
+	const size_t batchBlocks = std::max<size_t>(threadCount,WRITE_BATCH_ENTRIES/(blockRows*count));
+	std::vector<PatristicWorkspace> workspaces;
+	workspaces.reserve(threadCount);
+	for(unsigned int t=0; t<threadCount; t++) { workspaces.push_back(PatristicWorkspace(count,o.sorted ? blockRows : 2)); }
+	std::vector<std::string> batches[2];
+	batches[0].resize(batchBlocks);
+	batches[1].resize(batchBlocks);
+
+	// thread 0 writes out the previous batch before it joins in formatting the current one
+	size_t formatted = 0;
+	for(size_t batch=0; batch*batchBlocks<blocks || formatted>0; batch++) {
+		std::vector<std::string> &current = batches[batch&1];
+		std::vector<std::string> &previous = batches[(batch+1)&1];
+		const size_t firstBlock = batch*batchBlocks;
+		const size_t lastBlock = std::min(blocks,firstBlock+batchBlocks);
+		std::vector<std::exception_ptr> errors(threadCount);
+		std::atomic<size_t> nextBlock(firstBlock);
+		runOnThreads(firstBlock<lastBlock ? threadCount : 1,[&](unsigned int thread) {
+			try {
+				if(thread==0) {
+					for(size_t b=0; b<formatted; b++) { out.write(previous[b]); }
+				}
+				PatristicWorkspace &w = workspaces[thread];
+				char buf[MAX_DOUBLE_CHARS];
+				for(size_t block=nextBlock++; block<lastBlock; block=nextBlock++) {
+					std::string &text = current[block-firstBlock];
+					text.clear();
+					const size_t first = block*blockRows, last = std::min(count,first+blockRows);
+					for(size_t row=first; row<last; row++) {
+						const double *values;
+						if(o.sorted) {
+							if(row==first) { computeBlock(o,first,last,w,w.rows.data()); }
+							values = w.rows.data()+(row-first)*count;
+						} else {
+							const size_t s = o.position[row];
+							computeBlock(o,s,s+1,w,w.rows.data());
+							unsortRow(o,w.rows.data(),w.rows.data()+count);
+							values = w.rows.data()+count;
+						}
+						text.append(getName(nodes[row]));
+						for(size_t j=0; j<count; j++) {
+							text += separator;
+							text.append(buf,formatDouble(values[j],precision,buf));
+						}
+						text += '\n';
+					}
+				}
+			} catch (...) {
+				errors[thread] = std::current_exception();
+			}
+		});
+		for(unsigned int t=0; t<threadCount; t++) {
+			if(errors[t]) { std::rethrow_exception(errors[t]); }
+		}
+		formatted = lastBlock>firstBlock ? lastBlock-firstBlock : 0;
+		if(!out.good()) { break; }
+	}
+	return out.good();
+}
+
+
+bool KBAncestorIndex::getNamedNodesOrLeaves(const std::string &names, std::vector<uint32_t> &nodes) const
+{
+	std::vector<std::string> nameList;
+	splitNames(names,nameList);
+	if(nameList.empty()) {
+		getLeaves(nodes);
+		return true;
+	}
+	return getNodes(nameList,nodes);
+}
+
+bool KBAncestorIndex::writePatristicDistances(KBOutputSink &out, const std::string &names, unsigned int format, int precision, unsigned int threadCount) const
+{
+	std::vector<uint32_t> nodes;
+	if(!getNamedNodesOrLeaves(names,nodes)) { return false; }
+	return writePatristicDistances(nodes,out,format,precision,threadCount);
+}
+
+bool KBAncestorIndex::writePatristicDistancesToFile(const std::string &filename, const std::string &names, unsigned int format, int precision, unsigned int threadCount) const
+{
+	// the names are found before the file is opened, so that a name that is not found (which has already
+	// been reported) leaves the file as it was
+	std::vector<uint32_t> nodes;
+	if(!getNamedNodesOrLeaves(names,nodes)) { return false; }
+	int fd = open(filename.c_str(),O_WRONLY|O_CREAT|O_TRUNC,0666);
+	if(fd<0) {
+		cerr<<"!!KBTREE ERROR-- CANNOT OPEN OUTPUT STREAM TO FILE: '"<<filename<<"'"<<endl;
+		return false;
+	}
+	KBOutputSink out(fd);
+	bool written = writePatristicDistances(nodes,out,format,precision,threadCount);
+	written = out.flush() && written;
+	if(close(fd)!=0) { written=false; }
+	if(!written) {
+		cerr<<"!!KBTREE ERROR-- CANNOT WRITE TO FILE: '"<<filename<<"'"<<endl;
+	}
+	return written;
+}
+
+
+bool KBTree::getPatristicDistances(const std::vector<std::string> &names, double *distances, unsigned int threadCount)
+{
+	const KBAncestorIndex index(*this);
+	std::vector<uint32_t> nodes;
+	if(!index.getNodes(names,nodes)) { return false; }
+	index.getPatristicDistances(nodes,distances,threadCount);
+	return true;
+}
+
+void KBTree::getPatristicDistances(std::vector<std::string> &leafNames, std::vector<double> &distances, unsigned int threadCount)
+{
+	const KBAncestorIndex index(*this);
+	std::vector<uint32_t> leaves;
+	index.getLeaves(leaves);
+	leafNames.clear();
+	leafNames.reserve(leaves.size());
+	for(size_t i=0; i<leaves.size(); i++) { leafNames.push_back(std::string(index.getName(leaves[i]))); }
+	distances.resize(leaves.size()*leaves.size());
+	index.getPatristicDistances(leaves,distances.data(),threadCount);
+}
+
+bool KBTree::writePatristicDistances(KBOutputSink &out, const std::string &names, unsigned int format, unsigned int threadCount)
+{
+	const KBAncestorIndex index(*this);
+	return index.writePatristicDistances(out,names,format,output_precision,threadCount);
+}
+
+bool KBTree::writePatristicDistancesToFile(const std::string &filename, const std::string &names, unsigned int format, unsigned int threadCount)
+{
+	const KBAncestorIndex index(*this);
+	return index.writePatristicDistancesToFile(filename,names,format,output_precision,threadCount);
+}
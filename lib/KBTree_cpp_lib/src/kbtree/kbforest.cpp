@@ -0,0 +1,267 @@
+/**
+ * @file kbforest.cpp
+ * @brief Reading files and strings that hold many Newick trees
+ */
+
+#include "kbforest.hh"
+#include <cctype>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+using namespace std;
+using namespace KBTreeLib;
+
+
+KBForest::KBForest() {
+	this->threadCount=0;
+	this->verbose=false;
+	this->assumeBootstrapNames=false;
+}
+KBForest::~KBForest() { }
+
+unsigned int KBForest::getWorkerCount() const {
+	if(threadCount>0) { return threadCount; }
+	unsigned int cores = std::thread::hardware_concurrency();
+	return cores>0 ? cores : 1;
+}
+
+
+bool KBForest::nextNewickTree(std::string_view text, size_t &k, std::string_view &tree)
+{
+	const char *buf = text.data();
+	const size_t n = text.size();
+	// skip any blank text between trees
+	while(k<n && isspace((unsigned char)buf[k])) { k++; }
+	if(k>=n) { return false; }
+
+	// quotes and comments are recognized the same way as in KBTree::getNextLabel, so a semicolon in a
+	// quoted name or a comment never ends a tree
+	size_t start = k;
+	long depth = 0;
+	bool inComment = false;
+	while(k<n) {
+		char C = buf[k];
+		if(C=='\'' || C=='"') {
+			for(k++; k<n; k++) {
+				if(buf[k]=='\\' && k+1<n && buf[k+1]==C) { k++; }
+				else if(buf[k]==C) { break; }
+			}
+		}
+		else if(C==']') { inComment=false; }
+		else if(inComment) { }
+		else if(C=='[') { inComment=true; }
+		else if(C=='(') { depth++; }
+		else if(C==')') { depth--; }
+		else if(C==';' && depth<=0) {
+			k++;
+			tree = text.substr(start,k-start);
+			return true;
+		}
+		k++;
+	}
+	// the last tree was not terminated, but we still take what is there
+	if(k>n) { k=n; }
+	tree = text.substr(start);
+	return true;
+}
+
+void KBForest::splitNewickTrees(std::string_view text, std::vector<std::string_view> &trees)
+{
+	size_t k=0;
+	std::string_view tree;
+	while(nextNewickTree(text,k,tree)) { trees.push_back(tree); }
+}
+
+
+
+/** one tree of the forest, from the time it is found in the text until it is handed to the caller */
+class ForestJob {
+	public:
+		ForestJob(size_t index, std::string_view text) : index(index), text(text), tree(NULL), done(false) { };
+		size_t index;
+		std::string_view text;
+		KBTree *tree;
+		std::exception_ptr error;
+		bool done;
+};
+
+/**
+ * Worker threads and the window of trees they are parsing.  The calling thread finds trees in the text
+ * and appends them to the window; workers claim and parse them in order; the calling thread removes them
+ * from the front of the window as they complete, so trees are always delivered in input order.
+ * Destroying the pool stops the workers and deletes any parsed trees that were never delivered.
+ */
+class ForestPool {
+	public:
+		typedef std::function<KBTree *(std::string_view text)> TreeParser;
+
+		ForestPool(unsigned int workerCount, TreeParser parseTree)
+			: parseTree(parseTree), windowStart(0), nextToClaim(0), stopping(false) {
+			for(unsigned int w=0; w<workerCount; w++) {
+				workers.push_back(std::thread(&ForestPool::work,this));
+			}
+		};
+		~ForestPool() {
+			{
+				std::lock_guard<std::mutex> guard(lock);
+				stopping=true;
+			}
+			jobReady.notify_all();
+			for(size_t w=0; w<workers.size(); w++) { workers[w].join(); }
+			for(size_t j=0; j<window.size(); j++) { delete window[j].tree; }
+		};
+
+		size_t pending() {
+			std::lock_guard<std::mutex> guard(lock);
+			return window.size();
+		};
+		void submit(size_t index, std::string_view text) {
+			{
+				std::lock_guard<std::mutex> guard(lock);
+				window.push_back(ForestJob(index,text));
+			}
+			jobReady.notify_one();
+		};
+		/** wait for the oldest tree in the window to be parsed and remove it from the window */
+		ForestJob next() {
+			std::unique_lock<std::mutex> guard(lock);
+			while(!window.front().done) { jobDone.wait(guard); }
+			ForestJob job = window.front();
+			window.pop_front();
+			windowStart++;
+			return job;
+		};
+
+	private:
+		void work() {
+			std::unique_lock<std::mutex> guard(lock);
+			while(true) {
+				while(!stopping && nextToClaim-windowStart>=window.size()) { jobReady.wait(guard); }
+				if(stopping) { return; }
+				ForestJob &job = window[nextToClaim-windowStart];
+				nextToClaim++;
+				guard.unlock();
+				KBTree *tree = NULL;
+				std::exception_ptr error;
+				try {
+					tree = parseTree(job.text);
+				} catch (...) {
+					error = std::current_exception();
+				}
+				guard.lock();
+				job.tree=tree;
+				job.error=error;
+				job.done=true;
+				jobDone.notify_all();
+			}
+		};
+
+		TreeParser parseTree;
+		std::vector<std::thread> workers;
+		std::mutex lock;
+		std::condition_variable jobReady;
+		std::condition_variable jobDone;
+		std::deque<ForestJob> window;  // references stay valid as jobs are added at the back and removed at the front
+		size_t windowStart;            // input index of the job at the front of the window
+		size_t nextToClaim;            // input index of the next job a worker should take
+		bool stopping;
+};
+
+void KBForest::forEachInText(std::string_view text, std::shared_ptr<const void> owner, TreeHandler handler)
+{
+	size_t cursor = 0;
+	size_t index = 0;
+	std::string_view treeText;
+	unsigned int workerCount = getWorkerCount();
+	// every tree shares the forest text through the owner
+	ForestPool::TreeParser parseTree = [this,owner](std::string_view treeText) {
+		return new KBTree(treeText,owner,this->verbose,this->assumeBootstrapNames);
+	};
+
+	// with one thread there is nothing to coordinate: parse and deliver one tree at a time
+	if(workerCount<=1) {
+		while(nextNewickTree(text,cursor,treeText)) {
+			KBTree *tree = NULL;
+			try {
+				tree = parseTree(treeText);
+			} catch (ParseException& e) {
+				e.addTraceException("KBForest::forEach() while parsing tree "+std::to_string(index));
+				throw e;
+			}
+			handler(index++,tree);
+		}
+		return;
+	}
+
+	// keep a few trees per worker in flight, so workers stay busy while the handler runs but the
+	// number of parsed trees waiting for the handler stays bounded
+	const size_t windowSize = 4*(size_t)workerCount;
+	ForestPool pool(workerCount,parseTree);
+	bool moreText = true;
+	while(true) {
+		while(moreText && pool.pending()<windowSize) {
+			moreText = nextNewickTree(text,cursor,treeText);
+			if(moreText) { pool.submit(index++,treeText); }
+		}
+		if(pool.pending()==0) { break; }
+		ForestJob job = pool.next();
+		if(job.error) {
+			try {
+				std::rethrow_exception(job.error);
+			} catch (ParseException& e) {
+				e.addTraceException("KBForest::forEach() while parsing tree "+std::to_string(job.index));
+				throw e;
+			}
+		}
+		handler(job.index,job.tree);
+	}
+}
+
+void KBForest::forEach(const std::string &newickText, TreeHandler handler)
+{
+	// one shared copy of the text for the whole forest, rather than one per tree
+	std::shared_ptr<std::string> copy = std::make_shared<std::string>(newickText);
+	forEachInText(*copy,copy,handler);
+}
+
+bool KBForest::forEachInFile(const std::string &filename, TreeHandler handler)
+{
+	std::shared_ptr<KBMappedFile> file;
+	try {
+		file = std::make_shared<KBMappedFile>(filename);
+	} catch (ParseException& e) {
+		cerr<<"!!KBTREE ERROR-- "<<e.what()<<endl;
+		return false;
+	}
+	forEachInText(file->getText(),file,handler);
+	return true;
+}
+
+std::vector<KBTree *> KBForest::parse(const std::string &newickText)
+{
+	std::vector<KBTree *> trees;
+	try {
+		forEach(newickText,[&trees](size_t, KBTree *tree) { trees.push_back(tree); });
+	} catch (ParseException& e) {
+		for(size_t t=0; t<trees.size(); t++) { delete trees[t]; }
+		throw e;
+	}
+	return trees;
+}
+
+bool KBForest::parseFile(const std::string &filename, std::vector<KBTree *> &trees)
+{
+	std::vector<KBTree *> parsed;
+	try {
+		if(!forEachInFile(filename,[&parsed](size_t, KBTree *tree) { parsed.push_back(tree); })) { return false; }
+	} catch (ParseException& e) {
+		for(size_t t=0; t<parsed.size(); t++) { delete parsed[t]; }
+		throw e;
+	}
+	trees.insert(trees.end(),parsed.begin(),parsed.end());
+	return true;
+}
@@ -0,0 +1,87 @@
+/**
+ * @file kbforest.hh
+ * @brief Reading files and strings that hold many Newick trees
+ *
+ * Bulk data (bootstrap replicates, exported tree sets) commonly stores many trees back to back,
+ * each terminated by a semicolon.  KBForest splits such input into its trees and parses them
+ * concurrently on a pool of worker threads.
+ */
+
+#ifndef KBFOREST_HH_
+#define KBFOREST_HH_
+
+#include "kbtree.hh"
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace KBTreeLib {
+
+	/**
+	 * Parses a set of ';'-terminated Newick trees into independent KBTree objects.
+	 * Trees are parsed on a pool of worker threads but are always returned (or handed to the callback)
+	 * in the order in which they appear in the input.  All trees parsed from one input share a single
+	 * copy (or memory mapping) of the text, which is released once the last of those trees is deleted.
+	 */
+	class KBForest {
+		public:
+			/** Callback that receives each tree in input order, with its 0-based position in the input.
+			 * The callback takes ownership of the tree and must delete it when done. */
+			typedef std::function<void(size_t index, KBTree *tree)> TreeHandler;
+
+			KBForest();
+			~KBForest();
+
+			/** number of parsing threads to use; 0 (the default) uses one per available core */
+			void setThreadCount(unsigned int threadCount) { this->threadCount=threadCount; };
+			/** options passed on to each tree, see the KBTree constructors */
+			void setVerbose(bool verbose) { this->verbose=verbose; };
+			void setAssumeBootstrapNames(bool assumeBootstrapNames) { this->assumeBootstrapNames=assumeBootstrapNames; };
+
+			/**
+			 * Parse every tree in the string.  The returned trees are owned by the caller.  Throws
+			 * ParseException if any tree fails to parse (trees parsed up to that point are deleted).
+			 */
+			std::vector<KBTree *> parse(const std::string &newickText);
+
+			/**
+			 * Parse every tree in a file (which is memory mapped, not read into memory).  Returns false
+			 * if the file cannot be read.  Trees are appended to the given vector and owned by the caller.
+			 */
+			bool parseFile(const std::string &filename, std::vector<KBTree *> &trees);
+
+			/**
+			 * Streaming variants: each tree is handed to the handler as soon as it and all trees before it
+			 * are parsed.  Only a small window of trees (a few per thread) is ever parsed ahead of the
+			 * handler, so the forest never has to be in memory at once if the handler deletes the trees.
+			 * The handler is always called from the calling thread.
+			 */
+			void forEach(const std::string &newickText, TreeHandler handler);
+			bool forEachInFile(const std::string &filename, TreeHandler handler);
+
+			/**
+			 * Splits text into its trees at top level semicolons (semicolons inside quotes, comments, or
+			 * parentheses do not end a tree).  Each returned view includes its terminating semicolon.
+			 * Blank text after the last semicolon is not returned as a tree.
+			 */
+			static void splitNewickTrees(std::string_view text, std::vector<std::string_view> &trees);
+
+			/**
+			 * Find the tree starting at position k of the text, as in splitNewickTrees.  Returns false if
+			 * only blank text remains.  Otherwise sets tree and advances k just past it.
+			 */
+			static bool nextNewickTree(std::string_view text, size_t &k, std::string_view &tree);
+
+		protected:
+			void forEachInText(std::string_view text, std::shared_ptr<const void> owner, TreeHandler handler);
+			unsigned int getWorkerCount() const;
+
+			unsigned int threadCount;
+			bool verbose;
+			bool assumeBootstrapNames;
+	};
+
+};
+
+#endif /* KBFOREST_HH_ */
@@ -0,0 +1,149 @@
+/**
+ * @file kbfrozen.cpp
+ * @brief Immutable snapshots of a tree that any number of threads can read at once
+ */
+
+#include "kbfrozen.hh"
+#include <cmath>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace std;
+using namespace KBTreeLib;
+
+
+KBFrozenTree::Snapshot::Snapshot(KBTree &source) : tree(source,true), index(tree) {
+	with_labels = source.with_labels;
+	with_distances = source.with_distances;
+	with_comments = source.with_comments;
+	with_bootstrap_values_as_labels = source.with_bootstrap_values_as_labels;
+	output_precision = source.output_precision;
+	tree.setOutputFlagLabel(with_labels);
+	tree.setOutputFlagDistances(with_distances);
+	tree.setOutputFlagComments(with_comments);
+	tree.setOutputFlagBootstrapValuesAsLabels(with_bootstrap_values_as_labels);
+	tree.setOutputPrecision(output_precision);
+}
+
+KBFrozenTree::Snapshot::Snapshot(const std::string &newickString, bool assumeBootstrapNames) : tree(newickString,assumeBootstrapNames,true), index(tree) {
+	with_labels = true;
+	with_distances = true;
+	with_comments = true;
+	with_bootstrap_values_as_labels = true;
+	output_precision = DEFAULT_OUTPUT_PRECISION;
+}
+
+
+KBFrozenTree::KBFrozenTree(KBTree &tree) : snapshot(std::make_shared<const Snapshot>(tree)) { }
+
+KBFrozenTree::KBFrozenTree(const std::string &newickString, bool assumeBootstrapNames) :
+	snapshot(std::make_shared<const Snapshot>(newickString,assumeBootstrapNames)) { }
+
+KBFrozenTree::~KBFrozenTree() { }
+
+KBFrozenTree KBTree::freeze() {
+	return KBFrozenTree(*this);
+}
+
+size_t KBFrozenTree::getMemoryUsage() const {
+	return sizeof(Snapshot)-sizeof(KBCompactTree)-sizeof(KBAncestorIndex) + snapshot->tree.getMemoryUsage() + snapshot->index.getMemoryUsage();
+}
+
+
+std::string KBFrozenTree::getPathToRoot(const std::string &name) const {
+	const KBAncestorIndex &index = snapshot->index;
+	std::string path = "";
+	uint32_t node = index.getNode(name);
+	if(node==NONE) { return path; }
+	for(node=index.getParent(node); node!=NONE; node=index.getParent(node)) {
+		path += index.getName(node);
+		path += ";";
+	}
+	return path;
+}
+
+int KBFrozenTree::getDepth(const std::string &name) const {
+	const uint32_t node = snapshot->index.getNode(name);
+	return node==NONE ? -1 : (int)snapshot->index.getDepth(node);
+}
+
+unsigned int KBFrozenTree::getSubtreeSize(const std::string &name) const {
+	const uint32_t node = snapshot->index.getNode(name);
+	return node==NONE ? 0 : snapshot->index.getSubtreeSize(node);
+}
+
+unsigned int KBFrozenTree::getCladeLeafCount(const std::string &name) const {
+	const uint32_t node = snapshot->index.getNode(name);
+	return node==NONE ? 0 : snapshot->index.getLeafCount(node);
+}
+
+double KBFrozenTree::getDistanceToRoot(const std::string &name) const {
+	const uint32_t node = snapshot->index.getNode(name);
+	return node==NONE ? NAN : snapshot->index.getDistanceToRoot(node);
+}
+
+
+double KBFrozenTree::getPatristicDistance(const std::string &nameA, const std::string &nameB) const {
+	const uint32_t a = snapshot->index.getNode(nameA), b = snapshot->index.getNode(nameB);
+	if(a==NONE || b==NONE) { return NAN; }
+	return snapshot->index.getPatristicDistance(a,b);
+}
+
+bool KBFrozenTree::getPatristicDistances(const std::vector<std::string> &names, double *distances, unsigned int threadCount) const {
+	std::vector<uint32_t> nodes;
+	if(!snapshot->index.getNodes(names,nodes)) { return false; }
+	snapshot->index.getPatristicDistances(nodes,distances,threadCount);
+	return true;
+}
+
+bool KBFrozenTree::writePatristicDistances(KBOutputSink &out, const std::string &names, unsigned int format, unsigned int threadCount) const {
+	return snapshot->index.writePatristicDistances(out,names,format,snapshot->output_precision,threadCount);
+}
+
+bool KBFrozenTree::writePatristicDistancesToFile(const std::string &filename, const std::string &names, unsigned int format, unsigned int threadCount) const {
+	return snapshot->index.writePatristicDistancesToFile(filename,names,format,snapshot->output_precision,threadCount);
+}
+
+
+bool KBFrozenTree::writeNewickToFile(const std::string &filename) const {
+	return writeNewickToFile(filename,KBNode::NAME_AND_DISTANCE);
+}
+
+bool KBFrozenTree::writeNewickToFile(const std::string &filename, unsigned int style) const {
+	int fd = open(filename.c_str(),O_WRONLY|O_CREAT|O_TRUNC,0666);
+	if(fd<0) {
+		cerr<<"!!KBTREE ERROR-- CANNOT OPEN OUTPUT STREAM TO FILE: '"<<filename<<"'"<<endl;
+		return false;
+	}
+	KBOutputSink out(fd);
+	writeNewick(out,style);
+	bool written = out.flush();
+	if(close(fd)!=0) { written=false; }
+	if(!written) {
+		cerr<<"!!KBTREE ERROR-- CANNOT WRITE TO FILE: '"<<filename<<"'"<<endl;
+	}
+	return written;
+}
+
+
+KBTree *KBFrozenTree::toKBTree() const {
+	KBTree *tree = snapshot->tree.toKBTree();
+	tree->setOutputFlagLabel(snapshot->with_labels);
+	tree->setOutputFlagDistances(snapshot->with_distances);
+	tree->setOutputFlagComments(snapshot->with_comments);
+	tree->setOutputFlagBootstrapValuesAsLabels(snapshot->with_bootstrap_values_as_labels);
+	tree->setOutputPrecision(snapshot->output_precision);
+	return tree;
+}
+
+KBFrozenTree KBFrozenTree::removeNodesByNameAndSimplify(const std::string &nodeNames) const {
+	std::unique_ptr<KBTree> tree(toKBTree());
+	tree->removeNodesByNameAndSimplify(nodeNames);
+	return KBFrozenTree(*tree);
+}
+
+KBFrozenTree KBFrozenTree::replaceNodeNames(const std::string &replacements) const {
+	std::unique_ptr<KBTree> tree(toKBTree());
+	tree->replaceNodeNames(replacements);
+	return KBFrozenTree(*tree);
+}
@@ -0,0 +1,130 @@
+/**
+ * @file kbfrozen.hh
+ * @brief Immutable snapshots of a tree that any number of threads can read at once
+ *
+ * Even the read only queries of a KBTree may change it: the first name lookup builds the name index, the
+ * first depth query computes the derived properties, and a lazily parsed label is decoded the first time it
+ * is read.  A tree shared between threads therefore has to be locked, or have all of that done up front and
+ * then never be edited.  A KBFrozenTree is a snapshot that cannot be changed at all.  It holds a
+ * KBCompactTree, for the names, counts and Newick output, and a KBAncestorIndex over it, for the name lookups,
+ * clade properties, lowest common ancestors and distances, both built once when the tree is frozen.  Every
+ * method is const and changes nothing, so any number of threads can query one snapshot with no locking.
+ *
+ * A KBFrozenTree is a handle: copying one is cheap, and the copies share one snapshot, which is deleted with
+ * the last handle to it.  A handle itself is a value like any other, so two threads must not assign to the
+ * same handle at once, but each may freely copy, query and drop its own.  An edit never touches the snapshot;
+ * it makes a KBTree from it, edits that, and freezes the result as a new snapshot.
+ */
+
+#ifndef KBFROZEN_HH_
+#define KBFROZEN_HH_
+
+#include "kbtree.hh"
+#include "kbcompact.hh"
+#include "kbancestor.hh"
+#include <cstdint>
+#include <memory>
+
+namespace KBTreeLib {
+
+	class KBFrozenTree
+	{
+		public:
+			/** node returned when a name is not found (see KBAncestorIndex::NONE) */
+			static constexpr uint32_t NONE = KBAncestorIndex::NONE;
+
+			/** freeze a copy of the tree, with its output flags and, if it keeps them, its original labels; the
+			 * KBTree can be edited or deleted afterwards (see KBTree::freeze) */
+			explicit KBFrozenTree(KBTree &tree);
+			/** parse the Newick string (as KBTree(newickString,false,assumeBootstrapNames) would, keeping the
+			 * original labels) and freeze it */
+			KBFrozenTree(const std::string &newickString, bool assumeBootstrapNames=false);
+			~KBFrozenTree();
+
+			/** true if both handles share one snapshot */
+			bool isSameSnapshot(const KBFrozenTree &other) const { return snapshot==other.snapshot; };
+			/** number of handles sharing this snapshot, this one included */
+			long getHandleCount() const { return snapshot.use_count(); };
+
+			/** the snapshot itself, for queries by node number; both number the nodes in preorder */
+			const KBCompactTree &getCompactTree() const { return snapshot->tree; };
+			const KBAncestorIndex &getAncestorIndex() const { return snapshot->index; };
+
+			unsigned int getNodeCount() const { return snapshot->tree.getNodeCount(); };
+			unsigned int getLeafCount() const { return snapshot->tree.getLeafCount(); };
+			/** bytes held by the snapshot */
+			size_t getMemoryUsage() const;
+
+			/** same as KBTree::getAllLeafNames and KBTree::getAllNodeNames, in the same orders */
+			std::string getAllLeafNames() const { return snapshot->tree.getAllLeafNames(); };
+			void getAllLeafNames(std::vector<std::string> &names) const { snapshot->tree.getAllLeafNames(names); };
+			std::string getAllNodeNames() const { return snapshot->tree.getAllNodeNames(); };
+			void getAllNodeNames(std::vector<std::string> &names) const { snapshot->tree.getAllNodeNames(names); };
+
+			// Queries on the node with a name, as the KBTree methods of the same names: if several nodes share
+			// the name, the first of them in post order is used.
+			bool hasNode(const std::string &name) const { return snapshot->index.getNode(name)!=NONE; };
+			/** the number of the node with the name, or NONE */
+			uint32_t getNode(const std::string &name) const { return snapshot->index.getNode(name); };
+			std::string getPathToRoot(const std::string &name) const;
+			/** -1 if no node has the name */
+			int getDepth(const std::string &name) const;
+			/** 0 if no node has the name */
+			unsigned int getSubtreeSize(const std::string &name) const;
+			unsigned int getCladeLeafCount(const std::string &name) const;
+			/** NAN if no node has the name */
+			double getDistanceToRoot(const std::string &name) const;
+
+			/** as KBAncestorIndex::getLowestCommonAncestorNames, for name pairs given as a1;b1;a2;b2;... */
+			std::string getLowestCommonAncestorNames(const std::string &namePairs) const { return snapshot->index.getLowestCommonAncestorNames(namePairs); };
+			/** as KBAncestorIndex::isMonophyletic, for names given as name1;name2;... */
+			bool isMonophyletic(const std::string &leafNames) const { return snapshot->index.isMonophyletic(leafNames); };
+			/** the patristic distance between the two named nodes; NAN if either is not found or they are in
+			 * different top level trees */
+			double getPatristicDistance(const std::string &nameA, const std::string &nameB) const;
+			/** as the KBTree methods of the same names; matrices are written at the output precision of the tree
+			 * that was frozen */
+			bool getPatristicDistances(const std::vector<std::string> &names, double *distances, unsigned int threadCount=0) const;
+			bool writePatristicDistances(KBOutputSink &out, const std::string &names="", unsigned int format=KBTree::PHYLIP_MATRIX, unsigned int threadCount=0) const;
+			bool writePatristicDistancesToFile(const std::string &filename, const std::string &names="", unsigned int format=KBTree::PHYLIP_MATRIX, unsigned int threadCount=0) const;
+
+			/** the Newick text, with the output flags of the tree that was frozen, or in the style (see
+			 * KBCompactTree::toNewick) */
+			std::string toNewick() const { return snapshot->tree.toNewick(); };
+			std::string toNewick(unsigned int style) const { return snapshot->tree.toNewick(style); };
+			void writeNewick(KBOutputSink &out) const { snapshot->tree.writeNewick(out); };
+			void writeNewick(KBOutputSink &out, unsigned int style) const { snapshot->tree.writeNewick(out,style); };
+			/** as KBTree::writeNewickToFile */
+			bool writeNewickToFile(const std::string &filename) const;
+			bool writeNewickToFile(const std::string &filename, unsigned int style) const;
+
+			/** an editable KBTree with the same nodes, original labels and output flags; the caller owns (and must
+			 * delete) it */
+			KBTree *toKBTree() const;
+
+			// Edits, which leave this snapshot as it is and return a new one, as if the edit were made on
+			// toKBTree() and the result frozen.
+			KBFrozenTree removeNodesByNameAndSimplify(const std::string &nodeNames) const;
+			KBFrozenTree replaceNodeNames(const std::string &replacements) const;
+
+		private:
+			struct Snapshot {
+				KBCompactTree tree;
+				KBAncestorIndex index;
+				// the output flags of the tree that was frozen, which toKBTree passes on
+				bool with_labels;
+				bool with_distances;
+				bool with_comments;
+				bool with_bootstrap_values_as_labels;
+				int output_precision;
+
+				Snapshot(KBTree &source);
+				Snapshot(const std::string &newickString, bool assumeBootstrapNames);
+			};
+
+			std::shared_ptr<const Snapshot> snapshot;
+	};
+
+};
+
+#endif /* KBFROZEN_HH_ */
@@ -0,0 +1,325 @@
+/**
+ * @file kbparallel.cpp
+ * @brief Parsing a single large Newick tree on several threads
+ *
+ * A tree of the form (clade,clade,...,clade)root; is split at the commas that separate its top level
+ * clades.  These are found by computing the parenthesis depth at every structural character with a two
+ * pass parallel prefix sum over the structural index.  The node of each clade is then created under the
+ * root, in input order, and the clades are parsed concurrently, each thread building nodes only below
+ * the clade nodes it was given and adding label strings only to its own shard of the label table.
+ * Finally the root label is parsed as usual.
+ *
+ * The result must be exactly what parseNewickNonRecursive builds, including the order in which bootstrap
+ * names are rejected and the error reported for a bad label.  Rather than reproduce those sequential side
+ * effects, the parallel parse gives up on a tree if any clade hits one of them, and the caller parses the
+ * tree again on a single thread.
+ *
+ * Writing is split up differently, because the subtrees of a tree can be arbitrarily lopsided.  The text
+ * is a sequence of node labels in postorder, each preceded by the parentheses opened just before it and
+ * followed by a comma or parenthesis.  The calling thread walks the tree to list these steps for a window
+ * of nodes, which is cheap, and the threads format the labels of consecutive chunks of the window into
+ * buffers of their own, which is not.  The buffers of a window are written out in order while the next
+ * window is formatted, so memory use depends on the number of threads rather than the size of the tree.
+ */
+
+#include "kbtree.hh"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <thread>
+
+using namespace std;
+using namespace KBTreeLib;
+
+
+/** below this size the threads cost more than they save */
+static const size_t PARALLEL_PARSE_MIN_BYTES = 1<<20;
+/** below this many nodes the threads cost more than they save when writing */
+static const unsigned int PARALLEL_WRITE_MIN_NODES = 1<<16;
+/** labels that one thread formats into one buffer, and buffers per thread in each window */
+static const size_t WRITE_CHUNK_NODES = 1<<13;
+static const size_t WRITE_CHUNKS_PER_THREAD = 4;
+
+/** run task(0) ... task(threadCount-1) concurrently, the first on the calling thread */
+static void runOnThreads(unsigned int threadCount, const std::function<void(unsigned int)> &task) {
+	std::vector<std::thread> threads;
+	for(unsigned int t=1; t<threadCount; t++) { threads.push_back(std::thread(task,t)); }
+	task(0);
+	for(size_t t=0; t<threads.size(); t++) { threads[t].join(); }
+}
+
+/** a top level clade: the text [begin,end) and the index entry of the first structural character in it */
+struct CladeSpan {
+	size_t begin;
+	size_t end;
+	size_t firstEntry;
+};
+
+/** result of scanning the parenthesis depth over one run of structural index entries */
+struct DepthScan {
+	long delta;                      // net change in depth over the run
+	std::vector<size_t> separators;  // entries that are commas at depth 1
+	size_t close;                    // first entry that closes depth 1, or string::npos
+	bool emptyParentheses;           // found "()", which the sequential parser does not treat as a clade
+};
+
+/** one node in the order its label is written: the parentheses opened just before the label (only ever
+ * before a leaf), the node, and the character that follows the label */
+struct OutputStep {
+	tree_node_<KBNode> *node;
+	uint32_t opens;
+	char next;
+};
+
+/** the steps of a run of nodes, and the text of each chunk of them once formatted */
+struct OutputWindow {
+	std::vector<OutputStep> steps;
+	std::vector<std::string> chunks;
+	size_t used;   // chunks holding steps
+};
+
+
+bool KBTree::parseNewickParallel(std::string_view newickString, const KBStructuralIndex &structure, unsigned int threadCount)
+{
+	if(threadCount==0) { threadCount=std::thread::hardware_concurrency(); }
+	// each thread adds label strings to a shard of the label table of its own, next to the main shard 0
+	if(threadCount>=KBStringTable::SHARD_COUNT) { threadCount=KBStringTable::SHARD_COUNT-1; }
+	if(threadCount<=1 || verbose || newickString.size()<PARALLEL_PARSE_MIN_BYTES) { return false; }
+
+	// the text must start with the parenthesis that opens the root's children
+	const char *buf = newickString.data();
+	const size_t entries = structure.size();
+	size_t start = 0;
+	passLeadingWhiteSpace(newickString,start);
+	if(entries<2 || structure.getPosition(0)!=start || buf[start]!='(') { return false; }
+
+	// depth of every entry after the first, by a parallel prefix sum: first the net change of each run of
+	// entries, then the depth at the start of each run, then a second pass that knows its starting depth
+	std::vector<DepthScan> scans(threadCount);
+	std::vector<long> runDepth(threadCount);
+	auto runBegin = [entries,threadCount](unsigned int run) { return 1+(entries-1)*run/threadCount; };
+	runOnThreads(threadCount,[&](unsigned int run) {
+		long delta=0;
+		for(size_t e=runBegin(run); e<runBegin(run+1); e++) {
+			char C = buf[structure.getPosition(e)];
+			if(C=='(') { delta++; }
+			else if(C==')') { delta--; }
+		}
+		scans[run].delta=delta;
+	});
+	long depth = 1;
+	for(unsigned int run=0; run<threadCount; run++) { runDepth[run]=depth; depth+=scans[run].delta; }
+	runOnThreads(threadCount,[&](unsigned int run) {
+		DepthScan &scan = scans[run];
+		long d = runDepth[run];
+		scan.close = string::npos;
+		scan.emptyParentheses = false;
+		for(size_t e=runBegin(run); e<runBegin(run+1); e++) {
+			size_t pos = structure.getPosition(e);
+			char C = buf[pos];
+			if(C=='(') {
+				d++;
+				if(pos+1<newickString.size() && buf[pos+1]==')') { scan.emptyParentheses=true; }
+			}
+			else if(C==')') {
+				if(d==1 && scan.close==string::npos) { scan.close=e; }
+				d--;
+			}
+			else if(C==',' && d==1) { scan.separators.push_back(e); }
+		}
+	});
+
+	// the clades end where depth 1 is first closed, and only the root label and semicolon may follow
+	size_t close = string::npos;
+	for(unsigned int run=0; run<threadCount && close==string::npos; run++) { close=scans[run].close; }
+	if(close==string::npos) { return false; }
+	for(unsigned int run=0; run<threadCount; run++) { if(scans[run].emptyParentheses) { return false; } }
+	if(close+1<entries) {
+		if(close+2!=entries || buf[structure.getPosition(close+1)]!=';') { return false; }
+		size_t trailing = structure.getPosition(close+1)+1;
+		passLeadingWhiteSpace(newickString,trailing);
+		if(trailing<newickString.size()) { return false; }
+	}
+	std::vector<CladeSpan> clades;
+	CladeSpan clade = { start+1, 0, 1 };
+	for(unsigned int run=0; run<threadCount; run++) {
+		for(size_t s=0; s<scans[run].separators.size() && scans[run].separators[s]<close; s++) {
+			clade.end = structure.getPosition(scans[run].separators[s]);
+			clades.push_back(clade);
+			clade.begin = clade.end+1;
+			clade.firstEntry = scans[run].separators[s]+1;
+		}
+	}
+	clade.end = structure.getPosition(close);
+	clades.push_back(clade);
+	if(clades.size()<2) { return false; }
+	if(clades.size()<threadCount) { threadCount=(unsigned int)clades.size(); }
+
+	// create the clade nodes in order, so sibling order is fixed before any thread starts
+	KBNodeTree::iterator root = tr->begin();
+	std::vector<KBNodeTree::iterator> cladeNodes(clades.size());
+	cladeNodes[0] = tr->insert(root.begin(),KBNode(labelTable));
+	for(size_t c=1; c<clades.size(); c++) { cladeNodes[c] = tr->insert_after(cladeNodes[c-1],KBNode(labelTable)); }
+
+	// threads take the largest remaining clade until none are left
+	std::vector<size_t> order(clades.size());
+	for(size_t c=0; c<order.size(); c++) { order[c]=c; }
+	std::stable_sort(order.begin(),order.end(),[&clades](size_t a, size_t b) {
+		return clades[a].end-clades[a].begin > clades[b].end-clades[b].begin;
+	});
+	std::atomic<size_t> nextClade(0);
+	std::atomic<bool> failed(false);
+	std::vector<std::unique_ptr<KBLabelArena> > arenas(threadCount);
+	std::vector<unsigned int> nodeCounts(threadCount,0);
+	// every thread adds nodes to the same tree, so its node pool hands each thread chunks of its own
+	tr->node_allocator().setConcurrent(true);
+	runOnThreads(threadCount,[&](unsigned int thread) {
+		arenas[thread].reset(new KBLabelArena());
+		ParseState state(labelTable,thread+1,*arenas[thread],this->assumeBootstrapNames,this->lazyLabels,this->keepOriginalLabels);
+		state.quiet = true;
+		try {
+			for(size_t next=nextClade++; next<order.size() && !failed; next=nextClade++) {
+				const CladeSpan &span = clades[order[next]];
+				state.nextEntry = span.firstEntry;
+				parseSubtree(newickString,&structure,span.begin,span.end,cladeNodes[order[next]],state);
+				if(state.rejectedBootstrapName) { failed=true; }
+			}
+		} catch (...) {
+			failed=true;
+		}
+		nodeCounts[thread]=state.nodeCount;
+		tr->node_allocator().releaseThreadCache();
+	});
+	tr->node_allocator().setConcurrent(false);
+	if(failed) {
+		tr->erase_children(root);
+		for(unsigned int thread=0; thread<threadCount; thread++) { labelTable.clearShard(thread+1); }
+		return false;
+	}
+
+	for(unsigned int thread=0; thread<threadCount; thread++) {
+		labelArena.absorb(*arenas[thread]);
+		this->nodeCount += nodeCounts[thread];
+	}
+	this->nodeCount += clades.size();
+
+	// and last, the root label
+	ParseState state(labelTable,0,labelArena,this->assumeBootstrapNames,this->lazyLabels,this->keepOriginalLabels);
+	state.nextEntry = close+1;
+	parseSubtree(newickString,&structure,structure.getPosition(close)+1,newickString.size(),root,state);
+	this->nodeCount += state.nodeCount;
+	this->assumeBootstrapNames = state.assumeBootstrapNames;
+	return true;
+}
+
+
+bool KBTree::writeNewickParallel(KBOutputSink &out, bool useStyle, unsigned int style)
+{
+	unsigned int threadCount = output_thread_count;
+	if(threadCount==0) { threadCount=std::thread::hardware_concurrency(); }
+	if(threadCount<=1 || nodeCount<PARALLEL_WRITE_MIN_NODES) { return false; }
+
+	// a label is read in the workers without decoding it, as decoding a lazy label adds it to the table
+	auto writeStep = [this,useStyle,style](KBOutputSink &sink, const OutputStep &step, bool concurrent) {
+		for(uint32_t k=0; k<step.opens; k++) { sink.put('('); }
+		KBLabelText label;
+		if(concurrent) { step.node->data.readLabelText(labelTable,label); }
+		else { label = step.node->data.getLabelText(labelTable); }
+		if(useStyle) { KBNode::writeLabel(sink,label,style,output_precision); }
+		else { KBNode::writeLabel(sink,label,with_labels,with_distances,with_comments,with_bootstrap_values_as_labels,output_precision); }
+		sink.put(step.next);
+	};
+
+	// the walk is the one of writeNewick, stopping at the end of each window
+	tree_node_<KBNode> *end = tr->end().node;
+	tree_node_<KBNode> *node = tr->begin().node;
+	bool descend = true;
+	bool done = false;
+	const size_t chunkCount = threadCount*WRITE_CHUNKS_PER_THREAD;
+	auto walkWindow = [&](OutputWindow &window) {
+		window.steps.clear();
+		while(!done && window.steps.size()<chunkCount*WRITE_CHUNK_NODES) {
+			OutputStep step;
+			step.opens = 0;
+			if(descend) {
+				while(node->first_child!=NULL) { step.opens++; node=node->first_child; }
+			}
+			step.node = node;
+			if(node->next_sibling!=NULL && node->next_sibling!=end) {
+				step.next = ',';
+				node = node->next_sibling;
+				descend = true;
+			} else if(node->parent==NULL) {
+				step.next = ';';
+				done = true;
+			} else {
+				step.next = ')';
+				node = node->parent;
+				descend = false;
+			}
+			window.steps.push_back(step);
+		}
+		window.used = (window.steps.size()+WRITE_CHUNK_NODES-1)/WRITE_CHUNK_NODES;
+	};
+	auto writeChunks = [&out](OutputWindow &window) {
+		for(size_t c=0; c<window.used; c++) { out.write(window.chunks[c]); }
+	};
+
+	// Two windows: while the threads format the labels of the current one, the calling thread first writes
+	// out the previous one, and lists the steps of the next one in its place, before it joins in.
+	OutputWindow windows[2];
+	for(int w=0; w<2; w++) {
+		windows[w].steps.reserve(chunkCount*WRITE_CHUNK_NODES);
+		windows[w].chunks.resize(chunkCount);
+	}
+	OutputWindow *current = &windows[0];
+	OutputWindow *next = &windows[1];
+	bool nextIsFormatted = false;
+	walkWindow(*current);
+	while(true) {
+		bool walkedNext = false;
+		std::exception_ptr outputError;
+		std::atomic<size_t> nextChunk(0);
+		std::atomic<bool> failed(false);
+		runOnThreads((unsigned int)std::min<size_t>(threadCount,current->used),[&](unsigned int thread) {
+			if(thread==0) {
+				try {
+					if(nextIsFormatted) { writeChunks(*next); }
+					if(!done) { walkWindow(*next); walkedNext=true; }
+				} catch (...) {
+					outputError = std::current_exception();
+					return;
+				}
+			}
+			std::string *chunk = NULL;
+			KBOutputSink sink([&chunk](const char *data, size_t length) { chunk->append(data,length); });
+			try {
+				for(size_t c=nextChunk++; c<current->used && !failed; c=nextChunk++) {
+					chunk = &current->chunks[c];
+					chunk->clear();
+					size_t last = std::min(current->steps.size(),(c+1)*WRITE_CHUNK_NODES);
+					for(size_t s=c*WRITE_CHUNK_NODES; s<last; s++) { writeStep(sink,current->steps[s],true); }
+					sink.flush();
+				}
+			} catch (...) {
+				failed=true;
+			}
+		});
+		if(outputError) { std::rethrow_exception(outputError); }
+		if(failed) {
+			// a lazy label with a malformed distance: write the window on this thread instead, which reports
+			// the error after writing exactly what the single threaded writer would have
+			for(size_t s=0; s<current->steps.size(); s++) { writeStep(out,current->steps[s],false); }
+			nextIsFormatted = false;
+		} else {
+			nextIsFormatted = true;
+		}
+		if(!walkedNext) {
+			if(nextIsFormatted) { writeChunks(*current); }
+			break;
+		}
+		std::swap(current,next);
+	}
+	return true;
+}
@@ -0,0 +1,159 @@
+/**
+ * @file kbstatistics.cpp
+ * @brief Counting the nodes of a Newick tree without building it
+ *
+ * The parser creates a node at every ( and every , and a node has children exactly when a ( follows its
+ * label, so the node and leaf counts only need the structural characters, which come from the streaming
+ * structural scanner.  Labels are looked at only as far as needed to see whether they have a distance or,
+ * after a ), a numeric name.
+ */
+
+#include "kbtree.hh"
+
+using namespace std;
+using namespace KBTreeLib;
+
+
+/** longest internal node name that is still checked for being a number */
+static const size_t MAX_NUMERIC_NAME = 64;
+
+/** what scanStatistics needs to know about one label */
+struct LabelSummary {
+	bool hasDistance;
+	bool hasName;
+	bool nameIsNumber;
+};
+
+static inline bool isBlank(char C) { return C==' ' || C=='\t' || C=='\n' || C=='\r'; }
+
+/** a label without quotes or comments: a name, then optionally a colon and a distance */
+static void summarizePlainLabel(std::string_view label, bool needName, LabelSummary &summary) {
+	size_t colon = label.find(':');
+	summary.hasDistance = false;
+	if(colon!=string::npos) {
+		for(size_t k=colon+1; k<label.size() && !summary.hasDistance; k++) { summary.hasDistance = !isBlank(label[k]); }
+	}
+	summary.hasName = false;
+	summary.nameIsNumber = false;
+	if(needName) {
+		std::string_view name = label.substr(0,colon);
+		size_t begin=0, end=name.size();
+		while(begin<end && isBlank(name[begin])) { begin++; }
+		while(begin<end && isBlank(name[end-1])) { end--; }
+		double x;
+		summary.hasName = begin<end;
+		summary.nameIsNumber = summary.hasName && parseDouble(name.substr(begin,end-begin),x);
+	}
+}
+
+/**
+ * a label with quotes or comments, walked as KBTree::getNextLabel does: comments are skipped, quoted text is
+ * unquoted, and the first colon outside of them separates the name from the distance.  The name is only
+ * collected (into a small fixed buffer) when needed, and only for checking that it is a number.
+ */
+static void summarizeLabel(std::string_view label, bool needName, LabelSummary &summary) {
+	char name[MAX_NUMERIC_NAME];
+	size_t nameLength = 0;
+	bool nameTooLong = false;
+	bool inComment = false;
+	bool afterColon = false;
+	summary.hasDistance = false;
+	// text outside of comments goes to the name or the distance
+	auto addText = [&](char C) {
+		if(afterColon) { if(!isBlank(C)) { summary.hasDistance=true; } }
+		else if(needName && !(nameLength==0 && isBlank(C))) {
+			if(nameLength<MAX_NUMERIC_NAME) { name[nameLength++]=C; }
+			else { nameTooLong=true; }
+		}
+	};
+	for(size_t k=0; k<label.size(); k++) {
+		char C = label[k];
+		if(C=='\'' || C=='"') {
+			for(k++; k<label.size(); k++) {
+				if(label[k]=='\\' && k+1<label.size() && label[k+1]==C) { k++; }
+				else if(label[k]==C) { break; }
+				if(!inComment) { addText(label[k]); }
+			}
+		}
+		else if(C==']') { inComment=false; }
+		else if(inComment) { }
+		else if(C=='[') { inComment=true; }
+		else if(C==':' && !afterColon) { afterColon=true; }
+		else { addText(C); }
+	}
+	while(nameLength>0 && isBlank(name[nameLength-1])) { nameLength--; }
+	double x;
+	summary.hasName = nameLength>0 || nameTooLong;
+	summary.nameIsNumber = summary.hasName && !nameTooLong && parseDouble(std::string_view(name,nameLength),x);
+}
+
+
+KBTreeStatistics KBTree::scanStatistics(std::string_view newickString)
+{
+	KBTreeStatistics stats;
+	unsigned int nodeCount = 1;        // the root
+	unsigned int internalCount = 0;
+	unsigned int depth = 0;            // nesting depth, which is also the depth of the nodes a , creates
+	unsigned int namedInternalCount = 0;
+	bool allInternalNamesAreNumbers = true;
+
+	const char *buf = newickString.data();
+	KBStructuralScanner scanner(newickString);
+	size_t labelStart = 0;
+	char previous = 0;                 // the structural character before the current label, or 0 at the start
+	bool currentHasChildren = false;   // whether the node the parser is on already has children
+	size_t position;
+	bool labelHasSpecials;
+	bool more = true;
+	while(more) {
+		more = scanner.next(position,labelHasSpecials);
+		// the text after the last structural character is a label too, walked the slow way
+		if(!more) { position=newickString.size(); labelHasSpecials=true; }
+
+		// the label between two structural characters belongs to an internal node if it follows a ), and
+		// otherwise to the node created by the ( or , before it.  Once branch lengths have been seen and
+		// bootstrap values ruled out, there is nothing left to learn from labels.
+		std::string_view label = newickString.substr(labelStart,position-labelStart);
+		bool internal = (previous==')');
+		bool needName = internal && allInternalNamesAreNumbers;
+		if(!label.empty() && (needName || !stats.branchLengths)) {
+			LabelSummary summary;
+			if(labelHasSpecials) { summarizeLabel(label,needName,summary); }
+			else { summarizePlainLabel(label,needName,summary); }
+			if(summary.hasDistance) { stats.branchLengths=true; }
+			if(needName && summary.hasName) {
+				namedInternalCount++;
+				if(!summary.nameIsNumber) { allInternalNamesAreNumbers=false; }
+			}
+		}
+		if(!more) { break; }
+
+		char C = buf[position];
+		if(C=='(') {
+			// a new first child; its parent is an internal node unless it already had children
+			nodeCount++;
+			if(!currentHasChildren) { internalCount++; }
+			currentHasChildren = false;
+			if(depth+1>stats.maxDepth) { stats.maxDepth=depth+1; }
+			// the parser reads "()" as an unlabeled leaf whose ) closes the parent, so the depth stays
+			if(position+1>=newickString.size() || buf[position+1]!=')') { depth++; }
+		}
+		else if(C==',') {
+			nodeCount++;
+			currentHasChildren = false;
+		}
+		else if(C==')') {
+			// closing the root's parent ends the parse, and anything after it is ignored
+			if(depth==0) { break; }
+			depth--;
+			currentHasChildren = true;
+		}
+		labelStart = position+1;
+		previous = C;
+	}
+
+	stats.nodeCount = nodeCount;
+	stats.leafCount = nodeCount-internalCount;
+	stats.bootstrapValues = namedInternalCount>0 && allInternalNamesAreNumbers;
+	return stats;
+}
@@ -0,0 +1,191 @@
+/**
+ * @file kbstructural.cpp
+ * @brief Vectorized structural index of Newick text
+ *
+ * The scan works on 64 byte blocks.  Each block is first classified with vector compares into two
+ * bitmasks: structural characters ( ) , ; and "special" characters ' " [ ] that start or end quoted text
+ * and comments.  Blocks without special characters (the vast majority in real trees) outside of a quote
+ * or comment need no further work.  Otherwise only the special characters are walked, in order, to find
+ * the quoted and commented ranges, which are then masked out of the structural bits.
+ */
+
+#include "kbstructural.hh"
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define KBTREE_X86_SIMD
+#include <immintrin.h>
+#endif
+
+using namespace KBTreeLib;
+
+
+// bits [first,last] of a block
+static inline uint64_t bitRange(unsigned int first, unsigned int last) {
+	uint64_t upTo = (last>=63) ? ~(uint64_t)0 : (((uint64_t)1)<<(last+1))-1;
+	return upTo & ~((((uint64_t)1)<<first)-1);
+}
+
+static inline unsigned int lowestBit(uint64_t x) { return (unsigned int)__builtin_ctzll(x); }
+static inline unsigned int highestBit(uint64_t x) { return 63-(unsigned int)__builtin_clzll(x); }
+
+
+///////////////////////////////////////////////////////////////////////////////////////////
+// block classifiers, one per instruction set
+
+static void classifyScalar(const char *block, uint64_t &structural, uint64_t &special) {
+	structural=0; special=0;
+	for(unsigned int i=0; i<64; i++) {
+		char C = block[i];
+		if(C=='(' || C==')' || C==',' || C==';') { structural |= ((uint64_t)1)<<i; }
+		else if(C=='\'' || C=='"' || C=='[' || C==']') { special |= ((uint64_t)1)<<i; }
+	}
+}
+
+#ifdef KBTREE_X86_SIMD
+
+__attribute__((target("sse2")))
+static inline uint64_t matchSSE2(const __m128i chunk[4], char C) {
+	const __m128i c = _mm_set1_epi8(C);
+	uint64_t m0 = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk[0],c));
+	uint64_t m1 = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk[1],c));
+	uint64_t m2 = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk[2],c));
+	uint64_t m3 = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk[3],c));
+	return m0 | (m1<<16) | (m2<<32) | (m3<<48);
+}
+
+__attribute__((target("sse2")))
+static void classifySSE2(const char *block, uint64_t &structural, uint64_t &special) {
+	__m128i chunk[4];
+	for(unsigned int i=0; i<4; i++) { chunk[i] = _mm_loadu_si128((const __m128i *)(block+16*i)); }
+	structural = matchSSE2(chunk,'(') | matchSSE2(chunk,')') | matchSSE2(chunk,',') | matchSSE2(chunk,';');
+	special = matchSSE2(chunk,'\'') | matchSSE2(chunk,'"') | matchSSE2(chunk,'[') | matchSSE2(chunk,']');
+}
+
+__attribute__((target("avx2")))
+static inline uint64_t matchAVX2(__m256i lo, __m256i hi, char C) {
+	const __m256i c = _mm256_set1_epi8(C);
+	uint64_t mlo = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo,c));
+	uint64_t mhi = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi,c));
+	return mlo | (mhi<<32);
+}
+
+__attribute__((target("avx2")))
+static void classifyAVX2(const char *block, uint64_t &structural, uint64_t &special) {
+	const __m256i lo = _mm256_loadu_si256((const __m256i *)block);
+	const __m256i hi = _mm256_loadu_si256((const __m256i *)(block+32));
+	structural = matchAVX2(lo,hi,'(') | matchAVX2(lo,hi,')') | matchAVX2(lo,hi,',') | matchAVX2(lo,hi,';');
+	special = matchAVX2(lo,hi,'\'') | matchAVX2(lo,hi,'"') | matchAVX2(lo,hi,'[') | matchAVX2(lo,hi,']');
+}
+
+#endif
+
+
+///////////////////////////////////////////////////////////////////////////////////////////
+
+KBStructuralScanner::KBStructuralScanner(std::string_view text)
+	: KBStructuralScanner(text,getBestImplementation()) { }
+
+KBStructuralScanner::KBStructuralScanner(std::string_view text, Implementation requested) {
+	if(requested>getBestImplementation()) { requested=SCALAR; }
+	this->text=text;
+	this->implementation=requested;
+	this->classify=classifyScalar;
+#ifdef KBTREE_X86_SIMD
+	if(requested==AVX2) { classify=classifyAVX2; }
+	else if(requested==SSE2) { classify=classifySSE2; }
+#endif
+	nextBase=0;
+	blockBase=0;
+	pending=0;
+	blockSpecial=0;
+	state=SCAN_NORMAL;
+	stateAfterQuote=SCAN_NORMAL;
+	quoteChar=0;
+	quoteStart=0;
+	lastStructuralEnd=0;
+	lastSpecialEnd=0;
+}
+
+KBStructuralScanner::Implementation KBStructuralScanner::getBestImplementation() {
+#ifdef KBTREE_X86_SIMD
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("avx2")) { return AVX2; }
+	if(__builtin_cpu_supports("sse2")) { return SSE2; }
+#endif
+	return SCALAR;
+}
+
+void KBStructuralScanner::loadBlock() {
+	if(blockSpecial) { lastSpecialEnd = blockBase+highestBit(blockSpecial)+1; }
+	blockBase = nextBase;
+	nextBase += 64;
+	uint64_t structural;
+	if(blockBase+64<=text.size()) {
+		classify(text.data()+blockBase,structural,blockSpecial);
+	} else {
+		// the last partial block is padded with blanks, which belong to no character class
+		char tail[64];
+		memset(tail,' ',64);
+		memcpy(tail,text.data()+blockBase,text.size()-blockBase);
+		classify(tail,structural,blockSpecial);
+	}
+	if(blockSpecial!=0 || state!=SCAN_NORMAL) {
+		structural &= ~resolveQuotesAndComments(blockBase,blockSpecial);
+	}
+	pending = structural;
+}
+
+uint64_t KBStructuralScanner::resolveQuotesAndComments(size_t base, uint64_t special) {
+	// walk the quote and bracket characters of the block in order, collecting the ranges that are inside
+	// quotes or comments.  A range still open at the end of the block runs to the end of the block.
+	const char *buf = text.data();
+	uint64_t inside = 0;
+	unsigned int rangeStart = 0;
+	while(special) {
+		unsigned int bit = lowestBit(special);
+		special &= special-1;
+		size_t pos = base+bit;
+		char C = buf[pos];
+		if(state==SCAN_IN_QUOTE) {
+			// a backslash right before the quote character escapes it (see scanQuotedText in kbtree.cpp)
+			if(C==quoteChar && !(pos-1>quoteStart && buf[pos-1]=='\\')) {
+				state = stateAfterQuote;
+				if(state==SCAN_NORMAL) { inside |= bitRange(rangeStart,bit); }
+			}
+		} else if(state==SCAN_IN_COMMENT) {
+			if(C=='\'' || C=='"') { state=SCAN_IN_QUOTE; stateAfterQuote=SCAN_IN_COMMENT; quoteChar=C; quoteStart=pos; }
+			else if(C==']') { state=SCAN_NORMAL; inside |= bitRange(rangeStart,bit); }
+		} else {
+			if(C=='\'' || C=='"') { state=SCAN_IN_QUOTE; stateAfterQuote=SCAN_NORMAL; quoteChar=C; quoteStart=pos; rangeStart=bit; }
+			else if(C=='[') { state=SCAN_IN_COMMENT; rangeStart=bit; }
+		}
+	}
+	if(state!=SCAN_NORMAL) { inside |= bitRange(rangeStart,63); }
+	return inside;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////
+
+KBStructuralIndex::KBStructuralIndex() {
+	this->implementation=SCALAR;
+}
+KBStructuralIndex::~KBStructuralIndex() { }
+
+void KBStructuralIndex::build(std::string_view text) {
+	build(text,getBestImplementation());
+}
+
+void KBStructuralIndex::build(std::string_view text, Implementation requested) {
+	entries.clear();
+	// structural characters are typically a few percent of the text
+	entries.reserve(text.size()/16+16);
+	KBStructuralScanner scanner(text,requested);
+	this->implementation=scanner.getImplementation();
+	size_t position;
+	bool labelHasSpecials;
+	while(scanner.next(position,labelHasSpecials)) {
+		entries.push_back(labelHasSpecials ? (position|LABEL_HAS_SPECIALS) : position);
+	}
+}
@@ -0,0 +1,130 @@
+/**
+ * @file kbstructural.hh
+ * @brief Vectorized structural index of Newick text
+ *
+ * Before a tree is built, the Newick text is scanned 64 bytes at a time with SIMD compares to find
+ * every structural character - ( ) , and ; - that lies outside quoted text and [comments].  The tree
+ * builder then jumps from one structural position to the next instead of inspecting every character,
+ * and labels between them that contain no quotes or comments are decoded without a character walk.
+ * Scans that only need to look at each structural character once (such as counting nodes) can use the
+ * streaming scanner directly and never store the positions.
+ */
+
+#ifndef KBSTRUCTURAL_HH_
+#define KBSTRUCTURAL_HH_
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace KBTreeLib {
+
+	/**
+	 * Streaming scan for the structural characters of a Newick string, in order, holding only the
+	 * current 64 byte block.  Quotes and comments are recognized exactly as KBTree::getNextLabel does:
+	 * text in '...' or "..." (where a backslash escapes the quote character) and text in [...] (where
+	 * quotes are still recognized) never contains structural characters.  Each structural character also
+	 * comes with whether the label text since the previous structural character contains any quote or
+	 * bracket, so that plain labels can take a fast path.
+	 */
+	class KBStructuralScanner
+	{
+		public:
+			/** which instruction set the scanner uses */
+			enum Implementation { SCALAR=0, SSE2=1, AVX2=2 };
+
+			/** scan the text with the best implementation supported by this cpu; the text must outlive the scanner */
+			KBStructuralScanner(std::string_view text);
+			/** scan the text with a specific implementation (falls back to SCALAR if not supported) */
+			KBStructuralScanner(std::string_view text, Implementation implementation);
+
+			/** find the next structural character; returns false once there are no more */
+			inline bool next(size_t &position, bool &labelHasSpecials) {
+				while(pending==0) {
+					if(nextBase>=text.size()) { return false; }
+					loadBlock();
+				}
+				unsigned int bit = (unsigned int)__builtin_ctzll(pending);
+				pending &= pending-1;
+				position = blockBase+bit;
+				// did a quote or bracket appear since the previous structural character?
+				uint64_t specialBefore = blockSpecial & ((((uint64_t)1)<<bit)-1);
+				size_t specialEnd = specialBefore ? blockBase+64-(size_t)__builtin_clzll(specialBefore) : lastSpecialEnd;
+				labelHasSpecials = specialEnd>lastStructuralEnd;
+				lastStructuralEnd = position+1;
+				return true;
+			};
+
+			/** the best implementation supported by this cpu */
+			static Implementation getBestImplementation();
+			/** the implementation this scanner uses */
+			Implementation getImplementation() const { return implementation; };
+
+		private:
+			enum ScanState { SCAN_NORMAL, SCAN_IN_COMMENT, SCAN_IN_QUOTE };
+
+			void loadBlock();
+			uint64_t resolveQuotesAndComments(size_t base, uint64_t special);
+
+			std::string_view text;
+			Implementation implementation;
+			void (*classify)(const char *block, uint64_t &structural, uint64_t &special);
+
+			// the current block: structural characters not yet returned, and its quotes and brackets
+			size_t nextBase;
+			size_t blockBase;
+			uint64_t pending;
+			uint64_t blockSpecial;
+
+			// scan state carried from one block to the next
+			ScanState state;
+			ScanState stateAfterQuote;  // where a quote returns to: SCAN_NORMAL, or SCAN_IN_COMMENT for quotes inside comments
+			char quoteChar;
+			size_t quoteStart;
+			size_t lastStructuralEnd;   // one past the last structural position, or 0
+			size_t lastSpecialEnd;      // one past the last quote or bracket position before the current block, or 0
+	};
+
+
+	/**
+	 * Positions of the structural characters of a Newick string, in order, as found by KBStructuralScanner.
+	 */
+	class KBStructuralIndex
+	{
+		public:
+			typedef KBStructuralScanner::Implementation Implementation;
+			static constexpr Implementation SCALAR = KBStructuralScanner::SCALAR;
+			static constexpr Implementation SSE2 = KBStructuralScanner::SSE2;
+			static constexpr Implementation AVX2 = KBStructuralScanner::AVX2;
+
+			KBStructuralIndex();
+			~KBStructuralIndex();
+
+			/** index the text with the best implementation supported by this cpu */
+			void build(std::string_view text);
+			/** index the text with a specific implementation (falls back to SCALAR if not supported) */
+			void build(std::string_view text, Implementation implementation);
+
+			/** the best implementation supported by this cpu */
+			static Implementation getBestImplementation() { return KBStructuralScanner::getBestImplementation(); };
+			/** the implementation used by the last call to build() */
+			Implementation getImplementation() const { return implementation; };
+
+			/** number of structural characters found */
+			size_t size() const { return entries.size(); };
+			/** position in the text of the i-th structural character */
+			size_t getPosition(size_t i) const { return entries[i] & ~LABEL_HAS_SPECIALS; };
+			/** true if the text between structural character i-1 (or the start) and i has a quote or bracket */
+			bool labelHasSpecials(size_t i) const { return (entries[i] & LABEL_HAS_SPECIALS)!=0; };
+
+		private:
+			static const size_t LABEL_HAS_SPECIALS = ((size_t)1)<<(sizeof(size_t)*8-1);
+
+			Implementation implementation;
+			std::vector<size_t> entries;
+	};
+
+};
+
+#endif /* KBSTRUCTURAL_HH_ */
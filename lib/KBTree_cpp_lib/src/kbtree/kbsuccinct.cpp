@@ -0,0 +1,548 @@
+/**
+ * @file kbsuccinct.cpp
+ * @brief Succinct (balanced parentheses) representation of the shape of a tree
+ */
+
+#include "kbsuccinct.hh"
+#include <algorithm>
+#include <climits>
+
+using namespace std;
+using namespace KBTreeLib;
+
+
+/** for every byte of parentheses (bit 0 first): the change in excess over the byte, the least and greatest
+ * excess after each of its bits, and the least excess before each of its bits, all relative to its start;
+ * and the bit holding each of its opens */
+struct ExcessTables {
+	int8_t change[256];
+	int8_t minAfter[256];
+	int8_t maxAfter[256];
+	int8_t minBefore[256];
+	uint8_t selectOpen[256][8];
+
+	ExcessTables() {
+		for(int byte=0; byte<256; byte++) {
+			int excess = 0, least = 8, greatest = -8, leastBefore = 0, opens = 0;
+			for(int bit=0; bit<8; bit++) {
+				if((byte>>bit)&1) { selectOpen[byte][opens++] = (uint8_t)bit; }
+				leastBefore = std::min(leastBefore,excess);
+				excess += (byte>>bit)&1 ? 1 : -1;
+				least = std::min(least,excess);
+				greatest = std::max(greatest,excess);
+			}
+			change[byte] = (int8_t)excess;
+			minAfter[byte] = (int8_t)least;
+			maxAfter[byte] = (int8_t)greatest;
+			minBefore[byte] = (int8_t)leastBefore;
+		}
+	}
+};
+static const ExcessTables tables;
+
+static inline unsigned int byteAt(const std::vector<uint64_t> &bits, uint64_t position) {
+	return (unsigned int)(bits[position>>6]>>(position&63)) & 0xff;
+}
+
+
+KBSuccinctTopology::KBSuccinctTopology() {
+	build(KBNodeTree());
+}
+
+KBSuccinctTopology::KBSuccinctTopology(const KBNodeTree &tree) {
+	build(tree);
+}
+
+KBSuccinctTopology::~KBSuccinctTopology() { }
+
+void KBSuccinctTopology::build(const KBNodeTree &tree)
+{
+	const size_t n = tree.size();
+	if(n>=(size_t)INT32_MAX) { throw ParseException("Tree has too many nodes for a KBSuccinctTopology.","KBSuccinctTopology::KBSuccinctTopology()"); }
+	nodeCount = 0;
+	length = 0;
+	// whole blocks, plus one spare word so that a node's first child can be looked for without a bounds check
+	const size_t blocks = (2*n+(1u<<BLOCK_SHIFT)-1)>>BLOCK_SHIFT;
+	bits.assign(blocks*WORDS_PER_BLOCK+1,0);
+	// a preorder walk that writes an open on entering a node, and a close on leaving it
+	typedef tree_node_<KBNode> TreeNode;
+	const TreeNode *end = tree.end().node;
+	const TreeNode *node = tree.begin().node;
+	while(node!=end) {
+		bits[length>>6] |= ((uint64_t)1)<<(length&63);
+		length++;
+		nodeCount++;
+		if(node->first_child!=NULL) { node=node->first_child; continue; }
+		length++;
+		// at the top level the next sibling is the end of the tree, never null
+		while(node->next_sibling==NULL) {
+			node = node->parent;
+			length++;
+		}
+		node = node->next_sibling;
+	}
+
+	wordMin.assign(bits.size(),0);
+	wordMax.assign(bits.size(),0);
+	for(size_t w=0; w<bits.size(); w++) {
+		int32_t excess = 0, least = 64, greatest = -64;
+		for(unsigned int k=0; k<8; k++) {
+			const unsigned int byte = (unsigned int)(bits[w]>>(8*k)) & 0xff;
+			least = std::min(least,excess+tables.minAfter[byte]);
+			greatest = std::max(greatest,excess+tables.maxAfter[byte]);
+			excess += tables.change[byte];
+		}
+		wordMin[w] = (int8_t)least;
+		wordMax[w] = (int8_t)greatest;
+	}
+
+	leaves = 1;
+	while(leaves<blocks) { leaves*=2; }
+	rangeMin.assign(2*leaves,INT32_MAX);
+	rangeMax.assign(2*leaves,INT32_MIN);
+	blockExcess.resize(blocks+1);
+	openSamples.clear();
+	int32_t excess = 0;
+	uint32_t opens = 0;
+	for(size_t b=0; b<blocks; b++) {
+		blockExcess[b] = excess;
+		const uint64_t start = (uint64_t)b<<BLOCK_SHIFT;
+		const uint64_t end = std::min(start+(1u<<BLOCK_SHIFT),length);
+		int32_t least = excess, greatest = excess;
+		for(uint64_t p=start; p<end; p++) {
+			if(isOpen(p)) {
+				if((opens & ((1u<<SAMPLE_SHIFT)-1))==0) { openSamples.push_back((uint32_t)b); }
+				opens++;
+				excess++;
+				greatest = std::max(greatest,excess);
+			} else {
+				excess--;
+				least = std::min(least,excess);
+			}
+		}
+		rangeMin[leaves+b] = least;
+		rangeMax[leaves+b] = greatest;
+	}
+	blockExcess[blocks] = excess;
+	for(size_t t=leaves-1; t>0; t--) {
+		rangeMin[t] = std::min(rangeMin[2*t],rangeMin[2*t+1]);
+		rangeMax[t] = std::max(rangeMax[2*t],rangeMax[2*t+1]);
+	}
+}
+
+size_t KBSuccinctTopology::getMemoryUsage() const
+{
+	return sizeof(KBSuccinctTopology) + bits.capacity()*sizeof(uint64_t) + (wordMin.capacity()+wordMax.capacity())*sizeof(int8_t) +
+		blockExcess.capacity()*sizeof(int32_t) +
+		(rangeMin.capacity()+rangeMax.capacity())*sizeof(int32_t) + openSamples.capacity()*sizeof(uint32_t);
+}
+
+
+int32_t KBSuccinctTopology::getExcess(uint64_t position) const
+{
+	const uint64_t block = position>>BLOCK_SHIFT;
+	int32_t excess = blockExcess[block];
+	const uint64_t word = position>>6;
+	for(uint64_t w=block*WORDS_PER_BLOCK; w<word; w++) { excess += 2*(int32_t)countOnes(bits[w])-64; }
+	const unsigned int rest = (unsigned int)(position&63);
+	if(rest>0) { excess += 2*(int32_t)countOnes(bits[word] & ((((uint64_t)1)<<rest)-1))-(int32_t)rest; }
+	return excess;
+}
+
+uint64_t KBSuccinctTopology::getOpen(uint32_t node) const
+{
+	// the last block starting with at most node opens before it holds the open of the node; the samples
+	// narrow down the blocks to search
+	const size_t sample = node>>SAMPLE_SHIFT;
+	size_t low = openSamples[sample];
+	size_t high = sample+1<openSamples.size() ? openSamples[sample+1] : blockExcess.size()-2;
+	while(low<high) {
+		const size_t middle = (low+high+1)/2;
+		const uint64_t start = (uint64_t)middle<<BLOCK_SHIFT;
+		if((start+(uint64_t)blockExcess[middle])/2<=node) { low=middle; } else { high=middle-1; }
+	}
+	uint64_t remaining = node-((((uint64_t)low)<<BLOCK_SHIFT)+(uint64_t)blockExcess[low])/2;
+	uint64_t word = low*WORDS_PER_BLOCK;
+	while(true) {
+		const uint64_t opens = countOnes(bits[word]);
+		if(remaining<opens) { break; }
+		remaining -= opens;
+		word++;
+	}
+	uint64_t w = bits[word];
+	unsigned int shift = 0;
+	for(uint64_t opens; remaining>=(opens=countOnes(w&0xff)); remaining-=opens) { w>>=8; shift+=8; }
+	return word*64+shift+tables.selectOpen[w&0xff][remaining];
+}
+
+bool KBSuccinctTopology::scanForward(uint64_t from, int32_t excess, uint64_t end, int32_t target, uint64_t &found) const
+{
+	// look at the excess after each bit from from up to end, skipping whole words and bytes that cannot
+	// reach target
+	const bool down = target<excess;
+	uint64_t p = from;
+	while(p<end) {
+		if((p&63)==0 && p+64<=end) {
+			const uint64_t w = p>>6;
+			if(down ? excess+wordMin[w]>target : excess+wordMax[w]<target) {
+				excess += wordChange(w);
+				p += 64;
+				continue;
+			}
+		}
+		if((p&7)==0 && p+8<=end) {
+			const unsigned int byte = byteAt(bits,p);
+			if(down ? excess+tables.minAfter[byte]>target : excess+tables.maxAfter[byte]<target) {
+				excess += tables.change[byte];
+				p += 8;
+				continue;
+			}
+		}
+		excess += isOpen(p) ? 1 : -1;
+		p++;
+		if(excess==target) { found=p; return true; }
+	}
+	return false;
+}
+
+bool KBSuccinctTopology::scanBackward(uint64_t from, int32_t excess, uint64_t begin, int32_t target, uint64_t &found) const
+{
+	// look at the excess before each bit from from-1 down to begin, for one that falls to target
+	uint64_t p = from;
+	while(p>begin) {
+		if((p&63)==0 && p>=begin+64) {
+			// the least excess after any bit of the word, or at its start
+			const uint64_t w = (p>>6)-1;
+			const int32_t start = excess-wordChange(w);
+			if(start+std::min(0,(int32_t)wordMin[w])>target) {
+				excess = start;
+				p -= 64;
+				continue;
+			}
+		}
+		if((p&7)==0 && p>=begin+8) {
+			const unsigned int byte = byteAt(bits,p-8);
+			const int32_t start = excess-tables.change[byte];
+			if(start+tables.minBefore[byte]>target) {
+				excess = start;
+				p -= 8;
+				continue;
+			}
+		}
+		p--;
+		excess -= isOpen(p) ? 1 : -1;
+		if(excess==target) { found=p; return true; }
+	}
+	return false;
+}
+
+int32_t KBSuccinctTopology::scanMinimum(uint64_t from, int32_t excess, uint64_t end) const
+{
+	int32_t least = excess;
+	uint64_t p = from;
+	while(p<end) {
+		if((p&63)==0 && p+64<=end) {
+			const uint64_t w = p>>6;
+			least = std::min(least,excess+wordMin[w]);
+			excess += wordChange(w);
+			p += 64;
+			continue;
+		}
+		if((p&7)==0 && p+8<=end) {
+			const unsigned int byte = byteAt(bits,p);
+			least = std::min(least,excess+tables.minAfter[byte]);
+			excess += tables.change[byte];
+			p += 8;
+			continue;
+		}
+		excess += isOpen(p) ? 1 : -1;
+		p++;
+		least = std::min(least,excess);
+	}
+	return least;
+}
+
+uint64_t KBSuccinctTopology::searchForward(uint64_t from, int32_t excess, int32_t target) const
+{
+	// the excess moves by one at a time, so the first position at target is the first one past it
+	if(from>=length) { return NO_POSITION; }
+	const bool down = target<excess;
+	const uint64_t block = from>>BLOCK_SHIFT;
+	uint64_t found;
+	if(scanForward(from,excess,std::min((block+1)<<BLOCK_SHIFT,length),target,found)) { return found; }
+	// climb to the nearest range to the right that reaches target, then descend to its first such block
+	size_t t = leaves+block;
+	while(true) {
+		if(t==1) { return NO_POSITION; }
+		if((t&1)==0 && reaches(t+1,target,down)) { t++; break; }
+		t >>= 1;
+	}
+	while(t<leaves) { t = reaches(2*t,target,down) ? 2*t : 2*t+1; }
+	const uint64_t next = t-leaves;
+	scanForward(next<<BLOCK_SHIFT,blockExcess[next],std::min((next+1)<<BLOCK_SHIFT,length),target,found);
+	return found;
+}
+
+uint64_t KBSuccinctTopology::searchBackward(uint64_t from, int32_t excess, int32_t target) const
+{
+	if(from==0) { return NO_POSITION; }
+	const uint64_t block = (from-1)>>BLOCK_SHIFT;
+	uint64_t found;
+	if(scanBackward(from,excess,block<<BLOCK_SHIFT,target,found)) { return found; }
+	size_t t = leaves+block;
+	while(true) {
+		if(t==1) { return NO_POSITION; }
+		if((t&1)==1 && rangeMin[t-1]<=target) { t--; break; }
+		t >>= 1;
+	}
+	while(t<leaves) { t = rangeMin[2*t+1]<=target ? 2*t+1 : 2*t; }
+	const uint64_t previous = t-leaves;
+	scanBackward(std::min((previous+1)<<BLOCK_SHIFT,length),blockExcess[previous+1],previous<<BLOCK_SHIFT,target,found);
+	return found;
+}
+
+uint64_t KBSuccinctTopology::findMinimum(uint64_t from, int32_t excess, uint64_t to, int32_t &least) const
+{
+	// find the least excess, then the first position that reaches it
+	const uint64_t firstBlock = from>>BLOCK_SHIFT;
+	const uint64_t lastBlock = to>>BLOCK_SHIFT;
+	if(firstBlock==lastBlock) {
+		least = scanMinimum(from,excess,to);
+	} else {
+		least = scanMinimum(from,excess,(firstBlock+1)<<BLOCK_SHIFT);
+		least = std::min(least,scanMinimum(lastBlock<<BLOCK_SHIFT,blockExcess[lastBlock],to));
+		// the whole blocks in between, from the range min-max tree
+		for(size_t l=leaves+firstBlock+1, r=leaves+lastBlock; l<r; l>>=1, r>>=1) {
+			if(l&1) { least = std::min(least,rangeMin[l++]); }
+			if(r&1) { least = std::min(least,rangeMin[--r]); }
+		}
+	}
+	return least==excess ? from : searchForward(from,excess,least);
+}
+
+
+uint32_t KBSuccinctTopology::getParent(uint32_t node) const
+{
+	// the parent opens at the last position before the node where the excess is one lower
+	const uint64_t open = getOpen(node);
+	const int32_t depth = getExcess(open);
+	if(depth==0) { return NONE; }
+	return (uint32_t)((searchBackward(open,depth,depth-1)+(uint64_t)(depth-1))/2);
+}
+
+uint32_t KBSuccinctTopology::getFirstChild(uint32_t node) const
+{
+	return isOpen(getOpen(node)+1) ? node+1 : NONE;
+}
+
+uint32_t KBSuccinctTopology::getNextSibling(uint32_t node) const
+{
+	const uint64_t next = getClose(getOpen(node))+1;
+	return next<length && isOpen(next) ? getNodeAt(next) : NONE;
+}
+
+bool KBSuccinctTopology::isLeaf(uint32_t node) const
+{
+	return !isOpen(getOpen(node)+1);
+}
+
+uint32_t KBSuccinctTopology::getSubtreeSize(uint32_t node) const
+{
+	const uint64_t open = getOpen(node);
+	return (uint32_t)((getClose(open)-open+1)/2);
+}
+
+uint32_t KBSuccinctTopology::getDepth(uint32_t node) const
+{
+	return (uint32_t)getExcess(getOpen(node));
+}
+
+bool KBSuccinctTopology::isAncestor(uint32_t ancestor, uint32_t node) const
+{
+	// the subtree of a node is the nodes numbered from it up to the end of its subtree
+	return ancestor<=node && node-ancestor<getSubtreeSize(ancestor);
+}
+
+uint32_t KBSuccinctTopology::getLowestCommonAncestor(uint32_t a, uint32_t b) const
+{
+	if(a>b) { std::swap(a,b); }
+	if(a==b) { return a; }
+	// Between the two opens the excess stays above the depth of a if b is in its subtree.  Otherwise it is
+	// least just before the open of the child of their lowest common ancestor that holds b, or 0 if they
+	// have no common ancestor.
+	const uint64_t openA = getOpen(a);
+	const int32_t depth = getExcess(openA);
+	int32_t least;
+	const uint64_t child = findMinimum(openA+1,depth+1,getOpen(b),least);
+	if(least>depth) { return a; }
+	if(least==0) { return NONE; }
+	const uint64_t parent = searchBackward(child,least,least-1);
+	return (uint32_t)((parent+(uint64_t)(least-1))/2);
+}
+
+uint32_t KBSuccinctTopology::getNextBreadthFirst(uint32_t node, uint32_t root) const
+{
+	// nodes at the same depth come in preorder; the next one opens where the excess next rises from the
+	// depth of the node to one more, and the first node of the next level where it first reaches two more
+	const uint64_t rootOpen = getOpen(root);
+	const uint64_t rootClose = getClose(rootOpen);
+	const uint64_t open = getOpen(node);
+	const int32_t depth = getExcess(open);
+	const uint64_t close = searchForward(open+1,depth+1,depth)-1;
+	uint64_t next = searchForward(close+1,depth,depth+1);
+	if(next!=NO_POSITION && next-1<rootClose) { return getNodeAt(next-1); }
+	next = searchForward(rootOpen,getExcess(rootOpen),depth+2);
+	if(next!=NO_POSITION && next-1<rootClose) { return getNodeAt(next-1); }
+	return NONE;
+}
+
+
+
+KBSuccinctTree::KBSuccinctTree(KBTree &source) {
+	build(source);
+}
+
+KBSuccinctTree::KBSuccinctTree(const std::string &newickString, bool assumeBootstrapNames) {
+	// only the structure is built up front; each name is decoded once, as it is copied out
+	KBTree source(newickString,false,assumeBootstrapNames,1,true,false);
+	build(source);
+}
+
+KBSuccinctTree::~KBSuccinctTree() { }
+
+void KBSuccinctTree::build(KBTree &source)
+{
+	topology.build(*source.tr);
+
+	leafCount = 0;
+	nameOffsets.reserve(topology.getNodeCount()+1);
+	nameOffsets.push_back(0);
+	for(KBNodeTree::pre_order_iterator it=source.tr->begin(); it!=source.tr->end(); ++it) {
+		if(it.node->first_child==NULL) { leafCount++; }
+		namePool.append(it->getLabelText(source.labelTable).name);
+		if(namePool.size()>=KBSuccinctTopology::NONE) { throw ParseException("Tree has too much name text for a KBSuccinctTree.","KBSuccinctTree::KBSuccinctTree()"); }
+		nameOffsets.push_back((uint32_t)namePool.size());
+	}
+	namePool.shrink_to_fit();
+	resetBreadthFirstIterToRoot();
+}
+
+size_t KBSuccinctTree::getMemoryUsage() const
+{
+	return sizeof(KBSuccinctTree) - sizeof(KBSuccinctTopology) + topology.getMemoryUsage() +
+		nameOffsets.capacity()*sizeof(uint32_t) + namePool.capacity();
+}
+
+
+std::string KBSuccinctTree::getAllLeafNames() const
+{
+	std::string leafNames="";
+	topology.visitLeaves([&](uint32_t node) {
+		std::string_view name = getName(node);
+		if(name.size()>0) { leafNames += name; leafNames+=";"; }
+	});
+	return leafNames;
+}
+void KBSuccinctTree::getAllLeafNames(std::vector<std::string> &names) const {
+	names.reserve(leafCount);
+	topology.visitLeaves([&](uint32_t node) {
+		std::string_view name = getName(node);
+		if(name.size()>0) { names.push_back(std::string(name)); }
+	});
+}
+
+std::string KBSuccinctTree::getAllNodeNames() const
+{
+	std::string nodeNames="";
+	topology.visitPostOrder([&](uint32_t node) {
+		std::string_view name = getName(node);
+		if(name.size()>0) { nodeNames += name; nodeNames+=";"; }
+	});
+	return nodeNames;
+}
+void KBSuccinctTree::getAllNodeNames(std::vector<std::string> &names) const {
+	names.reserve(getNodeCount());
+	topology.visitPostOrder([&](uint32_t node) {
+		std::string_view name = getName(node);
+		if(name.size()>0) { names.push_back(std::string(name)); }
+	});
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////
+// the breadth first iterator of KBTree, which only walks the first top level tree; the iterator and the
+// markers are node numbers (the node IDs of KBTree), or NONE past the end
+void KBSuccinctTree::resetBreadthFirstIterToRoot() {
+	this->bfi = getNodeCount()>0 ? 0 : KBSuccinctTopology::NONE;
+}
+bool KBSuccinctTree::breadthFirstIterNext() {
+	if(this->bfi!=KBSuccinctTopology::NONE) {
+		this->bfi = topology.getNextBreadthFirst(bfi,0);
+		return this->bfi!=KBSuccinctTopology::NONE;
+	}
+	return false;
+}
+std::string KBSuccinctTree::breadthFirstIterGetName() {
+	if(this->bfi!=KBSuccinctTopology::NONE) {
+		return std::string(getName(bfi));
+	}
+	return "END_OF_KB_TREE";
+}
+std::string KBSuccinctTree::breadthFirstIterGetParentName() {
+	if(this->bfi==KBSuccinctTopology::NONE) { return ""; }
+	uint32_t parent = topology.getParent(bfi);
+	return parent!=KBSuccinctTopology::NONE ? std::string(getName(parent)) : "";
+}
+unsigned int KBSuccinctTree::breadthFirstIterMarkNode() {
+	return this->bfi;
+}
+bool KBSuccinctTree::breadthFirstIterSetToNode(unsigned int nodeMarker) {
+	if(nodeMarker>=getNodeCount()) {
+		this->bfi = KBSuccinctTopology::NONE;
+		return false;
+	}
+	this->bfi = nodeMarker;
+	return true;
+}
+
+std::string KBSuccinctTree::breadthFirstIterGetName(unsigned int nodeMarker) {
+	if(nodeMarker>=getNodeCount()) { return ""; }
+	return std::string(getName(nodeMarker));
+}
+
+std::string KBSuccinctTree::breadthFirstIterGetPathToRoot(unsigned int nodeMarker) {
+	if(nodeMarker>=getNodeCount()) { return ""; }
+	std::string path="";
+	for(uint32_t node=topology.getParent(nodeMarker); node!=KBSuccinctTopology::NONE; node=topology.getParent(node)) {
+		path += getName(node);
+		path += ";";
+	}
+	return path;
+}
+
+std::string KBSuccinctTree::breadthFirstIterGetParentName(unsigned int nodeMarker) {
+	if(nodeMarker>=getNodeCount()) { return ""; }
+	uint32_t parent = topology.getParent(nodeMarker);
+	return parent!=KBSuccinctTopology::NONE ? std::string(getName(parent)) : "";
+}
+
+std::string KBSuccinctTree::breadthFirstIterGetAllChildrenNames(unsigned int nodeMarker) {
+	if(nodeMarker>=getNodeCount()) { return ""; }
+	std::string namelist = "";
+	for(uint32_t child=topology.getFirstChild(nodeMarker); child!=KBSuccinctTopology::NONE; child=topology.getNextSibling(child)) {
+		namelist += getName(child);
+		namelist += ";";
+	}
+	return namelist;
+}
+
+std::string KBSuccinctTree::breadthFirstIterGetAllDescendantNames(unsigned int nodeMarker) {
+	if(nodeMarker>=getNodeCount()) { return ""; }
+	const uint32_t root = nodeMarker;
+	std::string namelist = "";
+	for(uint32_t node=topology.getNextBreadthFirst(root,root); node!=KBSuccinctTopology::NONE; node=topology.getNextBreadthFirst(node,root)) {
+		namelist += getName(node);
+		namelist += ";";
+	}
+	return namelist;
+}
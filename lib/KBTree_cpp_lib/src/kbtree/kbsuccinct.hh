@@ -0,0 +1,199 @@
+/**
+ * @file kbsuccinct.hh
+ * @brief Succinct (balanced parentheses) representation of the shape of a tree
+ *
+ * Even a KBCompactTree spends 12 bytes per node on its parent, first child and next sibling indices.  A
+ * KBSuccinctTopology stores the same shape in about 2 bits per node: a preorder walk writes an open
+ * parenthesis (a 1 bit) on entering each node and a close parenthesis (a 0 bit) on leaving it.  Every
+ * navigation question is then a question about the excess - opens minus closes - of a prefix of the bits:
+ * the depth of a node is the excess before its open, its close is the next position where the excess
+ * falls back to that value, its parent the last position before it where the excess was one lower, and
+ * the lowest common ancestor of two nodes is found from the minimum excess between them.
+ *
+ * To answer these quickly, the bits are split into blocks of 512.  The excess at the start of every block
+ * is stored, along with a range min-max tree: a complete binary tree over the blocks holding the least and
+ * greatest excess reached within each range of blocks, and the extremes within each 64 bit word are kept
+ * in a byte each.  A search scans at most the rest of its own block a word at a time, climbs the tree to
+ * the first block that can contain the answer, and scans that block, going down to bytes (with tables for
+ * the excess change and extremes of every byte) and bits only within the word holding the answer.  The
+ * extra data comes to about half a bit per bit.  Nodes are numbered by their preorder rank, which is the number of opens before them; a
+ * sample of the position of every 256th open makes finding the open of a node a short search.
+ *
+ * A KBSuccinctTree adds the names of the nodes, and offers the read only queries of KBTree (counts, all
+ * names, and the breadth first iterator with its markers) on top of the topology.
+ */
+
+#ifndef KBSUCCINCT_HH_
+#define KBSUCCINCT_HH_
+
+#include "kbtree.hh"
+#include <cstdint>
+
+namespace KBTreeLib {
+
+	/** number of 1 bits; the library is built for any x86-64, where __builtin_popcountll is a library call */
+	static inline unsigned int countOnes(uint64_t x) {
+		x = x-((x>>1) & 0x5555555555555555ULL);
+		x = (x & 0x3333333333333333ULL)+((x>>2) & 0x3333333333333333ULL);
+		x = (x+(x>>4)) & 0x0f0f0f0f0f0f0f0fULL;
+		return (unsigned int)((x*0x0101010101010101ULL)>>56);
+	}
+
+	class KBSuccinctTopology
+	{
+		public:
+			/** node returned when a node has no parent, child or sibling */
+			static constexpr uint32_t NONE = 0xffffffff;
+
+			/** a topology with no nodes */
+			KBSuccinctTopology();
+			/** the shape of the tree; the nodes are numbered in preorder, as in KBCompactTree */
+			explicit KBSuccinctTopology(const KBNodeTree &tree);
+			~KBSuccinctTopology();
+
+			unsigned int getNodeCount() const { return nodeCount; };
+			/** bytes held by the topology */
+			size_t getMemoryUsage() const;
+
+			// As in a KBCompactTree, the root is node 0, and any other nodes without a parent are its siblings.
+			uint32_t getParent(uint32_t node) const;
+			uint32_t getFirstChild(uint32_t node) const;
+			uint32_t getNextSibling(uint32_t node) const;
+			bool isLeaf(uint32_t node) const;
+			/** number of nodes in the subtree below and including the node */
+			uint32_t getSubtreeSize(uint32_t node) const;
+			/** number of ancestors of the node; 0 for the root */
+			uint32_t getDepth(uint32_t node) const;
+			/** true if ancestor is node or one of its ancestors */
+			bool isAncestor(uint32_t ancestor, uint32_t node) const;
+			/** the lowest common ancestor of the two nodes, or NONE if they are in different top level trees */
+			uint32_t getLowestCommonAncestor(uint32_t a, uint32_t b) const;
+			/** the node after this one in a breadth first walk of the subtree below root (which includes
+			 * node), or NONE if it is the last one */
+			uint32_t getNextBreadthFirst(uint32_t node, uint32_t root) const;
+
+			/** call visit(node) for every node in post order, in one pass over the bits */
+			template <class Visitor> void visitPostOrder(Visitor visit) const {
+				std::vector<uint32_t> open;
+				uint32_t next = 0;
+				for(uint64_t p=0; p<length; p++) {
+					if(isOpen(p)) { open.push_back(next++); }
+					else { visit(open.back()); open.pop_back(); }
+				}
+			};
+			/** call visit(node) for every leaf in preorder, in one pass over the bits */
+			template <class Visitor> void visitLeaves(Visitor visit) const {
+				uint32_t next = 0;
+				for(uint64_t p=0; p<length; p++) {
+					if(isOpen(p)) {
+						if(!isOpen(p+1)) { visit(next); }
+						next++;
+					}
+				}
+			};
+
+		private:
+			friend class KBSuccinctTree;
+			KBSuccinctTopology(const KBSuccinctTopology &);
+			KBSuccinctTopology &operator=(const KBSuccinctTopology &);
+
+			static const uint64_t NO_POSITION = ~(uint64_t)0;
+			static const unsigned int BLOCK_SHIFT = 9;
+			static const unsigned int WORDS_PER_BLOCK = (1u<<BLOCK_SHIFT)/64;
+			static const unsigned int SAMPLE_SHIFT = 8;
+
+			void build(const KBNodeTree &tree);
+			bool isOpen(uint64_t position) const { return (bits[position>>6]>>(position&63)) & 1; };
+			int32_t wordChange(uint64_t word) const { return 2*(int32_t)countOnes(bits[word])-64; };
+			/** opens minus closes before the position */
+			int32_t getExcess(uint64_t position) const;
+			/** the position of the open of the node, and the node whose open is at the position */
+			uint64_t getOpen(uint32_t node) const;
+			uint32_t getNodeAt(uint64_t open) const { return (uint32_t)((open+(uint64_t)getExcess(open))/2); };
+			uint64_t getClose(uint64_t open) const { int32_t excess=getExcess(open); return searchForward(open+1,excess+1,excess)-1; };
+
+			/** the first position after from (where the excess is excess) where the excess is target, or NO_POSITION */
+			uint64_t searchForward(uint64_t from, int32_t excess, int32_t target) const;
+			/** the last position before from where the excess is target, which must be below excess, the excess at from */
+			uint64_t searchBackward(uint64_t from, int32_t excess, int32_t target) const;
+			/** the first position in [from,to] where the excess is least; excess is the excess at from */
+			uint64_t findMinimum(uint64_t from, int32_t excess, uint64_t to, int32_t &least) const;
+
+			bool scanForward(uint64_t from, int32_t excess, uint64_t end, int32_t target, uint64_t &found) const;
+			bool scanBackward(uint64_t from, int32_t excess, uint64_t begin, int32_t target, uint64_t &found) const;
+			int32_t scanMinimum(uint64_t from, int32_t excess, uint64_t end) const;
+			bool reaches(size_t treeNode, int32_t target, bool down) const {
+				return down ? rangeMin[treeNode]<=target : rangeMax[treeNode]>=target;
+			};
+
+			unsigned int nodeCount;
+			uint64_t length;                    // 2 bits per node
+			std::vector<uint64_t> bits;         // bit p of the parentheses is bit p%64 of bits[p/64]; 1 is an open
+			std::vector<int8_t> wordMin;        // the extremes of the excess after each bit of a word, relative
+			std::vector<int8_t> wordMax;        // to its start
+			std::vector<int32_t> blockExcess;   // the excess before the first bit of each block, and at the end
+			size_t leaves;                      // leaves of the range min-max tree, a power of two at least the block count
+			std::vector<int32_t> rangeMin;      // the extremes of the excess over the positions of a range of
+			std::vector<int32_t> rangeMax;      // blocks (tree node 1 is the root, and leaf b is node leaves+b)
+			std::vector<uint32_t> openSamples;  // the block holding the open of every 256th node
+	};
+
+
+	class KBSuccinctTree
+	{
+		public:
+			/** copy the shape and names of the tree; the KBTree can be deleted afterwards */
+			KBSuccinctTree(KBTree &tree);
+			/** parse the Newick string (as KBTree(newickString,false,assumeBootstrapNames) would) */
+			KBSuccinctTree(const std::string &newickString, bool assumeBootstrapNames=false);
+			~KBSuccinctTree();
+
+			const KBSuccinctTopology &getTopology() const { return topology; };
+			unsigned int getNodeCount() const { return topology.getNodeCount(); };
+			unsigned int getLeafCount() const { return leafCount; };
+			/** bytes held by this tree, including its names */
+			size_t getMemoryUsage() const;
+
+			std::string_view getName(uint32_t node) const {
+				return std::string_view(namePool.data()+nameOffsets[node],nameOffsets[node+1]-nameOffsets[node]);
+			};
+
+			/** same as KBTree::getAllLeafNames, leaves in the same order */
+			std::string getAllLeafNames() const;
+			void getAllLeafNames(std::vector<std::string> &names) const;
+			/** same as KBTree::getAllNodeNames, nodes in the same (post) order */
+			std::string getAllNodeNames() const;
+			void getAllNodeNames(std::vector<std::string> &names) const;
+
+			// The breadth first iterator and markers of KBTree, giving the same results.  As there, the methods
+			// without a marker use the one iterator of the tree, so they are NOT THREAD SAFE.
+			void resetBreadthFirstIterToRoot();
+			bool breadthFirstIterNext();
+			unsigned int breadthFirstIterMarkNode();
+			bool breadthFirstIterSetToNode(unsigned int nodeMarker);
+			std::string breadthFirstIterGetName();
+			std::string breadthFirstIterGetParentName();
+
+			std::string breadthFirstIterGetName(unsigned int nodeMarker);
+			std::string breadthFirstIterGetPathToRoot(unsigned int nodeMarker);
+			std::string breadthFirstIterGetParentName(unsigned int nodeMarker);
+			std::string breadthFirstIterGetAllChildrenNames(unsigned int nodeMarker);
+			std::string breadthFirstIterGetAllDescendantNames(unsigned int nodeMarker);
+
+		private:
+			KBSuccinctTree(const KBSuccinctTree &);
+			KBSuccinctTree &operator=(const KBSuccinctTree &);
+
+			void build(KBTree &tree);
+
+			KBSuccinctTopology topology;
+			std::vector<uint32_t> nameOffsets;  // the name of node i is namePool[nameOffsets[i],nameOffsets[i+1])
+			std::string namePool;
+			unsigned int leafCount;
+
+			uint32_t bfi;
+	};
+
+};
+
+#endif /* KBSUCCINCT_HH_ */
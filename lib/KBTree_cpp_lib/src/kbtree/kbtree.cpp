@@ -29,15 +29,24 @@
 
 
 #include "kbtree.hh"
+#include "kbancestor.hh"
 #include "tree.hh"
 #include <iostream>
 #include <fstream>
 #include <algorithm>
+#include <charconv>
 #include <cassert>
 #include <cmath>
+#include <cstring>
+#include <mutex>
 #include <sstream>
 #include <stack>
+#include <unordered_set>
 #include <stdlib.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 using namespace std;
 using namespace KBTreeLib;
@@ -54,51 +63,362 @@ void KBTreeLib::trim(std::string& str) {
 	}
 }
 
-// convert string value to double, ends program if this fails
-double KBTreeLib::convertToDouble(const std::string& s)
+void KBTreeLib::splitNames(const std::string &list, std::vector<std::string> &names) {
+	size_t current = 0;
+	while(current<=list.size()) {
+		size_t next = list.find(';',current);
+		if(next==std::string::npos) { next=list.size(); }
+		std::string name = list.substr(current,next-current);
+		trim(name);
+		if(name.size()>0) { names.push_back(name); }
+		current = next+1;
+	}
+}
+
+// the power of ten of the leading digit of a decimal number that from_chars found to be out of range, which
+// is negative if the number is too small for a double rather than too large
+static long decimalOrder(std::string_view s)
+{
+	size_t k=0;
+	while(k<s.size() && s[k]=='0') { k++; }
+	long order=-1;
+	while(k<s.size() && isdigit((unsigned char)s[k])) { order++; k++; }
+	if(k<s.size() && s[k]=='.') {
+		k++;
+		if(order<0) {
+			while(k<s.size() && s[k]=='0') { order--; k++; }
+		}
+		while(k<s.size() && isdigit((unsigned char)s[k])) { k++; }
+	}
+	if(k<s.size() && (s[k]=='e' || s[k]=='E')) {
+		k++;
+		bool negative=false;
+		if(k<s.size() && (s[k]=='+' || s[k]=='-')) { negative=(s[k]=='-'); k++; }
+		long exponent=0;
+		while(k<s.size() && isdigit((unsigned char)s[k])) {
+			if(exponent<100000000) { exponent = exponent*10+(s[k]-'0'); }
+			k++;
+		}
+		order += negative ? -exponent : exponent;
+	}
+	return order;
+}
+
+// convert string value to double.  Accepts what reading a double from an istream accepts: leading
+// white space, an optional sign, and a decimal number with optional exponent, with no leftover characters.
+// A number too small for a double is read as zero, as an istream reads it; one too large is rejected.
+bool KBTreeLib::parseDouble(std::string_view s, double &x)
 {
-	//return strtod(s.c_str(),NULL);
-	bool failIfLeftoverChars = true;
-	std::istringstream i(s);
-	double x; char c;
-	if (!(i >> x) || (failIfLeftoverChars && i.get(c))) {
-		cerr<<"Cannot convert string '"+s+"' to double value."<<endl;
-		throw "error in convertToDouble";
+	size_t k=0;
+	while(k<s.size() && isspace((unsigned char)s[k])) { k++; }
+	bool negate=false;
+	if(k<s.size() && (s[k]=='+' || s[k]=='-')) { negate=(s[k]=='-'); k++; }
+	// from_chars would also take inf and nan, which we never want as distances or bootstrap values
+	if(k>=s.size() || !(isdigit((unsigned char)s[k]) || s[k]=='.')) { return false; }
+	double value;
+	std::from_chars_result r = std::from_chars(s.data()+k,s.data()+s.size(),value,std::chars_format::general);
+	if(r.ptr!=s.data()+s.size()) { return false; }
+	if(r.ec==std::errc::result_out_of_range && decimalOrder(s.substr(k))<0) { value=0.0; }
+	else if(r.ec!=std::errc()) { return false; }
+	x = negate ? -value : value;
+	return true;
+}
+
+double KBTreeLib::convertToDouble(std::string_view s, bool quiet)
+{
+	double x;
+	if(!parseDouble(s,x)) {
+		// reported here as well, as it always was, for callers (such as the wrappers) that do not show the exception
+		const std::string message = "Cannot convert string '"+std::string(s)+"' to double value.";
+		if(!quiet) { cerr<<message<<endl; }
+		throw ParseException(message,"KBTreeLib::convertToDouble()");
 	}
 	return x;
 }
 
-// convert double valto string, ends program if fails
-std::string KBTreeLib::toString(double x)
+size_t KBTreeLib::formatDouble(double x, int precision, char *buf)
 {
-	std::ostringstream o;
-	if (!(o << x)) {
-		cerr<<"Cannot convert double to string value."<<endl;
-		throw "error in toString";
+	std::to_chars_result r;
+	if(precision==SHORTEST_ROUND_TRIP) {
+		r = std::to_chars(buf,buf+MAX_DOUBLE_CHARS,x);
+	} else {
+		// more than 17 significant digits never changes the value, it only adds noise
+		if(precision<1) { precision=1; } else if(precision>17) { precision=17; }
+		r = std::to_chars(buf,buf+MAX_DOUBLE_CHARS,x,std::chars_format::general,precision);
 	}
-	return o.str();
+	if(r.ec!=std::errc()) {
+		throw ParseException("Cannot convert double to string value.","KBTreeLib::formatDouble()");
+	}
+	return r.ptr-buf;
+}
+
+// convert double value to string, using the same format as writing to an ostream (%g, 6 digits)
+std::string KBTreeLib::toString(double x)
+{
+	return toString(x,DEFAULT_OUTPUT_PRECISION);
 }
 
-std::string KBTreeLib::getQuotedString(const std::string& s)
+std::string KBTreeLib::toString(double x, int precision)
+{
+	char buf[MAX_DOUBLE_CHARS];
+	return std::string(buf,formatDouble(x,precision,buf));
+}
+
+// Labels are written through these templates so that the string returned by formatLabel and the text a
+// KBOutputSink receives from writeLabel come from one definition of each output style.  An Output has
+// put(char) and write(std::string_view), and nothing is allocated along the way except by the Output.
+namespace {
+	struct StringOutput {
+		std::string &s;
+		void put(char C) { s+=C; }
+		void write(std::string_view text) { s.append(text); }
+	};
+}
+
+template<class Output> static inline void writeDouble(Output &out, double x, int precision)
+{
+	char buf[MAX_DOUBLE_CHARS];
+	out.write(std::string_view(buf,formatDouble(x,precision,buf)));
+}
+
+template<class Output> static void writeQuoted(Output &out, std::string_view s)
 {
-	string quoted_string=""; char C;
 	bool reqQuote = false;
-	for(unsigned int k=0;k<s.size();k++) {
-		C = s.at(k);
-		if(C==DBL_QUOTE) { quoted_string+='\\'; reqQuote=true; }
-		if(!reqQuote) {
-			if(  C==OPEN_PARAN || C==CLOSE_PARAN  || C==COMMA         || C==SEMICOLON ||
-			     C==COLON      || C==OPEN_BRACKET || C==CLOSE_BRACKET  ) {
-				reqQuote=true;
-			}
-		}
-		quoted_string+=C;
+	for(size_t k=0; k<s.size() && !reqQuote; k++) {
+		char C = s[k];
+		reqQuote = C==DBL_QUOTE  || C==OPEN_PARAN   || C==CLOSE_PARAN   || C==COMMA || C==SEMICOLON ||
+		           C==COLON      || C==OPEN_BRACKET || C==CLOSE_BRACKET;
+	}
+	if(!reqQuote) { out.write(s); return; }
+	out.put(DBL_QUOTE);
+	for(size_t k=0; k<s.size(); k++) {
+		if(s[k]==DBL_QUOTE) { out.put('\\'); }
+		out.put(s[k]);
 	}
-	if(reqQuote) { quoted_string = "\""+quoted_string+"\""; }
+	out.put(DBL_QUOTE);
+}
+
+template<class Output> static inline void writeComment(Output &out, std::string_view s)
+{
+	out.put(OPEN_BRACKET); writeQuoted(out,s); out.put(CLOSE_BRACKET);
+}
+
+std::string KBTreeLib::getQuotedString(std::string_view s)
+{
+	string quoted_string;
+	StringOutput out = { quoted_string };
+	writeQuoted(out,s);
 	return quoted_string;
 }
 
 
+const size_t KBLabelArena::BLOCK_SIZE=64*1024;
+
+KBLabelArena::KBLabelArena() {
+	this->cursor=NULL;
+	this->remaining=0;
+	this->bytesStored=0;
+}
+KBLabelArena::~KBLabelArena() { }
+
+std::string_view KBLabelArena::store(std::string_view text) {
+	if(text.size()==0) { return std::string_view(); }
+	if(text.size()>remaining) {
+		// oversized labels get a block of their own so that the current block is not wasted
+		if(text.size()>BLOCK_SIZE/4) {
+			blocks.push_back(std::unique_ptr<char[]>(new char[text.size()]));
+			memcpy(blocks.back().get(),text.data(),text.size());
+			bytesStored+=text.size();
+			return std::string_view(blocks.back().get(),text.size());
+		}
+		blocks.push_back(std::unique_ptr<char[]>(new char[BLOCK_SIZE]));
+		cursor=blocks.back().get();
+		remaining=BLOCK_SIZE;
+	}
+	memcpy(cursor,text.data(),text.size());
+	std::string_view stored(cursor,text.size());
+	cursor+=text.size(); remaining-=text.size();
+	bytesStored+=text.size();
+	return stored;
+}
+
+void KBLabelArena::absorb(KBLabelArena &other) {
+	// the blocks themselves are moved, not copied, so views into them stay valid
+	for(size_t b=0; b<other.blocks.size(); b++) { blocks.push_back(std::move(other.blocks[b])); }
+	bytesStored+=other.bytesStored;
+	other.clear();
+}
+
+void KBLabelArena::clear() {
+	blocks.clear();
+	cursor=NULL;
+	remaining=0;
+	bytesStored=0;
+}
+
+
+/** every existing table by id, so a node can keep the 32 bit id of its table instead of a pointer.  It is
+ * made on first use, so tables that are themselves static can register whatever the order of initialization */
+struct KBStringTableRegistry {
+	std::mutex lock;
+	std::vector<KBStringTable *> tables;
+	std::vector<uint32_t> freeIds;
+};
+static KBStringTableRegistry &getStringTableRegistry() {
+	static KBStringTableRegistry registry;
+	return registry;
+}
+
+KBStringTable::KBStringTable() {
+	clear();
+	KBStringTableRegistry &registry = getStringTableRegistry();
+	std::lock_guard<std::mutex> guard(registry.lock);
+	if(!registry.freeIds.empty()) {
+		id = registry.freeIds.back();
+		registry.freeIds.pop_back();
+		registry.tables[id] = this;
+	} else {
+		id = (uint32_t)registry.tables.size();
+		registry.tables.push_back(this);
+	}
+}
+KBStringTable::~KBStringTable() {
+	KBStringTableRegistry &registry = getStringTableRegistry();
+	std::lock_guard<std::mutex> guard(registry.lock);
+	registry.tables[id] = NULL;
+	registry.freeIds.push_back(id);
+}
+
+KBStringTable *KBStringTable::findById(uint32_t id) {
+	KBStringTableRegistry &registry = getStringTableRegistry();
+	std::lock_guard<std::mutex> guard(registry.lock);
+	return id<registry.tables.size() ? registry.tables[id] : NULL;
+}
+
+uint32_t KBStringTable::append(unsigned int shard, std::string_view text) {
+	Shard &s = shards[shard];
+	if(s.entries.size()>INDEX_MASK) {
+		throw ParseException("TOO MANY DISTINCT LABEL STRINGS FOR ONE TREE","KBStringTable::append()");
+	}
+	s.entries.push_back(text);
+	return (uint32_t)(shard<<SHARD_SHIFT) | (uint32_t)(s.entries.size()-1);
+}
+
+void KBStringTable::reserve(size_t count, unsigned int shard) {
+	Shard &s = shards[shard];
+	s.entries.reserve(s.entries.size()+count);
+}
+
+uint32_t KBStringTable::find(std::string_view text, KBLabelArena *arena, unsigned int shard) {
+	if(text.empty()) { return EMPTY; }
+	Shard &s = shards[shard];
+	// keep the hash at most half full, so that probe sequences stay short
+	if(2*(s.interned+1)>s.slots.size()) { rehash(s); }
+	const size_t mask = s.slots.size()-1;
+	const uint32_t hash = (uint32_t)(std::hash<std::string_view>()(text)>>32);
+	size_t slot = hash & mask;
+	while(s.slots[slot]!=0) {
+		// the stored hash rules out almost every other entry without touching its text
+		if((uint32_t)(s.slots[slot]>>32)==hash) {
+			uint32_t index = (uint32_t)s.slots[slot]-1;
+			if(s.entries[index]==text) { return (uint32_t)(shard<<SHARD_SHIFT) | index; }
+		}
+		slot = (slot+1) & mask;
+	}
+	uint32_t handle = append(shard, arena!=NULL ? arena->store(text) : text);
+	s.slots[slot] = ((uint64_t)hash<<32) | ((handle&INDEX_MASK)+1);
+	s.interned++;
+	return handle;
+}
+
+void KBStringTable::rehash(Shard &s) {
+	std::vector<uint64_t> old;
+	old.swap(s.slots);
+	s.slots.assign(old.empty() ? 1024 : 2*old.size(), 0);
+	const size_t mask = s.slots.size()-1;
+	for(size_t o=0; o<old.size(); o++) {
+		if(old[o]==0) { continue; }
+		size_t slot = (old[o]>>32) & mask;
+		while(s.slots[slot]!=0) { slot = (slot+1) & mask; }
+		s.slots[slot] = old[o];
+	}
+}
+
+uint32_t KBStringTable::intern(std::string_view text, unsigned int shard) { return find(text,NULL,shard); }
+uint32_t KBStringTable::intern(std::string_view text, KBLabelArena &arena, unsigned int shard) { return find(text,&arena,shard); }
+
+uint32_t KBStringTable::add(std::string_view text, unsigned int shard) {
+	if(text.empty()) { return EMPTY; }
+	return append(shard,text);
+}
+
+void KBStringTable::clearShard(unsigned int shard) {
+	Shard &s = shards[shard];
+	s.entries.clear();
+	s.entries.shrink_to_fit();
+	s.slots.clear();
+	s.slots.shrink_to_fit();
+	s.interned = 0;
+	// handle 0 of shard 0 is EMPTY, so that handles of the other shards are never 0 either; its view points
+	// at a real (empty) string, so that copying it out never passes a null pointer to memcpy
+	if(shard==0) { s.entries.push_back(std::string_view("",0)); }
+}
+
+void KBStringTable::clear() {
+	for(unsigned int shard=0; shard<SHARD_COUNT; shard++) { clearShard(shard); }
+}
+
+size_t KBStringTable::size() const {
+	size_t entries = 0;
+	for(unsigned int shard=0; shard<SHARD_COUNT; shard++) { entries += shards[shard].entries.size(); }
+	return entries;
+}
+
+size_t KBStringTable::getMemoryUsage() const {
+	size_t bytes = sizeof(KBStringTable);
+	for(unsigned int shard=0; shard<SHARD_COUNT; shard++) {
+		bytes += shards[shard].entries.capacity()*sizeof(std::string_view) + shards[shard].slots.capacity()*sizeof(uint64_t);
+	}
+	return bytes;
+}
+
+
+KBMappedFile::KBMappedFile(const std::string &filename) {
+	this->data=NULL;
+	this->length=0;
+	int fd = open(filename.c_str(),O_RDONLY);
+	if(fd<0) {
+		throw ParseException("CANNOT OPEN FILE: '"+filename+"'","KBMappedFile::KBMappedFile()");
+	}
+	struct stat info;
+	if(fstat(fd,&info)!=0) {
+		close(fd);
+		throw ParseException("CANNOT READ FILE: '"+filename+"'","KBMappedFile::KBMappedFile()");
+	}
+	// an empty file cannot be mapped, but it is a valid (empty) text
+	if(info.st_size>0) {
+		void *region = mmap(NULL,(size_t)info.st_size,PROT_READ,MAP_PRIVATE,fd,0);
+		if(region==MAP_FAILED) {
+			close(fd);
+			throw ParseException("CANNOT MAP FILE: '"+filename+"'","KBMappedFile::KBMappedFile()");
+		}
+		// the parser reads the text front to back
+		madvise(region,(size_t)info.st_size,MADV_SEQUENTIAL);
+		this->data=(const char *)region;
+		this->length=(size_t)info.st_size;
+	}
+	// the mapping stays valid after the descriptor is closed
+	close(fd);
+}
+
+KBMappedFile::~KBMappedFile() {
+	if(this->data!=NULL) { munmap((void *)this->data,this->length); }
+}
+
+
+static std::string_view trimmedView(std::string_view text);
+
+
 const unsigned int KBNode::NAME_AND_DISTANCE=0;
 const unsigned int KBNode::NAME_DISTANCE_AND_COMMENTS=1;
 const unsigned int KBNode::NAME_ONLY=2;
@@ -107,137 +427,278 @@ const unsigned int KBNode::STRUCTURE_ONLY=4;
 const unsigned int KBNode::ORIGINAL_LABEL=5;
 
 KBNode::KBNode() { clear(); }
-KBNode::~KBNode() { }
+KBNode::KBNode(const KBStringTable &labels) { clear(); this->labelTableId=labels.getId(); }
 void KBNode::clear() {
-	this->original_label="";
-	this->name="";
-	this->pre_name_decoration="";
-	this->post_name_decoration="";
-	this->pre_dist_decoration="";
-	this->post_dist_decoration="";
+	this->original_label=KBStringTable::EMPTY;
+	this->name=KBStringTable::EMPTY;
+	this->pre_name_decoration=KBStringTable::EMPTY;
+	this->post_name_decoration=KBStringTable::EMPTY;
+	this->pre_dist_decoration=KBStringTable::EMPTY;
+	this->post_dist_decoration=KBStringTable::EMPTY;
 	this->distanceToParent=NAN;
 	this->bootstrapValue=NAN;
-	this->hidden_marker="";
+	this->hidden_marker=KBStringTable::EMPTY;
+	this->derivedIndex=0;
+	this->labelPending=false;
+	this->dropOriginalLabel=false;
+	this->labelTableId=KBStringTable::NO_TABLE;
+}
+
+KBStringTable &KBNode::getLabelTable() const {
+	// a node outside of any tree has only EMPTY handles, which read the same in every table
+	static KBStringTable noLabels;
+	KBStringTable *labels = labelTableId==KBStringTable::NO_TABLE ? NULL : KBStringTable::findById(labelTableId);
+	return labels!=NULL ? *labels : noLabels;
 }
 
-std::string KBNode::getLabelFromComponents(bool with_label, bool with_distance, bool with_comments, bool with_bootstrap_value_as_label) {
-	string constructedLabel = "";
+void KBNode::setPendingLabel(uint32_t rawLabel, bool keepOriginalLabel) {
+	this->original_label=rawLabel;
+	this->pre_name_decoration=KBStringTable::EMPTY;
+	this->post_name_decoration=KBStringTable::EMPTY;
+	this->pre_dist_decoration=KBStringTable::EMPTY;
+	this->post_dist_decoration=KBStringTable::EMPTY;
+	this->labelPending=true;
+	this->dropOriginalLabel=!keepOriginalLabel;
+}
+
+// A pending label has no quotes or comments, so it is just a name, optionally followed by a colon and a
+// distance, and every piece is a view of the (already trimmed) raw label, as in KBTree::getNextLabelIndexed.
+// Returns the name, and sets distance if the label has one.
+static std::string_view splitPendingLabel(std::string_view raw, double &distance) {
+	size_t colon = raw.find(COLON);
+	if(colon!=string::npos) {
+		std::string_view distanceText = trimmedView(raw.substr(colon+1));
+		if(!distanceText.empty()) {
+			try {
+				distance = convertToDouble(distanceText);
+			} catch (ParseException& e) {
+				e.addTraceException("KBNode::decodeLabel()");
+				throw e;
+			}
+		}
+	}
+	return trimmedView(raw.substr(0,colon));
+}
+
+void KBNode::decodePendingLabel(KBStringTable &labels, unsigned int shard) {
+	this->name = labels.intern(splitPendingLabel(labels.get(original_label),this->distanceToParent),shard);
+	if(dropOriginalLabel) { this->original_label = KBStringTable::EMPTY; }
+	this->labelPending = false;
+	this->dropOriginalLabel = false;
+}
+
+void KBNode::readLabelText(const KBStringTable &labels, KBLabelText &label) const {
+	label = KBLabelText{ labels.get(original_label), labels.get(name), labels.get(pre_name_decoration), labels.get(post_name_decoration),
+		labels.get(pre_dist_decoration), labels.get(post_dist_decoration), distanceToParent, bootstrapValue };
+	if(labelPending) {
+		label.name = splitPendingLabel(label.original_label,label.distanceToParent);
+		if(dropOriginalLabel) { label.original_label = std::string_view(); }
+	}
+}
+
+KBLabelText KBNode::getLabelText(KBStringTable &labels) const {
+	decodeLabel(labels);
+	return KBLabelText{ labels.get(original_label), labels.get(name), labels.get(pre_name_decoration), labels.get(post_name_decoration),
+		labels.get(pre_dist_decoration), labels.get(post_dist_decoration), distanceToParent, bootstrapValue };
+}
 
+std::string KBNode::getLabelFromComponents(KBStringTable &labels, bool with_label, bool with_distance, bool with_comments, bool with_bootstrap_value_as_label, int precision) const {
+	return formatLabel(getLabelText(labels),with_label,with_distance,with_comments,with_bootstrap_value_as_label,precision);
+}
+
+std::string KBNode::getLabelFromComponents(KBStringTable &labels, unsigned int style, int precision) const {
+	return formatLabel(getLabelText(labels),style,precision);
+}
+
+template<class Output> static void writeLabelWithFlags(Output &out, const KBLabelText &label, bool with_label, bool with_distance, bool with_comments, bool with_bootstrap_value_as_label, int precision)
+{
 	//add pre name comments
-	if(pre_name_decoration.size()>0 && with_comments) { constructedLabel+=("["+getQuotedString(pre_name_decoration)+"]"); }
+	if(label.pre_name_decoration.size()>0 && with_comments) { writeComment(out,label.pre_name_decoration); }
 	//add label name
-	if(with_label) { constructedLabel+=getQuotedString(name); }
+	if(with_label) { writeQuoted(out,label.name); }
 	//or possibly a bootstrap value if name is empty and bootstrap value exists
-	if(name.size()==0 && !isnan(bootstrapValue) && with_bootstrap_value_as_label) { constructedLabel+=toString(bootstrapValue); }
+	if(label.name.size()==0 && !isnan(label.bootstrapValue) && with_bootstrap_value_as_label) { writeDouble(out,label.bootstrapValue,precision); }
 	//add post name comments
-	if(post_name_decoration.size()>0) { constructedLabel+=("["+getQuotedString(post_name_decoration)+"]"); }
+	if(label.post_name_decoration.size()>0) { writeComment(out,label.post_name_decoration); }
 
 	//if we are outputting comments or distances, we need a colon.
-	if( (with_distance && !isnan(distanceToParent)) || (with_comments && (pre_dist_decoration.size()>0 || post_dist_decoration.size()>0)) ) {
-		constructedLabel+=":";
+	if( (with_distance && !isnan(label.distanceToParent)) || (with_comments && (label.pre_dist_decoration.size()>0 || label.post_dist_decoration.size()>0)) ) {
+		out.put(COLON);
 	}
 
 	//add pre dist comments
-	if(pre_dist_decoration.size()>0) { constructedLabel+=("["+getQuotedString(pre_dist_decoration)+"]"); }
+	if(label.pre_dist_decoration.size()>0) { writeComment(out,label.pre_dist_decoration); }
 	//add distance
-	if(!isnan(distanceToParent) && with_distance) { constructedLabel+= toString(distanceToParent); }
+	if(!isnan(label.distanceToParent) && with_distance) { writeDouble(out,label.distanceToParent,precision); }
 	//add post dist comments
-	if(post_dist_decoration.size()>0) {constructedLabel+=("["+getQuotedString(post_dist_decoration)+"]"); }
-
-	return constructedLabel;
+	if(label.post_dist_decoration.size()>0) { writeComment(out,label.post_dist_decoration); }
 }
 
-
-std::string KBNode::getLabelFromComponents(unsigned int style) {
-	string constructedLabel = "";
-	if(style==NAME_AND_DISTANCE) { //name:distance, distance left blank if no distance
-		constructedLabel=getQuotedString(name);
-		if(name.size()==0 && !isnan(bootstrapValue)) { constructedLabel+=toString(bootstrapValue); }
-		if(!isnan(distanceToParent)) {
-			constructedLabel+= (":"+toString(distanceToParent));
+template<class Output> static void writeLabelInStyle(Output &out, const KBLabelText &label, unsigned int style, int precision)
+{
+	if(style==KBNode::NAME_AND_DISTANCE) { //name:distance, distance left blank if no distance
+		writeQuoted(out,label.name);
+		if(label.name.size()==0 && !isnan(label.bootstrapValue)) { writeDouble(out,label.bootstrapValue,precision); }
+		if(!isnan(label.distanceToParent)) {
+			out.put(COLON); writeDouble(out,label.distanceToParent,precision);
 		}
-	} else if (style==NAME_ONLY) { //name
-		constructedLabel=getQuotedString(name);
-		if(name.size()==0 && !isnan(bootstrapValue)) { constructedLabel+=toString(bootstrapValue); }
-	} else if (style==DISTANCE_ONLY) { //:distance, left blank if no distance
-		if(!isnan(distanceToParent)) {
-			constructedLabel+= (":"+toString(distanceToParent));
+	} else if (style==KBNode::NAME_ONLY) { //name
+		writeQuoted(out,label.name);
+		if(label.name.size()==0 && !isnan(label.bootstrapValue)) { writeDouble(out,label.bootstrapValue,precision); }
+	} else if (style==KBNode::DISTANCE_ONLY) { //:distance, left blank if no distance
+		if(!isnan(label.distanceToParent)) {
+			out.put(COLON); writeDouble(out,label.distanceToParent,precision);
 		}
-	} else if (style==NAME_DISTANCE_AND_COMMENTS) { //name:distance + all comments, leave nothing out
-		if(pre_name_decoration.size()>0) { constructedLabel+=("["+getQuotedString(pre_name_decoration)+"]"); }
-		constructedLabel+=getQuotedString(name);
-		if(name.size()==0 && !isnan(bootstrapValue)) { constructedLabel+=toString(bootstrapValue); }
-		if(post_name_decoration.size()>0) { constructedLabel+=("["+getQuotedString(post_name_decoration)+"]"); }
-		if(pre_dist_decoration.size()>0 || !isnan(distanceToParent)) {
-			constructedLabel+=":";
-			if(pre_dist_decoration.size()>0) { constructedLabel+=("["+getQuotedString(pre_dist_decoration)+"]"); }
-			if(!isnan(distanceToParent)) { constructedLabel+= toString(distanceToParent); }
-			if(post_dist_decoration.size()>0) {constructedLabel+=("["+getQuotedString(post_dist_decoration)+"]"); }
+	} else if (style==KBNode::NAME_DISTANCE_AND_COMMENTS) { //name:distance + all comments, leave nothing out
+		if(label.pre_name_decoration.size()>0) { writeComment(out,label.pre_name_decoration); }
+		writeQuoted(out,label.name);
+		if(label.name.size()==0 && !isnan(label.bootstrapValue)) { writeDouble(out,label.bootstrapValue,precision); }
+		if(label.post_name_decoration.size()>0) { writeComment(out,label.post_name_decoration); }
+		if(label.pre_dist_decoration.size()>0 || !isnan(label.distanceToParent)) {
+			out.put(COLON);
+			if(label.pre_dist_decoration.size()>0) { writeComment(out,label.pre_dist_decoration); }
+			if(!isnan(label.distanceToParent)) { writeDouble(out,label.distanceToParent,precision); }
+			if(label.post_dist_decoration.size()>0) { writeComment(out,label.post_dist_decoration); }
 		}
-	} else if (style==ORIGINAL_LABEL) { //original parsed label
-		constructedLabel=original_label;
-	}
-	else if (style==STRUCTURE_ONLY) { //no label, just the structure is asked for
-		constructedLabel="";
+	} else if (style==KBNode::ORIGINAL_LABEL) { //original parsed label
+		out.write(label.original_label);
 	}
+	//STRUCTURE_ONLY: no label, just the structure is asked for
+}
+
+std::string KBNode::formatLabel(const KBLabelText &label, bool with_label, bool with_distance, bool with_comments, bool with_bootstrap_value_as_label, int precision) {
+	string constructedLabel;
+	StringOutput out = { constructedLabel };
+	writeLabelWithFlags(out,label,with_label,with_distance,with_comments,with_bootstrap_value_as_label,precision);
 	return constructedLabel;
 }
 
+std::string KBNode::formatLabel(const KBLabelText &label, unsigned int style, int precision) {
+	string constructedLabel;
+	StringOutput out = { constructedLabel };
+	writeLabelInStyle(out,label,style,precision);
+	return constructedLabel;
+}
+
+void KBNode::writeLabel(KBOutputSink &out, const KBLabelText &label, bool with_label, bool with_distance, bool with_comments, bool with_bootstrap_value_as_label, int precision) {
+	writeLabelWithFlags(out,label,with_label,with_distance,with_comments,with_bootstrap_value_as_label,precision);
+}
+
+void KBNode::writeLabel(KBOutputSink &out, const KBLabelText &label, unsigned int style, int precision) {
+	writeLabelInStyle(out,label,style,precision);
+}
+
+
 
 
 
+KBTree::KBTree(const std::string &newickString) : KBTree(newickString,false,false,1) { }
 
-KBTree::KBTree(const std::string &newickString) {
+KBTree::KBTree(const std::string &newickString,bool verbose) : KBTree(newickString,verbose,false,1) { }
+
+KBTree::KBTree(const std::string &newickString,bool verbose,bool assumeBootstrapNames) : KBTree(newickString,verbose,assumeBootstrapNames,1) { }
+
+KBTree::KBTree(const std::string &newickString,bool verbose,bool assumeBootstrapNames,unsigned int threadCount,bool lazyLabels,bool keepOriginalLabels) {
 	this->nodeCount=0;
-	this->verbose=false;
-	this->assumeBootstrapNames=false;
+	this->verbose=verbose;
+	this->assumeBootstrapNames=assumeBootstrapNames;
 	this->with_labels=true;
 	this->with_distances=true;
 	this->with_comments=true;
 	this->with_bootstrap_values_as_labels=true;
+	this->parseThreadCount=threadCount;
+	this->lazyLabels=lazyLabels;
+	this->keepOriginalLabels=keepOriginalLabels;
 	this->initializeFromNewick(newickString);
 	this->resetBreadthFirstIterToRoot();
 }
 
-KBTree::KBTree(const std::string &newickString,bool verbose) {
+KBTree::KBTree(std::string_view newickText, std::shared_ptr<const void> owner, bool verbose, bool assumeBootstrapNames, bool useStructuralIndex, unsigned int threadCount, bool lazyLabels, bool keepOriginalLabels) {
 	this->nodeCount=0;
 	this->verbose=verbose;
-	this->assumeBootstrapNames=false;
+	this->assumeBootstrapNames=assumeBootstrapNames;
 	this->with_labels=true;
 	this->with_distances=true;
 	this->with_comments=true;
 	this->with_bootstrap_values_as_labels=true;
-	this->initializeFromNewick(newickString);
+	this->parseThreadCount=threadCount;
+	this->lazyLabels=lazyLabels;
+	this->keepOriginalLabels=keepOriginalLabels;
+	this->initializeFromText(newickText,owner,useStructuralIndex);
 	this->resetBreadthFirstIterToRoot();
 }
 
-KBTree::KBTree(const std::string &newickString,bool verbose,bool assumeBootstrapNames) {
+KBTree::KBTree() {
 	this->nodeCount=0;
-	this->verbose=verbose;
-	this->assumeBootstrapNames=assumeBootstrapNames;
+	this->verbose=false;
+	this->assumeBootstrapNames=false;
 	this->with_labels=true;
 	this->with_distances=true;
 	this->with_comments=true;
 	this->with_bootstrap_values_as_labels=true;
-	this->initializeFromNewick(newickString);
-	this->resetBreadthFirstIterToRoot();
+	this->tr.reset(new KBNodeTree ());
 }
 
 KBTree::~KBTree() {
-	this->tr->clear();
+	// the node pool goes with the tree (see KBNodeTreeDeleter)
+}
+
+size_t KBTree::getMemoryUsage() const {
+	size_t nameIndexBytes = nameIndex.bucket_count()*sizeof(void *) + nameIndex.size()*(sizeof(std::string_view)+sizeof(std::pair<uint32_t,uint32_t>)+2*sizeof(void *))
+		+ nameIndexEntries.capacity()*sizeof(NameIndexEntry);
+	return sizeof(KBTree) + tr->node_allocator().getStatistics().bytesReserved + labelTable.getMemoryUsage() + labelArena.getBytesStored() + nameIndexBytes
+		+ derived.capacity()*sizeof(DerivedProperties) + nodesById.capacity()*sizeof(tree_node_<KBNode> *) + breadthFirstOrder.capacity()*sizeof(uint32_t)
+		+ (depthMinima ? depthMinima->getMemoryUsage() : 0);
+}
+
+KBTree *KBTree::fromFile(const std::string &filename, bool verbose, bool assumeBootstrapNames, unsigned int threadCount, bool lazyLabels, bool keepOriginalLabels) {
+	std::shared_ptr<KBMappedFile> file;
+	try {
+		file = std::make_shared<KBMappedFile>(filename);
+	} catch (ParseException& e) {
+		cerr<<"!!KBTREE ERROR-- "<<e.what()<<endl;
+		return NULL;
+	}
+	if(verbose) { cout<<"KBTREE-- mapped newick file '"<<filename<<"' ("<<file->getText().size()<<" bytes)"<<endl; }
+	return new KBTree(file->getText(),file,verbose,assumeBootstrapNames,true,threadCount,lazyLabels,keepOriginalLabels);
 }
 
 void KBTree::initializeFromNewick(const std::string &newickString) {
-	this->tr = new tree <KBNode> ();
+	// keep our own copy of the text; parsed labels refer back into it instead of being copied per node
+	std::shared_ptr<std::string> copy = std::make_shared<std::string>(newickString);
+	initializeFromText(*copy,copy);
+}
+
+void KBTree::initializeFromText(std::string_view newickText, std::shared_ptr<const void> owner, bool useStructuralIndex) {
+	this->newickText = newickText;
+	this->newickTextOwner = owner;
+	this->invalidateNameIndex();
+	this->invalidateDerivedProperties();
+	this->labelArena.clear();
+	this->labelTable.clear();
+	// any tree from before goes now; the new one is held by tr from the start, so that it is freed even if the
+	// parse throws from a constructor, which leaves no destructor to run
+	this->tr.reset(new KBNodeTree ());
+	this->nodeCount=0;
 	// create and add the root node
 	if(verbose) { cout<<"KBTREE-- initializing tree from newick string"<<endl; }
 	//trim(newickString);
-	tr->set_head(KBNode());
+	tr->set_head(KBNode(labelTable));
 	this->nodeCount++;
 	// Recursive parse can encounter stack overflow if tree is large, thus we have switched to non-recursive parse
 	//unsigned int curserPosition = 0;
-	//tree<KBNode>::iterator rootIter = tr->begin();
-	parseNewickNonRecursive(newickString);
+	//KBNodeTree::iterator rootIter = tr->begin();
+	if(useStructuralIndex) {
+		// locate all of the structural characters up front with a vectorized scan, so the parser below can
+		// jump from one to the next instead of examining every character of the labels
+		KBStructuralIndex structure;
+		structure.build(this->newickText);
+		if(!parseNewickParallel(this->newickText,structure,parseThreadCount)) {
+			parseNewickNonRecursive(this->newickText,&structure);
+		}
+	} else {
+		parseNewickNonRecursive(this->newickText);
+	}
 	//parseNewick(newickString,curserPosition,rootIter);
 	if(verbose) { cout<<"KBTREE-- newick parse is complete"<<endl; }
 }
@@ -250,35 +711,52 @@ void printPos(const std::string &newickString, unsigned int &k) {
 }
 
 
-void KBTree::parseNewickNonRecursive(const std::string &newickString)
+void KBTree::parseNewickNonRecursive(std::string_view newickString, const KBStructuralIndex *structure)
+{
+	ParseState state(labelTable,0,labelArena,this->assumeBootstrapNames,this->lazyLabels,this->keepOriginalLabels);
+	parseSubtree(newickString,structure,0,newickString.length(),tr->begin(),state);
+	this->nodeCount += state.nodeCount;
+	this->assumeBootstrapNames = state.assumeBootstrapNames;
+}
+
+void KBTree::parseSubtree(std::string_view newickString, const KBStructuralIndex *structure, size_t cursor, size_t limit, KBNodeTree::iterator top, ParseState &state)
 {
-	// setup stack and cursor
-	unsigned int cursor = 0;
-	stack<tree<KBNode>::iterator> nodeStack;
-	nodeStack.push(tr->begin());
+	// setup stack
+	stack<KBNodeTree::iterator> nodeStack;
+	nodeStack.push(top);
 
 	// handle every node we encounter
 	while(!nodeStack.empty()) {
 
 		// pop off the next node to process
-		tree<KBNode>::iterator currentNode = nodeStack.top();
+		KBNodeTree::iterator currentNode = nodeStack.top();
 		nodeStack.pop();
 
+		// a clade parsed on its own (see parseNewickParallel) stops at the comma or parenthesis that follows it.
+		// The full parse labels the current node there before moving on to the next clade, so do the same
+		if(cursor>=limit && limit<newickString.length()) {
+			labelNode(newickString,cursor,(*currentNode),structure,state);
+			return;
+		}
+
 		// advance the cursor as far as we can
-		while(cursor<newickString.length()) {
+		while(cursor<limit) {
 
 			// ditch leading white space first by advancing the cursor, if this gets us to the end then break
 			passLeadingWhiteSpace(newickString, cursor);
-			if( cursor >= newickString.length() ) break;
+			if( cursor >= limit ) {
+				if(limit<newickString.length()) { labelNode(newickString,cursor,(*currentNode),structure,state); return; }
+				break;
+			}
 			
 			// if we get to an open parenthesis, then create a child and recurse down
-			if( newickString.at(cursor)==OPEN_PARAN ) {
+			if( newickString[cursor]==OPEN_PARAN ) {
 				// note here that the begin iterator points to the first child of the current node
-				tree<KBNode>::iterator newChild = tr->insert(currentNode.begin(),KBNode());
-				this->nodeCount++;
+				KBNodeTree::iterator newChild = tr->insert(currentNode.begin(),KBNode(labelTable));
+				state.nodeCount++;
 				cursor++;
-				if( cursor >= newickString.length() ) { cerr<<"syntax error in tree at position:"<<cursor<<endl; exit(1); }
-				if(newickString.at(cursor)!=CLOSE_PARAN) {
+				if( cursor >= limit ) { throw ParseException("Syntax error in tree at position "+std::to_string(cursor)+".","KBTree::parseSubtree()"); }
+				if(newickString[cursor]!=CLOSE_PARAN) {
 					nodeStack.push(currentNode);
 					nodeStack.push(newChild);
 					break;
@@ -286,34 +764,38 @@ void KBTree::parseNewickNonRecursive(const std::string &newickString)
 			}
 
 			// If we get here, then we are ready to label it
-			getNextLabel(newickString,cursor,(*currentNode));
+			labelNode(newickString,cursor,(*currentNode),structure,state);
 			// if it is an internal node and has a name and we are assuming that internal node names are bootstrap values,
 			// then update the parsing. (note that this is the case for most MO trees)
-			if(this->assumeBootstrapNames && currentNode.number_of_children()>0 && (*currentNode).getName().size()>0) {
-				try {
-					(*currentNode).bootstrapValue = convertToDouble((*currentNode).name);
-					(*currentNode).name="";
-				} catch (...) {
-					this->assumeBootstrapNames = false;
-					cerr<<"assuming that internal nodes are NOT bootstrap values"<<endl;
+			if(state.assumeBootstrapNames && currentNode.number_of_children()>0) { (*currentNode).decodeLabel(state.labels,state.shard); }
+			if(state.assumeBootstrapNames && currentNode.number_of_children()>0 && (*currentNode).name!=KBStringTable::EMPTY) {
+				if(parseDouble(state.labels.get((*currentNode).name),(*currentNode).bootstrapValue)) {
+					(*currentNode).name=KBStringTable::EMPTY;
+				} else {
+					state.assumeBootstrapNames = false;
+					state.rejectedBootstrapName = true;
+					if(!state.quiet) {
+						cerr<<"Cannot convert string '"<<state.labels.get((*currentNode).name)<<"' to double value."<<endl;
+						cerr<<"assuming that internal nodes are NOT bootstrap values"<<endl;
+					}
 				}
 			}
 
 			// if we get to a close parenthesis, then go on to the next position in the string
 			// and return back up the hierarchy
-			if( cursor >= newickString.length() ) { break; }
-			if (newickString.at(cursor)==CLOSE_PARAN) {
+			if( cursor >= limit ) { break; }
+			if (newickString[cursor]==CLOSE_PARAN) {
 				cursor++;
 				break;
 			}
 
 			//again make sure we can go further
-			if( cursor >= newickString.length() ) break;
+			if( cursor >= limit ) break;
 
 			// If we get to a comma, then the current node has some siblings, so recurse on the sibling node
-			if (newickString.at(cursor)==COMMA) {
-				tree<KBNode>::iterator newSibling = tr->insert_after(currentNode,KBNode());
-				this->nodeCount++;
+			if (newickString[cursor]==COMMA) {
+				KBNodeTree::iterator newSibling = tr->insert_after(currentNode,KBNode(labelTable));
+				state.nodeCount++;
 				cursor++;
 				nodeStack.push(newSibling);
 				break;
@@ -323,6 +805,14 @@ void KBTree::parseNewickNonRecursive(const std::string &newickString)
 	// should be all done if we get here
 }
 
+void KBTree::labelNode(std::string_view newickString, size_t &k, KBNode &node, const KBStructuralIndex *structure, ParseState &state)
+{
+	// a node can be labeled twice in malformed input; the new label is applied on top of the old one
+	node.decodeLabel(state.labels,state.shard);
+	if(structure!=NULL) { getNextLabelIndexed(newickString,k,node,*structure,state); }
+	else { getNextLabel(newickString,k,node,state); }
+}
+
 
 
 
@@ -331,98 +821,179 @@ void KBTree::parseNewickNonRecursive(const std::string &newickString)
 
 
 
+/**
+ * Accumulates one component of a node label (the name, the distance, or one of the comments) while the
+ * label is scanned.  As long as the component is a single contiguous run of the Newick buffer it is
+ * tracked as a [begin,end) range only, so nothing is copied.  If it stops being contiguous (quoted text
+ * with escapes, a name interrupted by a comment, ...) the text spills into a scratch string that is
+ * owned by the parse state and reused from node to node.
+ */
+class LabelPiece {
+	public:
+		LabelPiece(const char *buffer, std::string &scratchText) : buf(buffer), begin(0), end(0), spilled(false), scratch(scratchText) {
+			scratch.clear();
+		};
+		bool empty() const { return spilled ? scratch.empty() : begin==end; };
+
+		/** add the buffer text in [b,e) to this piece */
+		void append(size_t b, size_t e) {
+			if(!spilled) {
+				if(begin==end) { begin=b; end=e; return; }
+				if(end==b) { end=e; return; }
+				spill();
+			}
+			scratch.append(buf+b,e-b);
+		};
+		/** add text that does not appear verbatim in the buffer */
+		void appendText(const std::string &text) {
+			if(!spilled) { spill(); }
+			scratch+=text;
+		};
+		/** in place removal of leading and trailing blanks, as done by KBTreeLib::trim */
+		void trim() {
+			if(!spilled) {
+				while(begin<end && (buf[begin]==' ' || buf[begin]=='\t')) { begin++; }
+				while(begin<end && (buf[end-1]==' ' || buf[end-1]=='\t')) { end--; }
+				return;
+			}
+			size_t endpos = scratch.find_last_not_of(" \t");
+			if(endpos==string::npos) { scratch.clear(); return; }
+			scratch.erase(endpos+1);
+			scratch.erase(0,scratch.find_first_not_of(" \t"));
+		};
+		/** view of the accumulated text; spilled text is only valid until the scratch string is reused */
+		std::string_view view() const {
+			if(spilled) { return std::string_view(scratch); }
+			return std::string_view(buf+begin,end-begin);
+		};
+		/** handle of the accumulated text in the parse's shard of the label table; spilled text is copied to
+		 * the arena (if the table does not have it yet), as it must stay valid for the life of the tree */
+		uint32_t intern(KBStringTable &labels, KBLabelArena &arena, unsigned int shard) const {
+			if(spilled) { return labels.intern(scratch,arena,shard); }
+			return labels.intern(std::string_view(buf+begin,end-begin),shard);
+		};
+
+	private:
+		void spill() {
+			scratch.assign(buf+begin,end-begin);
+			spilled=true;
+		};
+		const char *buf;
+		size_t begin;
+		size_t end;
+		bool spilled;
+		std::string &scratch;
+};
+
+
+/** view of the text with leading and trailing blanks dropped, as done by KBTreeLib::trim */
+static std::string_view trimmedView(std::string_view text) {
+	size_t startpos = text.find_first_not_of(" \t");
+	size_t endpos = text.find_last_not_of(" \t");
+	if(( string::npos == startpos ) || (string::npos == endpos)) { return std::string_view(); }
+	return text.substr(startpos,endpos-startpos+1);
+}
+
 /**
  * ignores comments (normally denoted by [..]), but does detect the first colon found and splits the string into names and distances
  * simply includes quotes as is in the strings without conversion
  */
-bool KBTree::getNextLabelWithoutComments(const std::string &newickString, unsigned int &k, KBNode &node)
+bool KBTree::getNextLabelWithoutComments(std::string_view newickString, size_t &k, KBNode &node, ParseState &state)
 {
-	std::string label = "";
-	std::string nameString="";
-	std::string distanceToParentString = "";
+	const char *buf = newickString.data();
+	const size_t n = newickString.size();
+	const size_t labelStart = k;
+	size_t labelEnd = string::npos;
+	LabelPiece nameString(buf,state.labelScratch[1]), distanceToParentString(buf,state.labelScratch[2]);
 
 	bool afterColonOperator = false;
 	char C;
-	while( k<newickString.size() ) {
-		C=newickString.at(k);
+	while( k<n ) {
+		C=buf[k];
 
 		// if we have to move somewhere else in the tree structure, then break (skipping over the closing semicolon)
-		if ( C==OPEN_PARAN || C==CLOSE_PARAN || C==COMMA ) { break; }
-		if ( C==SEMICOLON ) { k++; break; }
+		if ( C==OPEN_PARAN || C==CLOSE_PARAN || C==COMMA ) { labelEnd=k; break; }
+		if ( C==SEMICOLON ) { labelEnd=k; k++; break; }
 
 		// determine if we are before or after the colon (indicates name vs. distance)
-		if(afterColonOperator) { distanceToParentString += C; }
+		if(afterColonOperator) { distanceToParentString.append(k,k+1); }
 		if (C==COLON) { afterColonOperator = true; }
-		if(!afterColonOperator) { nameString += C; }
+		if(!afterColonOperator) { nameString.append(k,k+1); }
 
 		//always add the character to be part of the label
-		label += C;
 		k++;
 	}
-	trim(label);trim(nameString);trim(distanceToParentString);
-	node.original_label.assign(label);
-	node.name.assign(nameString);
-	if(distanceToParentString.size()>0) { node.distanceToParent = convertToDouble(distanceToParentString); }
+	if(labelEnd==string::npos) { labelEnd=k; }
+	nameString.trim(); distanceToParentString.trim();
+	node.original_label = state.keepOriginalLabels ? state.labels.add(trimmedView(newickString.substr(labelStart,labelEnd-labelStart)),state.shard) : KBStringTable::EMPTY;
+	node.name = nameString.intern(state.labels,state.arena,state.shard);
+	if(!distanceToParentString.empty()) { node.distanceToParent = convertToDouble(distanceToParentString.view(),state.quiet); }
 	return true;
 }
 
 
 
 
-void getQuotedText(const std::string &newickString, unsigned int &k, string &quotedText, string &rawLabel, char QUOTE) {
-	// grab the quote, because we need to include this in the raw label
-	rawLabel+=newickString.at(k);
+/**
+ * Scans quoted text starting at the opening quote at position k, leaving k on the closing quote (or at the end
+ * of the string if the quote is never closed).  The only escape is a backslash in front of the quote character.
+ * Returns true if the text contained escapes, in which case the unescaped text is written to quotedText.
+ * Otherwise the quoted text is exactly the buffer range [textBegin,k) and quotedText is left untouched.
+ */
+static bool scanQuotedText(const char *buf, size_t n, size_t &k, const char QUOTE, size_t &textBegin, std::string &quotedText) {
 	k++;
-	assert(k>=1);
-	quotedText="";
-	while( k<newickString.size() ) {
-		assert(k+1<newickString.size());
-		char C = newickString.at(k);
-		//cout<<"  *gots:"<<C<<endl;
-		if(C=='\\' && newickString.at(k+1)==QUOTE ) {
-			rawLabel+=C;
-			k++; C=newickString.at(k);
+	textBegin = k;
+	bool hasEscapes = false;
+	while( k<n ) {
+		char C = buf[k];
+		if(C=='\\' && k+1<n && buf[k+1]==QUOTE ) {
+			if(!hasEscapes) { quotedText.assign(buf+textBegin,k-textBegin); hasEscapes=true; }
+			k++; C=buf[k];
 		}
-		else if(C==QUOTE && newickString.at(k-1)!='\\' ) { break; }
-		rawLabel+=C;
-		quotedText+=C;
+		else if(C==QUOTE) { break; }
+		if(hasEscapes) { quotedText+=C; }
 		k++;
 	}
+	return hasEscapes;
 }
 
-bool KBTree::getNextLabel(const std::string &newickString, unsigned int &k, KBNode &node)
+bool KBTree::getNextLabel(std::string_view newickString, size_t &k, KBNode &node, ParseState &state)
 {
-	// reserve all of the components that might be needed to label the Node
-	std::string label = "";
-	std::string distanceToParentString = "";
-	std::string nameString = "";
-	std::string preNameComment  = "";
-	std::string postNameComment = "";
-	std::string preDistComment  = "";
-	std::string postDistComment = "";
+	// Nothing is copied while scanning; each component of the label is tracked as a range of the buffer and is
+	// only copied (to the tree's label arena) if it does not exist verbatim in the buffer.
+	const char *buf = newickString.data();
+	const size_t n = newickString.size();
+	const size_t labelStart = k;
+	size_t labelEnd = string::npos;
+	LabelPiece distanceToParentString(buf,state.labelScratch[0]);
+	LabelPiece nameString(buf,state.labelScratch[1]);
+	LabelPiece preNameComment(buf,state.labelScratch[2]);
+	LabelPiece postNameComment(buf,state.labelScratch[3]);
+	LabelPiece preDistComment(buf,state.labelScratch[4]);
+	LabelPiece postDistComment(buf,state.labelScratch[5]);
+	std::string &quotedText = state.labelScratch[6];
 
 	// keep track of what we are currently parsing
 	unsigned int commentType = 0; // 0=name/distance/delimeter, 1=preName, 2=postName, 3=preDist, 4=postDist
 	bool afterColonOperator = false;
-	bool quotedTextWasFound = false;
 
-	char C; string textToAdd="";
-	while( k<newickString.size() ) {
+	char C;
+	while( k<n ) {
 
 		// first things first - get the next character
-		C=newickString.at(k);
-
-		// Now handle anything in quotes.  Note how this is a bit deceptive.  We first save the character to
-		// the textToAdd string.  This will be the text that we eventually add to the comment, name, or distance
-		// strings.  By default we set it to be just the value of the current character that we see.  But if that
-		// character is a quote, then we parse the entire quote and overwrite the variable textToAdd.  Then later,
-		// we can simply add textToAdd to the appropriate string.  Note that this also advances k such that we
-		// won't try to parse anything inside the quoted string as a special character
-		textToAdd="";
-		textToAdd+=C;
-		quotedTextWasFound=false;
-		if ( C==SGL_QUOTE ) { getQuotedText(newickString,k,textToAdd,label,SGL_QUOTE); }
-		if ( C==DBL_QUOTE ) { getQuotedText(newickString,k,textToAdd,label,DBL_QUOTE); }
+		C=buf[k];
+
+		// Now handle anything in quotes.  The text to add to the comment, name, or distance is by default just the
+		// current character, [k,k+1).  But if that character is a quote, then we scan the entire quote and the text
+		// to add becomes the quoted text, either as a range of the buffer or, if it had escapes, the unescaped copy.
+		// Note that this also advances k such that we won't try to parse anything inside the quoted string as a
+		// special character
+		size_t textBegin = k, textEnd = k+1;
+		bool textIsEscaped = false;
+		if ( C==SGL_QUOTE || C==DBL_QUOTE ) {
+			textIsEscaped = scanQuotedText(buf,n,k,C,textBegin,quotedText);
+			textEnd = k;
+		}
 
 		//detect if we have to close a comment block (asserting that a comment was previously open)
 		//should we force that a ']' cannot be used unless it is in a comment or quoted string? I think so.
@@ -434,73 +1005,136 @@ bool KBTree::getNextLabel(const std::string &newickString, unsigned int &k, KBNo
 		//if we aren't closing a comment, then we should add the next character or quoted text to
 		//something, or detect that it is a special character
 		else {
+			LabelPiece *target = NULL;
 			//handle cases where we are in comments first, adding either the character or the quoted text
-			if(commentType==1)       { preNameComment+=textToAdd;  }
-			else if(commentType==2)  { postNameComment+=textToAdd; }
-			else if(commentType==3)  { preDistComment+=textToAdd;  }
-			else if(commentType==4)  { postDistComment+=textToAdd; }
+			if(commentType==1)       { target=&preNameComment;  }
+			else if(commentType==2)  { target=&postNameComment; }
+			else if(commentType==3)  { target=&preDistComment;  }
+			else if(commentType==4)  { target=&postDistComment; }
 
 			// if we are not in a comment, then we can process special characters or determine if the character or
 			// quoted text should be placed in a name or distanceFromParent string
 			else if(commentType==0) {
 
 				// if we have to move somewhere else in the tree structure, then break (skipping over the closing semicolon)
-				if ( C==OPEN_PARAN || C==CLOSE_PARAN || C==COMMA ) { assert(commentType==0); break; }
-				if ( C==SEMICOLON ) { assert(commentType==0); k++; break; }
+				if ( C==OPEN_PARAN || C==CLOSE_PARAN || C==COMMA ) { assert(commentType==0); labelEnd=k; break; }
+				if ( C==SEMICOLON ) { assert(commentType==0); labelEnd=k; k++; break; }
 
 				// detect if we are opening a comment block, and determine where this block appears
 				if ( C==OPEN_BRACKET ) {
-					trim(distanceToParentString); trim(nameString);
+					distanceToParentString.trim(); nameString.trim();
 					if(afterColonOperator) {
-						if(distanceToParentString.size()==0) { commentType=3; }
+						if(distanceToParentString.empty()) { commentType=3; }
 						else { commentType=4; }
 					} else {
-						if(nameString.size()==0) { commentType = 1; }
+						if(nameString.empty()) { commentType = 1; }
 						else {commentType = 2; }
 					}
 				}
 				// if we get here, then we have to add the character or quoted text to the name/distance strings
 				else{
 					// determine if we are before or after the colon (indicates name vs. distance)
-					if(afterColonOperator) { distanceToParentString += textToAdd; }
-					if (newickString.at(k)==COLON) { afterColonOperator = true; }
-					if(!afterColonOperator) { nameString += textToAdd; }
+					if(afterColonOperator) { target=&distanceToParentString; }
+					if (k<n && buf[k]==COLON) { afterColonOperator = true; }
+					if(!afterColonOperator) { target=&nameString; }
 				}
 			}
+			if(target!=NULL) {
+				if(textIsEscaped) { target->appendText(quotedText); }
+				else { target->append(textBegin,textEnd); }
+			}
 		}
 
-		//always add the character to be part of the label (note that quoted text was already added above if it was found)
-		label += C;
+		// the raw label is simply everything we pass over, so it is recovered as a range once we stop
 		k++;
 	}
-	trim(label); trim(nameString);
-
-	node.original_label.assign(label);
-	node.name.assign(nameString);
-	trim(distanceToParentString);
-	if(distanceToParentString.size()>0) { node.distanceToParent = convertToDouble(distanceToParentString); }
-	node.pre_name_decoration.assign(preNameComment);
-	node.post_name_decoration.assign(postNameComment);
-	node.pre_dist_decoration.assign(preDistComment);
-	node.post_dist_decoration.assign(postDistComment);
+	if(labelEnd==string::npos) { labelEnd = (k<n) ? k : n; }
+	nameString.trim(); distanceToParentString.trim();
+
+	node.original_label = state.keepOriginalLabels ? state.labels.add(trimmedView(newickString.substr(labelStart,labelEnd-labelStart)),state.shard) : KBStringTable::EMPTY;
+	node.name = nameString.intern(state.labels,state.arena,state.shard);
+	if(!distanceToParentString.empty()) {
+		try {
+			node.distanceToParent = convertToDouble(distanceToParentString.view(),state.quiet);
+		} catch (ParseException& e) {
+			e.addTraceException("KBTree::getNextLabel()");
+			throw e;
+		}
+	}
+	node.pre_name_decoration = preNameComment.intern(state.labels,state.arena,state.shard);
+	node.post_name_decoration = postNameComment.intern(state.labels,state.arena,state.shard);
+	node.pre_dist_decoration = preDistComment.intern(state.labels,state.arena,state.shard);
+	node.post_dist_decoration = postDistComment.intern(state.labels,state.arena,state.shard);
 	if(verbose) {
 		cout<<"KBTREE-- parsed node details:"<<endl;
-		cout<<"KBTREE--   LABEL=>'"<<label<<"'"<<endl;
-		cout<<"KBTREE--   NAME=>'"<<nameString<<"'"<<endl;
-		cout<<"KBTREE--   DIST=>'"<<distanceToParentString<<"'"<<endl;
+		cout<<"KBTREE--   LABEL=>'"<<state.labels.get(node.original_label)<<"'"<<endl;
+		cout<<"KBTREE--   NAME=>'"<<state.labels.get(node.name)<<"'"<<endl;
+		cout<<"KBTREE--   DIST=>'"<<distanceToParentString.view()<<"'"<<endl;
+
+		cout<<"KBTREE--   PRENAME=>'"<<state.labels.get(node.pre_name_decoration)<<"'"<<endl;
+		cout<<"KBTREE--   POSTNAME=>'"<<state.labels.get(node.post_name_decoration)<<"'"<<endl;
+		cout<<"KBTREE--   PREDIST=>'"<<state.labels.get(node.pre_dist_decoration)<<"'"<<endl;
+		cout<<"KBTREE--   POSTDIST=>'"<<state.labels.get(node.post_dist_decoration)<<"'"<<endl;
+	}
+	return true;
+}
 
-		cout<<"KBTREE--   PRENAME=>'"<<preNameComment<<"'"<<endl;
-		cout<<"KBTREE--   POSTNAME=>'"<<postNameComment<<"'"<<endl;
-		cout<<"KBTREE--   PREDIST=>'"<<preDistComment<<"'"<<endl;
-		cout<<"KBTREE--   POSTDIST=>'"<<postDistComment<<"'"<<endl;
+bool KBTree::getNextLabelIndexed(std::string_view newickString, size_t &k, KBNode &node, const KBStructuralIndex &structure, ParseState &state)
+{
+	// find the structural character that ends this label
+	size_t &nextEntry = state.nextEntry;
+	while(nextEntry<structure.size() && structure.getPosition(nextEntry)<k) { nextEntry++; }
+
+	// labels with quotes or comments, the last label when the text is not terminated, and verbose output
+	// all go through the character by character parser
+	if(verbose || nextEntry>=structure.size() || structure.labelHasSpecials(nextEntry)) {
+		return getNextLabel(newickString,k,node,state);
 	}
+
+	// otherwise the label is plain text: a name, then optionally a colon and a distance
+	const char *buf = newickString.data();
+	const size_t labelStart = k;
+	const size_t labelEnd = structure.getPosition(nextEntry);
+	// skip over the closing semicolon, as getNextLabel does
+	k = (buf[labelEnd]==SEMICOLON) ? labelEnd+1 : labelEnd;
+	if(state.lazyLabels) {
+		node.setPendingLabel(state.labels.add(trimmedView(newickString.substr(labelStart,labelEnd-labelStart)),state.shard),state.keepOriginalLabels);
+		return true;
+	}
+	LabelPiece distanceToParentString(buf,state.labelScratch[0]);
+	LabelPiece nameString(buf,state.labelScratch[1]);
+	const char *colon = (const char *)memchr(buf+labelStart,COLON,labelEnd-labelStart);
+	if(colon==NULL) {
+		nameString.append(labelStart,labelEnd);
+	} else {
+		size_t colonPos = colon-buf;
+		nameString.append(labelStart,colonPos);
+		distanceToParentString.append(colonPos+1,labelEnd);
+	}
+	nameString.trim(); distanceToParentString.trim();
+
+	node.original_label = state.keepOriginalLabels ? state.labels.add(trimmedView(newickString.substr(labelStart,labelEnd-labelStart)),state.shard) : KBStringTable::EMPTY;
+	node.name = nameString.intern(state.labels,state.arena,state.shard);
+	if(!distanceToParentString.empty()) {
+		try {
+			node.distanceToParent = convertToDouble(distanceToParentString.view(),state.quiet);
+		} catch (ParseException& e) {
+			e.addTraceException("KBTree::getNextLabel()");
+			throw e;
+		}
+	}
+	// the label has no comments (a node can be labeled twice in malformed input, so clear any old ones)
+	node.pre_name_decoration = KBStringTable::EMPTY;
+	node.post_name_decoration = KBStringTable::EMPTY;
+	node.pre_dist_decoration = KBStringTable::EMPTY;
+	node.post_dist_decoration = KBStringTable::EMPTY;
 	return true;
 }
 
-void KBTree::passLeadingWhiteSpace(const std::string &newickString, unsigned int &k)
+void KBTree::passLeadingWhiteSpace(std::string_view newickString, size_t &k)
 {
 	for(;k<newickString.size();k++) {
-		char C=newickString.at(k);
+		char C=newickString[k];
 		if( C!=' ' && C!='\t' && C!='\n' && C!='\r' ) {
 			break;
 		}
@@ -510,13 +1144,14 @@ void KBTree::passLeadingWhiteSpace(const std::string &newickString, unsigned int
 void KBTree::printTree() { printTree(cout); }
 std::string KBTree::printSimpleTreeToString() {
 	string pretty_tree;
-	tree<KBNode>::pre_order_iterator it  =this->tr->begin();
-	tree<KBNode>::pre_order_iterator end =this->tr->end();
-	int rootdepth=tr->depth(it);
+	KBNodeTree::pre_order_iterator it  =this->tr->begin();
+	KBNodeTree::pre_order_iterator end =this->tr->end();
+	buildDerivedProperties();
 	while(it!=end) {
-		for(int i=0; i<tr->depth(it)-rootdepth; ++i) { pretty_tree += "   "; }
+		for(uint32_t i=0; i<derived[(*it).derivedIndex].depth; ++i) { pretty_tree += "   "; }
 		pretty_tree += " -";
-		pretty_tree += (*it).name; pretty_tree+="\n";
+		(*it).decodeLabel(labelTable);
+		pretty_tree += labelTable.get((*it).name); pretty_tree+="\n";
 		++it;
 	}
 	return pretty_tree;
@@ -528,21 +1163,26 @@ std::string KBTree::printTreeToString() {
 	return ss.str();
 }
 void KBTree::printTree(ostream &o) {
-	KBTree::printTree(o,this->tr,this->tr->begin(),this->tr->end());
+	KBTree::printTree(o,this->tr.get(),this->labelTable,this->tr->begin(),this->tr->end());
 }
 
-void KBTree::printTree(ostream &o, const tree<KBNode> *tr, tree<KBNode>::pre_order_iterator it, tree<KBNode>::pre_order_iterator end)
+void KBTree::printTree(ostream &o, const KBNodeTree *tr, KBStringTable &labels, KBNodeTree::pre_order_iterator it, KBNodeTree::pre_order_iterator end)
 {
 	o<<"*****************"<<endl;
 	o<<"Tree Size: "<<tr->size()<<endl;
 	if(!tr->is_valid(it)) return;
 	int rootdepth=tr->depth(it);
+	// the depth of each node follows from the ancestors of the node before it, rather than counting up to the root
+	std::vector<std::pair<const tree_node_<KBNode> *,int> > path;
 	o << "-----" << std::endl;
 	while(it!=end) {
-		for(int i=0; i<tr->depth(it)-rootdepth; ++i)
+		while(!path.empty() && path.back().first!=it.node->parent) { path.pop_back(); }
+		int depth = path.empty() ? tr->depth(it) : path.back().second+1;
+		path.push_back(std::pair<const tree_node_<KBNode> *,int>(it.node,depth));
+		for(int i=0; i<depth-rootdepth; ++i)
 			o << "  ";
-		string full_label = (*it).getLabelFromComponents(KBNode::NAME_DISTANCE_AND_COMMENTS);
-		o << (*it).name<<"   (dist="<<(*it).distanceToParent <<",full="<<full_label<<")"<< std::endl << std::flush;
+		string full_label = (*it).getLabelFromComponents(labels,KBNode::NAME_DISTANCE_AND_COMMENTS);
+		o << labels.get((*it).name)<<"   (dist="<<(*it).distanceToParent <<",full="<<full_label<<")"<< std::endl << std::flush;
 		++it;
 	}
 	o << "*****************" << std::endl;
@@ -563,100 +1203,63 @@ void printAllNodes(ostream &o)
 
 
 
-class NodeHandle {
-	public:
-		NodeHandle(bool hasVisitedBefore,tree<KBNode>::iterator node) {
-			this->hasVisitedBefore = hasVisitedBefore;
-			this->node = node;
-		};
-		bool hasVisitedBefore;
-		tree<KBNode>::iterator node;
-};
-
 std::string KBTree::toNewick() {
-
-	std::string newickString="";
-	stack<NodeHandle> nodeStack;
-	nodeStack.push(NodeHandle(false,tr->begin()));
-
-	while(!nodeStack.empty()) {
-
-		// pop off the next node to process
-		NodeHandle currentNode = nodeStack.top();
-		nodeStack.pop();
-
-		if(currentNode.hasVisitedBefore) {
-			// we've seen this node before, so we have to just print, and move on to a sibling if one exists
-			newickString+=(*(currentNode.node)).getLabelFromComponents(this->with_labels, this->with_distances, this->with_comments, this->with_bootstrap_values_as_labels);
-			tree<KBNode>::iterator sibling = tr->next_sibling(currentNode.node);
-			if(sibling!=NULL && sibling!=tr->end()) {
-				/// if we have a next sibling, then go there
-				newickString+=",";
-				nodeStack.push(NodeHandle(false,sibling));
-			} else if(!nodeStack.empty()){
-				newickString+=")";
-			} else {
-				newickString+=";";
-			}
-
-		} else {
-			if(tree<KBNode>::number_of_children(currentNode.node)>0) {
-				// if there are children, add the current node back to the stack, but remember that we've been here...
-				newickString+="(";
-				nodeStack.push(NodeHandle(true,currentNode.node));
-				tree<KBNode>::iterator childIter = currentNode.node.begin();
-				nodeStack.push(NodeHandle(false,childIter));
-			} else {
-				// if there are no children, we can print so add this node to the stack, and mark that we have seen its children
-				nodeStack.push(NodeHandle(true,currentNode.node));
-			}
-		}
-	}
+	std::string newickString;
+	KBOutputSink out([&newickString](const char *data, size_t length) { newickString.append(data,length); });
+	writeNewick(out);
+	out.flush();
 	return newickString;
 }
 
-
-
 std::string KBTree::toNewick(unsigned int style) {
+	std::string newickString;
+	KBOutputSink out([&newickString](const char *data, size_t length) { newickString.append(data,length); });
+	writeNewick(out,style);
+	out.flush();
+	return newickString;
+}
 
-	std::string newickString="";
-	stack<NodeHandle> nodeStack;
-	nodeStack.push(NodeHandle(false,tr->begin()));
-
-	while(!nodeStack.empty()) {
+void KBTree::writeNewick(KBOutputSink &out) {
+	writeNewick(out,false,0);
+}
 
-		// pop off the next node to process
-		NodeHandle currentNode = nodeStack.top();
-		nodeStack.pop();
+void KBTree::writeNewick(KBOutputSink &out, unsigned int style) {
+	// without original labels, the closest thing is the label rebuilt from all of its components
+	if(style==KBNode::ORIGINAL_LABEL && !keepOriginalLabels) { style=KBNode::NAME_DISTANCE_AND_COMMENTS; }
+	writeNewick(out,true,style);
+}
 
-		if(currentNode.hasVisitedBefore) {
-			// we've seen this node before, so we have to just print, and move on to a sibling if one exists
-			newickString+=(*(currentNode.node)).getLabelFromComponents(style);
-			tree<KBNode>::iterator sibling = tr->next_sibling(currentNode.node);
-			if(sibling!=NULL && sibling!=tr->end()) {
-				/// if we have a next sibling, then go there
-				newickString+=",";
-				nodeStack.push(NodeHandle(false,sibling));
-			} else if(!nodeStack.empty()){
-				newickString+=")";
-			} else {
-				newickString+=";";
+void KBTree::writeNewick(KBOutputSink &out, bool useStyle, unsigned int style) {
+	// Walk the nodes by their parent and sibling links, which needs no stack: go down the first children
+	// opening a parenthesis for each, then write the label of the node and move on to its next sibling, or
+	// else close its parent and write the parent's label next.  The nodes at the top level (the root, and
+	// any siblings a malformed string gave it) are followed by the end of the tree, not a null sibling.
+	tree_node_<KBNode> *node = tr->begin().node;
+	tree_node_<KBNode> *end = tr->end().node;
+	// a tree with every node removed is written as just the semicolon
+	if(node==end) { out.put(';'); return; }
+	if(writeNewickParallel(out,useStyle,style)) { return; }
+	while(true) {
+		while(node->first_child!=NULL) {
+			out.put('(');
+			node = node->first_child;
+		}
+		while(true) {
+			if(useStyle) { KBNode::writeLabel(out,node->data.getLabelText(labelTable),style,this->output_precision); }
+			else { KBNode::writeLabel(out,node->data.getLabelText(labelTable),this->with_labels,this->with_distances,this->with_comments,this->with_bootstrap_values_as_labels,this->output_precision); }
+			if(node->next_sibling!=NULL && node->next_sibling!=end) {
+				out.put(',');
+				node = node->next_sibling;
+				break;
 			}
-
-		} else {
-			if(tree<KBNode>::number_of_children(currentNode.node)>0) {
-				// if there are children, add the current node back to the stack, but remember that we've been here...
-				newickString+="(";
-				nodeStack.push(NodeHandle(true,currentNode.node));
-				tree<KBNode>::iterator childIter = currentNode.node.begin();
-				nodeStack.push(NodeHandle(false,childIter));
-			} else {
-				// if there are no children, we can print so add this node to the stack, and mark that we have seen its children
-				nodeStack.push(NodeHandle(true,currentNode.node));
+			if(node->parent==NULL) {
+				out.put(';');
+				return;
 			}
+			out.put(')');
+			node = node->parent;
 		}
 	}
-	return newickString;
 }
 
 
@@ -689,52 +1292,71 @@ void KBTree::removeNodesByNameAndSimplify(const std::string &nodeNames)
 
 void KBTree::removeNodesByNameAndSimplify(std::map<std::string,std::string> &nodeNames)
 {
+	// a top level node cannot be removed; that is checked before anything is changed, so the tree is left as it was
+	tree_node_<KBNode> *end = tr->end().node;
+	for(tree_node_<KBNode> *top=tr->begin().node; top!=NULL && top!=end; top=top->next_sibling) {
+		const std::string name = top->data.getName(labelTable);
+		if(name.size()>0 && nodeNames.find(name)!=nodeNames.end()) {
+			throw ParseException("CANNOT REMOVE ROOT NODE FROM TREE: '"+name+"'","KBTree::removeNodesByNameAndSimplify()");
+		}
+	}
+	// this may remove nodes anywhere in the tree, so the derived properties of the nodes that are left are
+	// computed again at the end, by their IDs, which do not change
+	invalidateNameIndex();
+	// every node is looked at, so find the names of the nodes in a hash of the removal list by their text
+	// in the label table, rather than copying each name out to search the map
+	std::unordered_map<std::string_view,map<string,string>::iterator> removals(2*nodeNames.size());
+	for(map<string,string>::iterator it=nodeNames.begin(); it!=nodeNames.end(); it++) {
+		removals.emplace(it->first,it);
+	}
 	// loop through the nodes in a depth-first, post-order traversal
 	// thus, as we look at each node, we can assume all nodes below have been processed
 	bool nodeWasErased=false;
-	tree<KBNode>::post_order_iterator node = tr->begin_post();
+	KBNodeTree::post_order_iterator node = tr->begin_post();
 	while(node!=tr->end_post()) {
 		// look for this node in the removal list (only if it has some non-empty name)
-		if((*node).getName().size()>0) {
-			map<string,string>::iterator nodeIter=nodeNames.find((*node).getName());
-			if( nodeIter!=nodeNames.end() ) {
+		(*node).decodeLabel(labelTable);
+		std::string_view name = labelTable.get((*node).name);
+		if(name.size()>0) {
+			std::unordered_map<std::string_view,map<string,string>::iterator>::iterator removal=removals.find(name);
+			if( removal!=removals.end() ) {
+				map<string,string>::iterator nodeIter=removal->second;
 				if( (nodeIter->second).size()!=0) {
-					if(verbose) { cout<<"++KBTREE WARNING--   MORE THAN ONE NODE NAMED: '"<<(*node).getName()<<"' IS BEING REMOVED"<<endl;}
+					if(verbose) { cout<<"++KBTREE WARNING--   MORE THAN ONE NODE NAMED: '"<<(*node).getName(labelTable)<<"' IS BEING REMOVED"<<endl;}
 				}
 				nodeIter->second="+";
-				// if we are a leaf node, then just erase
+				// if we are a leaf node, then just erase (the root is never named here, see above)
 				if(tr->number_of_children(node)==0) {
-					if(verbose) { cout<<"KBTREE--   REMOVING LEAF NODE NAMED: '"<<(*node).getName()<<"'"<<endl;}
-					tree<KBNode>::post_order_iterator nodeToBeAxed(node); node++;
+					if(verbose) { cout<<"KBTREE--   REMOVING LEAF NODE NAMED: '"<<(*node).getName(labelTable)<<"'"<<endl;}
+					KBNodeTree::post_order_iterator nodeToBeAxed(node); node++;
+					if(derivedValid) { nodesById[(*nodeToBeAxed).derivedIndex]=NULL; }
 					tr->erase(nodeToBeAxed); nodeCount--;
 					nodeWasErased=true;
 				}
 				// if we have children, then we must replace this node with its child
 				else {
-					if(verbose) { cout<<"KBTREE--   REMOVING INTERNAL NODE NAMED: '"<<(*node).getName()<<"'"<<endl;}
+					if(verbose) { cout<<"KBTREE--   REMOVING INTERNAL NODE NAMED: '"<<(*node).getName(labelTable)<<"'"<<endl;}
 					//refactor distances to the child by adding the edge lengths
-					if(node.has_parent()) {
-						double distFromThisNodeToParent = (*node).distanceToParent;
-						for(tree<KBNode>::sibling_iterator child=node.begin(); child!=tr->end(child); child++) {
-							(*child).distanceToParent += distFromThisNodeToParent;
-						}
-						tree<KBNode>::post_order_iterator nodeToBeAxed(node); node++;
-						tr->erase_and_reparent_children(nodeToBeAxed); nodeCount--;
-						nodeWasErased=true;
-					} else {
-						cerr<<"!!KBTREE ERROR-- CANNOT REMOVE ROOT NODE FROM TREE."<<endl;
-						exit(1);
+					double distFromThisNodeToParent = (*node).distanceToParent;
+					for(KBNodeTree::sibling_iterator child=node.begin(); child!=tr->end(child); child++) {
+						(*child).decodeLabel(labelTable);
+						(*child).distanceToParent += distFromThisNodeToParent;
 					}
+					KBNodeTree::post_order_iterator nodeToBeAxed(node); node++;
+					if(derivedValid) { nodesById[(*nodeToBeAxed).derivedIndex]=NULL; }
+					tr->erase_and_reparent_children(nodeToBeAxed); nodeCount--;
+					nodeWasErased=true;
 				}
 			}
 		}
 		else {
 			// if node is unamed and has only zero or one children and is not the root node (has no parent), then remove
 			if(node.has_parent()) {
-				if(((*node).getName()).size()==0) {
+				if(name.size()==0) {
 					if(tr->number_of_children(node)==0) {
 						if(verbose) { cout<<"KBTREE--   REMOVING UNAMED LEAF NODE"<<endl;}
-						tree<KBNode>::post_order_iterator nodeToBeAxed(node); node++;
+						KBNodeTree::post_order_iterator nodeToBeAxed(node); node++;
+						if(derivedValid) { nodesById[(*nodeToBeAxed).derivedIndex]=NULL; }
 						tr->erase(nodeToBeAxed); nodeCount--;
 						nodeWasErased=true;
 					}
@@ -744,8 +1366,10 @@ void KBTree::removeNodesByNameAndSimplify(std::map<std::string,std::string> &nod
 						// distances (so that the total distance to the leaf nodes are conserved).  So update that first.  Note
 						// that if we are here, there is only one possible child, so we only have to update that single child.
 						double distFromThisNodeToParent = (*node).distanceToParent;
+						(*(node.begin())).decodeLabel(labelTable);
 						(*(node.begin())).distanceToParent += distFromThisNodeToParent;
-						tree<KBNode>::post_order_iterator nodeToBeAxed(node); node++;
+						KBNodeTree::post_order_iterator nodeToBeAxed(node); node++;
+						if(derivedValid) { nodesById[(*nodeToBeAxed).derivedIndex]=NULL; }
 						tr->erase_and_reparent_children(nodeToBeAxed); nodeCount--;
 						nodeWasErased=true;
 					}
@@ -765,7 +1389,104 @@ void KBTree::removeNodesByNameAndSimplify(std::map<std::string,std::string> &nod
 			cout<<"++KBTREE WARNING--   UNABLE TO FIND AND REMOVE NODE NAMED: '"<<it->first<<"'"<<endl;
 		}
 	}
+	refreshDerivedProperties();
+}
 
+unsigned int KBTree::removeNodeByNameAndSimplify(const std::string &name)
+{
+	buildNameIndex();
+	std::unordered_map<std::string_view,std::pair<uint32_t,uint32_t> >::iterator named = nameIndex.find(name);
+	if(named==nameIndex.end()) {
+		cout<<"++KBTREE WARNING--   UNABLE TO FIND AND REMOVE NODE NAMED: '"<<name<<"'"<<endl;
+		return 0;
+	}
+	// as in removeNodesByNameAndSimplify, a top level node cannot be removed, and the tree is left as it was
+	for(uint32_t entry=named->second.first; entry!=NO_NAME_ENTRY; entry=nameIndexEntries[entry].next) {
+		if(nameIndexEntries[entry].node->parent==NULL) {
+			throw ParseException("CANNOT REMOVE ROOT NODE FROM TREE: '"+name+"'","KBTree::removeNodeByNameAndSimplify()");
+		}
+	}
+	uint32_t first = takeNameChain(name);
+	// Remove all of the named nodes first, and then simplify the parents they leave behind: as in the post order
+	// walk of removeNodesByNameAndSimplify, no parent is looked at until every named node below it is gone.
+	// Simplification only ever removes unnamed nodes, which are not in the index, so every other entry stays valid.
+	unsigned int removed=0;
+	std::vector<tree_node_<KBNode> *> parents;
+	std::unordered_set<tree_node_<KBNode> *> erased;
+	for(uint32_t entry=first; entry!=NO_NAME_ENTRY; entry=nameIndexEntries[entry].next) {
+		tree_node_<KBNode> *node = nameIndexEntries[entry].node;
+		tree_node_<KBNode> *parent = node->parent;
+		if(verbose) { cout<<"KBTREE--   REMOVING NODE NAMED: '"<<name<<"'"<<endl;}
+		eraseNodeKeepingDistances(node);
+		erased.insert(node);
+		parents.push_back(parent);
+		nameIndexEntries[entry].node=NULL;
+		namedNodeCount--;
+		removed++;
+	}
+	// each parent, and then its ancestors in turn, may now be unnamed with only zero or one children (nodes are
+	// not allocated here, so an erased node cannot be mistaken for a new one)
+	for(size_t p=0; p<parents.size(); p++) {
+		tree_node_<KBNode> *parent = parents[p];
+		if(erased.count(parent)>0) { continue; }
+		while(parent->parent!=NULL && parent->first_child==parent->last_child) {
+			parent->data.decodeLabel(labelTable);
+			if(labelTable.get(parent->data.name).size()>0) { break; }
+			tree_node_<KBNode> *grandparent = parent->parent;
+			if(verbose) { cout<<"KBTREE--   REMOVING UNAMED NODE WITH ZERO OR ONE CHILDREN"<<endl;}
+			eraseNodeKeepingDistances(parent);
+			erased.insert(parent);
+			parent = grandparent;
+		}
+	}
+	return removed;
+}
+
+void KBTree::eraseNodeKeepingDistances(tree_node_<KBNode> *node)
+{
+	tree_node_<KBNode> *parent = node->parent;
+	tree_node_<KBNode> *firstChild = node->first_child;
+	if(derivedValid) {
+		// the node leaves the subtree of every ancestor; a leaf takes its leaf with it, unless it is the only
+		// child of its parent, which becomes a leaf in its place
+		uint32_t lostLeaves = (firstChild==NULL && parent->first_child!=parent->last_child) ? 1 : 0;
+		for(tree_node_<KBNode> *ancestor=parent; ancestor!=NULL; ancestor=ancestor->parent) {
+			DerivedProperties &properties = derived[ancestor->data.derivedIndex];
+			properties.subtreeSize--;
+			properties.leafCount-=lostLeaves;
+		}
+		leafCount-=lostLeaves;
+		// the ID is not used again, and the nodes below move up a level in breadth first order
+		nodesById[node->data.derivedIndex]=NULL;
+		invalidateBreadthFirstOrder();
+		depthMinima.reset();
+	}
+	// distances from the node's parent to its children become the sum of the two edges, so that the
+	// distances to the leaves are conserved
+	double distFromThisNodeToParent = node->data.distanceToParent;
+	std::vector<tree_node_<KBNode> *> below;
+	for(tree_node_<KBNode> *child=firstChild; child!=NULL; child=child->next_sibling) {
+		child->data.decodeLabel(labelTable);
+		child->data.distanceToParent += distFromThisNodeToParent;
+		if(derivedValid) { below.push_back(child); }
+	}
+	if(firstChild==NULL) { tr->erase(KBNodeTree::iterator(node)); }
+	else { tr->erase_and_reparent_children(KBNodeTree::iterator(node)); }
+	nodeCount--;
+	// everything below the node is now one level shallower, and its distance to the root is summed again over
+	// the changed branch lengths, exactly as buildRootDistances would
+	while(!below.empty()) {
+		tree_node_<KBNode> *next = below.back();
+		below.pop_back();
+		const DerivedProperties &up = derived[next->parent->data.derivedIndex];
+		DerivedProperties &properties = derived[next->data.derivedIndex];
+		properties.depth = up.depth+1;
+		if(rootDistancesValid) {
+			next->data.decodeLabel(labelTable);
+			properties.distanceToRoot = up.distanceToRoot+(isnan(next->data.distanceToParent) ? 0 : next->data.distanceToParent);
+		}
+		for(tree_node_<KBNode> *child=next->first_child; child!=NULL; child=child->next_sibling) { below.push_back(child); }
+	}
 }
 
 
@@ -830,46 +1551,78 @@ void KBTree::replaceNodeNames(std::map<std::string,std::string> &nodeNames) {
 }
 void KBTree::replaceNodeNames(std::map<std::string,std::string> &nodeNames, bool defaultToBlankIfNotFound)
 {
-	tree<KBNode>::post_order_iterator node;
-	map<string,string>::iterator name;
+	// unless every other node is to be blanked, only the nodes with the names need be visited.  Unnamed nodes
+	// are not in the name index, so renaming them still takes a walk over the tree.
+	if(!defaultToBlankIfNotFound && nodeNames.find("")==nodeNames.end()) {
+		// take all of the names out of the index before renaming any node, so that a node renamed to a name
+		// that is itself to be replaced keeps its new name
+		buildNameIndex();
+		std::vector<std::pair<uint32_t,const std::string *> > renames;
+		for(map<string,string>::iterator it=nodeNames.begin(); it!=nodeNames.end(); it++) {
+			uint32_t first = takeNameChain(it->first);
+			if(first!=NO_NAME_ENTRY) { renames.push_back(std::pair<uint32_t,const std::string *>(first,&it->second)); }
+		}
+		for(size_t r=0; r<renames.size(); r++) {
+			unsigned int renamed = addNameChain(renames[r].first,labelTable.intern(*renames[r].second,labelArena));
+			if(verbose) { cout<<"renamed "<<renamed<<" nodes to:"<<*renames[r].second<<endl; }
+		}
+		return;
+	}
+	invalidateNameIndex();
+	// add each replacement name to the label table once, no matter how many nodes end up sharing it
+	std::unordered_map<std::string_view,uint32_t> storedNames(2*nodeNames.size());
+	for(map<string,string>::iterator it=nodeNames.begin(); it!=nodeNames.end(); it++) {
+		storedNames.emplace(it->first,labelTable.intern(it->second,labelArena));
+	}
+	KBNodeTree::post_order_iterator node;
+	std::unordered_map<std::string_view,uint32_t>::iterator name;
 	for(node=tr->begin_post(); node!=tr->end_post(); node++) {
-		name = nodeNames.find((*node).getName());
-		if(verbose) { cout<<"looking at node:"<<(*node).getName()<<endl; }
-		if( name!=nodeNames.end() ) {
+		(*node).decodeLabel(labelTable);
+		name = storedNames.find(labelTable.get((*node).name));
+		if(verbose) { cout<<"looking at node:"<<labelTable.get((*node).name)<<endl; }
+		if( name!=storedNames.end() ) {
 			(*node).name=name->second;
 		} else if(defaultToBlankIfNotFound) {
-			(*node).name="";
+			(*node).name=KBStringTable::EMPTY;
 		}
 	}
 }
 
+unsigned int KBTree::replaceNodeName(const std::string &name, const std::string &newName) {
+	buildNameIndex();
+	uint32_t first = takeNameChain(name);
+	if(first==NO_NAME_ENTRY) { return 0; }
+	return addNameChain(first,labelTable.intern(newName,labelArena));
+}
+
 
 
 
 void KBTree::mergeZeroDistLeaves() {
+	invalidateNameIndex();
 
 	// we proceed in two steps.  First, we go through the entire tree and find the children
 	// that are zero distance.  We mark the parent if we found one for the first node we encounter,
 	// so that siblings can be marked for deletion. Marking for deletion is as simple as renaming
 	// the node to some string that (probably :) ) no one will use as a valid node name. Step
 	// two, we simply call the method to remove marked nodes and simplify the tree.
-	tree<KBNode>::post_order_iterator node;
+	KBNodeTree::post_order_iterator node;
 	map<string,string>::iterator name;
 	for(node=tr->begin_post(); node!=tr->end_post(); node++) {
 
 		if (tr->number_of_children(node)==0) {
-			if( !isnan((*node).getDistanceToParent()) ) {
-				if( (*node).getDistanceToParent()==0 ) {
+			if( !isnan((*node).getDistanceToParent(labelTable)) ) {
+				if( (*node).getDistanceToParent(labelTable)==0 ) {
 					if(verbose) {
-						cout<<"looking at node:"<<(*node).getName()<<endl;
-						cout<<"distance to parent: "<<(*node).getDistanceToParent()<<endl;
-						cout<<"parent marker: '" << (*tr->parent(node)).getHiddenMarkerLabel() <<"'"<< endl;
+						cout<<"looking at node:"<<(*node).getName(labelTable)<<endl;
+						cout<<"distance to parent: "<<(*node).getDistanceToParent(labelTable)<<endl;
+						cout<<"parent marker: '" << labelTable.get((*tr->parent(node)).getHiddenMarkerLabel()) <<"'"<< endl;
 					}
-					if((*tr->parent(node)).getHiddenMarkerLabel().compare("")==0) {
-						(*tr->parent(node)).setHiddenMarkerLabel("marked");
+					if((*tr->parent(node)).getHiddenMarkerLabel()==KBStringTable::EMPTY) {
+						(*tr->parent(node)).setHiddenMarkerLabel(labelTable.intern("marked"));
 						if(verbose) { cout<<"unmarked parent is now marked"<<endl; }
 					} else {
-						(*node).name="THE_SECRET_CODE_TO_DELETE_THIS_NODE_HACK";
+						(*node).name=labelTable.intern("THE_SECRET_CODE_TO_DELETE_THIS_NODE_HACK");
 						if(verbose) { cout<<"i have decided to delete this node."<<endl; }
 					}
 				}
@@ -894,15 +1647,19 @@ bool KBTree::writeNewickToFile(const std::string &filename) {
 	return writeNewickToFile(filename,KBNode::NAME_AND_DISTANCE);
 }
 bool KBTree::writeNewickToFile(const std::string &filename,unsigned int style) {
-	ofstream outputFileStream;
-	outputFileStream.open(filename.c_str());
-	if(!outputFileStream.is_open()) {
+	int fd = open(filename.c_str(),O_WRONLY|O_CREAT|O_TRUNC,0666);
+	if(fd<0) {
 		cerr<<"!!KBTREE ERROR-- CANNOT OPEN OUTPUT STREAM TO FILE: '"<<filename<<"'"<<endl;
 		return false;
 	}
-	outputFileStream << toNewick(style);
-	outputFileStream.close();
-	return true;
+	KBOutputSink out(fd);
+	writeNewick(out,style);
+	bool written = out.flush();
+	if(close(fd)!=0) { written=false; }
+	if(!written) {
+		cerr<<"!!KBTREE ERROR-- CANNOT WRITE TO FILE: '"<<filename<<"'"<<endl;
+	}
+	return written;
 }
 
 
@@ -910,18 +1667,18 @@ bool KBTree::writeNewickToFile(const std::string &filename,unsigned int style) {
 std::string KBTree::getAllLeafNames()
 {
 	std::string leafNames="";
-	tree<KBNode>::leaf_iterator leafIter;
+	KBNodeTree::leaf_iterator leafIter;
 	for(leafIter=tr->begin_leaf(); leafIter!=tr->end_leaf(); leafIter++) {
-		string name = (*leafIter).getName();
+		string name = (*leafIter).getName(labelTable);
 		if(name.size()>0) { leafNames += name; leafNames+=";"; }
 	}
 	return leafNames;
 }
 void KBTree::getAllLeafNames(vector<string> &names) {
-	tree<KBNode>::leaf_iterator leafIter;
+	KBNodeTree::leaf_iterator leafIter;
 	names.reserve((size_t)(1+getNodeCount()/2)); //assume full binary tree of leaves
 	for(leafIter=tr->begin_leaf(); leafIter!=tr->end_leaf(); leafIter++) {
-		string name = (*leafIter).getName();
+		string name = (*leafIter).getName(labelTable);
 		if(name.size()>0) { names.push_back(name); }
 	}
 }
@@ -929,18 +1686,18 @@ void KBTree::getAllLeafNames(vector<string> &names) {
 std::string KBTree::getAllNodeNames()
 {
 	std::string nodeNames="";
-	tree<KBNode>::post_order_iterator nodeIter;
+	KBNodeTree::post_order_iterator nodeIter;
 	for(nodeIter=tr->begin_post(); nodeIter!=tr->end_post(); nodeIter++) {
-		string name = (*nodeIter).getName();
+		string name = (*nodeIter).getName(labelTable);
 		if(name.size()>0) { nodeNames += name; nodeNames+=";"; }
 	}
 	return nodeNames;
 }
 void KBTree::getAllNodeNames(vector<string> &names) {
 	names.reserve((size_t)(1+getNodeCount()));
-	tree<KBNode>::post_order_iterator nodeIter;
+	KBNodeTree::post_order_iterator nodeIter;
 	for(nodeIter=tr->begin_post(); nodeIter!=tr->end_post(); nodeIter++) {
-		string name = (*nodeIter).getName();
+		string name = (*nodeIter).getName(labelTable);
 		if(name.size()>0) { names.push_back(name); }
 	}
 
@@ -948,9 +1705,10 @@ void KBTree::getAllNodeNames(vector<string> &names) {
 
 
 void KBTree::stripReservedCharsFromLabels() {
-	tree<KBNode>::post_order_iterator nodeIter;
+	invalidateNameIndex();
+	KBNodeTree::post_order_iterator nodeIter;
 	for(nodeIter=tr->begin_post(); nodeIter!=tr->end_post(); nodeIter++) {
-		string name = (*nodeIter).getName();
+		string name = (*nodeIter).getName(labelTable);
 		string stripped_name = "";
 		for (size_t i=0; i < name.length(); i++) {
 			if(name.at(i)==' ') { stripped_name += '_'; }
@@ -963,141 +1721,576 @@ void KBTree::stripReservedCharsFromLabels() {
 			else if(name.at(i)==']') { stripped_name += '}'; }
 			else { stripped_name += name.at(i); }
 		}
-		(*nodeIter).name = stripped_name;
+		if(stripped_name!=name) { (*nodeIter).name = labelTable.intern(stripped_name,labelArena); }
+	}
+}
+
+
+void KBTree::buildNameIndex() {
+	if(nameIndexValid) { return; }
+	nameIndex.clear();
+	nameIndexEntries.clear();
+	namedNodeCount=0;
+	nameIndexEntries.reserve(nodeCount);
+	nameIndex.reserve(nodeCount);
+	for(KBNodeTree::post_order_iterator node=tr->begin_post(); node!=tr->end_post(); node++) {
+		(*node).decodeLabel(labelTable);
+		std::string_view name = labelTable.get((*node).name);
+		if(name.size()==0) { continue; }
+		uint32_t entry = (uint32_t)nameIndexEntries.size();
+		nameIndexEntries.push_back(NameIndexEntry{node.node,NO_NAME_ENTRY});
+		namedNodeCount++;
+		std::pair<std::unordered_map<std::string_view,std::pair<uint32_t,uint32_t> >::iterator,bool> added =
+				nameIndex.emplace(name,std::pair<uint32_t,uint32_t>(entry,entry));
+		if(!added.second) {
+			nameIndexEntries[added.first->second.second].next = entry;
+			added.first->second.second = entry;
+		}
+	}
+	nameIndexValid=true;
+}
+
+void KBTree::invalidateNameIndex() {
+	if(!nameIndexValid) { return; }
+	// release the memory; an edited tree may never be queried by name again
+	std::unordered_map<std::string_view,std::pair<uint32_t,uint32_t> >().swap(nameIndex);
+	std::vector<NameIndexEntry>().swap(nameIndexEntries);
+	namedNodeCount=0;
+	nameIndexValid=false;
+}
+
+tree_node_<KBNode> *KBTree::findNodeByName(std::string_view name) {
+	buildNameIndex();
+	std::unordered_map<std::string_view,std::pair<uint32_t,uint32_t> >::iterator named = nameIndex.find(name);
+	if(named==nameIndex.end()) { return NULL; }
+	return nameIndexEntries[named->second.first].node;
+}
+
+uint32_t KBTree::takeNameChain(std::string_view name) {
+	std::unordered_map<std::string_view,std::pair<uint32_t,uint32_t> >::iterator named = nameIndex.find(name);
+	if(named==nameIndex.end()) { return NO_NAME_ENTRY; }
+	uint32_t first = named->second.first;
+	nameIndex.erase(named);
+	return first;
+}
+
+unsigned int KBTree::addNameChain(uint32_t first, uint32_t name) {
+	unsigned int renamed=0;
+	uint32_t last=first;
+	for(uint32_t entry=first; entry!=NO_NAME_ENTRY; entry=nameIndexEntries[entry].next) {
+		nameIndexEntries[entry].node->data.name=name;
+		last=entry;
+		renamed++;
+	}
+	std::string_view text = labelTable.get(name);
+	if(text.size()==0) {
+		for(uint32_t entry=first; entry!=NO_NAME_ENTRY; entry=nameIndexEntries[entry].next) { nameIndexEntries[entry].node=NULL; }
+		namedNodeCount-=renamed;
+		return renamed;
+	}
+	std::pair<std::unordered_map<std::string_view,std::pair<uint32_t,uint32_t> >::iterator,bool> added =
+			nameIndex.emplace(text,std::pair<uint32_t,uint32_t>(first,last));
+	if(!added.second) {
+		// merge the chain with that of the nodes already with the name, keeping them in post order
+		uint32_t a=added.first->second.first, b=first, head=NO_NAME_ENTRY, tail=NO_NAME_ENTRY;
+		while(a!=NO_NAME_ENTRY || b!=NO_NAME_ENTRY) {
+			uint32_t next;
+			if(b==NO_NAME_ENTRY || (a!=NO_NAME_ENTRY && a<b)) { next=a; a=nameIndexEntries[a].next; }
+			else { next=b; b=nameIndexEntries[b].next; }
+			if(tail==NO_NAME_ENTRY) { head=next; } else { nameIndexEntries[tail].next=next; }
+			tail=next;
+		}
+		added.first->second = std::pair<uint32_t,uint32_t>(head,tail);
 	}
+	return renamed;
+}
+
+bool KBTree::areAllLabelsUnique(string &infoMssg) {
+	buildNameIndex();
+	infoMssg="";
+	if(nameIndex.size()==namedNodeCount) { return true; }
+	// list each shared name once, in the post order of the first node with it
+	for(size_t entry=0; entry<nameIndexEntries.size(); entry++) {
+		if(nameIndexEntries[entry].node==NULL || nameIndexEntries[entry].next==NO_NAME_ENTRY) { continue; }
+		const KBNode &node = nameIndexEntries[entry].node->data;
+		std::unordered_map<std::string_view,std::pair<uint32_t,uint32_t> >::iterator named = nameIndex.find(labelTable.get(node.name));
+		if(named->second.first==entry) { infoMssg += std::string(named->first)+";"; }
+	}
+	return false;
+}
+
+std::string KBTree::getPathToRoot(const std::string &name) {
+	tree_node_<KBNode> *node = findNodeByName(name);
+	std::string path="";
+	if(node==NULL) { return path; }
+	for(node=node->parent; node!=NULL; node=node->parent) {
+		path += node->data.getName(labelTable)+";";
+	}
+	return path;
+}
+
+std::string KBTree::getAllDescendantNames(const std::string &name) {
+	tree_node_<KBNode> *node = findNodeByName(name);
+	if(node==NULL) { return ""; }
+	// indexing the names decoded every label
+	return getDescendantNamesBreadthFirst(node);
+}
+
+KBTree *KBTree::extractInducedSubtree(const std::string &names) {
+	std::vector<std::string> nameList;
+	splitNames(names,nameList);
+	return extractInducedSubtree(nameList);
+}
+
+KBTree *KBTree::extractInducedSubtree(const std::vector<std::string> &names) {
+	typedef tree_node_<KBNode> TreeNode;
+	buildNameIndex();
+	buildDepthMinima();
+	// the nodes with the names, in preorder
+	std::vector<TreeNode *> nodes;
+	for(size_t i=0; i<names.size(); i++) {
+		std::unordered_map<std::string_view,std::pair<uint32_t,uint32_t> >::iterator named = nameIndex.find(names[i]);
+		if(named==nameIndex.end()) {
+			cout<<"++KBTREE WARNING--   UNABLE TO FIND NODE NAMED: '"<<names[i]<<"'"<<endl;
+			continue;
+		}
+		for(uint32_t entry=named->second.first; entry!=NO_NAME_ENTRY; entry=nameIndexEntries[entry].next) {
+			nodes.push_back(nameIndexEntries[entry].node);
+		}
+	}
+	if(nodes.empty()) { return NULL; }
+	std::sort(nodes.begin(),nodes.end(),[](const TreeNode *a, const TreeNode *b) { return a->data.derivedIndex<b->data.derivedIndex; });
+	nodes.erase(std::unique(nodes.begin(),nodes.end()),nodes.end());
+
+	// Each node is added below the lowest common ancestor of it and the node before it: the parent of the
+	// shallowest node after the one before, up to and including it (see kbancestor.hh).  The stack holds the
+	// kept ancestors of the last node; those below the new ancestor are finished, and each becomes the child
+	// of the one under it.
+	auto depth = [this](const TreeNode *node) { return derived[node->data.derivedIndex].depth; };
+	std::vector<TreeNode *> kept;
+	std::unordered_map<TreeNode *,TreeNode *> keptParents;
+	std::vector<TreeNode *> stack;
+	for(size_t i=0; i<nodes.size(); i++) {
+		TreeNode *node = nodes[i];
+		if(!stack.empty()) {
+			const uint32_t shallowest = depthMinima->findShallowest(stack.back()->data.derivedIndex+1,node->data.derivedIndex);
+			TreeNode *ancestor = nodesById[shallowest]->parent;
+			TreeNode *finished = NULL;
+			while(!stack.empty() && (ancestor==NULL || depth(stack.back())>depth(ancestor))) {
+				if(finished!=NULL) { keptParents[finished]=stack.back(); }
+				finished = stack.back();
+				stack.pop_back();
+			}
+			if(ancestor!=NULL && (stack.empty() || stack.back()!=ancestor)) {
+				stack.push_back(ancestor);
+				kept.push_back(ancestor);
+			}
+			if(finished!=NULL) { keptParents[finished]=ancestor; }
+		}
+		stack.push_back(node);
+		kept.push_back(node);
+	}
+	for(size_t i=stack.size(); i-->0; ) { keptParents[stack[i]] = i>0 ? stack[i-1] : NULL; }
+
+	// The simplify logic never removes the top of a tree, nor a named node, so the top node of each tree the
+	// nodes are in is kept, and so is every named node on the paths between the kept nodes (the labels were
+	// all decoded by the name index).  These paths are the ones whose branch lengths are summed.
+	const size_t branching = kept.size();
+	for(size_t i=0; i<branching; i++) {
+		TreeNode *node = kept[i];
+		TreeNode *parent = keptParents[node];
+		for(TreeNode *skipped=node->parent; skipped!=parent; skipped=skipped->parent) {
+			if(skipped->parent==NULL || labelTable.get(skipped->data.name).size()>0) {
+				keptParents[node] = skipped;
+				kept.push_back(skipped);
+				node = skipped;
+			}
+		}
+		keptParents[node] = parent;
+	}
+
+	// copy the kept nodes in preorder, so that appending each to its parent keeps the order of siblings
+	std::sort(kept.begin(),kept.end(),[](const TreeNode *a, const TreeNode *b) { return a->data.derivedIndex<b->data.derivedIndex; });
+	KBTree *result = new KBTree();
+	KBStringTable &labels = result->labelTable;
+	KBLabelArena &arena = result->labelArena;
+	std::unordered_map<TreeNode *,KBNodeTree::iterator> copies;
+	KBNodeTree::iterator lastTopLevel;
+	for(size_t i=0; i<kept.size(); i++) {
+		TreeNode *node = kept[i];
+		KBLabelText text = node->data.getLabelText(labelTable);
+		KBNode label(labels);
+		label.name = labels.intern(text.name,arena);
+		label.distanceToParent = text.distanceToParent;
+		label.bootstrapValue = text.bootstrapValue;
+		label.pre_name_decoration = labels.intern(text.pre_name_decoration,arena);
+		label.post_name_decoration = labels.intern(text.post_name_decoration,arena);
+		label.pre_dist_decoration = labels.intern(text.pre_dist_decoration,arena);
+		label.post_dist_decoration = labels.intern(text.post_dist_decoration,arena);
+		TreeNode *parent = keptParents[node];
+		if(parent!=NULL) {
+			for(TreeNode *skipped=node->parent; skipped!=parent; skipped=skipped->parent) {
+				label.distanceToParent += skipped->data.distanceToParent;
+			}
+			copies[node] = result->tr->append_child(copies[parent],label);
+		} else if(i==0) {
+			copies[node] = lastTopLevel = result->tr->set_head(label);
+		} else {
+			copies[node] = lastTopLevel = result->tr->insert_after(lastTopLevel,label);
+		}
+	}
+	result->nodeCount = (unsigned int)kept.size();
+	result->keepOriginalLabels = false;
+	result->resetBreadthFirstIterToRoot();
+	return result;
 }
 
 void KBTree::printOutNamesAllPossibleTraversals(ostream &o)
 {
-	tree<KBNode>::leaf_iterator leafIter;
+	KBNodeTree::leaf_iterator leafIter;
 	for(leafIter=tr->begin_leaf(); leafIter!=tr->end_leaf(); leafIter++) {
-		o<<"leafIter::"<<(*leafIter).getName()<<" "<<leafIter.number_of_children()<<endl;
+		o<<"leafIter::"<<(*leafIter).getName(labelTable)<<" "<<leafIter.number_of_children()<<endl;
 
 	}
-	tree<KBNode>::post_order_iterator nodeIter;
+	KBNodeTree::post_order_iterator nodeIter;
 	for(nodeIter=tr->begin_post(); nodeIter!=tr->end_post(); nodeIter++) {
-		o<<"postOrderDF::"<<(*nodeIter).getName()<<endl;
+		o<<"postOrderDF::"<<(*nodeIter).getName(labelTable)<<endl;
 	}
 
-	tree<KBNode>::pre_order_iterator preNodeIter;
+	KBNodeTree::pre_order_iterator preNodeIter;
 	for(preNodeIter=tr->begin(); preNodeIter!=tr->end(); preNodeIter++) {
-		o<<"preOrderDF::"<<(*preNodeIter).getName()<<endl;
+		o<<"preOrderDF::"<<(*preNodeIter).getName(labelTable)<<endl;
 	}
 
-	tree<KBNode>::breadth_first_queued_iterator bfNodeIter;
+	KBNodeTree::breadth_first_queued_iterator bfNodeIter;
 	for(bfNodeIter=tr->begin_breadth_first(); bfNodeIter!=tr->end_breadth_first(); bfNodeIter++) {
-		o<<"breadthFirst::"<<(*bfNodeIter).getName()<<endl;
+		o<<"breadthFirst::"<<(*bfNodeIter).getName(labelTable)<<endl;
 	}
 }
 
 unsigned int KBTree::getLeafCount()
 {
-	int leafNodeCount=0;
-	for(tree<KBNode>::leaf_iterator leafIter=tr->begin_leaf(); leafIter!=tr->end_leaf(); leafIter++) {
+	if(derivedValid) { return leafCount; }
+	// a walk over the leaves reads no labels, so a tree parsed with lazy labels stays undecoded
+	unsigned int leafNodeCount=0;
+	for(KBNodeTree::leaf_iterator leafIter=tr->begin_leaf(); leafIter!=tr->end_leaf(); leafIter++) {
 		leafNodeCount++;
 	}
 	return leafNodeCount;
 }
 
+void KBTree::buildDerivedProperties() {
+	if(derivedValid) { return; }
+	derived.clear();
+	derived.reserve(nodeCount);
+	nodesById.clear();
+	nodesById.reserve(nodeCount);
+	leafCount=0;
+	// parents come before their children in preorder, so depths can be summed down in one walk
+	for(KBNodeTree::pre_order_iterator it=tr->begin(); it!=tr->end(); it++) {
+		tree_node_<KBNode> *node = it.node;
+		node->data.derivedIndex = (uint32_t)nodesById.size();
+		DerivedProperties properties;
+		properties.distanceToRoot = NAN;
+		properties.subtreeSize = 1;
+		properties.leafCount = node->first_child==NULL ? 1 : 0;
+		properties.depth = node->parent==NULL ? 0 : derived[node->parent->data.derivedIndex].depth+1;
+		leafCount += properties.leafCount;
+		derived.push_back(properties);
+		nodesById.push_back(node);
+	}
+	// and the subtree totals are added up in reverse preorder, where each subtree is complete when it is reached
+	for(size_t i=nodesById.size(); i-->0; ) {
+		derived[i].subtreeEnd = (uint32_t)i+derived[i].subtreeSize;
+		if(nodesById[i]->parent==NULL) { continue; }
+		DerivedProperties &up = derived[nodesById[i]->parent->data.derivedIndex];
+		up.subtreeSize += derived[i].subtreeSize;
+		up.leafCount += derived[i].leafCount;
+	}
+	derivedValid=true;
+	rootDistancesValid=false;
+	depthMinima.reset();
+}
+
+void KBTree::buildRootDistances() {
+	buildDerivedProperties();
+	if(rootDistancesValid) { return; }
+	// the IDs that are left are in preorder, so a parent's distance is always summed before its children's
+	for(size_t i=0; i<nodesById.size(); i++) {
+		const tree_node_<KBNode> *node = nodesById[i];
+		if(node==NULL) { continue; }
+		if(node->parent==NULL) { derived[i].distanceToRoot = 0; continue; }
+		node->data.decodeLabel(labelTable);
+		derived[i].distanceToRoot = derived[node->parent->data.derivedIndex].distanceToRoot+(isnan(node->data.distanceToParent) ? 0 : node->data.distanceToParent);
+	}
+	rootDistancesValid=true;
+}
+
+void KBTree::refreshDerivedProperties() {
+	if(!derivedValid) { return; }
+	// removals leave the order of the nodes alone, so the IDs that are left are still in preorder, and the two
+	// passes of buildDerivedProperties can be made over them; subtreeEnd stays as it is
+	leafCount=0;
+	for(size_t i=0; i<nodesById.size(); i++) {
+		const tree_node_<KBNode> *node = nodesById[i];
+		if(node==NULL) { continue; }
+		DerivedProperties &properties = derived[i];
+		properties.subtreeSize = 1;
+		properties.leafCount = node->first_child==NULL ? 1 : 0;
+		properties.depth = node->parent==NULL ? 0 : derived[node->parent->data.derivedIndex].depth+1;
+		leafCount += properties.leafCount;
+	}
+	for(size_t i=nodesById.size(); i-->0; ) {
+		if(nodesById[i]==NULL || nodesById[i]->parent==NULL) { continue; }
+		DerivedProperties &up = derived[nodesById[i]->parent->data.derivedIndex];
+		up.subtreeSize += derived[i].subtreeSize;
+		up.leafCount += derived[i].leafCount;
+	}
+	// the nodes below a removed node move up a level, and the distances are summed again when next asked for
+	invalidateBreadthFirstOrder();
+	rootDistancesValid=false;
+	depthMinima.reset();
+}
+
+void KBTree::invalidateDerivedProperties() {
+	if(!derivedValid) { return; }
+	std::vector<DerivedProperties>().swap(derived);
+	std::vector<tree_node_<KBNode> *>().swap(nodesById);
+	invalidateBreadthFirstOrder();
+	depthMinima.reset();
+	derivedValid=false;
+	rootDistancesValid=false;
+}
+
+void KBTree::buildDepthMinima() {
+	buildDerivedProperties();
+	if(depthMinima) { return; }
+	std::vector<uint32_t> depths(nodesById.size(),KBDepthMinima::UNUSED);
+	for(size_t i=0; i<nodesById.size(); i++) {
+		if(nodesById[i]!=NULL) { depths[i] = derived[i].depth; }
+	}
+	depthMinima.reset(new KBDepthMinima());
+	depthMinima->build(depths);
+}
+
+const KBTree::DerivedProperties *KBTree::findDerivedProperties(std::string_view name) {
+	tree_node_<KBNode> *node = findNodeByName(name);
+	if(node==NULL) { return NULL; }
+	buildDerivedProperties();
+	return &derived[node->data.derivedIndex];
+}
+
+int KBTree::getDepth(const std::string &name) {
+	const DerivedProperties *properties = findDerivedProperties(name);
+	return properties==NULL ? -1 : (int)properties->depth;
+}
+
+unsigned int KBTree::getSubtreeSize(const std::string &name) {
+	const DerivedProperties *properties = findDerivedProperties(name);
+	return properties==NULL ? 0 : properties->subtreeSize;
+}
+
+unsigned int KBTree::getCladeLeafCount(const std::string &name) {
+	const DerivedProperties *properties = findDerivedProperties(name);
+	return properties==NULL ? 0 : properties->leafCount;
+}
+
+double KBTree::getDistanceToRoot(const std::string &name) {
+	const DerivedProperties *properties = findDerivedProperties(name);
+	if(properties==NULL) { return NAN; }
+	buildRootDistances();
+	return properties->distanceToRoot;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////
+// queries by node ID, which only read the tree once the IDs are built
+void KBTree::buildNodeIds() {
+	buildNameIndex();
+	buildDerivedProperties();
+}
+
+unsigned int KBTree::getNodeId(const std::string &name) const {
+	if(!hasNodeIds()) { return NO_NODE_ID; }
+	std::unordered_map<std::string_view,std::pair<uint32_t,uint32_t> >::const_iterator named = nameIndex.find(name);
+	if(named==nameIndex.end()) { return NO_NODE_ID; }
+	return nameIndexEntries[named->second.first].node->data.derivedIndex;
+}
+
+unsigned int KBTree::getParentId(unsigned int id) const {
+	if(!isValidNodeId(id) || nodesById[id]->parent==NULL) { return NO_NODE_ID; }
+	return nodesById[id]->parent->data.derivedIndex;
+}
+
+std::string KBTree::getNameById(unsigned int id) const {
+	if(!isValidNodeId(id)) { return ""; }
+	// building the IDs decoded every label
+	return std::string(labelTable.get(nodesById[id]->data.name));
+}
+
+void KBTree::getChildIds(unsigned int id, std::vector<unsigned int> &children) const {
+	if(!isValidNodeId(id)) { return; }
+	for(const tree_node_<KBNode> *child=nodesById[id]->first_child; child!=NULL; child=child->next_sibling) {
+		children.push_back(child->data.derivedIndex);
+	}
+}
+
+void KBTree::getDescendantIds(unsigned int id, std::vector<unsigned int> &descendants) const {
+	if(!isValidNodeId(id)) { return; }
+	for(uint32_t below=id+1; below<derived[id].subtreeEnd; below++) {
+		if(nodesById[below]!=NULL) { descendants.push_back(below); }
+	}
+}
+
+std::string KBTree::getChildNamesById(unsigned int id) const {
+	std::string namelist = "";
+	if(!isValidNodeId(id)) { return namelist; }
+	for(const tree_node_<KBNode> *child=nodesById[id]->first_child; child!=NULL; child=child->next_sibling) {
+		namelist += labelTable.get(child->data.name);
+		namelist += ";";
+	}
+	return namelist;
+}
+
+std::string KBTree::getDescendantNamesById(unsigned int id) const {
+	std::string namelist = "";
+	if(!isValidNodeId(id)) { return namelist; }
+	for(uint32_t below=id+1; below<derived[id].subtreeEnd; below++) {
+		if(nodesById[below]==NULL) { continue; }
+		namelist += labelTable.get(nodesById[below]->data.name);
+		namelist += ";";
+	}
+	return namelist;
+}
+
+std::string KBTree::getPathToRootById(unsigned int id) const {
+	std::string path = "";
+	if(!isValidNodeId(id)) { return path; }
+	for(const tree_node_<KBNode> *node=nodesById[id]->parent; node!=NULL; node=node->parent) {
+		path += labelTable.get(node->data.name);
+		path += ";";
+	}
+	return path;
+}
+
+std::string KBTree::getDescendantNamesBreadthFirst(const tree_node_<KBNode> *node) const {
+	std::string namelist = "";
+	std::vector<const tree_node_<KBNode> *> queue;
+	for(const tree_node_<KBNode> *child=node->first_child; child!=NULL; child=child->next_sibling) { queue.push_back(child); }
+	for(size_t next=0; next<queue.size(); next++) {
+		namelist += labelTable.get(queue[next]->data.name);
+		namelist += ";";
+		for(const tree_node_<KBNode> *child=queue[next]->first_child; child!=NULL; child=child->next_sibling) { queue.push_back(child); }
+	}
+	return namelist;
+}
+
 
 
 ///////////////////////////////////////////////////////////////////////////////////////////
 // set of methods to traverse a tree, node by node, in a breadth first search, and mark specific
-// nodes for future fast retrieval.
+// nodes for future fast retrieval.  The iterator and the markers are node IDs.
 void KBTree::resetBreadthFirstIterToRoot() {
-	this->bfi = tr->begin_breadth_first();
+	// until the IDs are built, the root is the node that will get ID 0
+	if(tr->begin()==tr->end()) { this->bfi = NO_NODE_ID; }
+	else { this->bfi = derivedValid ? tr->begin().node->data.derivedIndex : 0; }
+	this->bfiPosition = NO_NODE_ID;
 }
 bool KBTree::breadthFirstIterNext() {
-	if(this->bfi!=tr->end_breadth_first()) {
-		bfi++;
-		if(this->bfi!=tr->end_breadth_first()) {
-			return true;
-		}
+	if(this->bfi==NO_NODE_ID) { return false; }
+	buildBreadthFirstOrder();
+	if(this->bfiPosition==NO_NODE_ID && isValidNodeId(bfi)) {
+		// the order is by depth, then ID
+		std::vector<uint32_t>::const_iterator found = std::lower_bound(breadthFirstOrder.begin(),breadthFirstOrder.end(),bfi,
+				[this](uint32_t a, uint32_t b) { return derived[a].depth<derived[b].depth || (derived[a].depth==derived[b].depth && a<b); });
+		if(found!=breadthFirstOrder.end() && *found==bfi) { this->bfiPosition = (uint32_t)(found-breadthFirstOrder.begin()); }
+	}
+	if(this->bfiPosition!=NO_NODE_ID && this->bfiPosition+1<breadthFirstOrder.size()) {
+		this->bfi = breadthFirstOrder[++this->bfiPosition];
+		return true;
 	}
+	this->bfi = NO_NODE_ID;
+	this->bfiPosition = NO_NODE_ID;
 	return false;
 }
 std::string KBTree::breadthFirstIterGetName() {
-	if(this->bfi!=tr->end_breadth_first()) {
-		return (*bfi).getName();
+	if(this->bfi!=NO_NODE_ID) {
+		buildDerivedProperties();
+		if(isValidNodeId(bfi)) { return getNameById(bfi); }
 	}
 	return "END_OF_KB_TREE";
 }
 
 std::string KBTree::breadthFirstIterGetParentName() {
-	if(bfi.has_parent()) {
-		return (*tr->parent(bfi)).getName();
-	}
-	return "";
+	if(this->bfi==NO_NODE_ID) { return ""; }
+	buildDerivedProperties();
+	return getNameById(getParentId(bfi));
 }
 unsigned int KBTree::breadthFirstIterMarkNode() {
-	this->bfiNodeIndex.push_back(tree<KBNode>::breadth_first_iterator(this->bfi));
-	return bfiNodeIndex.size()-1;
+	if(this->bfi==NO_NODE_ID) { return NO_NODE_ID; }
+	buildDerivedProperties();
+	return isValidNodeId(bfi) ? bfi : NO_NODE_ID;
 }
 bool KBTree::breadthFirstIterSetToNode(unsigned int nodeMarker) {
-	if(this->bfiNodeIndex.size()<=nodeMarker) {
-		this->bfi = tr->end_breadth_first();
+	buildDerivedProperties();
+	this->bfiPosition = NO_NODE_ID;
+	if(!isValidNodeId(nodeMarker)) {
+		this->bfi = NO_NODE_ID;
 		return false;
 	}
-	this->bfi = tree<KBNode>::breadth_first_queued_iterator(this->bfiNodeIndex.at(nodeMarker));
+	this->bfi = nodeMarker;
 	return true;
 }
 
+void KBTree::buildBreadthFirstOrder() {
+	buildDerivedProperties();
+	if(!breadthFirstOrder.empty() || tr->begin()==tr->end()) { return; }
+	// nodes at the same depth are visited in preorder, so counting the IDs of the first top level tree into
+	// their depths puts them in breadth first order
+	const uint32_t first = tr->begin().node->data.derivedIndex;
+	const uint32_t end = derived[first].subtreeEnd;
+	std::vector<uint32_t> starts;
+	for(uint32_t id=first; id<end; id++) {
+		if(nodesById[id]==NULL) { continue; }
+		const uint32_t depth = derived[id].depth;
+		if(depth+1>=starts.size()) { starts.resize(depth+2,0); }
+		starts[depth+1]++;
+	}
+	for(size_t depth=1; depth<starts.size(); depth++) { starts[depth] += starts[depth-1]; }
+	breadthFirstOrder.resize(starts.back());
+	for(uint32_t id=first; id<end; id++) {
+		if(nodesById[id]==NULL) { continue; }
+		breadthFirstOrder[starts[derived[id].depth]++] = id;
+	}
+}
+
+void KBTree::invalidateBreadthFirstOrder() {
+	std::vector<uint32_t>().swap(breadthFirstOrder);
+	this->bfiPosition = NO_NODE_ID;
+}
+
 
 
 std::string KBTree::breadthFirstIterGetName(unsigned int nodeMarker) {
-	if(this->bfiNodeIndex.size()<=nodeMarker) { return ""; }
-	// grab a copy of the iterator at the marker position
-	tree<KBNode>::breadth_first_queued_iterator node = tree<KBNode>::breadth_first_queued_iterator(this->bfiNodeIndex.at(nodeMarker));
-	if(node!=tr->end_breadth_first()) {
-		return (*node).getName();
-	}
-	return "";
+	return getNameById(nodeMarker);
 }
 
 std::string KBTree::breadthFirstIterGetPathToRoot(unsigned int nodeMarker) {
-	if(this->bfiNodeIndex.size()<=nodeMarker) { return ""; }
-	// grab a copy of the iterator at the marker position
-	tree<KBNode>::breadth_first_queued_iterator node = tree<KBNode>::breadth_first_queued_iterator(this->bfiNodeIndex.at(nodeMarker));
-	std::string path="";
-	while( node.has_parent() ){
-		node = tr->parent(node);
-		path += (*node).getName()+";";
-	}
-	return path;
+	return getPathToRootById(nodeMarker);
 }
 
 std::string KBTree::breadthFirstIterGetParentName(unsigned int nodeMarker) {
-	if(this->bfiNodeIndex.size()<=nodeMarker) { return ""; }
-	// grab a copy of the iterator at the marker position
-	tree<KBNode>::breadth_first_queued_iterator node = tree<KBNode>::breadth_first_queued_iterator(this->bfiNodeIndex.at(nodeMarker));
-	if(node.has_parent()) {
-		return (*tr->parent(node)).getName();
-	}
-	return "";
+	return getNameById(getParentId(nodeMarker));
 }
 
 std::string KBTree::breadthFirstIterGetAllChildrenNames(unsigned int nodeMarker) {
-	if(this->bfiNodeIndex.size()<=nodeMarker) { return ""; }
-	// grab a copy of the iterator at the marker position
-	tree<KBNode>::breadth_first_queued_iterator node = tree<KBNode>::breadth_first_queued_iterator(this->bfiNodeIndex.at(nodeMarker));
-	std::string namelist = "";
-	for(tree<KBNode>::sibling_iterator child = tr->begin(node);child!=tr->end(node);child++) {
-		namelist+=(*child).getName()+";";
-	}
-	return namelist;
+	return getChildNamesById(nodeMarker);
 }
 
 std::string KBTree::breadthFirstIterGetAllDescendantNames(unsigned int nodeMarker) {
-	if(this->bfiNodeIndex.size()<=nodeMarker) { return ""; }
-	std::string namelist = "";
-	// grab a copy of the iterator at the marker position
-	tree<KBNode>::breadth_first_queued_iterator node( this->bfiNodeIndex.at(nodeMarker) );
-	node.clear(); // clear the queue so we only search the subtree
-	node++; // drop the given node, cause we don't want to return that one.
-	for(; node!=tr->end_breadth_first(); node++) {
-		namelist+=(*node).getName()+";";
-	}
-	return namelist;
+	if(!isValidNodeId(nodeMarker)) { return ""; }
+	return getDescendantNamesBreadthFirst(nodesById[nodeMarker]);
 }
 
 
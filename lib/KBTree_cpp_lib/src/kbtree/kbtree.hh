@@ -13,9 +13,18 @@
 
 
 #include "tree.hh"
+#include "kballocator.hh"
+#include "kbstructural.hh"
+#include "kbwriter.hh"
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <map>
+#include <unordered_map>
+#include <memory>
 #include <sstream>
+#include <vector>
 
 using namespace std;
 
@@ -25,41 +34,224 @@ std::string translateToProt(const std::string &dna);
 namespace KBTreeLib {
 
 	class KBTree;
+	class KBCompactTree;
+	class KBFrozenTree;
+	class KBDepthMinima;
+
+	/** number of significant digits used when writing distances and bootstrap values, which matches the
+	 * default precision of an ostream (and therefore the output of earlier versions of this library) */
+	const int DEFAULT_OUTPUT_PRECISION = 6;
+
+	/** output precision value requesting the shortest string that reads back as exactly the same double */
+	const int SHORTEST_ROUND_TRIP = 0;
+
+	/*! Append-only storage for node label text owned by a single KBTree.
+	 * Label strings normally point directly into the Newick text the tree was parsed from.  Text that
+	 * does not exist verbatim in that buffer (quoted names with escapes, names split by a comment,
+	 * renamed nodes) is copied here instead.  Stored text never moves, so the tree's KBStringTable can
+	 * hold views into it for the lifetime of the tree.
+	 */
+	class KBLabelArena
+	{
+		public:
+			KBLabelArena();
+			~KBLabelArena();
+
+			/*! Copy the text into the arena and return a view of the stored copy */
+			std::string_view store(std::string_view text);
+
+			/*! Release all stored text; every view previously returned by store() becomes invalid */
+			void clear();
+
+			/*! Take over all text stored in the other arena, leaving it empty.  Views into the other arena
+			 * remain valid, and are now owned by this one */
+			void absorb(KBLabelArena &other);
+
+			/*! Total number of label bytes stored so far */
+			size_t getBytesStored() const { return bytesStored; };
+
+		private:
+			KBLabelArena(const KBLabelArena &);
+			KBLabelArena &operator=(const KBLabelArena &);
+
+			static const size_t BLOCK_SIZE;
+			std::vector<std::unique_ptr<char[]> > blocks;
+			char *cursor;
+			size_t remaining;
+			size_t bytesStored;
+	};
+
+	/*! The label strings of a single KBTree, each stored once and referred to by a 32 bit handle.
+	 * Nodes hold handles instead of strings: equal names, comments and markers added with intern() share one
+	 * entry, so a node's label costs a few bytes no matter how often its text repeats.  Entries are views, of
+	 * the tree's Newick text or of its KBLabelArena, so the table never copies label text itself.
+	 *
+	 * The table is split into shards, and the top bits of a handle select the shard.  Strings are only shared
+	 * within a shard, but different threads may add to different shards at the same time (see
+	 * KBTree::parseNewickParallel).  Handle 0 (EMPTY) is the empty string in every shard.
+	 */
+	class KBStringTable
+	{
+		public:
+			static const uint32_t EMPTY = 0;
+			/** number of shards, each of which may be filled by its own thread */
+			static const unsigned int SHARD_COUNT = 16;
+
+			KBStringTable();
+			~KBStringTable();
+
+			/*! Return the handle of the text, adding it if it is not in the shard yet.  The text is not copied,
+			 * so it must stay valid as long as the table */
+			uint32_t intern(std::string_view text, unsigned int shard=0);
+			/*! As above, except that text the shard does not have yet is first copied into the arena */
+			uint32_t intern(std::string_view text, KBLabelArena &arena, unsigned int shard=0);
+			/*! Add the text without looking for an equal entry; for text that is almost always distinct */
+			uint32_t add(std::string_view text, unsigned int shard=0);
+			/*! Make room for the given number of further entries in the shard, when it is known up front */
+			void reserve(size_t count, unsigned int shard=0);
+
+			std::string_view get(uint32_t handle) const { return shards[handle>>SHARD_SHIFT].entries[handle&INDEX_MASK]; };
+
+			/*! Remove every entry from the shard; all of its handles become invalid */
+			void clearShard(unsigned int shard);
+			/*! Remove every entry; all handles other than EMPTY become invalid */
+			void clear();
+
+			/*! Number of entries, counting EMPTY once */
+			size_t size() const;
+
+			/*! Number that identifies this table among those that exist, which a node keeps instead of a pointer */
+			uint32_t getId() const { return id; };
+			/*! The existing table with the number, or NULL if there is none (the table may be destroyed at any
+			 * time after, so its owner must be known to be alive) */
+			static KBStringTable *findById(uint32_t id);
+			static const uint32_t NO_TABLE = 0xffffffff;
+			/*! Bytes held by the table (not counting the text its entries refer to) */
+			size_t getMemoryUsage() const;
+
+		private:
+			KBStringTable(const KBStringTable &);
+			KBStringTable &operator=(const KBStringTable &);
+
+			static const unsigned int SHARD_SHIFT = 28;
+			static const uint32_t INDEX_MASK = (1u<<SHARD_SHIFT)-1;
+
+			struct Shard {
+				std::vector<std::string_view> entries;
+				std::vector<uint64_t> slots;  // open addressing hash of the interned entries: hash<<32 | entry index+1, or 0 if free
+				size_t interned;              // number of entries in slots
+			};
+			uint32_t append(unsigned int shard, std::string_view text);
+			uint32_t find(std::string_view text, KBLabelArena *arena, unsigned int shard);
+			void rehash(Shard &s);
+
+			Shard shards[SHARD_COUNT];
+			uint32_t id;
+	};
+
+	/*! A read-only memory mapping of an entire file.
+	 * Used to parse large Newick files in place: the mapped pages are the tree's label storage, so the text
+	 * never has to be copied into memory.  The mapping is released when the object is destroyed.
+	 */
+	class KBMappedFile
+	{
+		public:
+			/*! Map the file; throws ParseException if the file cannot be opened or mapped */
+			KBMappedFile(const std::string &filename);
+			~KBMappedFile();
+
+			/*! The complete contents of the file */
+			std::string_view getText() const { return std::string_view(data,length); };
+
+		private:
+			KBMappedFile(const KBMappedFile &);
+			KBMappedFile &operator=(const KBMappedFile &);
+
+			const char *data;
+			size_t length;
+	};
+
+
+
+	/*! The text of one node label, as looked up from the handles of a KBNode */
+	struct KBLabelText {
+		std::string_view original_label;
+		std::string_view name;
+		std::string_view pre_name_decoration;
+		std::string_view post_name_decoration;
+		std::string_view pre_dist_decoration;
+		std::string_view post_dist_decoration;
+		double distanceToParent;
+		double bootstrapValue;
+	};
 
 	/*! Encapsulates all information needed about nodes in a KBTree
 	 * Lightweight class to store node labels, distance to parent, and associated comments of the node.
 	 * You should not have to access this class directly in most cases - instead interact with the
 	 * KBTree object methods instead.
+	 * Label strings are handles into the KBStringTable of the tree holding the node, which must be given
+	 * to every method that reads them.
 	 */
 	class KBNode
 	{
 		public:
 			friend class KBTree;
+			friend class KBCompactTree;
+			friend class KBTreeCursor;
 
 			KBNode();   /*!< Create an empty node with empty, non-null strings for name, comments, labels.  Distance to parent is NAN.  */
-			~KBNode();  /*!< Delete an empty node  */
+			explicit KBNode(const KBStringTable &labels);  /*!< Create an empty node whose label handles are into the table, which the getters without a table then read  */
+			~KBNode() = default;  /*!< Delete an empty node; it owns nothing, so a whole tree of them can be dropped with its pool  */
 
-			/*! Returns the full node labeled string as it was ORIGINALLY parsed */
-			std::string getOriginalLabel() const { return original_label; };
+			/*! Returns the full node labeled string as it was ORIGINALLY parsed, or an empty string if the tree does not keep original labels */
+			std::string getOriginalLabel(KBStringTable &labels) const { decodeLabel(labels); return std::string(labels.get(original_label)); };
 
 			/*! Returns the name of the node (from parsing the original label) */
-			std::string getName() const { return name; };
+			std::string getName(KBStringTable &labels) const { decodeLabel(labels); return std::string(labels.get(name)); };
 
 			/*! Returns the distance from this node to its parent (from parsing the original label), or NAN if no distance was set */
-			double getDistanceToParent() const { return distanceToParent; };
+			double getDistanceToParent(KBStringTable &labels) const { decodeLabel(labels); return distanceToParent; };
 
 			/*! Returns the bootstrap value of this node (from parsing the original label), or NAN if no distance was set */
-			double getBootstrapValue() const { return bootstrapValue; };
+			double getBootstrapValue(KBStringTable &labels) const { decodeLabel(labels); return bootstrapValue; };
+
+			/*! The getters above, reading the label table of the tree holding the node; a node made outside of any
+			 * tree reads as empty.  These find the table by number on every call, so the table-taking getters are
+			 * faster in loops */
+			std::string getOriginalLabel() const { return getOriginalLabel(getLabelTable()); };
+			std::string getName() const { return getName(getLabelTable()); };
+			double getDistanceToParent() const { return getDistanceToParent(getLabelTable()); };
+			double getBootstrapValue() const { return getBootstrapValue(getLabelTable()); };
+
+			/*! Returns the text of all parts of the label; the views are valid as long as the table */
+			KBLabelText getLabelText(KBStringTable &labels) const;
 
 			/*! DEPRECATED!  Return a string representation of this Node based on the output style.
 			 * @param[in] style Specifies what parts of the node to print to the string.
+			 * @param[in] precision Significant digits for numbers, or SHORTEST_ROUND_TRIP
 			 */
-			std::string getLabelFromComponents(unsigned int style);
+			std::string getLabelFromComponents(KBStringTable &labels, unsigned int style, int precision=DEFAULT_OUTPUT_PRECISION) const;
 
 			/*! Return a string representation of this Node based on the output style.
 			* @param[in] style Specifies what parts of the node to print to the string.
+			* @param[in] precision Significant digits for numbers, or SHORTEST_ROUND_TRIP
 			*/
-			std::string getLabelFromComponents(bool with_label, bool with_distance, bool with_comments, bool with_bootstrap_value_as_label);
+			std::string getLabelFromComponents(KBStringTable &labels, bool with_label, bool with_distance, bool with_comments, bool with_bootstrap_value_as_label, int precision=DEFAULT_OUTPUT_PRECISION) const;
+
+			/*! The two getLabelFromComponents methods, reading the label table of the tree holding the node */
+			std::string getLabelFromComponents(unsigned int style, int precision=DEFAULT_OUTPUT_PRECISION) const {
+				return getLabelFromComponents(getLabelTable(),style,precision);
+			};
+			std::string getLabelFromComponents(bool with_label, bool with_distance, bool with_comments, bool with_bootstrap_value_as_label, int precision=DEFAULT_OUTPUT_PRECISION) const {
+				return getLabelFromComponents(getLabelTable(),with_label,with_distance,with_comments,with_bootstrap_value_as_label,precision);
+			};
+
+			/*! The two getLabelFromComponents methods, for label text from anywhere (see KBCompactTree) */
+			static std::string formatLabel(const KBLabelText &label, unsigned int style, int precision);
+			static std::string formatLabel(const KBLabelText &label, bool with_label, bool with_distance, bool with_comments, bool with_bootstrap_value_as_label, int precision);
+			/*! As formatLabel, but written to the sink instead of returned as a new string */
+			static void writeLabel(KBOutputSink &out, const KBLabelText &label, unsigned int style, int precision);
+			static void writeLabel(KBOutputSink &out, const KBLabelText &label, bool with_label, bool with_distance, bool with_comments, bool with_bootstrap_value_as_label, int precision);
 
 			static const unsigned int NAME_AND_DISTANCE;             /*!< DEPRECATED! Constant INT to specify output style format for input to getLabelFromComponents(int style)  */
 			static const unsigned int NAME_DISTANCE_AND_COMMENTS;    /*!< DEPRECATED! Constant INT to specify output style format for input to getLabelFromComponents(int style)  */
@@ -69,23 +261,79 @@ namespace KBTreeLib {
 			static const unsigned int ORIGINAL_LABEL;                /*!< DEPRECATED! Constant INT to specify output style format for input to getLabelFromComponents(int style)  */
 
 		protected:
-			void clear();                      /*!< set all pointers to null, all strings to empty.  This is method is also used for initialization */
-			std::string original_label;        /*!< The full, original node label that was parsed, including the name, comments, distance, etc.  */
-			std::string name;                  /*!< The parsed name of the node  */
-			std::string pre_name_decoration;   /*!< Comments enclosed in [...] before the node name  */
-			std::string post_name_decoration;  /*!< Comments enclosed in [...] after the node name  */
-			std::string pre_dist_decoration;   /*!< Comments enclosed in [...] before the distance label  */
-			std::string post_dist_decoration;  /*!< comments enclosed in [...] after the distance label  */
-			double distanceToParent;           /*!< Stores distance to parent if it is defined for this node, if not defined then it is set to NAN  */
-			double bootstrapValue;             /*!< Stores bootstrap value (which is parsed ONLY if activated from internal node names), if not defined then it is set to NAN  */
-
-			void setHiddenMarkerLabel(std::string marker) { hidden_marker=marker; };
-			std::string getHiddenMarkerLabel() { return hidden_marker; };
-			std::string hidden_marker;         /*!< A hidden marker that can be set and retrieved for internal use only!!! */
+			// Label strings are handles into the KBStringTable of the KBTree holding this node.  A node is
+			// therefore only meaningful inside the tree that created it.
+			void clear();                           /*!< set all pointers to null, all strings to empty.  This is method is also used for initialization */
+			double distanceToParent;                /*!< Stores distance to parent if it is defined for this node, if not defined then it is set to NAN  */
+			double bootstrapValue;                  /*!< Stores bootstrap value (which is parsed ONLY if activated from internal node names), if not defined then it is set to NAN  */
+			uint32_t original_label;                /*!< The full, original node label that was parsed, including the name, comments, distance, etc.  */
+			uint32_t name;                          /*!< The parsed name of the node  */
+			uint32_t pre_name_decoration;           /*!< Comments enclosed in [...] before the node name  */
+			uint32_t post_name_decoration;          /*!< Comments enclosed in [...] after the node name  */
+			uint32_t pre_dist_decoration;           /*!< Comments enclosed in [...] before the distance label  */
+			uint32_t post_dist_decoration;          /*!< comments enclosed in [...] after the distance label  */
+
+			/* Trees parsed with lazy labels leave plain labels (no quotes or comments) undecoded: original_label then
+			 * holds the raw label text, and the name and distance are split out of it the first time anything reads
+			 * this node's label.  Decoding changes the node and the table, so concurrent readers of a lazy tree are not safe. */
+			bool labelPending;                      /*!< true while original_label holds the raw, undecoded label text  */
+			bool dropOriginalLabel;                 /*!< the tree does not keep original labels, so original_label is cleared once decoded  */
+			void decodeLabel(KBStringTable &labels, unsigned int shard=0) const { if(labelPending) { const_cast<KBNode *>(this)->decodePendingLabel(labels,shard); } };
+			void setPendingLabel(uint32_t rawLabel, bool keepOriginalLabel);
+			void decodePendingLabel(KBStringTable &labels, unsigned int shard);
+			/* As getLabelText, except that a pending label is split without storing the result, so neither the node
+			 * nor the table is changed and several threads may read labels at once */
+			void readLabelText(const KBStringTable &labels, KBLabelText &label) const;
+
+			void setHiddenMarkerLabel(uint32_t marker) { hidden_marker=marker; };
+			uint32_t getHiddenMarkerLabel() { return hidden_marker; };
+			uint32_t hidden_marker;                 /*!< A hidden marker that can be set and retrieved for internal use only!!! */
+			uint32_t derivedIndex;                  /*!< ID of this node, its position in preorder when the derived properties of its tree were computed */
+			uint32_t labelTableId;                  /*!< getId() of the table the label handles are into, or KBStringTable::NO_TABLE (fits in padding)  */
+			/*! the table with labelTableId, or an empty table if there is none */
+			KBStringTable &getLabelTable() const;
 	};
 
 
 
+	/** the nodes of a KBTree, allocated from a pool owned by the tree */
+	typedef tree<KBNode, KBPoolAllocator<tree_node_<KBNode> > > KBNodeTree;
+
+	/** deletes a KBNodeTree without walking its nodes (which a deep tree could not do on the stack): a KBNode
+	 * holds only handles and numbers, and the pool frees all of its slabs at once */
+	struct KBNodeTreeDeleter {
+		void operator()(KBNodeTree *tr) const {
+			static_assert(std::is_trivially_destructible<KBNode>::value, "the nodes of a KBTree are freed without their destructors");
+			tr->abandon_nodes();
+			delete tr;
+		};
+	};
+
+
+	/**
+	 * Summary of a Newick tree, computed by KBTree::scanStatistics without building the tree.
+	 */
+	class KBTreeStatistics {
+		public:
+			KBTreeStatistics() : nodeCount(0), leafCount(0), maxDepth(0), branchLengths(false), bootstrapValues(false) { };
+
+			unsigned int getNodeCount() const { return nodeCount; };    /*!< number of nodes, including internal nodes  */
+			unsigned int getLeafCount() const { return leafCount; };    /*!< number of leaf nodes (aka tips)  */
+			unsigned int getMaxDepth() const { return maxDepth; };      /*!< number of edges on the longest path from the root to a leaf  */
+			bool hasBranchLengths() const { return branchLengths; };    /*!< true if any node has a distance to its parent  */
+			bool hasBootstrapValues() const { return bootstrapValues; };/*!< true if internal nodes are named, and all of those names are numbers  */
+
+			friend class KBTree;
+
+		private:
+			unsigned int nodeCount;
+			unsigned int leafCount;
+			unsigned int maxDepth;
+			bool branchLengths;
+			bool bootstrapValues;
+	};
+
+
 	/**
 	 * Class for manipulating trees
 	 */
@@ -94,30 +342,141 @@ namespace KBTreeLib {
 			KBTree(const string &newickString);  /*!< Create a new tree by parsing a newick represented tree.  */
 			KBTree(const string &newickString, bool verbose); /*!< Create a new tree by parsing the newick tree, and optionally outputting debug messages  */
             KBTree(const std::string &newickString, bool verbose, bool assumeBootstrapNames); /*!< Create an empty node with empty, non-null strings for name, comments, labels.  Distance to parent is NAN.  */
+			/**
+			 * Create a new tree, parsing large Newick strings on up to threadCount threads (0 uses one per
+			 * available core).  The top level clades are parsed concurrently; the tree is identical to the
+			 * one built by a single threaded parse.  Malformed text is reported as a ParseException either way.
+			 * With lazyLabels, only the structure of the tree is built up front: plain node labels (the vast
+			 * majority, without quotes or comments) are split into name and distance only when a method first
+			 * reads that node's label.  Counting nodes and leaves then never decodes a label.  Note that a
+			 * malformed distance is then reported (as a ParseException) by the call that decodes it.
+			 * Without keepOriginalLabels, the full label text of each node is not kept, which saves memory when
+			 * output in the ORIGINAL_LABEL style is not needed; that style then writes NAME_DISTANCE_AND_COMMENTS.
+			 */
+			KBTree(const std::string &newickString, bool verbose, bool assumeBootstrapNames, unsigned int threadCount, bool lazyLabels=false, bool keepOriginalLabels=true);
 			~KBTree();
 
+			/**
+			 * Create a new tree from a Newick file.  The file is memory mapped and parsed in place, and the
+			 * tree keeps the mapping open as the storage for its labels, so the text is never copied.  Returns
+			 * NULL if the file cannot be read; the caller owns (and must delete) the returned tree.  Large files
+			 * are parsed on up to threadCount threads, and labels decoded lazily or original labels dropped, as in
+			 * the constructor above.
+			 */
+			static KBTree *fromFile(const std::string &filename, bool verbose=false, bool assumeBootstrapNames=false, unsigned int threadCount=1, bool lazyLabels=false, bool keepOriginalLabels=true);
+
+			/**
+			 * Binary form of the tree (the layout is described in kbbinary.cpp): preorder arrays of the parents,
+			 * label strings, and the distances and bootstrap values that are present, plus one table of all label
+			 * text.  Loading it is a fast deserializer, not a view of the data: the nodes are still built, but
+			 * without any text to scan, and a tree loaded from a file uses the label text in the mapped file in
+			 * place.  The original labels are included if the tree keeps them.  Output flags are not saved.
+			 * The label text must add up to less than 4 GB; for a larger tree the error is reported, toBinary
+			 * returns an empty string, and writeBinary (having written nothing) returns false.
+			 */
+			std::string toBinary();
+			bool writeBinary(KBOutputSink &out);
+			/** returns false, after reporting the error, if the file cannot be opened or written */
+			bool writeBinaryToFile(const std::string &filename);
+			/** load a tree written by toBinary; throws ParseException if the data is not a binary tree of a
+			 * supported version.  The caller owns (and must delete) the returned tree */
+			static KBTree *fromBinary(const std::string &binary);
+			/** as fromBinary, from a memory mapped file; returns NULL if the file cannot be read */
+			static KBTree *fromBinaryFile(const std::string &filename);
+
+			/**
+			 * Computes the node and leaf counts, depth, and whether there are branch lengths and bootstrap values
+			 * of the tree in a Newick string, in a single pass over the text that builds no tree and allocates
+			 * nothing.  For well formed Newick the counts are the same as those of the tree built from the text.
+			 * Labels are only checked for the presence of a distance or a numeric internal node name; a malformed
+			 * distance, which the constructor rejects, still counts as a branch length here.
+			 */
+			static KBTreeStatistics scanStatistics(std::string_view newickString);
+
 			/** allows nodes to count themselves in a tree when the node is created */
 			friend class KBNode;
+			/** forests build their trees over one shared copy of the text */
+			friend class KBForest;
+			/** compact trees copy out of, and build, the node tree directly */
+			friend class KBCompactTree;
+			friend class KBSuccinctTree;
+			friend class KBAncestorIndex;
+			/** cursors walk the node tree directly, and only read it */
+			friend class KBTreeCursor;
+			/** frozen trees copy the output flags */
+			friend class KBFrozenTree;
 
 			void initializeFromNewick(const std::string &newick);
 
 			std::string toNewick();
 			std::string toNewick(unsigned int style);
+			/** write the same text as toNewick() and toNewick(style) to the sink, which holds at most its buffer of it
+			 * at a time; the sink is not flushed, so several trees can be written to it one after the other */
+			void writeNewick(KBOutputSink &out);
+			void writeNewick(KBOutputSink &out, unsigned int style);
 
 			void setOutputFlagLabel(bool flag) { with_labels=flag; };
 			void setOutputFlagDistances(bool flag) { with_distances=flag; };
 			void setOutputFlagComments(bool flag) { with_comments=flag; };
 			void setOutputFlagBootstrapValuesAsLabels(bool flag) { with_bootstrap_values_as_labels=flag; };
-
+			/** number of significant digits for distances and bootstrap values in the output (1-17), or
+			 * SHORTEST_ROUND_TRIP to write the shortest text that parses back to the identical value */
+			void setOutputPrecision(int precision) { output_precision=precision; };
+			/** write large trees on up to threadCount threads (0 uses one per available core); the text written is
+			 * identical to that of a single thread, which is the default */
+			void setOutputThreadCount(unsigned int threadCount) { output_thread_count=threadCount; };
+
+			/** write the tree to the file (replacing it) in the style, NAME_AND_DISTANCE by default; returns false,
+			 * after reporting the error, if the file cannot be opened or written */
 			bool writeNewickToFile(const std::string &filename);
 			bool writeNewickToFile(const std::string &filename,unsigned int style);
 
 			unsigned int getNodeCount() const { return nodeCount; };
-            unsigned int getLeafCount();
+			/** counted once the derived properties (see getDepth) are computed, and otherwise by walking the leaves,
+			 * which reads no labels (so a tree with lazy labels stays undecoded) */
+			unsigned int getLeafCount();
+			/** allocation counts of the pool the nodes of this tree come from */
+			KBAllocationStatistics getAllocationStatistics() const { return tr->node_allocator().getStatistics(); };
+			/** bytes held by this tree: its nodes, label string table and label arena, but not the Newick text
+			 * the labels refer to (which is shared, or a mapped file) */
+			size_t getMemoryUsage() const;
+			/** an immutable snapshot of the tree that any number of threads can query at once, with no locking;
+			 * copies of the returned handle share the snapshot (see kbfrozen.hh, which must be included to use it).
+			 * The tree is not edited, and can be edited or deleted afterwards. */
+			KBFrozenTree freeze();
+
+
+			/** formats of a distance matrix: the number of rows on the first line, then one line per row with the
+			 * name followed by the distances, separated by spaces (relaxed PHYLIP); or tab separated values, with
+			 * a header line of the names */
+			static const unsigned int PHYLIP_MATRIX = 0;
+			static const unsigned int TSV_MATRIX = 1;
+
+			/**
+			 * The patristic distance between every pair of the named nodes: the sum of the branch lengths on the
+			 * path from one to the other, a missing length counting as 0, or NaN between nodes in different top
+			 * level trees.  distances[i*n+j] is the distance between names[i] and names[j], where n is the number
+			 * of names, so it must have room for n*n values.  Where several nodes share a name, the first of them
+			 * in post order is used.  The matrix is computed on up to threadCount threads (0 for one per core).
+			 * Returns false, after reporting the error and writing nothing, if a name is not found.
+			 */
+			bool getPatristicDistances(const std::vector<std::string> &names, double *distances, unsigned int threadCount=0);
+			/** the same for every leaf, named or not, in preorder (the order of getAllLeafNames when all leaves are
+			 * named); leafNames is set to the names of the leaves and distances to the matrix */
+			void getPatristicDistances(std::vector<std::string> &leafNames, std::vector<double> &distances, unsigned int threadCount=0);
+			/** write the matrix for the nodes named name1;name2;..., or for every leaf if names is empty, to the sink
+			 * in the format, at the output precision, holding only a few rows at a time.  The sink is not flushed.
+			 * Returns false if a name is not found, after reporting it, or if writing fails. */
+			bool writePatristicDistances(KBOutputSink &out, const std::string &names="", unsigned int format=PHYLIP_MATRIX, unsigned int threadCount=0);
+			/** as writePatristicDistances, to the file (replacing it) */
+			bool writePatristicDistancesToFile(const std::string &filename, const std::string &names="", unsigned int format=PHYLIP_MATRIX, unsigned int threadCount=0);
 
 
-			// @todo implement this function
-			bool areAllLabelsUnique(string &infoMssg) {return false;};
+			/**
+			 * returns true if no two nodes of the tree share a name (unnamed nodes are ignored).  Otherwise returns
+			 * false and sets infoMssg to the names used more than once, concatenated as name1;name2;...
+			 */
+			bool areAllLabelsUnique(string &infoMssg);
 			// @todo implement this function
 			bool validateNewickString(string &infoMssg) {return false;};
 
@@ -185,12 +544,63 @@ namespace KBTreeLib {
 			 *  -if internal nodes are removed, edge distances are summed maintaining root->leaf distances
 			 *  -named internal nodes can also removed
 			 *  -leaf nodes without a name are removed
-			 *  -root node can never be removed, even if they are labeled and in the map
+			 *  -root node can never be removed: if it is labeled and in the map, ParseException is thrown before
+			 *   anything is changed
 			 * @param std::map<std::string,std::string> &nodeNames - hash listing names of nodes to remove.  Keys are the names, values are not used.
 			 */
 			void removeNodesByNameAndSimplify(std::map<std::string,std::string> &nodeNames);
 			void removeNodesByNameAndSimplify(const std::string &nodeNames);
 
+			/**
+			 * Removes every node with exactly this name as removeNodesByNameAndSimplify does, but only simplifies the
+			 * nodes that the removal leaves with one child or none, instead of visiting the whole tree.  Returns the
+			 * number of named nodes removed.  As there, if the root (or any top level node) has the name, nothing is
+			 * removed and ParseException is thrown.
+			 */
+			unsigned int removeNodeByNameAndSimplify(const std::string &name);
+			/** renames every node with exactly this name, returning the number renamed */
+			unsigned int replaceNodeName(const std::string &name, const std::string &newName);
+
+			// Queries on the node with a name, found without a traversal.  If several nodes share the name, the
+			// first of them in post order is used.  The results are formatted as those of the breadth first
+			// iterator methods of the same names, and are empty if no node has the name.  The first query indexes
+			// the names of all nodes, which replaceNodeName, replaceNodeNames and removeNodeByNameAndSimplify keep
+			// up to date, but any other edit drops, so these are NOT THREAD SAFE until the index is built.
+			std::string getPathToRoot(const std::string &name);
+			std::string getAllDescendantNames(const std::string &name);
+
+			// Properties of the node with a name that depend on the rest of the tree.  These are computed for all
+			// nodes in one walk of the tree when first needed, which reads no labels; the distances to the root need
+			// every branch length, so they are summed in a second walk only once one is asked for.
+			// removeNodeByNameAndSimplify keeps them up to date (renaming changes none of them); other removals and
+			// parsing drop them.  NOT THREAD SAFE until computed.
+			/** number of ancestors of the node (0 for a top level node), or -1 if no node has the name */
+			int getDepth(const std::string &name);
+			/** number of nodes in the subtree below and including the node, or 0 if no node has the name */
+			unsigned int getSubtreeSize(const std::string &name);
+			/** number of leaves in the clade of the node (1 for a leaf), or 0 if no node has the name */
+			unsigned int getCladeLeafCount(const std::string &name);
+			/** sum of the branch lengths from the top of the tree to the node, where a missing length counts as 0;
+			 * NAN if no node has the name */
+			double getDistanceToRoot(const std::string &name);
+
+			/**
+			 * A new tree of the nodes with the names, given as name1;name2;... (every node with a name is taken):
+			 * the tree that removeNodesByNameAndSimplify leaves after removing every other leaf, and every other
+			 * named node that none of the nodes is below.  That is, the nodes are kept with the ancestors where
+			 * their paths branch, the named nodes on the paths between them, and the top node of each top level
+			 * tree they are in (but not the top level trees they are not in).  Each branch length is the sum of the
+			 * lengths of the edges it replaces, added from the bottom up, as removeNodesByNameAndSimplify adds
+			 * them.  The first call builds the name index, the derived properties and an index of the lowest common
+			 * ancestors, each in time linear in the size of the tree (so it is NOT THREAD SAFE until they are
+			 * built); a later call for k nodes then takes O(k log k) time, plus the length of the paths whose branch
+			 * lengths are summed, and visits no other part of the tree.  Names that are not found are reported, and
+			 * if none is found NULL is returned.
+			 * The caller owns (and must delete) the returned tree, which does not keep original labels.
+			 */
+			KBTree *extractInducedSubtree(const std::string &names);
+			KBTree *extractInducedSubtree(const std::vector<std::string> &names);
+
 			/**
 			 * merge leaves that have zero distance between each other, keeping an arbitrary leaf
 			 */
@@ -206,11 +616,51 @@ namespace KBTreeLib {
 			 * Prints the tree to the given output stream in an indented format.  Used primarily for debugging.
 			 */
 			void printTree(ostream &o);
-			static void printTree(ostream &o, const tree<KBNode> *tr, tree<KBNode>::pre_order_iterator it, tree<KBNode>::pre_order_iterator end);
+			static void printTree(ostream &o, const KBNodeTree *tr, KBStringTable &labels, KBNodeTree::pre_order_iterator it, KBNodeTree::pre_order_iterator end);
+
+
+			/**
+			 * Node IDs.  buildNodeIds numbers the nodes 0,1,2,... in preorder, each top level tree after the one
+			 * before it, so the descendants of a node are the IDs after its own up to getSubtreeEndId.  The IDs are
+			 * kept while nodes are renamed or removed by name, where the ID of a removed node is no longer valid and
+			 * is not given to another node; any other edit drops them until buildNodeIds is called again.  These are
+			 * the IDs of the derived properties (see getDepth), which are computed with them.
+			 *
+			 * buildNodeIds, like every edit, is NOT THREAD SAFE, but the const methods below are: they only read the
+			 * tree (never its breadth first iterator), so any number of threads may call them at once.  Until the
+			 * IDs are built, every ID is taken as invalid.  Invalid IDs give NO_NODE_ID, false or an empty string.
+			 */
+			static const unsigned int NO_NODE_ID = 0xffffffff;
+			void buildNodeIds();
+			bool hasNodeIds() const { return derivedValid && nameIndexValid; };
+			/** one more than the largest ID */
+			unsigned int getNodeIdLimit() const { return derivedValid ? (unsigned int)derived.size() : 0; };
+			bool isValidNodeId(unsigned int id) const { return id<getNodeIdLimit() && nodesById[id]!=NULL; };
+			/** the ID of the node with the name, the first in post order if several share it */
+			unsigned int getNodeId(const std::string &name) const;
+			unsigned int getParentId(unsigned int id) const;
+			/** one more than the largest ID in the subtree of the node; IDs in between may be of removed nodes */
+			unsigned int getSubtreeEndId(unsigned int id) const { return isValidNodeId(id) ? derived[id].subtreeEnd : NO_NODE_ID; };
+			/** true if the node is below (and not the same as) the ancestor, in constant time */
+			bool isDescendantOf(unsigned int id, unsigned int ancestorId) const {
+				return isValidNodeId(id) && isValidNodeId(ancestorId) && ancestorId<id && id<derived[ancestorId].subtreeEnd;
+			};
+			std::string getNameById(unsigned int id) const;
+			/** add the IDs of the children of the node, in order, to children */
+			void getChildIds(unsigned int id, std::vector<unsigned int> &children) const;
+			/** add the IDs of the nodes below the node, in preorder, to descendants */
+			void getDescendantIds(unsigned int id, std::vector<unsigned int> &descendants) const;
+			/** name1;name2;... of the children of the node in order, of the nodes below it in preorder, and of its
+			 * ancestors from its parent up to the top of its tree */
+			std::string getChildNamesById(unsigned int id) const;
+			std::string getDescendantNamesById(unsigned int id) const;
+			std::string getPathToRootById(unsigned int id) const;
 
 
 			// set of methods to traverse a tree, node by node, in a breadth first search, and mark specific
-			// nodes for future fast retrieval.
+			// nodes for future fast retrieval.  The iterator walks the first top level tree, and is kept as
+			// the ID of its node, so the first call after the tree is built or edited builds the node IDs; a
+			// marker is the ID of the node.
 			//NOT THREAD SAFE!! - if you iterate this way, you MUST ensure that you are the only one who can call these methods! Concurrent calls
 			//will clobber your iterator!
 			void resetBreadthFirstIterToRoot();  //NOT THREAD SAFE!!
@@ -220,8 +670,8 @@ namespace KBTreeLib {
 			std::string breadthFirstIterGetName(); // NOT THEAD SAFE!!
 			std::string breadthFirstIterGetParentName(); //NOT THREAD SAFE!!
 
-			// These methods are thread safe.  They do not affect the global iterator, and assume that the node you are working on
-			// has already been marked
+			// These methods are thread safe.  They do not affect the global iterator, and take the marker as a node ID,
+			// as the methods above do; the descendants are listed in breadth first order
 			std::string breadthFirstIterGetName(unsigned int nodeMarker);
 			std::string breadthFirstIterGetPathToRoot(unsigned int nodeMarker);
 			std::string breadthFirstIterGetParentName(unsigned int nodeMarker);
@@ -233,17 +683,80 @@ namespace KBTreeLib {
 
 		protected:
 
+			/** Create a tree with no nodes and no text, to be filled in node by node (see KBCompactTree::toKBTree) */
+			KBTree();
+			/** the tree in binary form in data, which owner keeps alive */
+			static KBTree *fromBinaryData(std::string_view data, std::shared_ptr<const void> owner);
+			/** Create a tree by parsing text kept alive by owner; used to build trees over shared or mapped text.
+			 * If useStructuralIndex is false, the text is parsed one character at a time without first building
+			 * a KBStructuralIndex (both give identical trees; this is kept for comparison and benchmarking). */
+			KBTree(std::string_view newickText, std::shared_ptr<const void> owner, bool verbose, bool assumeBootstrapNames, bool useStructuralIndex=true, unsigned int threadCount=1, bool lazyLabels=false, bool keepOriginalLabels=true);
+			void initializeFromText(std::string_view newickText, std::shared_ptr<const void> owner, bool useStructuralIndex=true);
+
+			/** Everything the parser updates other than the tree itself.  The parallel parser gives each thread
+			 * its own, so that threads share nothing but the (read only) text and structural index, and add
+			 * strings to their own shard of the label table. */
+			struct ParseState {
+				ParseState(KBStringTable &labels, unsigned int shard, KBLabelArena &arena, bool assumeBootstrapNames, bool lazyLabels, bool keepOriginalLabels)
+					: labels(labels), shard(shard), arena(arena), nextEntry(0), nodeCount(0), assumeBootstrapNames(assumeBootstrapNames), lazyLabels(lazyLabels),
+					  keepOriginalLabels(keepOriginalLabels), rejectedBootstrapName(false), quiet(false) { };
+				KBStringTable &labels;        // the tree's label strings
+				unsigned int shard;           // the shard of labels this parse adds to
+				KBLabelArena &arena;          // storage for label text that is not found verbatim in the Newick text
+				std::string labelScratch[7];  // scratch strings reused by getNextLabel for labels that cannot be referenced in place
+				size_t nextEntry;             // position in the structural index, if there is one
+				unsigned int nodeCount;       // nodes created
+				bool assumeBootstrapNames;
+				bool lazyLabels;              // leave plain labels undecoded (see KBNode::labelPending)
+				bool keepOriginalLabels;      // set the original_label of nodes
+				bool rejectedBootstrapName;   // an internal node name was not a number, so assumeBootstrapNames was turned off
+				bool quiet;                   // do not report a rejected bootstrap name
+			};
+
 			//////////////////// NEWICK PARSING METHODS ///////////////////////////
+			// The label parsing methods do not copy label text; the label table is left pointing into the
+			// given string, which must therefore be newickText (or otherwise live as long as the tree).
 			/** recursive parsing of a string assuming newick format.  Do not call this method directly outside of KBTree */
-			void parseNewick(const std::string &newickString, unsigned int &k, tree<KBNode>::iterator &currentNode);
-			void parseNewickNonRecursive(const std::string &newickString);
-			bool getNextLabel(const std::string &newickString, unsigned int &k, KBNode &node);
-			bool getNextLabelWithoutComments(const std::string &newickString, unsigned int &k, KBNode &node);
-			void passLeadingWhiteSpace(const std::string &newickString, unsigned int &k);
+			void parseNewick(const std::string &newickString, unsigned int &k, KBNodeTree::iterator &currentNode);
+			/** if structure is given, it must be the structural index of newickString */
+			void parseNewickNonRecursive(std::string_view newickString, const KBStructuralIndex *structure=NULL);
+			/** parse the clade starting at cursor and ending before limit into the node top */
+			void parseSubtree(std::string_view newickString, const KBStructuralIndex *structure, size_t cursor, size_t limit, KBNodeTree::iterator top, ParseState &state);
+			/** try to parse the top level clades concurrently; returns false (leaving the tree as it was) if the
+			 * text is not suited to it, in which case it should be parsed with parseNewickNonRecursive */
+			bool parseNewickParallel(std::string_view newickString, const KBStructuralIndex &structure, unsigned int threadCount);
+			void labelNode(std::string_view newickString, size_t &k, KBNode &node, const KBStructuralIndex *structure, ParseState &state);
+			bool getNextLabel(std::string_view newickString, size_t &k, KBNode &node, ParseState &state);
+			/** getNextLabel using the structural index; state.nextEntry is the position in the index */
+			bool getNextLabelIndexed(std::string_view newickString, size_t &k, KBNode &node, const KBStructuralIndex &structure, ParseState &state);
+			bool getNextLabelWithoutComments(std::string_view newickString, size_t &k, KBNode &node, ParseState &state);
+			void passLeadingWhiteSpace(std::string_view newickString, size_t &k);
+
+			//////////////////// NEWICK OUTPUT ///////////////////////////
+			/** the walk behind both writeNewick methods: labels in the style if useStyle, else by the output flags */
+			void writeNewick(KBOutputSink &out, bool useStyle, unsigned int style);
+			/** write the tree with labels formatted on several threads; returns false, having written nothing, if the
+			 * tree is too small or only one output thread is set, in which case the caller should write it */
+			bool writeNewickParallel(KBOutputSink &out, bool useStyle, unsigned int style);
 
 			//////////////////// BASIC TREE DATA STRUCTURES ///////////////////////////
 			unsigned int nodeCount;
-			tree <KBNode> *tr;
+			std::unique_ptr<KBNodeTree,KBNodeTreeDeleter> tr;
+
+			/** the Newick text this tree was parsed from; most node labels are views into this buffer */
+			std::string_view newickText;
+			/** keeps newickText alive: either a private copy of the parsed string or a shared KBMappedFile */
+			std::shared_ptr<const void> newickTextOwner;
+			/** storage for label text that is not found verbatim in newickText */
+			KBLabelArena labelArena;
+			/** every label string of the nodes, which hold handles into this table */
+			KBStringTable labelTable;
+			/** number of threads the Newick text may be parsed on (0 for one per core) */
+			unsigned int parseThreadCount = 1;
+			/** leave plain labels undecoded until they are read */
+			bool lazyLabels = false;
+			/** keep the original label of every node, for output in the ORIGINAL_LABEL style */
+			bool keepOriginalLabels = true;
 
 
 			//////////////////// FLAGS FOR OUTPUTTING THE NEWICK STRING VIA toNewick() ///////////////////////////
@@ -251,12 +764,86 @@ namespace KBTreeLib {
 			bool with_distances;
 			bool with_comments;
 			bool with_bootstrap_values_as_labels;
+			int output_precision = DEFAULT_OUTPUT_PRECISION;
+			unsigned int output_thread_count = 1;
 
 
 			/////////////////// Structure for storing iterators to nodes in the tree
 
-			tree<KBNode>::breadth_first_iterator bfi;
-			std::vector<tree<KBNode>::breadth_first_iterator> bfiNodeIndex;
+			/** ID of the node of the breadth first iterator, or NO_NODE_ID past the end */
+			uint32_t bfi = NO_NODE_ID;
+			/** position of bfi in breadthFirstOrder, or NO_NODE_ID if it must be looked up */
+			uint32_t bfiPosition = NO_NODE_ID;
+			/** IDs of the first top level tree in breadth first order, which is by depth then ID; built when first
+			 * needed, and dropped with the derived properties or when a node is removed */
+			std::vector<uint32_t> breadthFirstOrder;
+			void buildBreadthFirstOrder();
+			void invalidateBreadthFirstOrder();
+
+
+			/////////////////// Index of the named nodes by name, built when first needed.  Renaming and removing
+			/////////////////// nodes by name keep it up to date; any other edit drops it.
+
+			static const uint32_t NO_NAME_ENTRY = 0xffffffff;
+			/** the nodes with one name are chained through their entries, which are in post order; the node of
+			 * an entry is NULL once it is removed or unnamed */
+			struct NameIndexEntry {
+				tree_node_<KBNode> *node;
+				uint32_t next;
+			};
+			/** the first and last entries of the nodes with each name */
+			std::unordered_map<std::string_view,std::pair<uint32_t,uint32_t> > nameIndex;
+			std::vector<NameIndexEntry> nameIndexEntries;
+			/** entries whose node is not NULL */
+			size_t namedNodeCount = 0;
+			bool nameIndexValid = false;
+			void buildNameIndex();
+			void invalidateNameIndex();
+			/** the first node with the name in post order, or NULL */
+			tree_node_<KBNode> *findNodeByName(std::string_view name);
+			/** remove the name from the index, returning the first entry of its chain (or NO_NAME_ENTRY) */
+			uint32_t takeNameChain(std::string_view name);
+			/** give the nodes of a chain taken from the index the name, and put them back in the index under it;
+			 * returns the number of nodes */
+			unsigned int addNameChain(uint32_t first, uint32_t name);
+			/** erase the node, reparenting any children to its parent with their distances extended by its own;
+			 * the derived properties are kept up to date */
+			void eraseNodeKeepingDistances(tree_node_<KBNode> *node);
+
+			/////////////////// Properties of every node derived from the shape of the tree and its branch lengths,
+			/////////////////// computed when first needed
+
+			struct DerivedProperties {
+				double distanceToRoot;  // only once rootDistancesValid
+				uint32_t depth;
+				uint32_t subtreeSize;   // nodes in the subtree below and including the node
+				uint32_t leafCount;     // leaves in the subtree
+				uint32_t subtreeEnd;    // one more than the largest ID in the subtree, which removals leave alone
+			};
+			/** indexed by KBNode::derivedIndex, the ID of the node */
+			std::vector<DerivedProperties> derived;
+			/** the node with each ID, or NULL once it is removed */
+			std::vector<tree_node_<KBNode> *> nodesById;
+			/** name1;name2;... of the nodes below the node in breadth first order; every label must be decoded */
+			std::string getDescendantNamesBreadthFirst(const tree_node_<KBNode> *node) const;
+			unsigned int leafCount = 0;
+			bool derivedValid = false;
+			/** the shape of the tree only (every property but distanceToRoot), which reads no labels */
+			void buildDerivedProperties();
+			/** whether distanceToRoot is filled in: it needs the distance of every node, which decodes its label,
+			 * so it is only computed once a distance to the root is asked for */
+			bool rootDistancesValid = false;
+			void buildRootDistances();
+			/** after nodes were removed (and their entries in nodesById set to NULL), compute the properties of
+			 * the nodes that are left again, keeping their IDs */
+			void refreshDerivedProperties();
+			void invalidateDerivedProperties();
+			/** the shallowest node in any range of IDs (a removed node never is), from which extractInducedSubtree
+			 * finds lowest common ancestors; built when first needed, and dropped whenever the depths change */
+			std::unique_ptr<KBDepthMinima> depthMinima;
+			void buildDepthMinima();
+			/** the derived properties of the first node with the name in post order, or NULL */
+			const DerivedProperties *findDerivedProperties(std::string_view name);
 
 
 
@@ -354,18 +941,34 @@ namespace KBTreeLib {
 	/** in place removal of leading and trailing whitespace **/
 	void trim(std::string& str);
 
-	/** given a string, attempts to parse as a double value.  Throws ParseException **/
-	double convertToDouble(const std::string& s);
+	/** appends the names of the list name1;name2;... to names, trimmed, leaving out empty names **/
+	void splitNames(const std::string &list, std::vector<std::string> &names);
+
+	/** given a string, attempts to parse as a double value.  Throws ParseException, after writing its message
+	 * to cerr unless quiet (as the parallel parser is, which parses the text again if it fails) **/
+	double convertToDouble(std::string_view s, bool quiet=false);
+
+	/** given a string, attempts to parse as a double value without throwing.  Returns false (and leaves x
+	 * untouched) if the string is not a number.  Parsing is locale independent. **/
+	bool parseDouble(std::string_view s, double &x);
+
+	/** maximum number of characters formatDouble can write */
+	const size_t MAX_DOUBLE_CHARS = 32;
+
+	/** writes the double to buf with the given precision (significant digits, or SHORTEST_ROUND_TRIP) and returns
+	 * the number of characters written.  buf must have room for MAX_DOUBLE_CHARS.  Formatting is locale independent. **/
+	size_t formatDouble(double x, int precision, char *buf);
 
 	/** given a double value, returns a string representation **/
 	std::string toString(double x);
+	std::string toString(double x, int precision);
 
 	/**
 	 * this method determines if we have any special characters in the string, and if so, we put quotes around it
 	 * and escape out any double quotes, and return the string.  This function is used when returning a newick
 	 * string.
 	 */
-	std::string getQuotedString(const std::string& s);
+	std::string getQuotedString(std::string_view s);
 
 
 
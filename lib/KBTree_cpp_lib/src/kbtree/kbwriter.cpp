@@ -0,0 +1,81 @@
+/**
+ * @file kbwriter.cpp
+ * @brief Buffered output for writing trees
+ */
+
+#include "kbwriter.hh"
+#include <cerrno>
+#include <unistd.h>
+
+using namespace KBTreeLib;
+
+
+KBOutputSink::KBOutputSink(int fd, size_t bufferSize)
+	: destination(TO_FD), fd(fd), out(NULL), callback(), buffer(new char[bufferSize>0 ? bufferSize : 1]),
+	  capacity(bufferSize>0 ? bufferSize : 1), used(0), drained(0), failed(fd<0) { }
+
+KBOutputSink::KBOutputSink(std::ostream &out, size_t bufferSize)
+	: destination(TO_STREAM), fd(-1), out(&out), callback(), buffer(new char[bufferSize>0 ? bufferSize : 1]),
+	  capacity(bufferSize>0 ? bufferSize : 1), used(0), drained(0), failed(false) { }
+
+KBOutputSink::KBOutputSink(Callback callback, size_t bufferSize)
+	: destination(TO_CALLBACK), fd(-1), out(NULL), callback(callback), buffer(new char[bufferSize>0 ? bufferSize : 1]),
+	  capacity(bufferSize>0 ? bufferSize : 1), used(0), drained(0), failed(false) { }
+
+KBOutputSink::~KBOutputSink() {
+	// a destructor cannot report a failure; call flush() first to find out about one
+	try { flush(); } catch (...) { }
+}
+
+bool KBOutputSink::flush() {
+	drain();
+	if(destination==TO_STREAM && !failed) {
+		out->flush();
+		if(!out->good()) { failed=true; }
+	}
+	return !failed;
+}
+
+void KBOutputSink::drain() {
+	size_t length = used;
+	// count the bytes as drained first, so a throwing callback does not see them again on the next flush
+	used = 0;
+	drained += length;
+	send(buffer.get(),length);
+}
+
+void KBOutputSink::writeLong(const char *data, size_t length) {
+	// top up the buffer, and pass anything longer than a whole buffer on directly
+	size_t head = capacity-used;
+	memcpy(buffer.get()+used,data,head);
+	used = capacity;
+	drain();
+	data += head; length -= head;
+	if(length>=capacity) {
+		drained += length;
+		send(data,length);
+	} else {
+		memcpy(buffer.get(),data,length);
+		used = length;
+	}
+}
+
+void KBOutputSink::send(const char *data, size_t length) {
+	if(length==0 || failed) { return; }
+	if(destination==TO_FD) {
+		while(length>0) {
+			ssize_t n = ::write(fd,data,length);
+			if(n<0) {
+				if(errno==EINTR) { continue; }
+				failed=true;
+				return;
+			}
+			data+=n; length-=(size_t)n;
+		}
+	} else if(destination==TO_STREAM) {
+		out->write(data,(std::streamsize)length);
+		if(!out->good()) { failed=true; }
+	} else {
+		callback(data,length);
+	}
+}
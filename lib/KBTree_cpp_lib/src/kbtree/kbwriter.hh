@@ -0,0 +1,85 @@
+/**
+ * @file kbwriter.hh
+ * @brief Buffered output for writing trees
+ *
+ * Writing a large tree as one std::string means holding the whole Newick text in memory, and copying it
+ * again to get it into a file.  A KBOutputSink instead collects output in a fixed size buffer and hands
+ * each full buffer to its destination - a file descriptor, an ostream, or a callback - so a tree of any
+ * size is written in constant memory.  A sink can be reused to write any number of trees one after the
+ * other; its buffer is only allocated once.
+ */
+
+#ifndef KBWRITER_HH_
+#define KBWRITER_HH_
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <string_view>
+
+namespace KBTreeLib {
+
+	class KBOutputSink
+	{
+		public:
+			/** receives each full buffer (and the rest on flush) */
+			typedef std::function<void(const char *data, size_t length)> Callback;
+
+			static const size_t DEFAULT_BUFFER_SIZE = 1<<16;
+
+			/** write to an open file descriptor, which the sink does not close */
+			explicit KBOutputSink(int fd, size_t bufferSize=DEFAULT_BUFFER_SIZE);
+			/** write to the stream, which must outlive the sink */
+			explicit KBOutputSink(std::ostream &out, size_t bufferSize=DEFAULT_BUFFER_SIZE);
+			/** pass the output to the callback */
+			explicit KBOutputSink(Callback callback, size_t bufferSize=DEFAULT_BUFFER_SIZE);
+			/** flushes whatever is still buffered */
+			~KBOutputSink();
+
+			inline void put(char C) {
+				if(used==capacity) { drain(); }
+				buffer[used++] = C;
+			};
+			inline void write(const char *data, size_t length) {
+				if(length<=capacity-used) {
+					memcpy(buffer.get()+used,data,length);
+					used+=length;
+				} else {
+					writeLong(data,length);
+				}
+			};
+			inline void write(std::string_view text) { write(text.data(),text.size()); };
+
+			/** send everything buffered to the destination; returns good() */
+			bool flush();
+			/** false once writing to the destination has failed; everything written after that is dropped */
+			bool good() const { return !failed; };
+			/** bytes written to the sink so far, including any still in the buffer */
+			size_t getBytesWritten() const { return drained+used; };
+
+		private:
+			KBOutputSink(const KBOutputSink &);
+			KBOutputSink &operator=(const KBOutputSink &);
+
+			void drain();
+			void writeLong(const char *data, size_t length);
+			void send(const char *data, size_t length);
+
+			enum Destination { TO_FD, TO_STREAM, TO_CALLBACK };
+			Destination destination;
+			int fd;
+			std::ostream *out;
+			Callback callback;
+
+			std::unique_ptr<char[]> buffer;
+			size_t capacity;
+			size_t used;
+			size_t drained;
+			bool failed;
+	};
+
+};
+
+#endif /* KBWRITER_HH_ */
@@ -96,6 +96,10 @@ class tree {
 		~tree();
 		tree<T,tree_node_allocator>& operator=(const tree<T, tree_node_allocator>&);
 
+		/// The allocator the nodes of this tree come from.
+		tree_node_allocator&       node_allocator()       { return alloc_; }
+		const tree_node_allocator& node_allocator() const { return alloc_; }
+
       /// Base class for iterators, only pointers stored, no traversal logic.
 #ifdef __SGI_STL_PORT
 		class iterator_base : public stlport::bidirectional_iterator<T, ptrdiff_t> {
@@ -300,6 +304,10 @@ class tree {
 
 		/// Erase all nodes of the tree.
 		void     clear();
+		/// Forget all nodes of the tree without visiting them.  Only for an allocator that frees its nodes
+		/// itself when it is destroyed, and data that needs no destructor; the nodes are not given back
+		/// to the allocator.
+		void     abandon_nodes();
 		/// Erase element at position pointed to by iterator, return incremented iterator.
 		/// also erases childredn of this node
 		template<typename iter> iter erase(iter);
@@ -589,25 +597,45 @@ void tree<T, tree_node_allocator>::clear()
 			erase(pre_order_iterator(head->next_sibling));
 	}
 
+template <class T, class tree_node_allocator>
+void tree<T, tree_node_allocator>::abandon_nodes()
+	{
+	if(head) {
+		head->next_sibling=feet;
+		feet->prev_sibling=head;
+		}
+	}
+
 template<class T, class tree_node_allocator> 
 void tree<T, tree_node_allocator>::erase_children(const iterator_base& it)
 	{
 //	std::cout << "erase_children " << it.node << std::endl;
 	if(it.node==0) return;
 
-	tree_node *cur=it.node->first_child;
-	tree_node *prev=0;
+	// depth first without recursion, so that a deep tree cannot overflow the stack: go down to a leaf, free
+	// it, and carry on with its next sibling, or with its parent once that has no children left
+	tree_node *top=it.node;
+	tree_node *cur=top->first_child;
 
 	while(cur!=0) {
-		prev=cur;
-		cur=cur->next_sibling;
-		erase_children(pre_order_iterator(prev));
-//		kp::destructor(&prev->data);
-		alloc_.destroy(prev);
-		alloc_.deallocate(prev,1);
-		}
-	it.node->first_child=0;
-	it.node->last_child=0;
+		if(cur->first_child!=0) {
+			cur=cur->first_child;
+			continue;
+			}
+		tree_node *next=cur->next_sibling;
+		tree_node *parent=cur->parent;
+//		kp::destructor(&cur->data);
+		alloc_.destroy(cur);
+		alloc_.deallocate(cur,1);
+		if(next!=0) cur=next;
+		else {
+			parent->first_child=0;
+			parent->last_child=0;
+			cur=(parent==top) ? 0 : parent;
+			}
+		}
+	top->first_child=0;
+	top->last_child=0;
 //	std::cout << "exit" << std::endl;
 	}
 
@@ -223,6 +223,11 @@ static void SWIGUNUSED SWIG_JavaThrowException(JNIEnv *jenv, SWIG_JavaExceptionC
 
 
 #include "kbtree/kbtree.hh"
+#include "kbtree/kbancestor.hh"
+#include "kbtree/kbcursor.hh"
+#include "kbtree/kbfrozen.hh"
+#include "kbtree/kbcache.hh"
+#include "kbtree/kbdiskcache.hh"
 std::string translateToProt(const std::string &dna);
 
 
@@ -252,6 +257,103 @@ SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_transl
 }
 
 
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeStatistics_1getNodeCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTreeStatistics *arg1 = (KBTreeLib::KBTreeStatistics *) 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTreeStatistics **)&jarg1; 
+  result = (unsigned int)((KBTreeLib::KBTreeStatistics const *)arg1)->getNodeCount();
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeStatistics_1getLeafCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTreeStatistics *arg1 = (KBTreeLib::KBTreeStatistics *) 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTreeStatistics **)&jarg1; 
+  result = (unsigned int)((KBTreeLib::KBTreeStatistics const *)arg1)->getLeafCount();
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeStatistics_1getMaxDepth(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTreeStatistics *arg1 = (KBTreeLib::KBTreeStatistics *) 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTreeStatistics **)&jarg1; 
+  result = (unsigned int)((KBTreeLib::KBTreeStatistics const *)arg1)->getMaxDepth();
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeStatistics_1hasBranchLengths(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBTreeStatistics *arg1 = (KBTreeLib::KBTreeStatistics *) 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTreeStatistics **)&jarg1; 
+  result = (bool)((KBTreeLib::KBTreeStatistics const *)arg1)->hasBranchLengths();
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeStatistics_1hasBootstrapValues(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBTreeStatistics *arg1 = (KBTreeLib::KBTreeStatistics *) 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTreeStatistics **)&jarg1; 
+  result = (bool)((KBTreeLib::KBTreeStatistics const *)arg1)->hasBootstrapValues();
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_new_1KBTreeStatistics(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTreeStatistics *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (KBTreeLib::KBTreeStatistics *)new KBTreeLib::KBTreeStatistics();
+  *(KBTreeLib::KBTreeStatistics **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_delete_1KBTreeStatistics(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  KBTreeLib::KBTreeStatistics *arg1 = (KBTreeLib::KBTreeStatistics *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(KBTreeLib::KBTreeStatistics **)&jarg1; 
+  delete arg1;
+}
+
+
 SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_new_1KBTree_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jstring jarg1) {
   jlong jresult = 0 ;
   std::string *arg1 = 0 ;
@@ -259,175 +361,2911 @@ SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_new_1KBT
   
   (void)jenv;
   (void)jcls;
-  if(!jarg1) {
+  if(!jarg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg1_pstr = (const char *)jenv->GetStringUTFChars(jarg1, 0); 
+  if (!arg1_pstr) return 0;
+  std::string arg1_str(arg1_pstr);
+  arg1 = &arg1_str;
+  jenv->ReleaseStringUTFChars(jarg1, arg1_pstr); 
+  result = (KBTreeLib::KBTree *)new KBTreeLib::KBTree((std::string const &)*arg1);
+  *(KBTreeLib::KBTree **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_new_1KBTree_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jstring jarg1, jboolean jarg2) {
+  jlong jresult = 0 ;
+  std::string *arg1 = 0 ;
+  bool arg2 ;
+  KBTreeLib::KBTree *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  if(!jarg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg1_pstr = (const char *)jenv->GetStringUTFChars(jarg1, 0); 
+  if (!arg1_pstr) return 0;
+  std::string arg1_str(arg1_pstr);
+  arg1 = &arg1_str;
+  jenv->ReleaseStringUTFChars(jarg1, arg1_pstr); 
+  arg2 = jarg2 ? true : false; 
+  result = (KBTreeLib::KBTree *)new KBTreeLib::KBTree((std::string const &)*arg1,arg2);
+  *(KBTreeLib::KBTree **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_new_1KBTree_1_1SWIG_12(JNIEnv *jenv, jclass jcls, jstring jarg1, jboolean jarg2, jboolean jarg3) {
+  jlong jresult = 0 ;
+  std::string *arg1 = 0 ;
+  bool arg2 ;
+  bool arg3 ;
+  KBTreeLib::KBTree *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  if(!jarg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg1_pstr = (const char *)jenv->GetStringUTFChars(jarg1, 0); 
+  if (!arg1_pstr) return 0;
+  std::string arg1_str(arg1_pstr);
+  arg1 = &arg1_str;
+  jenv->ReleaseStringUTFChars(jarg1, arg1_pstr); 
+  arg2 = jarg2 ? true : false; 
+  arg3 = jarg3 ? true : false; 
+  result = (KBTreeLib::KBTree *)new KBTreeLib::KBTree((std::string const &)*arg1,arg2,arg3);
+  *(KBTreeLib::KBTree **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_new_1KBTree_1_1SWIG_13(JNIEnv *jenv, jclass jcls, jstring jarg1, jboolean jarg2, jboolean jarg3, jlong jarg4, jboolean jarg5, jboolean jarg6) {
+  jlong jresult = 0 ;
+  std::string *arg1 = 0 ;
+  bool arg2 ;
+  bool arg3 ;
+  unsigned int arg4 ;
+  bool arg5 ;
+  bool arg6 ;
+  KBTreeLib::KBTree *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  if(!jarg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg1_pstr = (const char *)jenv->GetStringUTFChars(jarg1, 0); 
+  if (!arg1_pstr) return 0;
+  std::string arg1_str(arg1_pstr);
+  arg1 = &arg1_str;
+  jenv->ReleaseStringUTFChars(jarg1, arg1_pstr); 
+  arg2 = jarg2 ? true : false; 
+  arg3 = jarg3 ? true : false; 
+  arg4 = (unsigned int)jarg4; 
+  arg5 = jarg5 ? true : false; 
+  arg6 = jarg6 ? true : false; 
+  result = (KBTreeLib::KBTree *)new KBTreeLib::KBTree((std::string const &)*arg1,arg2,arg3,arg4,arg5,arg6);
+  *(KBTreeLib::KBTree **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_new_1KBTree_1_1SWIG_14(JNIEnv *jenv, jclass jcls, jstring jarg1, jboolean jarg2, jboolean jarg3, jlong jarg4, jboolean jarg5) {
+  jlong jresult = 0 ;
+  std::string *arg1 = 0 ;
+  bool arg2 ;
+  bool arg3 ;
+  unsigned int arg4 ;
+  bool arg5 ;
+  KBTreeLib::KBTree *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  if(!jarg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg1_pstr = (const char *)jenv->GetStringUTFChars(jarg1, 0); 
+  if (!arg1_pstr) return 0;
+  std::string arg1_str(arg1_pstr);
+  arg1 = &arg1_str;
+  jenv->ReleaseStringUTFChars(jarg1, arg1_pstr); 
+  arg2 = jarg2 ? true : false; 
+  arg3 = jarg3 ? true : false; 
+  arg4 = (unsigned int)jarg4; 
+  arg5 = jarg5 ? true : false; 
+  result = (KBTreeLib::KBTree *)new KBTreeLib::KBTree((std::string const &)*arg1,arg2,arg3,arg4,arg5);
+  *(KBTreeLib::KBTree **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_new_1KBTree_1_1SWIG_15(JNIEnv *jenv, jclass jcls, jstring jarg1, jboolean jarg2, jboolean jarg3, jlong jarg4) {
+  jlong jresult = 0 ;
+  std::string *arg1 = 0 ;
+  bool arg2 ;
+  bool arg3 ;
+  unsigned int arg4 ;
+  KBTreeLib::KBTree *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  if(!jarg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg1_pstr = (const char *)jenv->GetStringUTFChars(jarg1, 0); 
+  if (!arg1_pstr) return 0;
+  std::string arg1_str(arg1_pstr);
+  arg1 = &arg1_str;
+  jenv->ReleaseStringUTFChars(jarg1, arg1_pstr); 
+  arg2 = jarg2 ? true : false; 
+  arg3 = jarg3 ? true : false; 
+  arg4 = (unsigned int)jarg4; 
+  result = (KBTreeLib::KBTree *)new KBTreeLib::KBTree((std::string const &)*arg1,arg2,arg3,arg4);
+  *(KBTreeLib::KBTree **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_delete_1KBTree(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  delete arg1;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1fromFile_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jstring jarg1, jboolean jarg2, jboolean jarg3, jlong jarg4, jboolean jarg5, jboolean jarg6) {
+  jlong jresult = 0 ;
+  std::string *arg1 = 0 ;
+  bool arg2 ;
+  bool arg3 ;
+  unsigned int arg4 ;
+  bool arg5 ;
+  bool arg6 ;
+  KBTreeLib::KBTree *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  if(!jarg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg1_pstr = (const char *)jenv->GetStringUTFChars(jarg1, 0); 
+  if (!arg1_pstr) return 0;
+  std::string arg1_str(arg1_pstr);
+  arg1 = &arg1_str;
+  jenv->ReleaseStringUTFChars(jarg1, arg1_pstr); 
+  arg2 = jarg2 ? true : false; 
+  arg3 = jarg3 ? true : false; 
+  arg4 = (unsigned int)jarg4; 
+  arg5 = jarg5 ? true : false; 
+  arg6 = jarg6 ? true : false; 
+  result = (KBTreeLib::KBTree *)KBTreeLib::KBTree::fromFile((std::string const &)*arg1,arg2,arg3,arg4,arg5,arg6);
+  *(KBTreeLib::KBTree **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1fromFile_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jstring jarg1, jboolean jarg2, jboolean jarg3, jlong jarg4, jboolean jarg5) {
+  jlong jresult = 0 ;
+  std::string *arg1 = 0 ;
+  bool arg2 ;
+  bool arg3 ;
+  unsigned int arg4 ;
+  bool arg5 ;
+  KBTreeLib::KBTree *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  if(!jarg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg1_pstr = (const char *)jenv->GetStringUTFChars(jarg1, 0); 
+  if (!arg1_pstr) return 0;
+  std::string arg1_str(arg1_pstr);
+  arg1 = &arg1_str;
+  jenv->ReleaseStringUTFChars(jarg1, arg1_pstr); 
+  arg2 = jarg2 ? true : false; 
+  arg3 = jarg3 ? true : false; 
+  arg4 = (unsigned int)jarg4; 
+  arg5 = jarg5 ? true : false; 
+  result = (KBTreeLib::KBTree *)KBTreeLib::KBTree::fromFile((std::string const &)*arg1,arg2,arg3,arg4,arg5);
+  *(KBTreeLib::KBTree **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1fromFile_1_1SWIG_12(JNIEnv *jenv, jclass jcls, jstring jarg1, jboolean jarg2, jboolean jarg3, jlong jarg4) {
+  jlong jresult = 0 ;
+  std::string *arg1 = 0 ;
+  bool arg2 ;
+  bool arg3 ;
+  unsigned int arg4 ;
+  KBTreeLib::KBTree *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  if(!jarg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg1_pstr = (const char *)jenv->GetStringUTFChars(jarg1, 0); 
+  if (!arg1_pstr) return 0;
+  std::string arg1_str(arg1_pstr);
+  arg1 = &arg1_str;
+  jenv->ReleaseStringUTFChars(jarg1, arg1_pstr); 
+  arg2 = jarg2 ? true : false; 
+  arg3 = jarg3 ? true : false; 
+  arg4 = (unsigned int)jarg4; 
+  result = (KBTreeLib::KBTree *)KBTreeLib::KBTree::fromFile((std::string const &)*arg1,arg2,arg3,arg4);
+  *(KBTreeLib::KBTree **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1fromFile_1_1SWIG_13(JNIEnv *jenv, jclass jcls, jstring jarg1, jboolean jarg2, jboolean jarg3) {
+  jlong jresult = 0 ;
+  std::string *arg1 = 0 ;
+  bool arg2 ;
+  bool arg3 ;
+  KBTreeLib::KBTree *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  if(!jarg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg1_pstr = (const char *)jenv->GetStringUTFChars(jarg1, 0); 
+  if (!arg1_pstr) return 0;
+  std::string arg1_str(arg1_pstr);
+  arg1 = &arg1_str;
+  jenv->ReleaseStringUTFChars(jarg1, arg1_pstr); 
+  arg2 = jarg2 ? true : false; 
+  arg3 = jarg3 ? true : false; 
+  result = (KBTreeLib::KBTree *)KBTreeLib::KBTree::fromFile((std::string const &)*arg1,arg2,arg3);
+  *(KBTreeLib::KBTree **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1fromFile_1_1SWIG_14(JNIEnv *jenv, jclass jcls, jstring jarg1, jboolean jarg2) {
+  jlong jresult = 0 ;
+  std::string *arg1 = 0 ;
+  bool arg2 ;
+  KBTreeLib::KBTree *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  if(!jarg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg1_pstr = (const char *)jenv->GetStringUTFChars(jarg1, 0); 
+  if (!arg1_pstr) return 0;
+  std::string arg1_str(arg1_pstr);
+  arg1 = &arg1_str;
+  jenv->ReleaseStringUTFChars(jarg1, arg1_pstr); 
+  arg2 = jarg2 ? true : false; 
+  result = (KBTreeLib::KBTree *)KBTreeLib::KBTree::fromFile((std::string const &)*arg1,arg2);
+  *(KBTreeLib::KBTree **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1fromFile_1_1SWIG_15(JNIEnv *jenv, jclass jcls, jstring jarg1) {
+  jlong jresult = 0 ;
+  std::string *arg1 = 0 ;
+  KBTreeLib::KBTree *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  if(!jarg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg1_pstr = (const char *)jenv->GetStringUTFChars(jarg1, 0); 
+  if (!arg1_pstr) return 0;
+  std::string arg1_str(arg1_pstr);
+  arg1 = &arg1_str;
+  jenv->ReleaseStringUTFChars(jarg1, arg1_pstr); 
+  result = (KBTreeLib::KBTree *)KBTreeLib::KBTree::fromFile((std::string const &)*arg1);
+  *(KBTreeLib::KBTree **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1toBinary(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  result = (arg1)->toBinary();
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1writeBinaryToFile(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string *arg2 = 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = (bool)(arg1)->writeBinaryToFile((std::string const &)*arg2);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1fromBinary(JNIEnv *jenv, jclass jcls, jstring jarg1) {
+  jlong jresult = 0 ;
+  std::string *arg1 = 0 ;
+  KBTreeLib::KBTree *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  if(!jarg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg1_pstr = (const char *)jenv->GetStringUTFChars(jarg1, 0); 
+  if (!arg1_pstr) return 0;
+  std::string arg1_str(arg1_pstr);
+  arg1 = &arg1_str;
+  jenv->ReleaseStringUTFChars(jarg1, arg1_pstr); 
+  result = (KBTreeLib::KBTree *)KBTreeLib::KBTree::fromBinary((std::string const &)*arg1);
+  *(KBTreeLib::KBTree **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1fromBinaryFile(JNIEnv *jenv, jclass jcls, jstring jarg1) {
+  jlong jresult = 0 ;
+  std::string *arg1 = 0 ;
+  KBTreeLib::KBTree *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  if(!jarg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg1_pstr = (const char *)jenv->GetStringUTFChars(jarg1, 0); 
+  if (!arg1_pstr) return 0;
+  std::string arg1_str(arg1_pstr);
+  arg1 = &arg1_str;
+  jenv->ReleaseStringUTFChars(jarg1, arg1_pstr); 
+  result = (KBTreeLib::KBTree *)KBTreeLib::KBTree::fromBinaryFile((std::string const &)*arg1);
+  *(KBTreeLib::KBTree **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1scanStatistics(JNIEnv *jenv, jclass jcls, jstring jarg1) {
+  jlong jresult = 0 ;
+  std::string *arg1 = 0 ;
+  KBTreeLib::KBTreeStatistics result;
+  
+  (void)jenv;
+  (void)jcls;
+  if(!jarg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg1_pstr = (const char *)jenv->GetStringUTFChars(jarg1, 0); 
+  if (!arg1_pstr) return 0;
+  std::string arg1_str(arg1_pstr);
+  arg1 = &arg1_str;
+  jenv->ReleaseStringUTFChars(jarg1, arg1_pstr); 
+  result = KBTreeLib::KBTree::scanStatistics((std::string const &)*arg1);
+  *(KBTreeLib::KBTreeStatistics **)&jresult = new KBTreeLib::KBTreeStatistics((const KBTreeLib::KBTreeStatistics &)result); 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1toNewick_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  result = (arg1)->toNewick();
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1setOutputFlagLabel(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  bool arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  arg2 = jarg2 ? true : false; 
+  (arg1)->setOutputFlagLabel(arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1setOutputFlagDistances(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  bool arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  arg2 = jarg2 ? true : false; 
+  (arg1)->setOutputFlagDistances(arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1setOutputFlagComments(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  bool arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  arg2 = jarg2 ? true : false; 
+  (arg1)->setOutputFlagComments(arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1setOutputFlagBootstrapValuesAsLabels(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  bool arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  arg2 = jarg2 ? true : false; 
+  (arg1)->setOutputFlagBootstrapValuesAsLabels(arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1setOutputPrecision(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  int arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  arg2 = (int)jarg2; 
+  (arg1)->setOutputPrecision(arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1setOutputThreadCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  unsigned int arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  (arg1)->setOutputThreadCount(arg2);
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1toNewick_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  unsigned int arg2 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  result = (arg1)->toNewick(arg2);
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1writeNewickToFile_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string *arg2 = 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = (bool)(arg1)->writeNewickToFile((std::string const &)*arg2);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1writeNewickToFile_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jlong jarg3) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string *arg2 = 0 ;
+  unsigned int arg3 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  arg3 = (unsigned int)jarg3; 
+  result = (bool)(arg1)->writeNewickToFile((std::string const &)*arg2,arg3);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1removeNodesByNameAndSimplify(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string *arg2 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return ;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return ;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  try {
+    (arg1)->removeNodesByNameAndSimplify((std::string const &)*arg2);
+  }
+  catch(KBTreeLib::ParseException &_e) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaRuntimeException, _e.what().c_str());
+    return ;
+  }
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1removeNodeByNameAndSimplify(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string *arg2 = 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  try {
+    result = (unsigned int)(arg1)->removeNodeByNameAndSimplify((std::string const &)*arg2);
+  }
+  catch(KBTreeLib::ParseException &_e) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaRuntimeException, _e.what().c_str());
+    return 0;
+  }
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1mergeZeroDistLeaves(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  (arg1)->mergeZeroDistLeaves();
+}
+
+
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1replaceNodeNames(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string *arg2 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return ;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return ;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  (arg1)->replaceNodeNames((std::string const &)*arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1replaceNodeNamesOrMakeBlank(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string *arg2 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return ;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return ;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  (arg1)->replaceNodeNamesOrMakeBlank((std::string const &)*arg2);
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1replaceNodeName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jstring jarg3) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  if(!jarg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg3_pstr = (const char *)jenv->GetStringUTFChars(jarg3, 0); 
+  if (!arg3_pstr) return 0;
+  std::string arg3_str(arg3_pstr);
+  arg3 = &arg3_str;
+  jenv->ReleaseStringUTFChars(jarg3, arg3_pstr); 
+  result = (unsigned int)(arg1)->replaceNodeName((std::string const &)*arg2,(std::string const &)*arg3);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1getPathToRoot(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = (arg1)->getPathToRoot((std::string const &)*arg2);
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1getAllDescendantNames(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = (arg1)->getAllDescendantNames((std::string const &)*arg2);
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1getDepth(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jint jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string *arg2 = 0 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = (int)(arg1)->getDepth((std::string const &)*arg2);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1getSubtreeSize(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string *arg2 = 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = (unsigned int)(arg1)->getSubtreeSize((std::string const &)*arg2);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1getCladeLeafCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string *arg2 = 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = (unsigned int)(arg1)->getCladeLeafCount((std::string const &)*arg2);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jdouble JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1getDistanceToRoot(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jdouble jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string *arg2 = 0 ;
+  double result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = (double)(arg1)->getDistanceToRoot((std::string const &)*arg2);
+  jresult = (jdouble)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1extractInducedSubtree(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string *arg2 = 0 ;
+  KBTreeLib::KBTree *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = (KBTreeLib::KBTree *)(arg1)->extractInducedSubtree((std::string const &)*arg2);
+  *(KBTreeLib::KBTree **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1PHYLIP_1MATRIX_1get(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (unsigned int)KBTreeLib::KBTree::PHYLIP_MATRIX;
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1TSV_1MATRIX_1get(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (unsigned int)KBTreeLib::KBTree::TSV_MATRIX;
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1writePatristicDistancesToFile_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jstring jarg3, jlong jarg4, jlong jarg5) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  unsigned int arg4 ;
+  unsigned int arg5 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  if(!jarg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg3_pstr = (const char *)jenv->GetStringUTFChars(jarg3, 0); 
+  if (!arg3_pstr) return 0;
+  std::string arg3_str(arg3_pstr);
+  arg3 = &arg3_str;
+  jenv->ReleaseStringUTFChars(jarg3, arg3_pstr); 
+  arg4 = (unsigned int)jarg4; 
+  arg5 = (unsigned int)jarg5; 
+  result = (bool)(arg1)->writePatristicDistancesToFile((std::string const &)*arg2,(std::string const &)*arg3,arg4,arg5);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1writePatristicDistancesToFile_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jstring jarg3, jlong jarg4) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  unsigned int arg4 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  if(!jarg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg3_pstr = (const char *)jenv->GetStringUTFChars(jarg3, 0); 
+  if (!arg3_pstr) return 0;
+  std::string arg3_str(arg3_pstr);
+  arg3 = &arg3_str;
+  jenv->ReleaseStringUTFChars(jarg3, arg3_pstr); 
+  arg4 = (unsigned int)jarg4; 
+  result = (bool)(arg1)->writePatristicDistancesToFile((std::string const &)*arg2,(std::string const &)*arg3,arg4);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1writePatristicDistancesToFile_1_1SWIG_12(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jstring jarg3) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  if(!jarg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg3_pstr = (const char *)jenv->GetStringUTFChars(jarg3, 0); 
+  if (!arg3_pstr) return 0;
+  std::string arg3_str(arg3_pstr);
+  arg3 = &arg3_str;
+  jenv->ReleaseStringUTFChars(jarg3, arg3_pstr); 
+  result = (bool)(arg1)->writePatristicDistancesToFile((std::string const &)*arg2,(std::string const &)*arg3);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1writePatristicDistancesToFile_1_1SWIG_13(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string *arg2 = 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = (bool)(arg1)->writePatristicDistancesToFile((std::string const &)*arg2);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1stripReservedCharsFromLabels(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  (arg1)->stripReservedCharsFromLabels();
+}
+
+
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1printTree(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  (arg1)->printTree();
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1printSimpleTreeToString(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  result = (arg1)->printSimpleTreeToString();
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1printTreeToString(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  result = (arg1)->printTreeToString();
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1getNodeCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  result = (unsigned int)((KBTreeLib::KBTree const *)arg1)->getNodeCount();
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1getLeafCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  result = (unsigned int)(arg1)->getLeafCount();
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1getMemoryUsage(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  size_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  result = (size_t)((KBTreeLib::KBTree const *)arg1)->getMemoryUsage();
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1freeze(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  SwigValueWrapper< KBTreeLib::KBFrozenTree > result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  result = (arg1)->freeze();
+  *(KBTreeLib::KBFrozenTree **)&jresult = new KBTreeLib::KBFrozenTree((const KBTreeLib::KBFrozenTree &)result); 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1getAllLeafNames(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  result = (arg1)->getAllLeafNames();
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1getAllNodeNames(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  result = (arg1)->getAllNodeNames();
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1resetBreadthFirstIterToRoot(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  (arg1)->resetBreadthFirstIterToRoot();
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1breadthFirstIterNext(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  result = (bool)(arg1)->breadthFirstIterNext();
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1breadthFirstIterGetName_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  result = (arg1)->breadthFirstIterGetName();
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1breadthFirstIterGetParentName_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  result = (arg1)->breadthFirstIterGetParentName();
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1breadthFirstIterMarkNode(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  result = (unsigned int)(arg1)->breadthFirstIterMarkNode();
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1breadthFirstIterSetToNode(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  unsigned int arg2 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  result = (bool)(arg1)->breadthFirstIterSetToNode(arg2);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1breadthFirstIterGetName_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  unsigned int arg2 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  result = (arg1)->breadthFirstIterGetName(arg2);
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1breadthFirstIterGetPathToRoot(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  unsigned int arg2 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  result = (arg1)->breadthFirstIterGetPathToRoot(arg2);
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1breadthFirstIterGetParentName_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  unsigned int arg2 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  result = (arg1)->breadthFirstIterGetParentName(arg2);
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1breadthFirstIterGetAllChildrenNames(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  unsigned int arg2 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  result = (arg1)->breadthFirstIterGetAllChildrenNames(arg2);
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1breadthFirstIterGetAllDescendantNames(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  unsigned int arg2 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  result = (arg1)->breadthFirstIterGetAllDescendantNames(arg2);
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1NO_1NODE_1ID_1get(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (unsigned int)KBTreeLib::KBTree::NO_NODE_ID;
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1buildNodeIds(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  (arg1)->buildNodeIds();
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1hasNodeIds(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  result = (bool)((KBTreeLib::KBTree const *)arg1)->hasNodeIds();
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1getNodeIdLimit(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  result = (unsigned int)((KBTreeLib::KBTree const *)arg1)->getNodeIdLimit();
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1isValidNodeId(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  unsigned int arg2 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  result = (bool)((KBTreeLib::KBTree const *)arg1)->isValidNodeId(arg2);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1getNodeId(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  std::string *arg2 = 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = (unsigned int)((KBTreeLib::KBTree const *)arg1)->getNodeId((std::string const &)*arg2);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1getParentId(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  unsigned int arg2 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  result = (unsigned int)((KBTreeLib::KBTree const *)arg1)->getParentId(arg2);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1getSubtreeEndId(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  unsigned int arg2 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  result = (unsigned int)((KBTreeLib::KBTree const *)arg1)->getSubtreeEndId(arg2);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1isDescendantOf(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  unsigned int arg2 ;
+  unsigned int arg3 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  arg3 = (unsigned int)jarg3; 
+  result = (bool)((KBTreeLib::KBTree const *)arg1)->isDescendantOf(arg2,arg3);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1getNameById(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  unsigned int arg2 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  result = ((KBTreeLib::KBTree const *)arg1)->getNameById(arg2);
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1getChildNamesById(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  unsigned int arg2 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  result = ((KBTreeLib::KBTree const *)arg1)->getChildNamesById(arg2);
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1getDescendantNamesById(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  unsigned int arg2 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  result = ((KBTreeLib::KBTree const *)arg1)->getDescendantNamesById(arg2);
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1getPathToRootById(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  unsigned int arg2 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  result = ((KBTreeLib::KBTree const *)arg1)->getPathToRootById(arg2);
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBAncestorIndex_1NONE_1get(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (unsigned int)KBTreeLib::KBAncestorIndex::NONE;
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_new_1KBAncestorIndex(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = 0 ;
+  KBTreeLib::KBAncestorIndex *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1;
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "KBTreeLib::KBTree & reference is null");
+    return 0;
+  } 
+  result = (KBTreeLib::KBAncestorIndex *)new KBTreeLib::KBAncestorIndex(*arg1);
+  *(KBTreeLib::KBAncestorIndex **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_delete_1KBAncestorIndex(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(KBTreeLib::KBAncestorIndex **)&jarg1; 
+  delete arg1;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBAncestorIndex_1getNodeCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBAncestorIndex **)&jarg1; 
+  result = (unsigned int)((KBTreeLib::KBAncestorIndex const *)arg1)->getNodeCount();
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBAncestorIndex_1getParent(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+  unsigned int arg2 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBAncestorIndex **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  result = (unsigned int)((KBTreeLib::KBAncestorIndex const *)arg1)->getParent(arg2);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBAncestorIndex_1getDepth(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+  unsigned int arg2 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBAncestorIndex **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  result = (unsigned int)((KBTreeLib::KBAncestorIndex const *)arg1)->getDepth(arg2);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBAncestorIndex_1getSubtreeSize(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+  unsigned int arg2 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBAncestorIndex **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  result = (unsigned int)((KBTreeLib::KBAncestorIndex const *)arg1)->getSubtreeSize(arg2);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBAncestorIndex_1getLeafCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+  unsigned int arg2 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBAncestorIndex **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  result = (unsigned int)((KBTreeLib::KBAncestorIndex const *)arg1)->getLeafCount(arg2);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBAncestorIndex_1isLeaf(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+  unsigned int arg2 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBAncestorIndex **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  result = (bool)((KBTreeLib::KBAncestorIndex const *)arg1)->isLeaf(arg2);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jdouble JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBAncestorIndex_1getDistanceToRoot(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jdouble jresult = 0 ;
+  KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+  unsigned int arg2 ;
+  double result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBAncestorIndex **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  result = (double)((KBTreeLib::KBAncestorIndex const *)arg1)->getDistanceToRoot(arg2);
+  jresult = (jdouble)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBAncestorIndex_1getNode(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+  std::string *arg2 = 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBAncestorIndex **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = (unsigned int)((KBTreeLib::KBAncestorIndex const *)arg1)->getNode((std::string const &)*arg2);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBAncestorIndex_1isAncestor(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+  unsigned int arg2 ;
+  unsigned int arg3 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBAncestorIndex **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  arg3 = (unsigned int)jarg3; 
+  result = (bool)((KBTreeLib::KBAncestorIndex const *)arg1)->isAncestor(arg2,arg3);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBAncestorIndex_1getLowestCommonAncestor(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+  unsigned int arg2 ;
+  unsigned int arg3 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBAncestorIndex **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  arg3 = (unsigned int)jarg3; 
+  result = (unsigned int)((KBTreeLib::KBAncestorIndex const *)arg1)->getLowestCommonAncestor(arg2,arg3);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBAncestorIndex_1getLowestCommonAncestorNames(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBAncestorIndex **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = ((KBTreeLib::KBAncestorIndex const *)arg1)->getLowestCommonAncestorNames((std::string const &)*arg2);
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBAncestorIndex_1isMonophyletic(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+  std::string *arg2 = 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBAncestorIndex **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = (bool)((KBTreeLib::KBAncestorIndex const *)arg1)->isMonophyletic((std::string const &)*arg2);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCursor_1PREORDER_1get(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (unsigned int)KBTreeLib::KBTreeCursor::PREORDER;
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCursor_1POSTORDER_1get(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (unsigned int)KBTreeLib::KBTreeCursor::POSTORDER;
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCursor_1BREADTH_1FIRST_1get(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (unsigned int)KBTreeLib::KBTreeCursor::BREADTH_FIRST;
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCursor_1LEAVES_1get(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (unsigned int)KBTreeLib::KBTreeCursor::LEAVES;
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_new_1KBTreeCursor_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = 0 ;
+  unsigned int arg2 ;
+  KBTreeLib::KBTreeCursor *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1;
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "KBTreeLib::KBTree const & reference is null");
+    return 0;
+  } 
+  arg2 = (unsigned int)jarg2; 
+  result = (KBTreeLib::KBTreeCursor *)new KBTreeLib::KBTreeCursor((KBTreeLib::KBTree const &)*arg1,arg2);
+  *(KBTreeLib::KBTreeCursor **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_new_1KBTreeCursor_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = 0 ;
+  KBTreeLib::KBTreeCursor *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1;
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "KBTreeLib::KBTree const & reference is null");
+    return 0;
+  } 
+  result = (KBTreeLib::KBTreeCursor *)new KBTreeLib::KBTreeCursor((KBTreeLib::KBTree const &)*arg1);
+  *(KBTreeLib::KBTreeCursor **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_delete_1KBTreeCursor(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  KBTreeLib::KBTreeCursor *arg1 = (KBTreeLib::KBTreeCursor *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(KBTreeLib::KBTreeCursor **)&jarg1; 
+  delete arg1;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCursor_1getOrder(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTreeCursor *arg1 = (KBTreeLib::KBTreeCursor *) 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTreeCursor **)&jarg1; 
+  result = (unsigned int)((KBTreeLib::KBTreeCursor const *)arg1)->getOrder();
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCursor_1reset(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  KBTreeLib::KBTreeCursor *arg1 = (KBTreeLib::KBTreeCursor *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTreeCursor **)&jarg1; 
+  (arg1)->reset();
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCursor_1next(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBTreeCursor *arg1 = (KBTreeLib::KBTreeCursor *) 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTreeCursor **)&jarg1; 
+  result = (bool)(arg1)->next();
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCursor_1isAtEnd(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBTreeCursor *arg1 = (KBTreeLib::KBTreeCursor *) 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTreeCursor **)&jarg1; 
+  result = (bool)((KBTreeLib::KBTreeCursor const *)arg1)->isAtEnd();
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCursor_1getName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBTreeCursor *arg1 = (KBTreeLib::KBTreeCursor *) 0 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTreeCursor **)&jarg1; 
+  result = ((KBTreeLib::KBTreeCursor const *)arg1)->getName();
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCursor_1getParentName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBTreeCursor *arg1 = (KBTreeLib::KBTreeCursor *) 0 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTreeCursor **)&jarg1; 
+  result = ((KBTreeLib::KBTreeCursor const *)arg1)->getParentName();
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jdouble JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCursor_1getDistanceToParent(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jdouble jresult = 0 ;
+  KBTreeLib::KBTreeCursor *arg1 = (KBTreeLib::KBTreeCursor *) 0 ;
+  double result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTreeCursor **)&jarg1; 
+  result = (double)((KBTreeLib::KBTreeCursor const *)arg1)->getDistanceToParent();
+  jresult = (jdouble)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jdouble JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCursor_1getBootstrapValue(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jdouble jresult = 0 ;
+  KBTreeLib::KBTreeCursor *arg1 = (KBTreeLib::KBTreeCursor *) 0 ;
+  double result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTreeCursor **)&jarg1; 
+  result = (double)((KBTreeLib::KBTreeCursor const *)arg1)->getBootstrapValue();
+  jresult = (jdouble)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCursor_1isLeaf(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBTreeCursor *arg1 = (KBTreeLib::KBTreeCursor *) 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTreeCursor **)&jarg1; 
+  result = (bool)((KBTreeLib::KBTreeCursor const *)arg1)->isLeaf();
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCursor_1getNodeId(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTreeCursor *arg1 = (KBTreeLib::KBTreeCursor *) 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTreeCursor **)&jarg1; 
+  result = (unsigned int)((KBTreeLib::KBTreeCursor const *)arg1)->getNodeId();
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_new_1KBFrozenTree_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTree *arg1 = 0 ;
+  KBTreeLib::KBFrozenTree *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTree **)&jarg1;
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "KBTreeLib::KBTree & reference is null");
+    return 0;
+  } 
+  result = (KBTreeLib::KBFrozenTree *)new KBTreeLib::KBFrozenTree(*arg1);
+  *(KBTreeLib::KBFrozenTree **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_new_1KBFrozenTree_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jstring jarg1, jboolean jarg2) {
+  jlong jresult = 0 ;
+  std::string *arg1 = 0 ;
+  bool arg2 ;
+  KBTreeLib::KBFrozenTree *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  if(!jarg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg1_pstr = (const char *)jenv->GetStringUTFChars(jarg1, 0); 
+  if (!arg1_pstr) return 0;
+  std::string arg1_str(arg1_pstr);
+  arg1 = &arg1_str;
+  jenv->ReleaseStringUTFChars(jarg1, arg1_pstr); 
+  arg2 = jarg2 ? true : false; 
+  result = (KBTreeLib::KBFrozenTree *)new KBTreeLib::KBFrozenTree((std::string const &)*arg1,arg2);
+  *(KBTreeLib::KBFrozenTree **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_new_1KBFrozenTree_1_1SWIG_12(JNIEnv *jenv, jclass jcls, jstring jarg1) {
+  jlong jresult = 0 ;
+  std::string *arg1 = 0 ;
+  KBTreeLib::KBFrozenTree *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  if(!jarg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg1_pstr = (const char *)jenv->GetStringUTFChars(jarg1, 0); 
+  if (!arg1_pstr) return 0;
+  std::string arg1_str(arg1_pstr);
+  arg1 = &arg1_str;
+  jenv->ReleaseStringUTFChars(jarg1, arg1_pstr); 
+  result = (KBTreeLib::KBFrozenTree *)new KBTreeLib::KBFrozenTree((std::string const &)*arg1);
+  *(KBTreeLib::KBFrozenTree **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_delete_1KBFrozenTree(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  delete arg1;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1isSameSnapshot(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  KBTreeLib::KBFrozenTree *arg2 = 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg2_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  arg2 = *(KBTreeLib::KBFrozenTree **)&jarg2;
+  if (!arg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "KBTreeLib::KBFrozenTree const & reference is null");
+    return 0;
+  } 
+  result = (bool)((KBTreeLib::KBFrozenTree const *)arg1)->isSameSnapshot((KBTreeLib::KBFrozenTree const &)*arg2);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1getNodeCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  result = (unsigned int)((KBTreeLib::KBFrozenTree const *)arg1)->getNodeCount();
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1getLeafCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  result = (unsigned int)((KBTreeLib::KBFrozenTree const *)arg1)->getLeafCount();
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1getMemoryUsage(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  size_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  result = (size_t)((KBTreeLib::KBFrozenTree const *)arg1)->getMemoryUsage();
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1getAllLeafNames(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  result = ((KBTreeLib::KBFrozenTree const *)arg1)->getAllLeafNames();
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1getAllNodeNames(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  result = ((KBTreeLib::KBFrozenTree const *)arg1)->getAllNodeNames();
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1hasNode(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  std::string *arg2 = 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = (bool)((KBTreeLib::KBFrozenTree const *)arg1)->hasNode((std::string const &)*arg2);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1getPathToRoot(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = ((KBTreeLib::KBFrozenTree const *)arg1)->getPathToRoot((std::string const &)*arg2);
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1getDepth(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jint jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  std::string *arg2 = 0 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = (int)((KBTreeLib::KBFrozenTree const *)arg1)->getDepth((std::string const &)*arg2);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1getSubtreeSize(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  std::string *arg2 = 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = (unsigned int)((KBTreeLib::KBFrozenTree const *)arg1)->getSubtreeSize((std::string const &)*arg2);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1getCladeLeafCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  std::string *arg2 = 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = (unsigned int)((KBTreeLib::KBFrozenTree const *)arg1)->getCladeLeafCount((std::string const &)*arg2);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jdouble JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1getDistanceToRoot(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jdouble jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  std::string *arg2 = 0 ;
+  double result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = (double)((KBTreeLib::KBFrozenTree const *)arg1)->getDistanceToRoot((std::string const &)*arg2);
+  jresult = (jdouble)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1getLowestCommonAncestorNames(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = ((KBTreeLib::KBFrozenTree const *)arg1)->getLowestCommonAncestorNames((std::string const &)*arg2);
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1isMonophyletic(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  std::string *arg2 = 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = (bool)((KBTreeLib::KBFrozenTree const *)arg1)->isMonophyletic((std::string const &)*arg2);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jdouble JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1getPatristicDistance(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jstring jarg3) {
+  jdouble jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  double result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  if(!jarg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg3_pstr = (const char *)jenv->GetStringUTFChars(jarg3, 0); 
+  if (!arg3_pstr) return 0;
+  std::string arg3_str(arg3_pstr);
+  arg3 = &arg3_str;
+  jenv->ReleaseStringUTFChars(jarg3, arg3_pstr); 
+  result = (double)((KBTreeLib::KBFrozenTree const *)arg1)->getPatristicDistance((std::string const &)*arg2,(std::string const &)*arg3);
+  jresult = (jdouble)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1writePatristicDistancesToFile_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jstring jarg3, jlong jarg4, jlong jarg5) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  unsigned int arg4 ;
+  unsigned int arg5 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  if(!jarg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg3_pstr = (const char *)jenv->GetStringUTFChars(jarg3, 0); 
+  if (!arg3_pstr) return 0;
+  std::string arg3_str(arg3_pstr);
+  arg3 = &arg3_str;
+  jenv->ReleaseStringUTFChars(jarg3, arg3_pstr); 
+  arg4 = (unsigned int)jarg4; 
+  arg5 = (unsigned int)jarg5; 
+  result = (bool)((KBTreeLib::KBFrozenTree const *)arg1)->writePatristicDistancesToFile((std::string const &)*arg2,(std::string const &)*arg3,arg4,arg5);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1writePatristicDistancesToFile_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jstring jarg3, jlong jarg4) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  unsigned int arg4 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  if(!jarg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg3_pstr = (const char *)jenv->GetStringUTFChars(jarg3, 0); 
+  if (!arg3_pstr) return 0;
+  std::string arg3_str(arg3_pstr);
+  arg3 = &arg3_str;
+  jenv->ReleaseStringUTFChars(jarg3, arg3_pstr); 
+  arg4 = (unsigned int)jarg4; 
+  result = (bool)((KBTreeLib::KBFrozenTree const *)arg1)->writePatristicDistancesToFile((std::string const &)*arg2,(std::string const &)*arg3,arg4);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1writePatristicDistancesToFile_1_1SWIG_12(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jstring jarg3) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  if(!jarg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg3_pstr = (const char *)jenv->GetStringUTFChars(jarg3, 0); 
+  if (!arg3_pstr) return 0;
+  std::string arg3_str(arg3_pstr);
+  arg3 = &arg3_str;
+  jenv->ReleaseStringUTFChars(jarg3, arg3_pstr); 
+  result = (bool)((KBTreeLib::KBFrozenTree const *)arg1)->writePatristicDistancesToFile((std::string const &)*arg2,(std::string const &)*arg3);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1writePatristicDistancesToFile_1_1SWIG_13(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  std::string *arg2 = 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = (bool)((KBTreeLib::KBFrozenTree const *)arg1)->writePatristicDistancesToFile((std::string const &)*arg2);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1toNewick_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  result = ((KBTreeLib::KBFrozenTree const *)arg1)->toNewick();
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1toNewick_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jstring jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  unsigned int arg2 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  result = ((KBTreeLib::KBFrozenTree const *)arg1)->toNewick(arg2);
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1writeNewickToFile_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  std::string *arg2 = 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  if(!jarg2) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
     return 0;
   }
-  const char *arg1_pstr = (const char *)jenv->GetStringUTFChars(jarg1, 0); 
-  if (!arg1_pstr) return 0;
-  std::string arg1_str(arg1_pstr);
-  arg1 = &arg1_str;
-  jenv->ReleaseStringUTFChars(jarg1, arg1_pstr); 
-  result = (KBTreeLib::KBTree *)new KBTreeLib::KBTree((std::string const &)*arg1);
-  *(KBTreeLib::KBTree **)&jresult = result; 
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = (bool)((KBTreeLib::KBFrozenTree const *)arg1)->writeNewickToFile((std::string const &)*arg2);
+  jresult = (jboolean)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_new_1KBTree_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jstring jarg1, jboolean jarg2) {
-  jlong jresult = 0 ;
-  std::string *arg1 = 0 ;
-  bool arg2 ;
-  KBTreeLib::KBTree *result = 0 ;
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1writeNewickToFile_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jlong jarg3) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  std::string *arg2 = 0 ;
+  unsigned int arg3 ;
+  bool result;
   
   (void)jenv;
   (void)jcls;
-  if(!jarg1) {
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  if(!jarg2) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
     return 0;
   }
-  const char *arg1_pstr = (const char *)jenv->GetStringUTFChars(jarg1, 0); 
-  if (!arg1_pstr) return 0;
-  std::string arg1_str(arg1_pstr);
-  arg1 = &arg1_str;
-  jenv->ReleaseStringUTFChars(jarg1, arg1_pstr); 
-  arg2 = jarg2 ? true : false; 
-  result = (KBTreeLib::KBTree *)new KBTreeLib::KBTree((std::string const &)*arg1,arg2);
-  *(KBTreeLib::KBTree **)&jresult = result; 
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  arg3 = (unsigned int)jarg3; 
+  result = (bool)((KBTreeLib::KBFrozenTree const *)arg1)->writeNewickToFile((std::string const &)*arg2,arg3);
+  jresult = (jboolean)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_new_1KBTree_1_1SWIG_12(JNIEnv *jenv, jclass jcls, jstring jarg1, jboolean jarg2, jboolean jarg3) {
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1toKBTree(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  std::string *arg1 = 0 ;
-  bool arg2 ;
-  bool arg3 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
   KBTreeLib::KBTree *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  if(!jarg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
-    return 0;
-  }
-  const char *arg1_pstr = (const char *)jenv->GetStringUTFChars(jarg1, 0); 
-  if (!arg1_pstr) return 0;
-  std::string arg1_str(arg1_pstr);
-  arg1 = &arg1_str;
-  jenv->ReleaseStringUTFChars(jarg1, arg1_pstr); 
-  arg2 = jarg2 ? true : false; 
-  arg3 = jarg3 ? true : false; 
-  result = (KBTreeLib::KBTree *)new KBTreeLib::KBTree((std::string const &)*arg1,arg2,arg3);
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  result = (KBTreeLib::KBTree *)((KBTreeLib::KBFrozenTree const *)arg1)->toKBTree();
   *(KBTreeLib::KBTree **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_delete_1KBTree(JNIEnv *jenv, jclass jcls, jlong jarg1) {
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1removeNodesByNameAndSimplify(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  std::string *arg2 = 0 ;
+  SwigValueWrapper< KBTreeLib::KBFrozenTree > result;
   
   (void)jenv;
   (void)jcls;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  delete arg1;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  try {
+    result = ((KBTreeLib::KBFrozenTree const *)arg1)->removeNodesByNameAndSimplify((std::string const &)*arg2);
+  }
+  catch(KBTreeLib::ParseException &_e) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaRuntimeException, _e.what().c_str());
+    return 0;
+  }
+  *(KBTreeLib::KBFrozenTree **)&jresult = new KBTreeLib::KBFrozenTree((const KBTreeLib::KBFrozenTree &)result); 
+  return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1toNewick_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-  std::string result;
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBFrozenTree_1replaceNodeNames(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+  std::string *arg2 = 0 ;
+  SwigValueWrapper< KBTreeLib::KBFrozenTree > result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  result = (arg1)->toNewick();
-  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  arg1 = *(KBTreeLib::KBFrozenTree **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = ((KBTreeLib::KBFrozenTree const *)arg1)->replaceNodeNames((std::string const &)*arg2);
+  *(KBTreeLib::KBFrozenTree **)&jresult = new KBTreeLib::KBFrozenTree((const KBTreeLib::KBFrozenTree &)result); 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1setOutputFlagLabel(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-  bool arg2 ;
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_new_1KBTreeCache_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  jlong jresult = 0 ;
+  size_t arg1 ;
+  KBTreeLib::KBTreeCache *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  arg2 = jarg2 ? true : false; 
-  (arg1)->setOutputFlagLabel(arg2);
+  arg1 = (size_t)jarg1; 
+  result = (KBTreeLib::KBTreeCache *)new KBTreeLib::KBTreeCache(arg1);
+  *(KBTreeLib::KBTreeCache **)&jresult = result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1setOutputFlagDistances(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-  bool arg2 ;
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_new_1KBTreeCache_1_1SWIG_11(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTreeCache *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  arg2 = jarg2 ? true : false; 
-  (arg1)->setOutputFlagDistances(arg2);
+  result = (KBTreeLib::KBTreeCache *)new KBTreeLib::KBTreeCache();
+  *(KBTreeLib::KBTreeCache **)&jresult = result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1setOutputFlagComments(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-  bool arg2 ;
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_delete_1KBTreeCache(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  arg2 = jarg2 ? true : false; 
-  (arg1)->setOutputFlagComments(arg2);
+  arg1 = *(KBTreeLib::KBTreeCache **)&jarg1; 
+  delete arg1;
 }
 
 
-SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1setOutputFlagBootstrapValuesAsLabels(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-  bool arg2 ;
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCache_1getShared(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTreeCache *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  arg2 = jarg2 ? true : false; 
-  (arg1)->setOutputFlagBootstrapValuesAsLabels(arg2);
+  result = (KBTreeLib::KBTreeCache *) &KBTreeLib::KBTreeCache::getShared();
+  *(KBTreeLib::KBTreeCache **)&jresult = result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1toNewick_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
-  jstring jresult = 0 ;
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-  unsigned int arg2 ;
-  std::string result;
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCache_1get_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jboolean jarg3) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
+  std::string *arg2 = 0 ;
+  bool arg3 ;
+  SwigValueWrapper< KBTreeLib::KBFrozenTree > result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  arg2 = (unsigned int)jarg2; 
-  result = (arg1)->toNewick(arg2);
-  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  arg1 = *(KBTreeLib::KBTreeCache **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  arg3 = jarg3 ? true : false; 
+  result = (arg1)->get((std::string const &)*arg2,arg3);
+  *(KBTreeLib::KBFrozenTree **)&jresult = new KBTreeLib::KBFrozenTree((const KBTreeLib::KBFrozenTree &)result); 
   return jresult;
 }
 
 
-SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1writeNewickToFile_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
-  jboolean jresult = 0 ;
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCache_1get_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
   std::string *arg2 = 0 ;
-  bool result;
+  SwigValueWrapper< KBTreeLib::KBFrozenTree > result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  arg1 = *(KBTreeLib::KBTreeCache **)&jarg1; 
   if(!jarg2) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
     return 0;
@@ -437,23 +3275,23 @@ SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTre
   std::string arg2_str(arg2_pstr);
   arg2 = &arg2_str;
   jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
-  result = (bool)(arg1)->writeNewickToFile((std::string const &)*arg2);
-  jresult = (jboolean)result; 
+  result = (arg1)->get((std::string const &)*arg2);
+  *(KBTreeLib::KBFrozenTree **)&jresult = new KBTreeLib::KBFrozenTree((const KBTreeLib::KBFrozenTree &)result); 
   return jresult;
 }
 
 
-SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1writeNewickToFile_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jlong jarg3) {
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCache_1contains_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jboolean jarg3) {
   jboolean jresult = 0 ;
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
   std::string *arg2 = 0 ;
-  unsigned int arg3 ;
+  bool arg3 ;
   bool result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  arg1 = *(KBTreeLib::KBTreeCache **)&jarg1; 
   if(!jarg2) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
     return 0;
@@ -463,372 +3301,668 @@ SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTre
   std::string arg2_str(arg2_pstr);
   arg2 = &arg2_str;
   jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
-  arg3 = (unsigned int)jarg3; 
-  result = (bool)(arg1)->writeNewickToFile((std::string const &)*arg2,arg3);
+  arg3 = jarg3 ? true : false; 
+  result = (bool)((KBTreeLib::KBTreeCache const *)arg1)->contains((std::string const &)*arg2,arg3);
   jresult = (jboolean)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1removeNodesByNameAndSimplify(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCache_1contains_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
   std::string *arg2 = 0 ;
+  bool result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
+  arg1 = *(KBTreeLib::KBTreeCache **)&jarg1; 
   if(!jarg2) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
-    return ;
+    return 0;
   }
   const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
-  if (!arg2_pstr) return ;
+  if (!arg2_pstr) return 0;
   std::string arg2_str(arg2_pstr);
   arg2 = &arg2_str;
   jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
-  (arg1)->removeNodesByNameAndSimplify((std::string const &)*arg2);
+  result = (bool)((KBTreeLib::KBTreeCache const *)arg1)->contains((std::string const &)*arg2);
+  jresult = (jboolean)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1mergeZeroDistLeaves(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCache_1clear(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  (arg1)->mergeZeroDistLeaves();
+  arg1 = *(KBTreeLib::KBTreeCache **)&jarg1; 
+  (arg1)->clear();
 }
 
 
-SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1replaceNodeNames(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-  std::string *arg2 = 0 ;
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCache_1setMemoryBudget(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
+  size_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  if(!jarg2) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
-    return ;
-  }
-  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
-  if (!arg2_pstr) return ;
-  std::string arg2_str(arg2_pstr);
-  arg2 = &arg2_str;
-  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
-  (arg1)->replaceNodeNames((std::string const &)*arg2);
+  arg1 = *(KBTreeLib::KBTreeCache **)&jarg1; 
+  arg2 = (size_t)jarg2; 
+  (arg1)->setMemoryBudget(arg2);
 }
 
 
-SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1replaceNodeNamesOrMakeBlank(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-  std::string *arg2 = 0 ;
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCache_1getMemoryBudget(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
+  size_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  if(!jarg2) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
-    return ;
+  arg1 = *(KBTreeLib::KBTreeCache **)&jarg1; 
+  result = (size_t)((KBTreeLib::KBTreeCache const *)arg1)->getMemoryBudget();
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCache_1getMemoryUsage(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
+  size_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTreeCache **)&jarg1; 
+  result = (size_t)((KBTreeLib::KBTreeCache const *)arg1)->getMemoryUsage();
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCache_1getTreeCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
+  size_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTreeCache **)&jarg1; 
+  result = (size_t)((KBTreeLib::KBTreeCache const *)arg1)->getTreeCount();
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jobject JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCache_1getHitCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jobject jresult = 0 ;
+  KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
+  uint64_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTreeCache **)&jarg1; 
+  result = (uint64_t)((KBTreeLib::KBTreeCache const *)arg1)->getHitCount();
+  {
+    jbyteArray ba = jenv->NewByteArray(9);
+    jbyte* bae = jenv->GetByteArrayElements(ba, 0);
+    jclass clazz = jenv->FindClass("java/math/BigInteger");
+    jmethodID mid = jenv->GetMethodID(clazz, "<init>", "([B)V");
+    jobject bigint;
+    int i;
+
+    bae[0] = 0;
+    for(i=1; i<9; i++ ) {
+      bae[i] = (jbyte)(result>>8*(8-i));
+    }
+
+    jenv->ReleaseByteArrayElements(ba, bae, 0);
+    bigint = jenv->NewObject(clazz, mid, ba);
+    jresult = bigint;
   }
-  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
-  if (!arg2_pstr) return ;
-  std::string arg2_str(arg2_pstr);
-  arg2 = &arg2_str;
-  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
-  (arg1)->replaceNodeNamesOrMakeBlank((std::string const &)*arg2);
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1stripReservedCharsFromLabels(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+SWIGEXPORT jobject JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCache_1getMissCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jobject jresult = 0 ;
+  KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
+  uint64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  (arg1)->stripReservedCharsFromLabels();
+  arg1 = *(KBTreeLib::KBTreeCache **)&jarg1; 
+  result = (uint64_t)((KBTreeLib::KBTreeCache const *)arg1)->getMissCount();
+  {
+    jbyteArray ba = jenv->NewByteArray(9);
+    jbyte* bae = jenv->GetByteArrayElements(ba, 0);
+    jclass clazz = jenv->FindClass("java/math/BigInteger");
+    jmethodID mid = jenv->GetMethodID(clazz, "<init>", "([B)V");
+    jobject bigint;
+    int i;
+
+    bae[0] = 0;
+    for(i=1; i<9; i++ ) {
+      bae[i] = (jbyte)(result>>8*(8-i));
+    }
+
+    jenv->ReleaseByteArrayElements(ba, bae, 0);
+    bigint = jenv->NewObject(clazz, mid, ba);
+    jresult = bigint;
+  }
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1printTree(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+SWIGEXPORT jobject JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCache_1getEvictionCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jobject jresult = 0 ;
+  KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
+  uint64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  (arg1)->printTree();
+  arg1 = *(KBTreeLib::KBTreeCache **)&jarg1; 
+  result = (uint64_t)((KBTreeLib::KBTreeCache const *)arg1)->getEvictionCount();
+  {
+    jbyteArray ba = jenv->NewByteArray(9);
+    jbyte* bae = jenv->GetByteArrayElements(ba, 0);
+    jclass clazz = jenv->FindClass("java/math/BigInteger");
+    jmethodID mid = jenv->GetMethodID(clazz, "<init>", "([B)V");
+    jobject bigint;
+    int i;
+
+    bae[0] = 0;
+    for(i=1; i<9; i++ ) {
+      bae[i] = (jbyte)(result>>8*(8-i));
+    }
+
+    jenv->ReleaseByteArrayElements(ba, bae, 0);
+    bigint = jenv->NewObject(clazz, mid, ba);
+    jresult = bigint;
+  }
+  return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1printSimpleTreeToString(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-  std::string result;
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeCache_1resetCounters(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  result = (arg1)->printSimpleTreeToString();
-  jresult = jenv->NewStringUTF((&result)->c_str()); 
-  return jresult;
+  arg1 = *(KBTreeLib::KBTreeCache **)&jarg1; 
+  (arg1)->resetCounters();
 }
 
 
-SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1printTreeToString(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-  std::string result;
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_new_1KBTreeDiskCache_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jstring jarg1, jobject jarg2) {
+  jlong jresult = 0 ;
+  std::string *arg1 = 0 ;
+  uint64_t arg2 ;
+  KBTreeLib::KBTreeDiskCache *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  result = (arg1)->printTreeToString();
-  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  if(!jarg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg1_pstr = (const char *)jenv->GetStringUTFChars(jarg1, 0); 
+  if (!arg1_pstr) return 0;
+  std::string arg1_str(arg1_pstr);
+  arg1 = &arg1_str;
+  jenv->ReleaseStringUTFChars(jarg1, arg1_pstr); 
+  {
+    jclass clazz;
+    jmethodID mid;
+    jbyteArray ba;
+    jbyte* bae;
+    jsize sz;
+    int i;
+
+    if (!jarg2) {
+      SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "BigInteger null");
+      return 0;
+    }
+    clazz = jenv->GetObjectClass(jarg2);
+    mid = jenv->GetMethodID(clazz, "toByteArray", "()[B");
+    ba = (jbyteArray)jenv->CallObjectMethod(jarg2, mid);
+    bae = jenv->GetByteArrayElements(ba, 0);
+    sz = jenv->GetArrayLength(ba);
+    arg2 = 0;
+    for(i=0; i<sz; i++) {
+      arg2 = (arg2 << 8) | (uint64_t)(unsigned char)bae[i];
+    }
+    jenv->ReleaseByteArrayElements(ba, bae, 0);
+  }
+  result = (KBTreeLib::KBTreeDiskCache *)new KBTreeLib::KBTreeDiskCache((std::string const &)*arg1,arg2);
+  *(KBTreeLib::KBTreeDiskCache **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1getNodeCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_new_1KBTreeDiskCache_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jstring jarg1) {
   jlong jresult = 0 ;
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-  unsigned int result;
+  std::string *arg1 = 0 ;
+  KBTreeLib::KBTreeDiskCache *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  result = (unsigned int)((KBTreeLib::KBTree const *)arg1)->getNodeCount();
-  jresult = (jlong)result; 
+  if(!jarg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg1_pstr = (const char *)jenv->GetStringUTFChars(jarg1, 0); 
+  if (!arg1_pstr) return 0;
+  std::string arg1_str(arg1_pstr);
+  arg1 = &arg1_str;
+  jenv->ReleaseStringUTFChars(jarg1, arg1_pstr); 
+  result = (KBTreeLib::KBTreeDiskCache *)new KBTreeLib::KBTreeDiskCache((std::string const &)*arg1);
+  *(KBTreeLib::KBTreeDiskCache **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1getLeafCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-  unsigned int result;
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_delete_1KBTreeDiskCache(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  result = (unsigned int)(arg1)->getLeafCount();
-  jresult = (jlong)result; 
-  return jresult;
+  arg1 = *(KBTreeLib::KBTreeDiskCache **)&jarg1; 
+  delete arg1;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1getAllLeafNames(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-  std::string result;
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeDiskCache_1get_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jboolean jarg3) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+  std::string *arg2 = 0 ;
+  bool arg3 ;
+  KBTreeLib::KBTree *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  result = (arg1)->getAllLeafNames();
-  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  arg1 = *(KBTreeLib::KBTreeDiskCache **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  arg3 = jarg3 ? true : false; 
+  result = (KBTreeLib::KBTree *)(arg1)->get((std::string const &)*arg2,arg3);
+  *(KBTreeLib::KBTree **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1getAllNodeNames(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-  std::string result;
+SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeDiskCache_1get_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jlong jresult = 0 ;
+  KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+  std::string *arg2 = 0 ;
+  KBTreeLib::KBTree *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  result = (arg1)->getAllNodeNames();
-  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  arg1 = *(KBTreeLib::KBTreeDiskCache **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = (KBTreeLib::KBTree *)(arg1)->get((std::string const &)*arg2);
+  *(KBTreeLib::KBTree **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1resetBreadthFirstIterToRoot(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeDiskCache_1contains_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jboolean jarg3) {
+  jboolean jresult = 0 ;
+  KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+  std::string *arg2 = 0 ;
+  bool arg3 ;
+  bool result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  (arg1)->resetBreadthFirstIterToRoot();
+  arg1 = *(KBTreeLib::KBTreeDiskCache **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  arg3 = jarg3 ? true : false; 
+  result = (bool)((KBTreeLib::KBTreeDiskCache const *)arg1)->contains((std::string const &)*arg2,arg3);
+  jresult = (jboolean)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1breadthFirstIterNext(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeDiskCache_1contains_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
   jboolean jresult = 0 ;
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+  std::string *arg2 = 0 ;
   bool result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  result = (bool)(arg1)->breadthFirstIterNext();
+  arg1 = *(KBTreeLib::KBTreeDiskCache **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = (bool)((KBTreeLib::KBTreeDiskCache const *)arg1)->contains((std::string const &)*arg2);
   jresult = (jboolean)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1breadthFirstIterGetName_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeDiskCache_1getImagePath_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jboolean jarg3) {
   jstring jresult = 0 ;
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+  std::string *arg2 = 0 ;
+  bool arg3 ;
   std::string result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  result = (arg1)->breadthFirstIterGetName();
+  arg1 = *(KBTreeLib::KBTreeDiskCache **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  arg3 = jarg3 ? true : false; 
+  result = ((KBTreeLib::KBTreeDiskCache const *)arg1)->getImagePath((std::string const &)*arg2,arg3);
   jresult = jenv->NewStringUTF((&result)->c_str()); 
   return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1breadthFirstIterGetParentName_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeDiskCache_1getImagePath_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
   jstring jresult = 0 ;
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+  KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+  std::string *arg2 = 0 ;
   std::string result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  result = (arg1)->breadthFirstIterGetParentName();
+  arg1 = *(KBTreeLib::KBTreeDiskCache **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return 0;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  result = ((KBTreeLib::KBTreeDiskCache const *)arg1)->getImagePath((std::string const &)*arg2);
   jresult = jenv->NewStringUTF((&result)->c_str()); 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1breadthFirstIterMarkNode(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-  unsigned int result;
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeDiskCache_1trim(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  result = (unsigned int)(arg1)->breadthFirstIterMarkNode();
-  jresult = (jlong)result; 
-  return jresult;
+  arg1 = *(KBTreeLib::KBTreeDiskCache **)&jarg1; 
+  (arg1)->trim();
 }
 
 
-SWIGEXPORT jboolean JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1breadthFirstIterSetToNode(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
-  jboolean jresult = 0 ;
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-  unsigned int arg2 ;
-  bool result;
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeDiskCache_1clear(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  arg2 = (unsigned int)jarg2; 
-  result = (bool)(arg1)->breadthFirstIterSetToNode(arg2);
-  jresult = (jboolean)result; 
-  return jresult;
+  arg1 = *(KBTreeLib::KBTreeDiskCache **)&jarg1; 
+  (arg1)->clear();
 }
 
 
-SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1breadthFirstIterGetName_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
-  jstring jresult = 0 ;
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-  unsigned int arg2 ;
-  std::string result;
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeDiskCache_1setSizeLimit(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jobject jarg2) {
+  KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+  uint64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  arg2 = (unsigned int)jarg2; 
-  result = (arg1)->breadthFirstIterGetName(arg2);
-  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  arg1 = *(KBTreeLib::KBTreeDiskCache **)&jarg1; 
+  {
+    jclass clazz;
+    jmethodID mid;
+    jbyteArray ba;
+    jbyte* bae;
+    jsize sz;
+    int i;
+
+    if (!jarg2) {
+      SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "BigInteger null");
+      return ;
+    }
+    clazz = jenv->GetObjectClass(jarg2);
+    mid = jenv->GetMethodID(clazz, "toByteArray", "()[B");
+    ba = (jbyteArray)jenv->CallObjectMethod(jarg2, mid);
+    bae = jenv->GetByteArrayElements(ba, 0);
+    sz = jenv->GetArrayLength(ba);
+    arg2 = 0;
+    for(i=0; i<sz; i++) {
+      arg2 = (arg2 << 8) | (uint64_t)(unsigned char)bae[i];
+    }
+    jenv->ReleaseByteArrayElements(ba, bae, 0);
+  }
+  (arg1)->setSizeLimit(arg2);
+}
+
+
+SWIGEXPORT jobject JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeDiskCache_1getSizeLimit(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jobject jresult = 0 ;
+  KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+  uint64_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTreeDiskCache **)&jarg1; 
+  result = (uint64_t)((KBTreeLib::KBTreeDiskCache const *)arg1)->getSizeLimit();
+  {
+    jbyteArray ba = jenv->NewByteArray(9);
+    jbyte* bae = jenv->GetByteArrayElements(ba, 0);
+    jclass clazz = jenv->FindClass("java/math/BigInteger");
+    jmethodID mid = jenv->GetMethodID(clazz, "<init>", "([B)V");
+    jobject bigint;
+    int i;
+
+    bae[0] = 0;
+    for(i=1; i<9; i++ ) {
+      bae[i] = (jbyte)(result>>8*(8-i));
+    }
+
+    jenv->ReleaseByteArrayElements(ba, bae, 0);
+    bigint = jenv->NewObject(clazz, mid, ba);
+    jresult = bigint;
+  }
   return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1breadthFirstIterGetPathToRoot(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
-  jstring jresult = 0 ;
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-  unsigned int arg2 ;
-  std::string result;
+SWIGEXPORT jobject JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeDiskCache_1getDiskUsage(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jobject jresult = 0 ;
+  KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+  uint64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  arg2 = (unsigned int)jarg2; 
-  result = (arg1)->breadthFirstIterGetPathToRoot(arg2);
-  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  arg1 = *(KBTreeLib::KBTreeDiskCache **)&jarg1; 
+  result = (uint64_t)((KBTreeLib::KBTreeDiskCache const *)arg1)->getDiskUsage();
+  {
+    jbyteArray ba = jenv->NewByteArray(9);
+    jbyte* bae = jenv->GetByteArrayElements(ba, 0);
+    jclass clazz = jenv->FindClass("java/math/BigInteger");
+    jmethodID mid = jenv->GetMethodID(clazz, "<init>", "([B)V");
+    jobject bigint;
+    int i;
+
+    bae[0] = 0;
+    for(i=1; i<9; i++ ) {
+      bae[i] = (jbyte)(result>>8*(8-i));
+    }
+
+    jenv->ReleaseByteArrayElements(ba, bae, 0);
+    bigint = jenv->NewObject(clazz, mid, ba);
+    jresult = bigint;
+  }
   return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1breadthFirstIterGetParentName_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
-  jstring jresult = 0 ;
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-  unsigned int arg2 ;
-  std::string result;
+SWIGEXPORT jobject JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeDiskCache_1getHitCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jobject jresult = 0 ;
+  KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+  uint64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  arg2 = (unsigned int)jarg2; 
-  result = (arg1)->breadthFirstIterGetParentName(arg2);
-  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  arg1 = *(KBTreeLib::KBTreeDiskCache **)&jarg1; 
+  result = (uint64_t)((KBTreeLib::KBTreeDiskCache const *)arg1)->getHitCount();
+  {
+    jbyteArray ba = jenv->NewByteArray(9);
+    jbyte* bae = jenv->GetByteArrayElements(ba, 0);
+    jclass clazz = jenv->FindClass("java/math/BigInteger");
+    jmethodID mid = jenv->GetMethodID(clazz, "<init>", "([B)V");
+    jobject bigint;
+    int i;
+
+    bae[0] = 0;
+    for(i=1; i<9; i++ ) {
+      bae[i] = (jbyte)(result>>8*(8-i));
+    }
+
+    jenv->ReleaseByteArrayElements(ba, bae, 0);
+    bigint = jenv->NewObject(clazz, mid, ba);
+    jresult = bigint;
+  }
   return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1breadthFirstIterGetAllChildrenNames(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
-  jstring jresult = 0 ;
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-  unsigned int arg2 ;
-  std::string result;
+SWIGEXPORT jobject JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeDiskCache_1getMissCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jobject jresult = 0 ;
+  KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+  uint64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  arg2 = (unsigned int)jarg2; 
-  result = (arg1)->breadthFirstIterGetAllChildrenNames(arg2);
-  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  arg1 = *(KBTreeLib::KBTreeDiskCache **)&jarg1; 
+  result = (uint64_t)((KBTreeLib::KBTreeDiskCache const *)arg1)->getMissCount();
+  {
+    jbyteArray ba = jenv->NewByteArray(9);
+    jbyte* bae = jenv->GetByteArrayElements(ba, 0);
+    jclass clazz = jenv->FindClass("java/math/BigInteger");
+    jmethodID mid = jenv->GetMethodID(clazz, "<init>", "([B)V");
+    jobject bigint;
+    int i;
+
+    bae[0] = 0;
+    for(i=1; i<9; i++ ) {
+      bae[i] = (jbyte)(result>>8*(8-i));
+    }
+
+    jenv->ReleaseByteArrayElements(ba, bae, 0);
+    bigint = jenv->NewObject(clazz, mid, ba);
+    jresult = bigint;
+  }
   return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTree_1breadthFirstIterGetAllDescendantNames(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
-  jstring jresult = 0 ;
-  KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-  unsigned int arg2 ;
-  std::string result;
+SWIGEXPORT jobject JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeDiskCache_1getEvictionCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jobject jresult = 0 ;
+  KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+  uint64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(KBTreeLib::KBTree **)&jarg1; 
-  arg2 = (unsigned int)jarg2; 
-  result = (arg1)->breadthFirstIterGetAllDescendantNames(arg2);
-  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  arg1 = *(KBTreeLib::KBTreeDiskCache **)&jarg1; 
+  result = (uint64_t)((KBTreeLib::KBTreeDiskCache const *)arg1)->getEvictionCount();
+  {
+    jbyteArray ba = jenv->NewByteArray(9);
+    jbyte* bae = jenv->GetByteArrayElements(ba, 0);
+    jclass clazz = jenv->FindClass("java/math/BigInteger");
+    jmethodID mid = jenv->GetMethodID(clazz, "<init>", "([B)V");
+    jobject bigint;
+    int i;
+
+    bae[0] = 0;
+    for(i=1; i<9; i++ ) {
+      bae[i] = (jbyte)(result>>8*(8-i));
+    }
+
+    jenv->ReleaseByteArrayElements(ba, bae, 0);
+    bigint = jenv->NewObject(clazz, mid, ba);
+    jresult = bigint;
+  }
   return jresult;
 }
 
 
+SWIGEXPORT void JNICALL Java_us_kbase_kbasetrees_cpputil_KBTreeUtilJNI_KBTreeDiskCache_1resetCounters(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(KBTreeLib::KBTreeDiskCache **)&jarg1; 
+  (arg1)->resetCounters();
+}
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -1514,10 +1514,16 @@ SWIG_Perl_SetModule(swig_module_info *module) {
 
 /* -------- TYPES TABLE (BEGIN) -------- */
 
-#define SWIGTYPE_p_KBTreeLib__KBTree swig_types[0]
-#define SWIGTYPE_p_char swig_types[1]
-static swig_type_info *swig_types[3];
-static swig_module_info swig_module = {swig_types, 2, 0, 0, 0, 0};
+#define SWIGTYPE_p_KBTreeLib__KBAncestorIndex swig_types[0]
+#define SWIGTYPE_p_KBTreeLib__KBFrozenTree swig_types[1]
+#define SWIGTYPE_p_KBTreeLib__KBTree swig_types[2]
+#define SWIGTYPE_p_KBTreeLib__KBTreeCache swig_types[3]
+#define SWIGTYPE_p_KBTreeLib__KBTreeCursor swig_types[4]
+#define SWIGTYPE_p_KBTreeLib__KBTreeDiskCache swig_types[5]
+#define SWIGTYPE_p_KBTreeLib__KBTreeStatistics swig_types[6]
+#define SWIGTYPE_p_char swig_types[7]
+static swig_type_info *swig_types[9];
+static swig_module_info swig_module = {swig_types, 8, 0, 0, 0, 0};
 #define SWIG_TypeQuery(name) SWIG_TypeQueryModule(&swig_module, &swig_module, name)
 #define SWIG_MangledTypeQuery(name) SWIG_MangledTypeQueryModule(&swig_module, &swig_module, name)
 
@@ -1580,6 +1586,11 @@ void SwigSvFromString(SV* sv, const std::string& s) {
 
 
 #include "kbtree/kbtree.hh"
+#include "kbtree/kbancestor.hh"
+#include "kbtree/kbcursor.hh"
+#include "kbtree/kbfrozen.hh"
+#include "kbtree/kbcache.hh"
+#include "kbtree/kbdiskcache.hh"
 std::string translateToProt(const std::string &dna);
 
 
@@ -1869,6 +1880,175 @@ SWIG_From_unsigned_SS_int  SWIG_PERL_DECL_ARGS_1(unsigned int value)
   return SWIG_From_unsigned_SS_long  SWIG_PERL_CALL_ARGS_1(value);
 }
 
+
+SWIGINTERN int
+SWIG_AsVal_long SWIG_PERL_DECL_ARGS_2(SV *obj, long* val)
+{
+  if (SvUOK(obj)) {
+    UV v = SvUV(obj);
+    if (v <= LONG_MAX) {
+      if (val) *val = v;
+      return SWIG_OK;
+    }
+    return SWIG_OverflowError;
+  } else if (SvIOK(obj)) {
+    IV v = SvIV(obj);
+    if (v >= LONG_MIN && v <= LONG_MAX) {
+      if(val) *val = v;
+      return SWIG_OK;
+    }
+    return SWIG_OverflowError;
+  } else {
+    int dispatch = 0;
+    const char *nptr = SvPV_nolen(obj);
+    if (nptr) {
+      char *endptr;
+      long v;
+      errno = 0;
+      v = strtol(nptr, &endptr,0);
+      if (errno == ERANGE) {
+	errno = 0;
+	return SWIG_OverflowError;
+      } else {
+	if (*endptr == '\0') {
+	  if (val) *val = v;
+	  return SWIG_Str2NumCast(SWIG_OK);
+	}
+      }
+    }
+    if (!dispatch) {
+      double d;
+      int res = SWIG_AddCast(SWIG_AsVal_double SWIG_PERL_CALL_ARGS_2(obj,&d));
+      if (SWIG_IsOK(res) && SWIG_CanCastAsInteger(&d, LONG_MIN, LONG_MAX)) {
+	if (val) *val = (long)(d);
+	return res;
+      }
+    }
+  }
+  return SWIG_TypeError;
+}
+
+
+SWIGINTERN int
+SWIG_AsVal_int SWIG_PERL_DECL_ARGS_2(SV * obj, int *val)
+{
+  long v;
+  int res = SWIG_AsVal_long SWIG_PERL_CALL_ARGS_2(obj, &v);
+  if (SWIG_IsOK(res)) {
+    if ((v < INT_MIN || v > INT_MAX)) {
+      return SWIG_OverflowError;
+    } else {
+      if (val) *val = static_cast< int >(v);
+    }
+  }
+  return res;
+}
+
+
+SWIGINTERNINLINE SV *
+SWIG_From_long  SWIG_PERL_DECL_ARGS_1(long value)
+{
+  SV *sv;
+  if (value >= IV_MIN && value <= IV_MAX)
+    sv = newSViv(value);
+  else
+    sv = newSVpvf("%ld", value);
+  return sv_2mortal(sv);
+}
+
+
+SWIGINTERNINLINE SV *
+SWIG_From_int  SWIG_PERL_DECL_ARGS_1(int value)
+{
+  return SWIG_From_long  SWIG_PERL_CALL_ARGS_1(value);
+}
+
+
+SWIGINTERNINLINE SV *
+SWIG_From_double  SWIG_PERL_DECL_ARGS_1(double value)
+{
+  return sv_2mortal(newSVnv(value));
+}
+
+
+SWIGINTERNINLINE SV *
+SWIG_From_size_t  SWIG_PERL_DECL_ARGS_1(size_t value)
+{
+  return SWIG_From_unsigned_SS_long  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned long >(value));
+}
+
+
+SWIGINTERNINLINE int
+SWIG_AsVal_size_t SWIG_PERL_DECL_ARGS_2(SV * obj, size_t *val)
+{
+  unsigned long v;
+  int res = SWIG_AsVal_unsigned_SS_long SWIG_PERL_CALL_ARGS_2(obj, val ? &v : 0);
+  if (SWIG_IsOK(res) && val) *val = static_cast< size_t >(v);
+  return res;
+}
+
+
+SWIGINTERN int
+SWIG_AsVal_unsigned_SS_long_SS_long SWIG_PERL_DECL_ARGS_2(SV *obj, unsigned long long *val)
+{
+  if (SvUOK(obj)) {
+    if (val) *val = SvUV(obj);
+    return SWIG_OK;
+  } else  if (SvIOK(obj)) {
+    IV v = SvIV(obj);
+    if (v >= 0 && v <= ULLONG_MAX) {
+      if (val) *val = v;
+      return SWIG_OK;
+    } else {
+      return SWIG_OverflowError;
+    }
+  } else {
+    int dispatch = 0;
+    const char *nptr = SvPV_nolen(obj);
+    if (nptr) {
+      char *endptr;
+      unsigned long long v;
+      errno = 0;
+      v = strtoull(nptr, &endptr,0);
+      if (errno == ERANGE) {
+	errno = 0;
+	return SWIG_OverflowError;
+      } else {
+	if (*endptr == '\0') {
+	  if (val) *val = v;
+	  return SWIG_Str2NumCast(SWIG_OK);
+	}
+      }
+    }
+    if (!dispatch) {
+      const double mant_max = 1LL << DBL_MANT_DIG;
+      double d;
+      int res = SWIG_AddCast(SWIG_AsVal_double SWIG_PERL_CALL_ARGS_2(obj,&d));
+      if (SWIG_IsOK(res) && SWIG_CanCastAsInteger(&d, 0, mant_max)) {
+	if (val) *val = (unsigned long long)(d);
+	return res;
+      }
+    }
+  }
+  return SWIG_TypeError;
+}
+
+
+SWIGINTERNINLINE SV *
+SWIG_From_unsigned_SS_long_SS_long  SWIG_PERL_DECL_ARGS_1(unsigned long long value)
+{
+  SV *sv;
+  if (value <= UV_MAX)
+    sv = newSVuv((UV)(value));
+  else {
+    //sv = newSVpvf("%llu", value); doesn't work in non 64bit Perl
+    char temp[256];
+    sprintf(temp, "%llu", value);
+    sv = newSVpv(temp, 0);
+  }
+  return sv_2mortal(sv);
+}
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -1931,190 +2111,6967 @@ XS(_wrap_translateToProt) {
 }
 
 
-XS(_wrap_new_KBTree__SWIG_0) {
+XS(_wrap_KBTreeStatistics_getNodeCount) {
   {
-    std::string *arg1 = 0 ;
-    int res1 = SWIG_OLDOBJ ;
+    KBTreeLib::KBTreeStatistics *arg1 = (KBTreeLib::KBTreeStatistics *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
     int argvi = 0;
-    KBTreeLib::KBTree *result = 0 ;
+    unsigned int result;
     dXSARGS;
     
     if ((items < 1) || (items > 1)) {
-      SWIG_croak("Usage: new_KBTree(newickString);");
+      SWIG_croak("Usage: KBTreeStatistics_getNodeCount(self);");
     }
-    {
-      std::string *ptr = (std::string *)0;
-      res1 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), &ptr);
-      if (!SWIG_IsOK(res1)) {
-        SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_KBTree" "', argument " "1"" of type '" "std::string const &""'"); 
-      }
-      if (!ptr) {
-        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_KBTree" "', argument " "1"" of type '" "std::string const &""'"); 
-      }
-      arg1 = ptr;
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeStatistics, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeStatistics_getNodeCount" "', argument " "1"" of type '" "KBTreeLib::KBTreeStatistics const *""'"); 
     }
-    result = (KBTreeLib::KBTree *)new KBTreeLib::KBTree((std::string const &)*arg1);
-    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTree, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
-    if (SWIG_IsNewObj(res1)) delete arg1;
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeStatistics * >(argp1);
+    result = (unsigned int)((KBTreeLib::KBTreeStatistics const *)arg1)->getNodeCount();
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
     XSRETURN(argvi);
   fail:
-    if (SWIG_IsNewObj(res1)) delete arg1;
+    
     SWIG_croak_null();
   }
 }
 
 
-XS(_wrap_new_KBTree__SWIG_1) {
+XS(_wrap_KBTreeStatistics_getLeafCount) {
   {
-    std::string *arg1 = 0 ;
-    bool arg2 ;
-    int res1 = SWIG_OLDOBJ ;
-    bool val2 ;
-    int ecode2 = 0 ;
+    KBTreeLib::KBTreeStatistics *arg1 = (KBTreeLib::KBTreeStatistics *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
     int argvi = 0;
-    KBTreeLib::KBTree *result = 0 ;
+    unsigned int result;
     dXSARGS;
     
-    if ((items < 2) || (items > 2)) {
-      SWIG_croak("Usage: new_KBTree(newickString,verbose);");
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTreeStatistics_getLeafCount(self);");
     }
-    {
-      std::string *ptr = (std::string *)0;
-      res1 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), &ptr);
-      if (!SWIG_IsOK(res1)) {
-        SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_KBTree" "', argument " "1"" of type '" "std::string const &""'"); 
-      }
-      if (!ptr) {
-        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_KBTree" "', argument " "1"" of type '" "std::string const &""'"); 
-      }
-      arg1 = ptr;
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeStatistics, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeStatistics_getLeafCount" "', argument " "1"" of type '" "KBTreeLib::KBTreeStatistics const *""'"); 
     }
-    ecode2 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
-    if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_KBTree" "', argument " "2"" of type '" "bool""'");
-    } 
-    arg2 = static_cast< bool >(val2);
-    result = (KBTreeLib::KBTree *)new KBTreeLib::KBTree((std::string const &)*arg1,arg2);
-    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTree, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
-    if (SWIG_IsNewObj(res1)) delete arg1;
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeStatistics * >(argp1);
+    result = (unsigned int)((KBTreeLib::KBTreeStatistics const *)arg1)->getLeafCount();
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTreeStatistics_getMaxDepth) {
+  {
+    KBTreeLib::KBTreeStatistics *arg1 = (KBTreeLib::KBTreeStatistics *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTreeStatistics_getMaxDepth(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeStatistics, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeStatistics_getMaxDepth" "', argument " "1"" of type '" "KBTreeLib::KBTreeStatistics const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeStatistics * >(argp1);
+    result = (unsigned int)((KBTreeLib::KBTreeStatistics const *)arg1)->getMaxDepth();
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTreeStatistics_hasBranchLengths) {
+  {
+    KBTreeLib::KBTreeStatistics *arg1 = (KBTreeLib::KBTreeStatistics *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTreeStatistics_hasBranchLengths(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeStatistics, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeStatistics_hasBranchLengths" "', argument " "1"" of type '" "KBTreeLib::KBTreeStatistics const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeStatistics * >(argp1);
+    result = (bool)((KBTreeLib::KBTreeStatistics const *)arg1)->hasBranchLengths();
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTreeStatistics_hasBootstrapValues) {
+  {
+    KBTreeLib::KBTreeStatistics *arg1 = (KBTreeLib::KBTreeStatistics *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTreeStatistics_hasBootstrapValues(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeStatistics, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeStatistics_hasBootstrapValues" "', argument " "1"" of type '" "KBTreeLib::KBTreeStatistics const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeStatistics * >(argp1);
+    result = (bool)((KBTreeLib::KBTreeStatistics const *)arg1)->hasBootstrapValues();
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_new_KBTreeStatistics) {
+  {
+    int argvi = 0;
+    KBTreeLib::KBTreeStatistics *result = 0 ;
+    dXSARGS;
+    
+    if ((items < 0) || (items > 0)) {
+      SWIG_croak("Usage: new_KBTreeStatistics();");
+    }
+    result = (KBTreeLib::KBTreeStatistics *)new KBTreeLib::KBTreeStatistics();
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTreeStatistics, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    XSRETURN(argvi);
+  fail:
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_delete_KBTreeStatistics) {
+  {
+    KBTreeLib::KBTreeStatistics *arg1 = (KBTreeLib::KBTreeStatistics *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: delete_KBTreeStatistics(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeStatistics, SWIG_POINTER_DISOWN |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_KBTreeStatistics" "', argument " "1"" of type '" "KBTreeLib::KBTreeStatistics *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeStatistics * >(argp1);
+    delete arg1;
+    ST(argvi) = sv_newmortal();
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_new_KBTree__SWIG_0) {
+  {
+    std::string *arg1 = 0 ;
+    int res1 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    KBTreeLib::KBTree *result = 0 ;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: new_KBTree(newickString);");
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res1 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), &ptr);
+      if (!SWIG_IsOK(res1)) {
+        SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_KBTree" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_KBTree" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      arg1 = ptr;
+    }
+    result = (KBTreeLib::KBTree *)new KBTreeLib::KBTree((std::string const &)*arg1);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTree, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    XSRETURN(argvi);
+  fail:
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_new_KBTree__SWIG_1) {
+  {
+    std::string *arg1 = 0 ;
+    bool arg2 ;
+    int res1 = SWIG_OLDOBJ ;
+    bool val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    KBTreeLib::KBTree *result = 0 ;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: new_KBTree(newickString,verbose);");
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res1 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), &ptr);
+      if (!SWIG_IsOK(res1)) {
+        SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_KBTree" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_KBTree" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      arg1 = ptr;
+    }
+    ecode2 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_KBTree" "', argument " "2"" of type '" "bool""'");
+    } 
+    arg2 = static_cast< bool >(val2);
+    result = (KBTreeLib::KBTree *)new KBTreeLib::KBTree((std::string const &)*arg1,arg2);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTree, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    
+    XSRETURN(argvi);
+  fail:
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_new_KBTree__SWIG_2) {
+  {
+    std::string *arg1 = 0 ;
+    bool arg2 ;
+    bool arg3 ;
+    int res1 = SWIG_OLDOBJ ;
+    bool val2 ;
+    int ecode2 = 0 ;
+    bool val3 ;
+    int ecode3 = 0 ;
+    int argvi = 0;
+    KBTreeLib::KBTree *result = 0 ;
+    dXSARGS;
+    
+    if ((items < 3) || (items > 3)) {
+      SWIG_croak("Usage: new_KBTree(newickString,verbose,assumeBootstrapNames);");
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res1 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), &ptr);
+      if (!SWIG_IsOK(res1)) {
+        SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_KBTree" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_KBTree" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      arg1 = ptr;
+    }
+    ecode2 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_KBTree" "', argument " "2"" of type '" "bool""'");
+    } 
+    arg2 = static_cast< bool >(val2);
+    ecode3 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "new_KBTree" "', argument " "3"" of type '" "bool""'");
+    } 
+    arg3 = static_cast< bool >(val3);
+    result = (KBTreeLib::KBTree *)new KBTreeLib::KBTree((std::string const &)*arg1,arg2,arg3);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTree, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_new_KBTree__SWIG_3) {
+  {
+    std::string *arg1 = 0 ;
+    bool arg2 ;
+    bool arg3 ;
+    unsigned int arg4 ;
+    bool arg5 ;
+    bool arg6 ;
+    int res1 = SWIG_OLDOBJ ;
+    bool val2 ;
+    int ecode2 = 0 ;
+    bool val3 ;
+    int ecode3 = 0 ;
+    unsigned int val4 ;
+    int ecode4 = 0 ;
+    bool val5 ;
+    int ecode5 = 0 ;
+    bool val6 ;
+    int ecode6 = 0 ;
+    int argvi = 0;
+    KBTreeLib::KBTree *result = 0 ;
+    dXSARGS;
+    
+    if ((items < 6) || (items > 6)) {
+      SWIG_croak("Usage: new_KBTree(newickString,verbose,assumeBootstrapNames,threadCount,lazyLabels,keepOriginalLabels);");
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res1 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), &ptr);
+      if (!SWIG_IsOK(res1)) {
+        SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_KBTree" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_KBTree" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      arg1 = ptr;
+    }
+    ecode2 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_KBTree" "', argument " "2"" of type '" "bool""'");
+    } 
+    arg2 = static_cast< bool >(val2);
+    ecode3 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "new_KBTree" "', argument " "3"" of type '" "bool""'");
+    } 
+    arg3 = static_cast< bool >(val3);
+    ecode4 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(3), &val4);
+    if (!SWIG_IsOK(ecode4)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "new_KBTree" "', argument " "4"" of type '" "unsigned int""'");
+    } 
+    arg4 = static_cast< unsigned int >(val4);
+    ecode5 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(4), &val5);
+    if (!SWIG_IsOK(ecode5)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode5), "in method '" "new_KBTree" "', argument " "5"" of type '" "bool""'");
+    } 
+    arg5 = static_cast< bool >(val5);
+    ecode6 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(5), &val6);
+    if (!SWIG_IsOK(ecode6)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode6), "in method '" "new_KBTree" "', argument " "6"" of type '" "bool""'");
+    } 
+    arg6 = static_cast< bool >(val6);
+    result = (KBTreeLib::KBTree *)new KBTreeLib::KBTree((std::string const &)*arg1,arg2,arg3,arg4,arg5,arg6);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTree, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    
+    
+    
+    
+    
+    XSRETURN(argvi);
+  fail:
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    
+    
+    
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_new_KBTree__SWIG_4) {
+  {
+    std::string *arg1 = 0 ;
+    bool arg2 ;
+    bool arg3 ;
+    unsigned int arg4 ;
+    bool arg5 ;
+    int res1 = SWIG_OLDOBJ ;
+    bool val2 ;
+    int ecode2 = 0 ;
+    bool val3 ;
+    int ecode3 = 0 ;
+    unsigned int val4 ;
+    int ecode4 = 0 ;
+    bool val5 ;
+    int ecode5 = 0 ;
+    int argvi = 0;
+    KBTreeLib::KBTree *result = 0 ;
+    dXSARGS;
+    
+    if ((items < 5) || (items > 5)) {
+      SWIG_croak("Usage: new_KBTree(newickString,verbose,assumeBootstrapNames,threadCount,lazyLabels);");
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res1 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), &ptr);
+      if (!SWIG_IsOK(res1)) {
+        SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_KBTree" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_KBTree" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      arg1 = ptr;
+    }
+    ecode2 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_KBTree" "', argument " "2"" of type '" "bool""'");
+    } 
+    arg2 = static_cast< bool >(val2);
+    ecode3 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "new_KBTree" "', argument " "3"" of type '" "bool""'");
+    } 
+    arg3 = static_cast< bool >(val3);
+    ecode4 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(3), &val4);
+    if (!SWIG_IsOK(ecode4)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "new_KBTree" "', argument " "4"" of type '" "unsigned int""'");
+    } 
+    arg4 = static_cast< unsigned int >(val4);
+    ecode5 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(4), &val5);
+    if (!SWIG_IsOK(ecode5)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode5), "in method '" "new_KBTree" "', argument " "5"" of type '" "bool""'");
+    } 
+    arg5 = static_cast< bool >(val5);
+    result = (KBTreeLib::KBTree *)new KBTreeLib::KBTree((std::string const &)*arg1,arg2,arg3,arg4,arg5);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTree, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    
+    
+    
+    
+    XSRETURN(argvi);
+  fail:
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    
+    
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_new_KBTree__SWIG_5) {
+  {
+    std::string *arg1 = 0 ;
+    bool arg2 ;
+    bool arg3 ;
+    unsigned int arg4 ;
+    int res1 = SWIG_OLDOBJ ;
+    bool val2 ;
+    int ecode2 = 0 ;
+    bool val3 ;
+    int ecode3 = 0 ;
+    unsigned int val4 ;
+    int ecode4 = 0 ;
+    int argvi = 0;
+    KBTreeLib::KBTree *result = 0 ;
+    dXSARGS;
+    
+    if ((items < 4) || (items > 4)) {
+      SWIG_croak("Usage: new_KBTree(newickString,verbose,assumeBootstrapNames,threadCount);");
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res1 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), &ptr);
+      if (!SWIG_IsOK(res1)) {
+        SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_KBTree" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_KBTree" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      arg1 = ptr;
+    }
+    ecode2 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_KBTree" "', argument " "2"" of type '" "bool""'");
+    } 
+    arg2 = static_cast< bool >(val2);
+    ecode3 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "new_KBTree" "', argument " "3"" of type '" "bool""'");
+    } 
+    arg3 = static_cast< bool >(val3);
+    ecode4 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(3), &val4);
+    if (!SWIG_IsOK(ecode4)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "new_KBTree" "', argument " "4"" of type '" "unsigned int""'");
+    } 
+    arg4 = static_cast< unsigned int >(val4);
+    result = (KBTreeLib::KBTree *)new KBTreeLib::KBTree((std::string const &)*arg1,arg2,arg3,arg4);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTree, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    
+    
+    
+    XSRETURN(argvi);
+  fail:
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_new_KBTree) {
+  dXSARGS;
+  
+  {
+    unsigned long _index = 0;
+    SWIG_TypeRank _rank = 0; 
+    if (items == 1) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 1;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_1:
+    
+    if (items == 2) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 2;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_2:
+    
+    if (items == 3) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_3;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_3;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_3;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 3;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_3:
+    
+    if (items == 4) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_4;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_4;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_4;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(3), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_4;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 4;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_4:
+    
+    if (items == 5) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_5;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_5;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_5;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(3), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_5;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(4), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_5;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 5;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_5:
+    
+    if (items == 6) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_6;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_6;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_6;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(3), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_6;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(4), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_6;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(5), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_6;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 6;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_6:
+    
+  dispatch:
+    switch(_index) {
+    case 1:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_new_KBTree__SWIG_0); return;
+    case 2:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_new_KBTree__SWIG_1); return;
+    case 3:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_new_KBTree__SWIG_2); return;
+    case 4:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_new_KBTree__SWIG_5); return;
+    case 5:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_new_KBTree__SWIG_4); return;
+    case 6:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_new_KBTree__SWIG_3); return;
+    }
+  }
+  
+  croak("No matching function for overloaded 'new_KBTree'");
+  XSRETURN(0);
+}
+
+
+XS(_wrap_delete_KBTree) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: delete_KBTree(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, SWIG_POINTER_DISOWN |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_KBTree" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    delete arg1;
+    ST(argvi) = sv_newmortal();
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_fromFile__SWIG_0) {
+  {
+    std::string *arg1 = 0 ;
+    bool arg2 ;
+    bool arg3 ;
+    unsigned int arg4 ;
+    bool arg5 ;
+    bool arg6 ;
+    int res1 = SWIG_OLDOBJ ;
+    bool val2 ;
+    int ecode2 = 0 ;
+    bool val3 ;
+    int ecode3 = 0 ;
+    unsigned int val4 ;
+    int ecode4 = 0 ;
+    bool val5 ;
+    int ecode5 = 0 ;
+    bool val6 ;
+    int ecode6 = 0 ;
+    int argvi = 0;
+    KBTreeLib::KBTree *result = 0 ;
+    dXSARGS;
+    
+    if ((items < 6) || (items > 6)) {
+      SWIG_croak("Usage: KBTree_fromFile(filename,verbose,assumeBootstrapNames,threadCount,lazyLabels,keepOriginalLabels);");
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res1 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), &ptr);
+      if (!SWIG_IsOK(res1)) {
+        SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_fromFile" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_fromFile" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      arg1 = ptr;
+    }
+    ecode2 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_fromFile" "', argument " "2"" of type '" "bool""'");
+    } 
+    arg2 = static_cast< bool >(val2);
+    ecode3 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "KBTree_fromFile" "', argument " "3"" of type '" "bool""'");
+    } 
+    arg3 = static_cast< bool >(val3);
+    ecode4 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(3), &val4);
+    if (!SWIG_IsOK(ecode4)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "KBTree_fromFile" "', argument " "4"" of type '" "unsigned int""'");
+    } 
+    arg4 = static_cast< unsigned int >(val4);
+    ecode5 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(4), &val5);
+    if (!SWIG_IsOK(ecode5)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode5), "in method '" "KBTree_fromFile" "', argument " "5"" of type '" "bool""'");
+    } 
+    arg5 = static_cast< bool >(val5);
+    ecode6 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(5), &val6);
+    if (!SWIG_IsOK(ecode6)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode6), "in method '" "KBTree_fromFile" "', argument " "6"" of type '" "bool""'");
+    } 
+    arg6 = static_cast< bool >(val6);
+    result = (KBTreeLib::KBTree *)KBTreeLib::KBTree::fromFile((std::string const &)*arg1,arg2,arg3,arg4,arg5,arg6);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTree, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    
+    
+    
+    
+    
+    XSRETURN(argvi);
+  fail:
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    
+    
+    
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_fromFile__SWIG_1) {
+  {
+    std::string *arg1 = 0 ;
+    bool arg2 ;
+    bool arg3 ;
+    unsigned int arg4 ;
+    bool arg5 ;
+    int res1 = SWIG_OLDOBJ ;
+    bool val2 ;
+    int ecode2 = 0 ;
+    bool val3 ;
+    int ecode3 = 0 ;
+    unsigned int val4 ;
+    int ecode4 = 0 ;
+    bool val5 ;
+    int ecode5 = 0 ;
+    int argvi = 0;
+    KBTreeLib::KBTree *result = 0 ;
+    dXSARGS;
+    
+    if ((items < 5) || (items > 5)) {
+      SWIG_croak("Usage: KBTree_fromFile(filename,verbose,assumeBootstrapNames,threadCount,lazyLabels);");
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res1 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), &ptr);
+      if (!SWIG_IsOK(res1)) {
+        SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_fromFile" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_fromFile" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      arg1 = ptr;
+    }
+    ecode2 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_fromFile" "', argument " "2"" of type '" "bool""'");
+    } 
+    arg2 = static_cast< bool >(val2);
+    ecode3 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "KBTree_fromFile" "', argument " "3"" of type '" "bool""'");
+    } 
+    arg3 = static_cast< bool >(val3);
+    ecode4 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(3), &val4);
+    if (!SWIG_IsOK(ecode4)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "KBTree_fromFile" "', argument " "4"" of type '" "unsigned int""'");
+    } 
+    arg4 = static_cast< unsigned int >(val4);
+    ecode5 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(4), &val5);
+    if (!SWIG_IsOK(ecode5)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode5), "in method '" "KBTree_fromFile" "', argument " "5"" of type '" "bool""'");
+    } 
+    arg5 = static_cast< bool >(val5);
+    result = (KBTreeLib::KBTree *)KBTreeLib::KBTree::fromFile((std::string const &)*arg1,arg2,arg3,arg4,arg5);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTree, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    
+    
+    
+    
+    XSRETURN(argvi);
+  fail:
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    
+    
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_fromFile__SWIG_2) {
+  {
+    std::string *arg1 = 0 ;
+    bool arg2 ;
+    bool arg3 ;
+    unsigned int arg4 ;
+    int res1 = SWIG_OLDOBJ ;
+    bool val2 ;
+    int ecode2 = 0 ;
+    bool val3 ;
+    int ecode3 = 0 ;
+    unsigned int val4 ;
+    int ecode4 = 0 ;
+    int argvi = 0;
+    KBTreeLib::KBTree *result = 0 ;
+    dXSARGS;
+    
+    if ((items < 4) || (items > 4)) {
+      SWIG_croak("Usage: KBTree_fromFile(filename,verbose,assumeBootstrapNames,threadCount);");
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res1 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), &ptr);
+      if (!SWIG_IsOK(res1)) {
+        SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_fromFile" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_fromFile" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      arg1 = ptr;
+    }
+    ecode2 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_fromFile" "', argument " "2"" of type '" "bool""'");
+    } 
+    arg2 = static_cast< bool >(val2);
+    ecode3 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "KBTree_fromFile" "', argument " "3"" of type '" "bool""'");
+    } 
+    arg3 = static_cast< bool >(val3);
+    ecode4 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(3), &val4);
+    if (!SWIG_IsOK(ecode4)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "KBTree_fromFile" "', argument " "4"" of type '" "unsigned int""'");
+    } 
+    arg4 = static_cast< unsigned int >(val4);
+    result = (KBTreeLib::KBTree *)KBTreeLib::KBTree::fromFile((std::string const &)*arg1,arg2,arg3,arg4);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTree, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    
+    
+    
+    XSRETURN(argvi);
+  fail:
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_fromFile__SWIG_3) {
+  {
+    std::string *arg1 = 0 ;
+    bool arg2 ;
+    bool arg3 ;
+    int res1 = SWIG_OLDOBJ ;
+    bool val2 ;
+    int ecode2 = 0 ;
+    bool val3 ;
+    int ecode3 = 0 ;
+    int argvi = 0;
+    KBTreeLib::KBTree *result = 0 ;
+    dXSARGS;
+    
+    if ((items < 3) || (items > 3)) {
+      SWIG_croak("Usage: KBTree_fromFile(filename,verbose,assumeBootstrapNames);");
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res1 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), &ptr);
+      if (!SWIG_IsOK(res1)) {
+        SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_fromFile" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_fromFile" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      arg1 = ptr;
+    }
+    ecode2 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_fromFile" "', argument " "2"" of type '" "bool""'");
+    } 
+    arg2 = static_cast< bool >(val2);
+    ecode3 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "KBTree_fromFile" "', argument " "3"" of type '" "bool""'");
+    } 
+    arg3 = static_cast< bool >(val3);
+    result = (KBTreeLib::KBTree *)KBTreeLib::KBTree::fromFile((std::string const &)*arg1,arg2,arg3);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTree, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_fromFile__SWIG_4) {
+  {
+    std::string *arg1 = 0 ;
+    bool arg2 ;
+    int res1 = SWIG_OLDOBJ ;
+    bool val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    KBTreeLib::KBTree *result = 0 ;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_fromFile(filename,verbose);");
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res1 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), &ptr);
+      if (!SWIG_IsOK(res1)) {
+        SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_fromFile" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_fromFile" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      arg1 = ptr;
+    }
+    ecode2 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_fromFile" "', argument " "2"" of type '" "bool""'");
+    } 
+    arg2 = static_cast< bool >(val2);
+    result = (KBTreeLib::KBTree *)KBTreeLib::KBTree::fromFile((std::string const &)*arg1,arg2);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTree, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    
+    XSRETURN(argvi);
+  fail:
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_fromFile__SWIG_5) {
+  {
+    std::string *arg1 = 0 ;
+    int res1 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    KBTreeLib::KBTree *result = 0 ;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_fromFile(filename);");
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res1 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), &ptr);
+      if (!SWIG_IsOK(res1)) {
+        SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_fromFile" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_fromFile" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      arg1 = ptr;
+    }
+    result = (KBTreeLib::KBTree *)KBTreeLib::KBTree::fromFile((std::string const &)*arg1);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTree, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    XSRETURN(argvi);
+  fail:
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_fromFile) {
+  dXSARGS;
+  
+  {
+    unsigned long _index = 0;
+    SWIG_TypeRank _rank = 0; 
+    if (items == 1) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 1;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_1:
+    
+    if (items == 2) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 2;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_2:
+    
+    if (items == 3) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_3;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_3;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_3;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 3;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_3:
+    
+    if (items == 4) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_4;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_4;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_4;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(3), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_4;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 4;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_4:
+    
+    if (items == 5) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_5;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_5;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_5;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(3), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_5;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(4), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_5;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 5;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_5:
+    
+    if (items == 6) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_6;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_6;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_6;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(3), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_6;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(4), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_6;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(5), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_6;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 6;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_6:
+    
+  dispatch:
+    switch(_index) {
+    case 1:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_fromFile__SWIG_5); return;
+    case 2:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_fromFile__SWIG_4); return;
+    case 3:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_fromFile__SWIG_3); return;
+    case 4:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_fromFile__SWIG_2); return;
+    case 5:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_fromFile__SWIG_1); return;
+    case 6:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_fromFile__SWIG_0); return;
+    }
+  }
+  
+  croak("No matching function for overloaded 'KBTree_fromFile'");
+  XSRETURN(0);
+}
+
+
+XS(_wrap_KBTree_toBinary) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_toBinary(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_toBinary" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    result = (arg1)->toBinary();
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_writeBinaryToFile) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_writeBinaryToFile(self,filename);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_writeBinaryToFile" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_writeBinaryToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_writeBinaryToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = (bool)(arg1)->writeBinaryToFile((std::string const &)*arg2);
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_fromBinary) {
+  {
+    std::string *arg1 = 0 ;
+    int res1 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    KBTreeLib::KBTree *result = 0 ;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_fromBinary(binary);");
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res1 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), &ptr);
+      if (!SWIG_IsOK(res1)) {
+        SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_fromBinary" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_fromBinary" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      arg1 = ptr;
+    }
+    result = (KBTreeLib::KBTree *)KBTreeLib::KBTree::fromBinary((std::string const &)*arg1);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTree, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    XSRETURN(argvi);
+  fail:
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_fromBinaryFile) {
+  {
+    std::string *arg1 = 0 ;
+    int res1 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    KBTreeLib::KBTree *result = 0 ;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_fromBinaryFile(filename);");
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res1 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), &ptr);
+      if (!SWIG_IsOK(res1)) {
+        SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_fromBinaryFile" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_fromBinaryFile" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      arg1 = ptr;
+    }
+    result = (KBTreeLib::KBTree *)KBTreeLib::KBTree::fromBinaryFile((std::string const &)*arg1);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTree, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    XSRETURN(argvi);
+  fail:
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_scanStatistics) {
+  {
+    std::string *arg1 = 0 ;
+    int res1 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    KBTreeLib::KBTreeStatistics result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_scanStatistics(newickString);");
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res1 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), &ptr);
+      if (!SWIG_IsOK(res1)) {
+        SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_scanStatistics" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_scanStatistics" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      arg1 = ptr;
+    }
+    result = KBTreeLib::KBTree::scanStatistics((std::string const &)*arg1);
+    ST(argvi) = SWIG_NewPointerObj((new KBTreeLib::KBTreeStatistics(static_cast< const KBTreeLib::KBTreeStatistics& >(result))), SWIGTYPE_p_KBTreeLib__KBTreeStatistics, SWIG_POINTER_OWN | SWIG_SHADOW); argvi++ ;
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    XSRETURN(argvi);
+  fail:
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_toNewick__SWIG_0) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_toNewick(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_toNewick" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    result = (arg1)->toNewick();
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_setOutputFlagLabel) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    bool arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    bool val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_setOutputFlagLabel(self,flag);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_setOutputFlagLabel" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    ecode2 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_setOutputFlagLabel" "', argument " "2"" of type '" "bool""'");
+    } 
+    arg2 = static_cast< bool >(val2);
+    (arg1)->setOutputFlagLabel(arg2);
+    ST(argvi) = sv_newmortal();
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_setOutputFlagDistances) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    bool arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    bool val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_setOutputFlagDistances(self,flag);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_setOutputFlagDistances" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    ecode2 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_setOutputFlagDistances" "', argument " "2"" of type '" "bool""'");
+    } 
+    arg2 = static_cast< bool >(val2);
+    (arg1)->setOutputFlagDistances(arg2);
+    ST(argvi) = sv_newmortal();
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_setOutputFlagComments) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    bool arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    bool val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_setOutputFlagComments(self,flag);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_setOutputFlagComments" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    ecode2 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_setOutputFlagComments" "', argument " "2"" of type '" "bool""'");
+    } 
+    arg2 = static_cast< bool >(val2);
+    (arg1)->setOutputFlagComments(arg2);
+    ST(argvi) = sv_newmortal();
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_setOutputFlagBootstrapValuesAsLabels) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    bool arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    bool val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_setOutputFlagBootstrapValuesAsLabels(self,flag);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_setOutputFlagBootstrapValuesAsLabels" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    ecode2 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_setOutputFlagBootstrapValuesAsLabels" "', argument " "2"" of type '" "bool""'");
+    } 
+    arg2 = static_cast< bool >(val2);
+    (arg1)->setOutputFlagBootstrapValuesAsLabels(arg2);
+    ST(argvi) = sv_newmortal();
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_setOutputPrecision) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    int arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_setOutputPrecision(self,precision);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_setOutputPrecision" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    ecode2 = SWIG_AsVal_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_setOutputPrecision" "', argument " "2"" of type '" "int""'");
+    } 
+    arg2 = static_cast< int >(val2);
+    (arg1)->setOutputPrecision(arg2);
+    ST(argvi) = sv_newmortal();
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_setOutputThreadCount) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    unsigned int arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_setOutputThreadCount(self,threadCount);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_setOutputThreadCount" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_setOutputThreadCount" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    (arg1)->setOutputThreadCount(arg2);
+    ST(argvi) = sv_newmortal();
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_toNewick__SWIG_1) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    unsigned int arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_toNewick(self,style);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_toNewick" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_toNewick" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    result = (arg1)->toNewick(arg2);
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_toNewick) {
+  dXSARGS;
+  
+  {
+    unsigned long _index = 0;
+    SWIG_TypeRank _rank = 0; 
+    if (items == 1) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTree, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 1;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_1:
+    
+    if (items == 2) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTree, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 2;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_2:
+    
+  dispatch:
+    switch(_index) {
+    case 1:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_toNewick__SWIG_0); return;
+    case 2:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_toNewick__SWIG_1); return;
+    }
+  }
+  
+  croak("No matching function for overloaded 'KBTree_toNewick'");
+  XSRETURN(0);
+}
+
+
+XS(_wrap_KBTree_writeNewickToFile__SWIG_0) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_writeNewickToFile(self,filename);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_writeNewickToFile" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_writeNewickToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_writeNewickToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = (bool)(arg1)->writeNewickToFile((std::string const &)*arg2);
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_writeNewickToFile__SWIG_1) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    std::string *arg2 = 0 ;
+    unsigned int arg3 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    unsigned int val3 ;
+    int ecode3 = 0 ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 3) || (items > 3)) {
+      SWIG_croak("Usage: KBTree_writeNewickToFile(self,filename,style);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_writeNewickToFile" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_writeNewickToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_writeNewickToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    ecode3 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(2), &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "KBTree_writeNewickToFile" "', argument " "3"" of type '" "unsigned int""'");
+    } 
+    arg3 = static_cast< unsigned int >(val3);
+    result = (bool)(arg1)->writeNewickToFile((std::string const &)*arg2,arg3);
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_writeNewickToFile) {
+  dXSARGS;
+  
+  {
+    unsigned long _index = 0;
+    SWIG_TypeRank _rank = 0; 
+    if (items == 2) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTree, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 1;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_1:
+    
+    if (items == 3) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTree, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(2), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 2;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_2:
+    
+  dispatch:
+    switch(_index) {
+    case 1:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_writeNewickToFile__SWIG_0); return;
+    case 2:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_writeNewickToFile__SWIG_1); return;
+    }
+  }
+  
+  croak("No matching function for overloaded 'KBTree_writeNewickToFile'");
+  XSRETURN(0);
+}
+
+
+XS(_wrap_KBTree_removeNodesByNameAndSimplify) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_removeNodesByNameAndSimplify(self,nodeNames);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_removeNodesByNameAndSimplify" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_removeNodesByNameAndSimplify" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_removeNodesByNameAndSimplify" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    try {
+      (arg1)->removeNodesByNameAndSimplify((std::string const &)*arg2);
+    }
+    catch(KBTreeLib::ParseException &_e) {
+      SWIG_croak(_e.what().c_str());
+    }
+    ST(argvi) = sv_newmortal();
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_removeNodeByNameAndSimplify) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_removeNodeByNameAndSimplify(self,name);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_removeNodeByNameAndSimplify" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_removeNodeByNameAndSimplify" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_removeNodeByNameAndSimplify" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    try {
+      result = (unsigned int)(arg1)->removeNodeByNameAndSimplify((std::string const &)*arg2);
+    }
+    catch(KBTreeLib::ParseException &_e) {
+      SWIG_croak(_e.what().c_str());
+    }
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_mergeZeroDistLeaves) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_mergeZeroDistLeaves(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_mergeZeroDistLeaves" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    (arg1)->mergeZeroDistLeaves();
+    ST(argvi) = sv_newmortal();
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_replaceNodeNames) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_replaceNodeNames(self,replacements);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_replaceNodeNames" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_replaceNodeNames" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_replaceNodeNames" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    (arg1)->replaceNodeNames((std::string const &)*arg2);
+    ST(argvi) = sv_newmortal();
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_replaceNodeNamesOrMakeBlank) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_replaceNodeNamesOrMakeBlank(self,replacements);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_replaceNodeNamesOrMakeBlank" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_replaceNodeNamesOrMakeBlank" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_replaceNodeNamesOrMakeBlank" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    (arg1)->replaceNodeNamesOrMakeBlank((std::string const &)*arg2);
+    ST(argvi) = sv_newmortal();
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_replaceNodeName) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    std::string *arg2 = 0 ;
+    std::string *arg3 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int res3 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 3) || (items > 3)) {
+      SWIG_croak("Usage: KBTree_replaceNodeName(self,name,newName);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_replaceNodeName" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_replaceNodeName" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_replaceNodeName" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res3 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(2), &ptr);
+      if (!SWIG_IsOK(res3)) {
+        SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "KBTree_replaceNodeName" "', argument " "3"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_replaceNodeName" "', argument " "3"" of type '" "std::string const &""'"); 
+      }
+      arg3 = ptr;
+    }
+    result = (unsigned int)(arg1)->replaceNodeName((std::string const &)*arg2,(std::string const &)*arg3);
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    if (SWIG_IsNewObj(res3)) delete arg3;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    if (SWIG_IsNewObj(res3)) delete arg3;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_getPathToRoot) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_getPathToRoot(self,name);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_getPathToRoot" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_getPathToRoot" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_getPathToRoot" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = (arg1)->getPathToRoot((std::string const &)*arg2);
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_getAllDescendantNames) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_getAllDescendantNames(self,name);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_getAllDescendantNames" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_getAllDescendantNames" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_getAllDescendantNames" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = (arg1)->getAllDescendantNames((std::string const &)*arg2);
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_getDepth) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    int result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_getDepth(self,name);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_getDepth" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_getDepth" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_getDepth" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = (int)(arg1)->getDepth((std::string const &)*arg2);
+    ST(argvi) = SWIG_From_int  SWIG_PERL_CALL_ARGS_1(static_cast< int >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_getSubtreeSize) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_getSubtreeSize(self,name);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_getSubtreeSize" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_getSubtreeSize" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_getSubtreeSize" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = (unsigned int)(arg1)->getSubtreeSize((std::string const &)*arg2);
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_getCladeLeafCount) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_getCladeLeafCount(self,name);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_getCladeLeafCount" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_getCladeLeafCount" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_getCladeLeafCount" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = (unsigned int)(arg1)->getCladeLeafCount((std::string const &)*arg2);
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_getDistanceToRoot) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    double result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_getDistanceToRoot(self,name);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_getDistanceToRoot" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_getDistanceToRoot" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_getDistanceToRoot" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = (double)(arg1)->getDistanceToRoot((std::string const &)*arg2);
+    ST(argvi) = SWIG_From_double  SWIG_PERL_CALL_ARGS_1(static_cast< double >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_extractInducedSubtree) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    KBTreeLib::KBTree *result = 0 ;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_extractInducedSubtree(self,names);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_extractInducedSubtree" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_extractInducedSubtree" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_extractInducedSubtree" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = (KBTreeLib::KBTree *)(arg1)->extractInducedSubtree((std::string const &)*arg2);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTree, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_writePatristicDistancesToFile__SWIG_0) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    std::string *arg2 = 0 ;
+    std::string *arg3 = 0 ;
+    unsigned int arg4 ;
+    unsigned int arg5 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int res3 = SWIG_OLDOBJ ;
+    unsigned int val4 ;
+    int ecode4 = 0 ;
+    unsigned int val5 ;
+    int ecode5 = 0 ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 5) || (items > 5)) {
+      SWIG_croak("Usage: KBTree_writePatristicDistancesToFile(self,filename,names,format,threadCount);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_writePatristicDistancesToFile" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_writePatristicDistancesToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_writePatristicDistancesToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res3 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(2), &ptr);
+      if (!SWIG_IsOK(res3)) {
+        SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "KBTree_writePatristicDistancesToFile" "', argument " "3"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_writePatristicDistancesToFile" "', argument " "3"" of type '" "std::string const &""'"); 
+      }
+      arg3 = ptr;
+    }
+    ecode4 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(3), &val4);
+    if (!SWIG_IsOK(ecode4)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "KBTree_writePatristicDistancesToFile" "', argument " "4"" of type '" "unsigned int""'");
+    } 
+    arg4 = static_cast< unsigned int >(val4);
+    ecode5 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(4), &val5);
+    if (!SWIG_IsOK(ecode5)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode5), "in method '" "KBTree_writePatristicDistancesToFile" "', argument " "5"" of type '" "unsigned int""'");
+    } 
+    arg5 = static_cast< unsigned int >(val5);
+    result = (bool)(arg1)->writePatristicDistancesToFile((std::string const &)*arg2,(std::string const &)*arg3,arg4,arg5);
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    if (SWIG_IsNewObj(res3)) delete arg3;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    if (SWIG_IsNewObj(res3)) delete arg3;
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_writePatristicDistancesToFile__SWIG_1) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    std::string *arg2 = 0 ;
+    std::string *arg3 = 0 ;
+    unsigned int arg4 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int res3 = SWIG_OLDOBJ ;
+    unsigned int val4 ;
+    int ecode4 = 0 ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 4) || (items > 4)) {
+      SWIG_croak("Usage: KBTree_writePatristicDistancesToFile(self,filename,names,format);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_writePatristicDistancesToFile" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_writePatristicDistancesToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_writePatristicDistancesToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res3 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(2), &ptr);
+      if (!SWIG_IsOK(res3)) {
+        SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "KBTree_writePatristicDistancesToFile" "', argument " "3"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_writePatristicDistancesToFile" "', argument " "3"" of type '" "std::string const &""'"); 
+      }
+      arg3 = ptr;
+    }
+    ecode4 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(3), &val4);
+    if (!SWIG_IsOK(ecode4)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "KBTree_writePatristicDistancesToFile" "', argument " "4"" of type '" "unsigned int""'");
+    } 
+    arg4 = static_cast< unsigned int >(val4);
+    result = (bool)(arg1)->writePatristicDistancesToFile((std::string const &)*arg2,(std::string const &)*arg3,arg4);
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    if (SWIG_IsNewObj(res3)) delete arg3;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    if (SWIG_IsNewObj(res3)) delete arg3;
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_writePatristicDistancesToFile__SWIG_2) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    std::string *arg2 = 0 ;
+    std::string *arg3 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int res3 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 3) || (items > 3)) {
+      SWIG_croak("Usage: KBTree_writePatristicDistancesToFile(self,filename,names);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_writePatristicDistancesToFile" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_writePatristicDistancesToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_writePatristicDistancesToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res3 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(2), &ptr);
+      if (!SWIG_IsOK(res3)) {
+        SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "KBTree_writePatristicDistancesToFile" "', argument " "3"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_writePatristicDistancesToFile" "', argument " "3"" of type '" "std::string const &""'"); 
+      }
+      arg3 = ptr;
+    }
+    result = (bool)(arg1)->writePatristicDistancesToFile((std::string const &)*arg2,(std::string const &)*arg3);
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    if (SWIG_IsNewObj(res3)) delete arg3;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    if (SWIG_IsNewObj(res3)) delete arg3;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_writePatristicDistancesToFile__SWIG_3) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_writePatristicDistancesToFile(self,filename);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_writePatristicDistancesToFile" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_writePatristicDistancesToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_writePatristicDistancesToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = (bool)(arg1)->writePatristicDistancesToFile((std::string const &)*arg2);
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_writePatristicDistancesToFile) {
+  dXSARGS;
+  
+  {
+    unsigned long _index = 0;
+    SWIG_TypeRank _rank = 0; 
+    if (items == 2) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTree, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 1;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_1:
+    
+    if (items == 3) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTree, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(2), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 2;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_2:
+    
+    if (items == 4) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTree, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_3;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_3;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(2), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_3;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(3), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_3;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 3;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_3:
+    
+    if (items == 5) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTree, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_4;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_4;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(2), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_4;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(3), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_4;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(4), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_4;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 4;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_4:
+    
+  dispatch:
+    switch(_index) {
+    case 1:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_writePatristicDistancesToFile__SWIG_3); return;
+    case 2:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_writePatristicDistancesToFile__SWIG_2); return;
+    case 3:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_writePatristicDistancesToFile__SWIG_1); return;
+    case 4:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_writePatristicDistancesToFile__SWIG_0); return;
+    }
+  }
+  
+  croak("No matching function for overloaded 'KBTree_writePatristicDistancesToFile'");
+  XSRETURN(0);
+}
+
+
+XS(_wrap_KBTree_stripReservedCharsFromLabels) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_stripReservedCharsFromLabels(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_stripReservedCharsFromLabels" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    (arg1)->stripReservedCharsFromLabels();
+    ST(argvi) = sv_newmortal();
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_printTree) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_printTree(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_printTree" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    (arg1)->printTree();
+    ST(argvi) = sv_newmortal();
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_printSimpleTreeToString) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_printSimpleTreeToString(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_printSimpleTreeToString" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    result = (arg1)->printSimpleTreeToString();
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_printTreeToString) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_printTreeToString(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_printTreeToString" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    result = (arg1)->printTreeToString();
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_getNodeCount) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_getNodeCount(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_getNodeCount" "', argument " "1"" of type '" "KBTreeLib::KBTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    result = (unsigned int)((KBTreeLib::KBTree const *)arg1)->getNodeCount();
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_getLeafCount) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_getLeafCount(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_getLeafCount" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    result = (unsigned int)(arg1)->getLeafCount();
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_getMemoryUsage) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    size_t result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_getMemoryUsage(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_getMemoryUsage" "', argument " "1"" of type '" "KBTreeLib::KBTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    result = (size_t)((KBTreeLib::KBTree const *)arg1)->getMemoryUsage();
+    ST(argvi) = SWIG_From_size_t  SWIG_PERL_CALL_ARGS_1(static_cast< size_t >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_freeze) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    SwigValueWrapper< KBTreeLib::KBFrozenTree > result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_freeze(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_freeze" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    result = (arg1)->freeze();
+    ST(argvi) = SWIG_NewPointerObj((new KBTreeLib::KBFrozenTree(static_cast< const KBTreeLib::KBFrozenTree& >(result))), SWIGTYPE_p_KBTreeLib__KBFrozenTree, SWIG_POINTER_OWN | SWIG_SHADOW); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_getAllLeafNames) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_getAllLeafNames(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_getAllLeafNames" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    result = (arg1)->getAllLeafNames();
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_getAllNodeNames) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_getAllNodeNames(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_getAllNodeNames" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    result = (arg1)->getAllNodeNames();
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_resetBreadthFirstIterToRoot) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_resetBreadthFirstIterToRoot(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_resetBreadthFirstIterToRoot" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    (arg1)->resetBreadthFirstIterToRoot();
+    ST(argvi) = sv_newmortal();
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_breadthFirstIterNext) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_breadthFirstIterNext(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_breadthFirstIterNext" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    result = (bool)(arg1)->breadthFirstIterNext();
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_breadthFirstIterGetName__SWIG_0) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_breadthFirstIterGetName(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_breadthFirstIterGetName" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    result = (arg1)->breadthFirstIterGetName();
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_breadthFirstIterGetParentName__SWIG_0) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_breadthFirstIterGetParentName(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_breadthFirstIterGetParentName" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    result = (arg1)->breadthFirstIterGetParentName();
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_breadthFirstIterMarkNode) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_breadthFirstIterMarkNode(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_breadthFirstIterMarkNode" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    result = (unsigned int)(arg1)->breadthFirstIterMarkNode();
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_breadthFirstIterSetToNode) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    unsigned int arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_breadthFirstIterSetToNode(self,nodeMarker);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_breadthFirstIterSetToNode" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_breadthFirstIterSetToNode" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    result = (bool)(arg1)->breadthFirstIterSetToNode(arg2);
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_breadthFirstIterGetName__SWIG_1) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    unsigned int arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_breadthFirstIterGetName(self,nodeMarker);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_breadthFirstIterGetName" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_breadthFirstIterGetName" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    result = (arg1)->breadthFirstIterGetName(arg2);
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_breadthFirstIterGetName) {
+  dXSARGS;
+  
+  {
+    unsigned long _index = 0;
+    SWIG_TypeRank _rank = 0; 
+    if (items == 1) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTree, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 1;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_1:
+    
+    if (items == 2) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTree, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 2;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_2:
+    
+  dispatch:
+    switch(_index) {
+    case 1:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_breadthFirstIterGetName__SWIG_0); return;
+    case 2:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_breadthFirstIterGetName__SWIG_1); return;
+    }
+  }
+  
+  croak("No matching function for overloaded 'KBTree_breadthFirstIterGetName'");
+  XSRETURN(0);
+}
+
+
+XS(_wrap_KBTree_breadthFirstIterGetPathToRoot) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    unsigned int arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_breadthFirstIterGetPathToRoot(self,nodeMarker);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_breadthFirstIterGetPathToRoot" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_breadthFirstIterGetPathToRoot" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    result = (arg1)->breadthFirstIterGetPathToRoot(arg2);
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_breadthFirstIterGetParentName__SWIG_1) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    unsigned int arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_breadthFirstIterGetParentName(self,nodeMarker);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_breadthFirstIterGetParentName" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_breadthFirstIterGetParentName" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    result = (arg1)->breadthFirstIterGetParentName(arg2);
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_breadthFirstIterGetParentName) {
+  dXSARGS;
+  
+  {
+    unsigned long _index = 0;
+    SWIG_TypeRank _rank = 0; 
+    if (items == 1) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTree, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 1;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_1:
+    
+    if (items == 2) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTree, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 2;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_2:
+    
+  dispatch:
+    switch(_index) {
+    case 1:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_breadthFirstIterGetParentName__SWIG_0); return;
+    case 2:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_breadthFirstIterGetParentName__SWIG_1); return;
+    }
+  }
+  
+  croak("No matching function for overloaded 'KBTree_breadthFirstIterGetParentName'");
+  XSRETURN(0);
+}
+
+
+XS(_wrap_KBTree_breadthFirstIterGetAllChildrenNames) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    unsigned int arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_breadthFirstIterGetAllChildrenNames(self,nodeMarker);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_breadthFirstIterGetAllChildrenNames" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_breadthFirstIterGetAllChildrenNames" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    result = (arg1)->breadthFirstIterGetAllChildrenNames(arg2);
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_breadthFirstIterGetAllDescendantNames) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    unsigned int arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_breadthFirstIterGetAllDescendantNames(self,nodeMarker);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_breadthFirstIterGetAllDescendantNames" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_breadthFirstIterGetAllDescendantNames" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    result = (arg1)->breadthFirstIterGetAllDescendantNames(arg2);
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_buildNodeIds) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_buildNodeIds(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_buildNodeIds" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    (arg1)->buildNodeIds();
+    ST(argvi) = sv_newmortal();
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_hasNodeIds) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_hasNodeIds(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_hasNodeIds" "', argument " "1"" of type '" "KBTreeLib::KBTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    result = (bool)((KBTreeLib::KBTree const *)arg1)->hasNodeIds();
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_getNodeIdLimit) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTree_getNodeIdLimit(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_getNodeIdLimit" "', argument " "1"" of type '" "KBTreeLib::KBTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    result = (unsigned int)((KBTreeLib::KBTree const *)arg1)->getNodeIdLimit();
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_isValidNodeId) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    unsigned int arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_isValidNodeId(self,id);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_isValidNodeId" "', argument " "1"" of type '" "KBTreeLib::KBTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_isValidNodeId" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    result = (bool)((KBTreeLib::KBTree const *)arg1)->isValidNodeId(arg2);
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_getNodeId) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_getNodeId(self,name);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_getNodeId" "', argument " "1"" of type '" "KBTreeLib::KBTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_getNodeId" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_getNodeId" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = (unsigned int)((KBTreeLib::KBTree const *)arg1)->getNodeId((std::string const &)*arg2);
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_getParentId) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    unsigned int arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_getParentId(self,id);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_getParentId" "', argument " "1"" of type '" "KBTreeLib::KBTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_getParentId" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    result = (unsigned int)((KBTreeLib::KBTree const *)arg1)->getParentId(arg2);
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_getSubtreeEndId) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    unsigned int arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_getSubtreeEndId(self,id);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_getSubtreeEndId" "', argument " "1"" of type '" "KBTreeLib::KBTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_getSubtreeEndId" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    result = (unsigned int)((KBTreeLib::KBTree const *)arg1)->getSubtreeEndId(arg2);
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_isDescendantOf) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    unsigned int arg2 ;
+    unsigned int arg3 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    unsigned int val3 ;
+    int ecode3 = 0 ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 3) || (items > 3)) {
+      SWIG_croak("Usage: KBTree_isDescendantOf(self,id,ancestorId);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_isDescendantOf" "', argument " "1"" of type '" "KBTreeLib::KBTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_isDescendantOf" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    ecode3 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(2), &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "KBTree_isDescendantOf" "', argument " "3"" of type '" "unsigned int""'");
+    } 
+    arg3 = static_cast< unsigned int >(val3);
+    result = (bool)((KBTreeLib::KBTree const *)arg1)->isDescendantOf(arg2,arg3);
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_getNameById) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    unsigned int arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_getNameById(self,id);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_getNameById" "', argument " "1"" of type '" "KBTreeLib::KBTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_getNameById" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    result = ((KBTreeLib::KBTree const *)arg1)->getNameById(arg2);
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_getChildNamesById) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    unsigned int arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_getChildNamesById(self,id);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_getChildNamesById" "', argument " "1"" of type '" "KBTreeLib::KBTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_getChildNamesById" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    result = ((KBTreeLib::KBTree const *)arg1)->getChildNamesById(arg2);
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_getDescendantNamesById) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    unsigned int arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_getDescendantNamesById(self,id);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_getDescendantNamesById" "', argument " "1"" of type '" "KBTreeLib::KBTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_getDescendantNamesById" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    result = ((KBTreeLib::KBTree const *)arg1)->getDescendantNamesById(arg2);
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTree_getPathToRootById) {
+  {
+    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    unsigned int arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTree_getPathToRootById(self,id);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_getPathToRootById" "', argument " "1"" of type '" "KBTreeLib::KBTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_getPathToRootById" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    result = ((KBTreeLib::KBTree const *)arg1)->getPathToRootById(arg2);
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_new_KBAncestorIndex) {
+  {
+    KBTreeLib::KBTree *arg1 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    KBTreeLib::KBAncestorIndex *result = 0 ;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: new_KBAncestorIndex(tree);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1, SWIGTYPE_p_KBTreeLib__KBTree,  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_KBAncestorIndex" "', argument " "1"" of type '" "KBTreeLib::KBTree &""'"); 
+    }
+    if (!argp1) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_KBAncestorIndex" "', argument " "1"" of type '" "KBTreeLib::KBTree &""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    result = (KBTreeLib::KBAncestorIndex *)new KBTreeLib::KBAncestorIndex(*arg1);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBAncestorIndex, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_delete_KBAncestorIndex) {
+  {
+    KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: delete_KBAncestorIndex(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBAncestorIndex, SWIG_POINTER_DISOWN |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_KBAncestorIndex" "', argument " "1"" of type '" "KBTreeLib::KBAncestorIndex *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBAncestorIndex * >(argp1);
+    delete arg1;
+    ST(argvi) = sv_newmortal();
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBAncestorIndex_getNodeCount) {
+  {
+    KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBAncestorIndex_getNodeCount(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBAncestorIndex, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBAncestorIndex_getNodeCount" "', argument " "1"" of type '" "KBTreeLib::KBAncestorIndex const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBAncestorIndex * >(argp1);
+    result = (unsigned int)((KBTreeLib::KBAncestorIndex const *)arg1)->getNodeCount();
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBAncestorIndex_getParent) {
+  {
+    KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+    unsigned int arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBAncestorIndex_getParent(self,node);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBAncestorIndex, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBAncestorIndex_getParent" "', argument " "1"" of type '" "KBTreeLib::KBAncestorIndex const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBAncestorIndex * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBAncestorIndex_getParent" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    result = (unsigned int)((KBTreeLib::KBAncestorIndex const *)arg1)->getParent(arg2);
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBAncestorIndex_getDepth) {
+  {
+    KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+    unsigned int arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBAncestorIndex_getDepth(self,node);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBAncestorIndex, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBAncestorIndex_getDepth" "', argument " "1"" of type '" "KBTreeLib::KBAncestorIndex const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBAncestorIndex * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBAncestorIndex_getDepth" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    result = (unsigned int)((KBTreeLib::KBAncestorIndex const *)arg1)->getDepth(arg2);
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBAncestorIndex_getSubtreeSize) {
+  {
+    KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+    unsigned int arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBAncestorIndex_getSubtreeSize(self,node);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBAncestorIndex, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBAncestorIndex_getSubtreeSize" "', argument " "1"" of type '" "KBTreeLib::KBAncestorIndex const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBAncestorIndex * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBAncestorIndex_getSubtreeSize" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    result = (unsigned int)((KBTreeLib::KBAncestorIndex const *)arg1)->getSubtreeSize(arg2);
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBAncestorIndex_getLeafCount) {
+  {
+    KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+    unsigned int arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBAncestorIndex_getLeafCount(self,node);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBAncestorIndex, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBAncestorIndex_getLeafCount" "', argument " "1"" of type '" "KBTreeLib::KBAncestorIndex const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBAncestorIndex * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBAncestorIndex_getLeafCount" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    result = (unsigned int)((KBTreeLib::KBAncestorIndex const *)arg1)->getLeafCount(arg2);
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBAncestorIndex_isLeaf) {
+  {
+    KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+    unsigned int arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBAncestorIndex_isLeaf(self,node);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBAncestorIndex, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBAncestorIndex_isLeaf" "', argument " "1"" of type '" "KBTreeLib::KBAncestorIndex const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBAncestorIndex * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBAncestorIndex_isLeaf" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    result = (bool)((KBTreeLib::KBAncestorIndex const *)arg1)->isLeaf(arg2);
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBAncestorIndex_getDistanceToRoot) {
+  {
+    KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+    unsigned int arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    double result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBAncestorIndex_getDistanceToRoot(self,node);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBAncestorIndex, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBAncestorIndex_getDistanceToRoot" "', argument " "1"" of type '" "KBTreeLib::KBAncestorIndex const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBAncestorIndex * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBAncestorIndex_getDistanceToRoot" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    result = (double)((KBTreeLib::KBAncestorIndex const *)arg1)->getDistanceToRoot(arg2);
+    ST(argvi) = SWIG_From_double  SWIG_PERL_CALL_ARGS_1(static_cast< double >(result)); argvi++ ;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBAncestorIndex_getNode) {
+  {
+    KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBAncestorIndex_getNode(self,name);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBAncestorIndex, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBAncestorIndex_getNode" "', argument " "1"" of type '" "KBTreeLib::KBAncestorIndex const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBAncestorIndex * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBAncestorIndex_getNode" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBAncestorIndex_getNode" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = (unsigned int)((KBTreeLib::KBAncestorIndex const *)arg1)->getNode((std::string const &)*arg2);
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBAncestorIndex_isAncestor) {
+  {
+    KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+    unsigned int arg2 ;
+    unsigned int arg3 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    unsigned int val3 ;
+    int ecode3 = 0 ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 3) || (items > 3)) {
+      SWIG_croak("Usage: KBAncestorIndex_isAncestor(self,ancestor,node);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBAncestorIndex, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBAncestorIndex_isAncestor" "', argument " "1"" of type '" "KBTreeLib::KBAncestorIndex const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBAncestorIndex * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBAncestorIndex_isAncestor" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    ecode3 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(2), &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "KBAncestorIndex_isAncestor" "', argument " "3"" of type '" "unsigned int""'");
+    } 
+    arg3 = static_cast< unsigned int >(val3);
+    result = (bool)((KBTreeLib::KBAncestorIndex const *)arg1)->isAncestor(arg2,arg3);
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBAncestorIndex_getLowestCommonAncestor) {
+  {
+    KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+    unsigned int arg2 ;
+    unsigned int arg3 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    unsigned int val3 ;
+    int ecode3 = 0 ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 3) || (items > 3)) {
+      SWIG_croak("Usage: KBAncestorIndex_getLowestCommonAncestor(self,a,b);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBAncestorIndex, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBAncestorIndex_getLowestCommonAncestor" "', argument " "1"" of type '" "KBTreeLib::KBAncestorIndex const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBAncestorIndex * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBAncestorIndex_getLowestCommonAncestor" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    ecode3 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(2), &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "KBAncestorIndex_getLowestCommonAncestor" "', argument " "3"" of type '" "unsigned int""'");
+    } 
+    arg3 = static_cast< unsigned int >(val3);
+    result = (unsigned int)((KBTreeLib::KBAncestorIndex const *)arg1)->getLowestCommonAncestor(arg2,arg3);
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBAncestorIndex_getLowestCommonAncestorNames) {
+  {
+    KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBAncestorIndex_getLowestCommonAncestorNames(self,namePairs);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBAncestorIndex, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBAncestorIndex_getLowestCommonAncestorNames" "', argument " "1"" of type '" "KBTreeLib::KBAncestorIndex const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBAncestorIndex * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBAncestorIndex_getLowestCommonAncestorNames" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBAncestorIndex_getLowestCommonAncestorNames" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = ((KBTreeLib::KBAncestorIndex const *)arg1)->getLowestCommonAncestorNames((std::string const &)*arg2);
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBAncestorIndex_isMonophyletic) {
+  {
+    KBTreeLib::KBAncestorIndex *arg1 = (KBTreeLib::KBAncestorIndex *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBAncestorIndex_isMonophyletic(self,leafNames);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBAncestorIndex, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBAncestorIndex_isMonophyletic" "', argument " "1"" of type '" "KBTreeLib::KBAncestorIndex const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBAncestorIndex * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBAncestorIndex_isMonophyletic" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBAncestorIndex_isMonophyletic" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = (bool)((KBTreeLib::KBAncestorIndex const *)arg1)->isMonophyletic((std::string const &)*arg2);
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_new_KBTreeCursor__SWIG_0) {
+  {
+    KBTreeLib::KBTree *arg1 = 0 ;
+    unsigned int arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    KBTreeLib::KBTreeCursor *result = 0 ;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: new_KBTreeCursor(tree,order);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1, SWIGTYPE_p_KBTreeLib__KBTree,  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_KBTreeCursor" "', argument " "1"" of type '" "KBTreeLib::KBTree const &""'"); 
+    }
+    if (!argp1) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_KBTreeCursor" "', argument " "1"" of type '" "KBTreeLib::KBTree const &""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_KBTreeCursor" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    result = (KBTreeLib::KBTreeCursor *)new KBTreeLib::KBTreeCursor((KBTreeLib::KBTree const &)*arg1,arg2);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTreeCursor, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_new_KBTreeCursor__SWIG_1) {
+  {
+    KBTreeLib::KBTree *arg1 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    KBTreeLib::KBTreeCursor *result = 0 ;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: new_KBTreeCursor(tree);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1, SWIGTYPE_p_KBTreeLib__KBTree,  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_KBTreeCursor" "', argument " "1"" of type '" "KBTreeLib::KBTree const &""'"); 
+    }
+    if (!argp1) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_KBTreeCursor" "', argument " "1"" of type '" "KBTreeLib::KBTree const &""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    result = (KBTreeLib::KBTreeCursor *)new KBTreeLib::KBTreeCursor((KBTreeLib::KBTree const &)*arg1);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTreeCursor, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_new_KBTreeCursor) {
+  dXSARGS;
+  
+  {
+    unsigned long _index = 0;
+    SWIG_TypeRank _rank = 0; 
+    if (items == 1) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTree, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 1;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_1:
+    
+    if (items == 2) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTree, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 2;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_2:
+    
+  dispatch:
+    switch(_index) {
+    case 1:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_new_KBTreeCursor__SWIG_1); return;
+    case 2:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_new_KBTreeCursor__SWIG_0); return;
+    }
+  }
+  
+  croak("No matching function for overloaded 'new_KBTreeCursor'");
+  XSRETURN(0);
+}
+
+
+XS(_wrap_delete_KBTreeCursor) {
+  {
+    KBTreeLib::KBTreeCursor *arg1 = (KBTreeLib::KBTreeCursor *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: delete_KBTreeCursor(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCursor, SWIG_POINTER_DISOWN |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_KBTreeCursor" "', argument " "1"" of type '" "KBTreeLib::KBTreeCursor *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCursor * >(argp1);
+    delete arg1;
+    ST(argvi) = sv_newmortal();
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTreeCursor_getOrder) {
+  {
+    KBTreeLib::KBTreeCursor *arg1 = (KBTreeLib::KBTreeCursor *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTreeCursor_getOrder(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCursor, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeCursor_getOrder" "', argument " "1"" of type '" "KBTreeLib::KBTreeCursor const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCursor * >(argp1);
+    result = (unsigned int)((KBTreeLib::KBTreeCursor const *)arg1)->getOrder();
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTreeCursor_reset) {
+  {
+    KBTreeLib::KBTreeCursor *arg1 = (KBTreeLib::KBTreeCursor *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTreeCursor_reset(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCursor, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeCursor_reset" "', argument " "1"" of type '" "KBTreeLib::KBTreeCursor *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCursor * >(argp1);
+    (arg1)->reset();
+    ST(argvi) = sv_newmortal();
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTreeCursor_next) {
+  {
+    KBTreeLib::KBTreeCursor *arg1 = (KBTreeLib::KBTreeCursor *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTreeCursor_next(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCursor, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeCursor_next" "', argument " "1"" of type '" "KBTreeLib::KBTreeCursor *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCursor * >(argp1);
+    result = (bool)(arg1)->next();
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTreeCursor_isAtEnd) {
+  {
+    KBTreeLib::KBTreeCursor *arg1 = (KBTreeLib::KBTreeCursor *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTreeCursor_isAtEnd(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCursor, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeCursor_isAtEnd" "', argument " "1"" of type '" "KBTreeLib::KBTreeCursor const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCursor * >(argp1);
+    result = (bool)((KBTreeLib::KBTreeCursor const *)arg1)->isAtEnd();
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTreeCursor_getName) {
+  {
+    KBTreeLib::KBTreeCursor *arg1 = (KBTreeLib::KBTreeCursor *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTreeCursor_getName(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCursor, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeCursor_getName" "', argument " "1"" of type '" "KBTreeLib::KBTreeCursor const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCursor * >(argp1);
+    result = ((KBTreeLib::KBTreeCursor const *)arg1)->getName();
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTreeCursor_getParentName) {
+  {
+    KBTreeLib::KBTreeCursor *arg1 = (KBTreeLib::KBTreeCursor *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTreeCursor_getParentName(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCursor, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeCursor_getParentName" "', argument " "1"" of type '" "KBTreeLib::KBTreeCursor const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCursor * >(argp1);
+    result = ((KBTreeLib::KBTreeCursor const *)arg1)->getParentName();
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTreeCursor_getDistanceToParent) {
+  {
+    KBTreeLib::KBTreeCursor *arg1 = (KBTreeLib::KBTreeCursor *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    double result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTreeCursor_getDistanceToParent(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCursor, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeCursor_getDistanceToParent" "', argument " "1"" of type '" "KBTreeLib::KBTreeCursor const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCursor * >(argp1);
+    result = (double)((KBTreeLib::KBTreeCursor const *)arg1)->getDistanceToParent();
+    ST(argvi) = SWIG_From_double  SWIG_PERL_CALL_ARGS_1(static_cast< double >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTreeCursor_getBootstrapValue) {
+  {
+    KBTreeLib::KBTreeCursor *arg1 = (KBTreeLib::KBTreeCursor *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    double result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTreeCursor_getBootstrapValue(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCursor, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeCursor_getBootstrapValue" "', argument " "1"" of type '" "KBTreeLib::KBTreeCursor const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCursor * >(argp1);
+    result = (double)((KBTreeLib::KBTreeCursor const *)arg1)->getBootstrapValue();
+    ST(argvi) = SWIG_From_double  SWIG_PERL_CALL_ARGS_1(static_cast< double >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTreeCursor_isLeaf) {
+  {
+    KBTreeLib::KBTreeCursor *arg1 = (KBTreeLib::KBTreeCursor *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTreeCursor_isLeaf(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCursor, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeCursor_isLeaf" "', argument " "1"" of type '" "KBTreeLib::KBTreeCursor const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCursor * >(argp1);
+    result = (bool)((KBTreeLib::KBTreeCursor const *)arg1)->isLeaf();
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTreeCursor_getNodeId) {
+  {
+    KBTreeLib::KBTreeCursor *arg1 = (KBTreeLib::KBTreeCursor *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTreeCursor_getNodeId(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCursor, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeCursor_getNodeId" "', argument " "1"" of type '" "KBTreeLib::KBTreeCursor const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCursor * >(argp1);
+    result = (unsigned int)((KBTreeLib::KBTreeCursor const *)arg1)->getNodeId();
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_new_KBFrozenTree__SWIG_0) {
+  {
+    KBTreeLib::KBTree *arg1 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    KBTreeLib::KBFrozenTree *result = 0 ;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: new_KBFrozenTree(tree);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1, SWIGTYPE_p_KBTreeLib__KBTree,  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_KBFrozenTree" "', argument " "1"" of type '" "KBTreeLib::KBTree &""'"); 
+    }
+    if (!argp1) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_KBFrozenTree" "', argument " "1"" of type '" "KBTreeLib::KBTree &""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    result = (KBTreeLib::KBFrozenTree *)new KBTreeLib::KBFrozenTree(*arg1);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBFrozenTree, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_new_KBFrozenTree__SWIG_1) {
+  {
+    std::string *arg1 = 0 ;
+    bool arg2 ;
+    int res1 = SWIG_OLDOBJ ;
+    bool val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    KBTreeLib::KBFrozenTree *result = 0 ;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: new_KBFrozenTree(newickString,assumeBootstrapNames);");
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res1 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), &ptr);
+      if (!SWIG_IsOK(res1)) {
+        SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_KBFrozenTree" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_KBFrozenTree" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      arg1 = ptr;
+    }
+    ecode2 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_KBFrozenTree" "', argument " "2"" of type '" "bool""'");
+    } 
+    arg2 = static_cast< bool >(val2);
+    result = (KBTreeLib::KBFrozenTree *)new KBTreeLib::KBFrozenTree((std::string const &)*arg1,arg2);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBFrozenTree, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    
+    XSRETURN(argvi);
+  fail:
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_new_KBFrozenTree__SWIG_2) {
+  {
+    std::string *arg1 = 0 ;
+    int res1 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    KBTreeLib::KBFrozenTree *result = 0 ;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: new_KBFrozenTree(newickString);");
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res1 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), &ptr);
+      if (!SWIG_IsOK(res1)) {
+        SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_KBFrozenTree" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_KBFrozenTree" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      arg1 = ptr;
+    }
+    result = (KBTreeLib::KBFrozenTree *)new KBTreeLib::KBFrozenTree((std::string const &)*arg1);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBFrozenTree, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    XSRETURN(argvi);
+  fail:
+    if (SWIG_IsNewObj(res1)) delete arg1;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_new_KBFrozenTree) {
+  dXSARGS;
+  
+  {
+    unsigned long _index = 0;
+    SWIG_TypeRank _rank = 0; 
+    if (items == 1) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTree, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 1;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_1:
+    
+    if (items == 1) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 2;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_2:
+    
+    if (items == 2) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_3;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_3;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 3;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_3:
+    
+  dispatch:
+    switch(_index) {
+    case 1:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_new_KBFrozenTree__SWIG_0); return;
+    case 2:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_new_KBFrozenTree__SWIG_2); return;
+    case 3:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_new_KBFrozenTree__SWIG_1); return;
+    }
+  }
+  
+  croak("No matching function for overloaded 'new_KBFrozenTree'");
+  XSRETURN(0);
+}
+
+
+XS(_wrap_delete_KBFrozenTree) {
+  {
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: delete_KBFrozenTree(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, SWIG_POINTER_DISOWN |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_KBFrozenTree" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    delete arg1;
+    ST(argvi) = sv_newmortal();
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBFrozenTree_isSameSnapshot) {
+  {
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    KBTreeLib::KBFrozenTree *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    void *argp2 = 0 ;
+    int res2 = 0 ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBFrozenTree_isSameSnapshot(self,other);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_isSameSnapshot" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    res2 = SWIG_ConvertPtr(ST(1), &argp2, SWIGTYPE_p_KBTreeLib__KBFrozenTree,  0 );
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBFrozenTree_isSameSnapshot" "', argument " "2"" of type '" "KBTreeLib::KBFrozenTree const &""'"); 
+    }
+    if (!argp2) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBFrozenTree_isSameSnapshot" "', argument " "2"" of type '" "KBTreeLib::KBFrozenTree const &""'"); 
+    }
+    arg2 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp2);
+    result = (bool)((KBTreeLib::KBFrozenTree const *)arg1)->isSameSnapshot((KBTreeLib::KBFrozenTree const &)*arg2);
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBFrozenTree_getNodeCount) {
+  {
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBFrozenTree_getNodeCount(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_getNodeCount" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    result = (unsigned int)((KBTreeLib::KBFrozenTree const *)arg1)->getNodeCount();
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBFrozenTree_getLeafCount) {
+  {
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBFrozenTree_getLeafCount(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_getLeafCount" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    result = (unsigned int)((KBTreeLib::KBFrozenTree const *)arg1)->getLeafCount();
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBFrozenTree_getMemoryUsage) {
+  {
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    size_t result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBFrozenTree_getMemoryUsage(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_getMemoryUsage" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    result = (size_t)((KBTreeLib::KBFrozenTree const *)arg1)->getMemoryUsage();
+    ST(argvi) = SWIG_From_size_t  SWIG_PERL_CALL_ARGS_1(static_cast< size_t >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBFrozenTree_getAllLeafNames) {
+  {
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBFrozenTree_getAllLeafNames(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_getAllLeafNames" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    result = ((KBTreeLib::KBFrozenTree const *)arg1)->getAllLeafNames();
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBFrozenTree_getAllNodeNames) {
+  {
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBFrozenTree_getAllNodeNames(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_getAllNodeNames" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    result = ((KBTreeLib::KBFrozenTree const *)arg1)->getAllNodeNames();
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBFrozenTree_hasNode) {
+  {
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBFrozenTree_hasNode(self,name);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_hasNode" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBFrozenTree_hasNode" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBFrozenTree_hasNode" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = (bool)((KBTreeLib::KBFrozenTree const *)arg1)->hasNode((std::string const &)*arg2);
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBFrozenTree_getPathToRoot) {
+  {
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBFrozenTree_getPathToRoot(self,name);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_getPathToRoot" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBFrozenTree_getPathToRoot" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBFrozenTree_getPathToRoot" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = ((KBTreeLib::KBFrozenTree const *)arg1)->getPathToRoot((std::string const &)*arg2);
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBFrozenTree_getDepth) {
+  {
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    int result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBFrozenTree_getDepth(self,name);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_getDepth" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBFrozenTree_getDepth" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBFrozenTree_getDepth" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = (int)((KBTreeLib::KBFrozenTree const *)arg1)->getDepth((std::string const &)*arg2);
+    ST(argvi) = SWIG_From_int  SWIG_PERL_CALL_ARGS_1(static_cast< int >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBFrozenTree_getSubtreeSize) {
+  {
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBFrozenTree_getSubtreeSize(self,name);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_getSubtreeSize" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBFrozenTree_getSubtreeSize" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBFrozenTree_getSubtreeSize" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = (unsigned int)((KBTreeLib::KBFrozenTree const *)arg1)->getSubtreeSize((std::string const &)*arg2);
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBFrozenTree_getCladeLeafCount) {
+  {
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    unsigned int result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBFrozenTree_getCladeLeafCount(self,name);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_getCladeLeafCount" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBFrozenTree_getCladeLeafCount" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBFrozenTree_getCladeLeafCount" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = (unsigned int)((KBTreeLib::KBFrozenTree const *)arg1)->getCladeLeafCount((std::string const &)*arg2);
+    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBFrozenTree_getDistanceToRoot) {
+  {
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    double result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBFrozenTree_getDistanceToRoot(self,name);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_getDistanceToRoot" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBFrozenTree_getDistanceToRoot" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBFrozenTree_getDistanceToRoot" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = (double)((KBTreeLib::KBFrozenTree const *)arg1)->getDistanceToRoot((std::string const &)*arg2);
+    ST(argvi) = SWIG_From_double  SWIG_PERL_CALL_ARGS_1(static_cast< double >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBFrozenTree_getLowestCommonAncestorNames) {
+  {
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBFrozenTree_getLowestCommonAncestorNames(self,namePairs);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_getLowestCommonAncestorNames" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBFrozenTree_getLowestCommonAncestorNames" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBFrozenTree_getLowestCommonAncestorNames" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = ((KBTreeLib::KBFrozenTree const *)arg1)->getLowestCommonAncestorNames((std::string const &)*arg2);
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBFrozenTree_isMonophyletic) {
+  {
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBFrozenTree_isMonophyletic(self,leafNames);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_isMonophyletic" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBFrozenTree_isMonophyletic" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBFrozenTree_isMonophyletic" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = (bool)((KBTreeLib::KBFrozenTree const *)arg1)->isMonophyletic((std::string const &)*arg2);
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBFrozenTree_getPatristicDistance) {
+  {
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    std::string *arg2 = 0 ;
+    std::string *arg3 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int res3 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    double result;
+    dXSARGS;
+    
+    if ((items < 3) || (items > 3)) {
+      SWIG_croak("Usage: KBFrozenTree_getPatristicDistance(self,nameA,nameB);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_getPatristicDistance" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBFrozenTree_getPatristicDistance" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBFrozenTree_getPatristicDistance" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res3 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(2), &ptr);
+      if (!SWIG_IsOK(res3)) {
+        SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "KBFrozenTree_getPatristicDistance" "', argument " "3"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBFrozenTree_getPatristicDistance" "', argument " "3"" of type '" "std::string const &""'"); 
+      }
+      arg3 = ptr;
+    }
+    result = (double)((KBTreeLib::KBFrozenTree const *)arg1)->getPatristicDistance((std::string const &)*arg2,(std::string const &)*arg3);
+    ST(argvi) = SWIG_From_double  SWIG_PERL_CALL_ARGS_1(static_cast< double >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    if (SWIG_IsNewObj(res3)) delete arg3;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    if (SWIG_IsNewObj(res3)) delete arg3;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBFrozenTree_writePatristicDistancesToFile__SWIG_0) {
+  {
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    std::string *arg2 = 0 ;
+    std::string *arg3 = 0 ;
+    unsigned int arg4 ;
+    unsigned int arg5 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int res3 = SWIG_OLDOBJ ;
+    unsigned int val4 ;
+    int ecode4 = 0 ;
+    unsigned int val5 ;
+    int ecode5 = 0 ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 5) || (items > 5)) {
+      SWIG_croak("Usage: KBFrozenTree_writePatristicDistancesToFile(self,filename,names,format,threadCount);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_writePatristicDistancesToFile" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBFrozenTree_writePatristicDistancesToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBFrozenTree_writePatristicDistancesToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res3 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(2), &ptr);
+      if (!SWIG_IsOK(res3)) {
+        SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "KBFrozenTree_writePatristicDistancesToFile" "', argument " "3"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBFrozenTree_writePatristicDistancesToFile" "', argument " "3"" of type '" "std::string const &""'"); 
+      }
+      arg3 = ptr;
+    }
+    ecode4 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(3), &val4);
+    if (!SWIG_IsOK(ecode4)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "KBFrozenTree_writePatristicDistancesToFile" "', argument " "4"" of type '" "unsigned int""'");
+    } 
+    arg4 = static_cast< unsigned int >(val4);
+    ecode5 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(4), &val5);
+    if (!SWIG_IsOK(ecode5)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode5), "in method '" "KBFrozenTree_writePatristicDistancesToFile" "', argument " "5"" of type '" "unsigned int""'");
+    } 
+    arg5 = static_cast< unsigned int >(val5);
+    result = (bool)((KBTreeLib::KBFrozenTree const *)arg1)->writePatristicDistancesToFile((std::string const &)*arg2,(std::string const &)*arg3,arg4,arg5);
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    if (SWIG_IsNewObj(res3)) delete arg3;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    if (SWIG_IsNewObj(res3)) delete arg3;
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBFrozenTree_writePatristicDistancesToFile__SWIG_1) {
+  {
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    std::string *arg2 = 0 ;
+    std::string *arg3 = 0 ;
+    unsigned int arg4 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int res3 = SWIG_OLDOBJ ;
+    unsigned int val4 ;
+    int ecode4 = 0 ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 4) || (items > 4)) {
+      SWIG_croak("Usage: KBFrozenTree_writePatristicDistancesToFile(self,filename,names,format);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_writePatristicDistancesToFile" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBFrozenTree_writePatristicDistancesToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBFrozenTree_writePatristicDistancesToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res3 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(2), &ptr);
+      if (!SWIG_IsOK(res3)) {
+        SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "KBFrozenTree_writePatristicDistancesToFile" "', argument " "3"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBFrozenTree_writePatristicDistancesToFile" "', argument " "3"" of type '" "std::string const &""'"); 
+      }
+      arg3 = ptr;
+    }
+    ecode4 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(3), &val4);
+    if (!SWIG_IsOK(ecode4)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "KBFrozenTree_writePatristicDistancesToFile" "', argument " "4"" of type '" "unsigned int""'");
+    } 
+    arg4 = static_cast< unsigned int >(val4);
+    result = (bool)((KBTreeLib::KBFrozenTree const *)arg1)->writePatristicDistancesToFile((std::string const &)*arg2,(std::string const &)*arg3,arg4);
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    if (SWIG_IsNewObj(res3)) delete arg3;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    if (SWIG_IsNewObj(res3)) delete arg3;
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBFrozenTree_writePatristicDistancesToFile__SWIG_2) {
+  {
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    std::string *arg2 = 0 ;
+    std::string *arg3 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int res3 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 3) || (items > 3)) {
+      SWIG_croak("Usage: KBFrozenTree_writePatristicDistancesToFile(self,filename,names);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_writePatristicDistancesToFile" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBFrozenTree_writePatristicDistancesToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBFrozenTree_writePatristicDistancesToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    {
+      std::string *ptr = (std::string *)0;
+      res3 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(2), &ptr);
+      if (!SWIG_IsOK(res3)) {
+        SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "KBFrozenTree_writePatristicDistancesToFile" "', argument " "3"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBFrozenTree_writePatristicDistancesToFile" "', argument " "3"" of type '" "std::string const &""'"); 
+      }
+      arg3 = ptr;
+    }
+    result = (bool)((KBTreeLib::KBFrozenTree const *)arg1)->writePatristicDistancesToFile((std::string const &)*arg2,(std::string const &)*arg3);
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    if (SWIG_IsNewObj(res3)) delete arg3;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    if (SWIG_IsNewObj(res3)) delete arg3;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBFrozenTree_writePatristicDistancesToFile__SWIG_3) {
+  {
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBFrozenTree_writePatristicDistancesToFile(self,filename);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_writePatristicDistancesToFile" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBFrozenTree_writePatristicDistancesToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBFrozenTree_writePatristicDistancesToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = (bool)((KBTreeLib::KBFrozenTree const *)arg1)->writePatristicDistancesToFile((std::string const &)*arg2);
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBFrozenTree_writePatristicDistancesToFile) {
+  dXSARGS;
+  
+  {
+    unsigned long _index = 0;
+    SWIG_TypeRank _rank = 0; 
+    if (items == 2) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 1;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_1:
+    
+    if (items == 3) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(2), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 2;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_2:
+    
+    if (items == 4) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_3;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_3;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(2), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_3;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(3), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_3;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 3;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_3:
+    
+    if (items == 5) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_4;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_4;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(2), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_4;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(3), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_4;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(4), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_4;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 4;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_4:
+    
+  dispatch:
+    switch(_index) {
+    case 1:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBFrozenTree_writePatristicDistancesToFile__SWIG_3); return;
+    case 2:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBFrozenTree_writePatristicDistancesToFile__SWIG_2); return;
+    case 3:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBFrozenTree_writePatristicDistancesToFile__SWIG_1); return;
+    case 4:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBFrozenTree_writePatristicDistancesToFile__SWIG_0); return;
+    }
+  }
+  
+  croak("No matching function for overloaded 'KBFrozenTree_writePatristicDistancesToFile'");
+  XSRETURN(0);
+}
+
+
+XS(_wrap_KBFrozenTree_toNewick__SWIG_0) {
+  {
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBFrozenTree_toNewick(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_toNewick" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    result = ((KBTreeLib::KBFrozenTree const *)arg1)->toNewick();
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBFrozenTree_toNewick__SWIG_1) {
+  {
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    unsigned int arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned int val2 ;
+    int ecode2 = 0 ;
+    int argvi = 0;
+    std::string result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBFrozenTree_toNewick(self,style);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_toNewick" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBFrozenTree_toNewick" "', argument " "2"" of type '" "unsigned int""'");
+    } 
+    arg2 = static_cast< unsigned int >(val2);
+    result = ((KBTreeLib::KBFrozenTree const *)arg1)->toNewick(arg2);
+    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    
+    
+    XSRETURN(argvi);
+  fail:
+    
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBFrozenTree_toNewick) {
+  dXSARGS;
+  
+  {
+    unsigned long _index = 0;
+    SWIG_TypeRank _rank = 0; 
+    if (items == 1) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 1;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_1:
+    
+    if (items == 2) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 2;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_2:
+    
+  dispatch:
+    switch(_index) {
+    case 1:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBFrozenTree_toNewick__SWIG_0); return;
+    case 2:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBFrozenTree_toNewick__SWIG_1); return;
+    }
+  }
+  
+  croak("No matching function for overloaded 'KBFrozenTree_toNewick'");
+  XSRETURN(0);
+}
+
+
+XS(_wrap_KBFrozenTree_writeNewickToFile__SWIG_0) {
+  {
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    std::string *arg2 = 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    int argvi = 0;
+    bool result;
+    dXSARGS;
+    
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBFrozenTree_writeNewickToFile(self,filename);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_writeNewickToFile" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBFrozenTree_writeNewickToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBFrozenTree_writeNewickToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = (bool)((KBTreeLib::KBFrozenTree const *)arg1)->writeNewickToFile((std::string const &)*arg2);
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
     
+    if (SWIG_IsNewObj(res2)) delete arg2;
     XSRETURN(argvi);
   fail:
-    if (SWIG_IsNewObj(res1)) delete arg1;
     
+    if (SWIG_IsNewObj(res2)) delete arg2;
     SWIG_croak_null();
   }
 }
 
 
-XS(_wrap_new_KBTree__SWIG_2) {
+XS(_wrap_KBFrozenTree_writeNewickToFile__SWIG_1) {
   {
-    std::string *arg1 = 0 ;
-    bool arg2 ;
-    bool arg3 ;
-    int res1 = SWIG_OLDOBJ ;
-    bool val2 ;
-    int ecode2 = 0 ;
-    bool val3 ;
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    std::string *arg2 = 0 ;
+    unsigned int arg3 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    unsigned int val3 ;
     int ecode3 = 0 ;
     int argvi = 0;
-    KBTreeLib::KBTree *result = 0 ;
+    bool result;
     dXSARGS;
     
     if ((items < 3) || (items > 3)) {
-      SWIG_croak("Usage: new_KBTree(newickString,verbose,assumeBootstrapNames);");
+      SWIG_croak("Usage: KBFrozenTree_writeNewickToFile(self,filename,style);");
     }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_writeNewickToFile" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
     {
       std::string *ptr = (std::string *)0;
-      res1 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), &ptr);
-      if (!SWIG_IsOK(res1)) {
-        SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_KBTree" "', argument " "1"" of type '" "std::string const &""'"); 
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBFrozenTree_writeNewickToFile" "', argument " "2"" of type '" "std::string const &""'"); 
       }
       if (!ptr) {
-        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_KBTree" "', argument " "1"" of type '" "std::string const &""'"); 
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBFrozenTree_writeNewickToFile" "', argument " "2"" of type '" "std::string const &""'"); 
       }
-      arg1 = ptr;
+      arg2 = ptr;
     }
-    ecode2 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
-    if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_KBTree" "', argument " "2"" of type '" "bool""'");
-    } 
-    arg2 = static_cast< bool >(val2);
-    ecode3 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), &val3);
+    ecode3 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(2), &val3);
     if (!SWIG_IsOK(ecode3)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "new_KBTree" "', argument " "3"" of type '" "bool""'");
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "KBFrozenTree_writeNewickToFile" "', argument " "3"" of type '" "unsigned int""'");
     } 
-    arg3 = static_cast< bool >(val3);
-    result = (KBTreeLib::KBTree *)new KBTreeLib::KBTree((std::string const &)*arg1,arg2,arg3);
-    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTree, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
-    if (SWIG_IsNewObj(res1)) delete arg1;
+    arg3 = static_cast< unsigned int >(val3);
+    result = (bool)((KBTreeLib::KBFrozenTree const *)arg1)->writeNewickToFile((std::string const &)*arg2,arg3);
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
     
+    if (SWIG_IsNewObj(res2)) delete arg2;
     
     XSRETURN(argvi);
   fail:
-    if (SWIG_IsNewObj(res1)) delete arg1;
     
+    if (SWIG_IsNewObj(res2)) delete arg2;
     
     SWIG_croak_null();
   }
 }
 
 
-XS(_wrap_new_KBTree) {
+XS(_wrap_KBFrozenTree_writeNewickToFile) {
   dXSARGS;
   
   {
     unsigned long _index = 0;
     SWIG_TypeRank _rank = 0; 
-    if (items == 1) {
+    if (items == 2) {
       SWIG_TypeRank _ranki = 0;
       SWIG_TypeRank _rankm = 0;
       SWIG_TypeRank _pi = 1;
       int _v = 0;
       {
-        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), (std::string**)(0));
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0);
         _v = SWIG_CheckState(res);
       }
       if (!_v) goto check_1;
       _ranki += _v*_pi;
       _rankm += _pi;
       _pi *= SWIG_MAXCASTRANK;
-      if (!_index || (_ranki < _rank)) {
-        _rank = _ranki; _index = 1;
-        if (_rank == _rankm) goto dispatch;
-      }
-    }
-  check_1:
-    
-    if (items == 2) {
-      SWIG_TypeRank _ranki = 0;
-      SWIG_TypeRank _rankm = 0;
-      SWIG_TypeRank _pi = 1;
-      int _v = 0;
       {
-        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), (std::string**)(0));
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), (std::string**)(0));
         _v = SWIG_CheckState(res);
       }
-      if (!_v) goto check_2;
-      _ranki += _v*_pi;
-      _rankm += _pi;
-      _pi *= SWIG_MAXCASTRANK;
-      {
-        {
-          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), NULL);
-          _v = SWIG_CheckState(res);
-        }
-      }
-      if (!_v) goto check_2;
+      if (!_v) goto check_1;
       _ranki += _v*_pi;
       _rankm += _pi;
       _pi *= SWIG_MAXCASTRANK;
       if (!_index || (_ranki < _rank)) {
-        _rank = _ranki; _index = 2;
+        _rank = _ranki; _index = 1;
         if (_rank == _rankm) goto dispatch;
       }
     }
-  check_2:
+  check_1:
     
     if (items == 3) {
       SWIG_TypeRank _ranki = 0;
@@ -2122,74 +9079,72 @@ XS(_wrap_new_KBTree) {
       SWIG_TypeRank _pi = 1;
       int _v = 0;
       {
-        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), (std::string**)(0));
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0);
         _v = SWIG_CheckState(res);
       }
-      if (!_v) goto check_3;
+      if (!_v) goto check_2;
       _ranki += _v*_pi;
       _rankm += _pi;
       _pi *= SWIG_MAXCASTRANK;
       {
-        {
-          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), NULL);
-          _v = SWIG_CheckState(res);
-        }
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), (std::string**)(0));
+        _v = SWIG_CheckState(res);
       }
-      if (!_v) goto check_3;
+      if (!_v) goto check_2;
       _ranki += _v*_pi;
       _rankm += _pi;
       _pi *= SWIG_MAXCASTRANK;
       {
         {
-          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), NULL);
+          int res = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(2), NULL);
           _v = SWIG_CheckState(res);
         }
       }
-      if (!_v) goto check_3;
+      if (!_v) goto check_2;
       _ranki += _v*_pi;
       _rankm += _pi;
       _pi *= SWIG_MAXCASTRANK;
       if (!_index || (_ranki < _rank)) {
-        _rank = _ranki; _index = 3;
+        _rank = _ranki; _index = 2;
         if (_rank == _rankm) goto dispatch;
       }
     }
-  check_3:
+  check_2:
     
   dispatch:
     switch(_index) {
     case 1:
-      PUSHMARK(MARK); SWIG_CALLXS(_wrap_new_KBTree__SWIG_0); return;
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBFrozenTree_writeNewickToFile__SWIG_0); return;
     case 2:
-      PUSHMARK(MARK); SWIG_CALLXS(_wrap_new_KBTree__SWIG_1); return;
-    case 3:
-      PUSHMARK(MARK); SWIG_CALLXS(_wrap_new_KBTree__SWIG_2); return;
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBFrozenTree_writeNewickToFile__SWIG_1); return;
     }
   }
   
-  croak("No matching function for overloaded 'new_KBTree'");
+  croak("No matching function for overloaded 'KBFrozenTree_writeNewickToFile'");
   XSRETURN(0);
 }
 
 
-XS(_wrap_delete_KBTree) {
+XS(_wrap_KBFrozenTree_toKBTree) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
     int argvi = 0;
+    KBTreeLib::KBTree *result = 0 ;
     dXSARGS;
     
     if ((items < 1) || (items > 1)) {
-      SWIG_croak("Usage: delete_KBTree(self);");
+      SWIG_croak("Usage: KBFrozenTree_toKBTree(self);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, SWIG_POINTER_DISOWN |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_KBTree" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_toKBTree" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    delete arg1;
-    ST(argvi) = sv_newmortal();
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    result = (KBTreeLib::KBTree *)((KBTreeLib::KBFrozenTree const *)arg1)->toKBTree();
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTree, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
     
     XSRETURN(argvi);
   fail:
@@ -2199,234 +9154,360 @@ XS(_wrap_delete_KBTree) {
 }
 
 
-XS(_wrap_KBTree_toNewick__SWIG_0) {
+XS(_wrap_KBFrozenTree_removeNodesByNameAndSimplify) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    std::string *arg2 = 0 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
     int argvi = 0;
-    std::string result;
+    SwigValueWrapper< KBTreeLib::KBFrozenTree > result;
     dXSARGS;
     
-    if ((items < 1) || (items > 1)) {
-      SWIG_croak("Usage: KBTree_toNewick(self);");
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBFrozenTree_removeNodesByNameAndSimplify(self,nodeNames);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_toNewick" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_removeNodesByNameAndSimplify" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    result = (arg1)->toNewick();
-    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBFrozenTree_removeNodesByNameAndSimplify" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBFrozenTree_removeNodesByNameAndSimplify" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    try {
+      result = ((KBTreeLib::KBFrozenTree const *)arg1)->removeNodesByNameAndSimplify((std::string const &)*arg2);
+    }
+    catch(KBTreeLib::ParseException &_e) {
+      SWIG_croak(_e.what().c_str());
+    }
+    ST(argvi) = SWIG_NewPointerObj((new KBTreeLib::KBFrozenTree(static_cast< const KBTreeLib::KBFrozenTree& >(result))), SWIGTYPE_p_KBTreeLib__KBFrozenTree, SWIG_POINTER_OWN | SWIG_SHADOW); argvi++ ;
     
+    if (SWIG_IsNewObj(res2)) delete arg2;
     XSRETURN(argvi);
   fail:
     
+    if (SWIG_IsNewObj(res2)) delete arg2;
     SWIG_croak_null();
   }
 }
 
 
-XS(_wrap_KBTree_setOutputFlagLabel) {
+XS(_wrap_KBFrozenTree_replaceNodeNames) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-    bool arg2 ;
+    KBTreeLib::KBFrozenTree *arg1 = (KBTreeLib::KBFrozenTree *) 0 ;
+    std::string *arg2 = 0 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
-    bool val2 ;
-    int ecode2 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
     int argvi = 0;
+    SwigValueWrapper< KBTreeLib::KBFrozenTree > result;
     dXSARGS;
     
     if ((items < 2) || (items > 2)) {
-      SWIG_croak("Usage: KBTree_setOutputFlagLabel(self,flag);");
+      SWIG_croak("Usage: KBFrozenTree_replaceNodeNames(self,replacements);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBFrozenTree, 0 |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_setOutputFlagLabel" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBFrozenTree_replaceNodeNames" "', argument " "1"" of type '" "KBTreeLib::KBFrozenTree const *""'"); 
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    ecode2 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
-    if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_setOutputFlagLabel" "', argument " "2"" of type '" "bool""'");
-    } 
-    arg2 = static_cast< bool >(val2);
-    (arg1)->setOutputFlagLabel(arg2);
-    ST(argvi) = sv_newmortal();
+    arg1 = reinterpret_cast< KBTreeLib::KBFrozenTree * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBFrozenTree_replaceNodeNames" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBFrozenTree_replaceNodeNames" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = ((KBTreeLib::KBFrozenTree const *)arg1)->replaceNodeNames((std::string const &)*arg2);
+    ST(argvi) = SWIG_NewPointerObj((new KBTreeLib::KBFrozenTree(static_cast< const KBTreeLib::KBFrozenTree& >(result))), SWIGTYPE_p_KBTreeLib__KBFrozenTree, SWIG_POINTER_OWN | SWIG_SHADOW); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    XSRETURN(argvi);
+  fail:
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_new_KBTreeCache__SWIG_0) {
+  {
+    size_t arg1 ;
+    size_t val1 ;
+    int ecode1 = 0 ;
+    int argvi = 0;
+    KBTreeLib::KBTreeCache *result = 0 ;
+    dXSARGS;
     
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: new_KBTreeCache(memoryBudget);");
+    }
+    ecode1 = SWIG_AsVal_size_t SWIG_PERL_CALL_ARGS_2(ST(0), &val1);
+    if (!SWIG_IsOK(ecode1)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "new_KBTreeCache" "', argument " "1"" of type '" "size_t""'");
+    } 
+    arg1 = static_cast< size_t >(val1);
+    result = (KBTreeLib::KBTreeCache *)new KBTreeLib::KBTreeCache(arg1);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTreeCache, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
     
     XSRETURN(argvi);
   fail:
     
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_new_KBTreeCache__SWIG_1) {
+  {
+    int argvi = 0;
+    KBTreeLib::KBTreeCache *result = 0 ;
+    dXSARGS;
     
+    if ((items < 0) || (items > 0)) {
+      SWIG_croak("Usage: new_KBTreeCache();");
+    }
+    result = (KBTreeLib::KBTreeCache *)new KBTreeLib::KBTreeCache();
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTreeCache, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    XSRETURN(argvi);
+  fail:
     SWIG_croak_null();
   }
 }
 
 
-XS(_wrap_KBTree_setOutputFlagDistances) {
+XS(_wrap_new_KBTreeCache) {
+  dXSARGS;
+  
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-    bool arg2 ;
+    unsigned long _index = 0;
+    SWIG_TypeRank _rank = 0; 
+    if (items == 0) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 1;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_1:
+    
+    if (items == 1) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        {
+          int res = SWIG_AsVal_size_t SWIG_PERL_CALL_ARGS_2(ST(0), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 2;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_2:
+    
+  dispatch:
+    switch(_index) {
+    case 1:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_new_KBTreeCache__SWIG_1); return;
+    case 2:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_new_KBTreeCache__SWIG_0); return;
+    }
+  }
+  
+  croak("No matching function for overloaded 'new_KBTreeCache'");
+  XSRETURN(0);
+}
+
+
+XS(_wrap_delete_KBTreeCache) {
+  {
+    KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
     void *argp1 = 0 ;
-    int res1 = 0 ;
-    bool val2 ;
-    int ecode2 = 0 ;
+    int res1 = 0 ;
     int argvi = 0;
     dXSARGS;
     
-    if ((items < 2) || (items > 2)) {
-      SWIG_croak("Usage: KBTree_setOutputFlagDistances(self,flag);");
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: delete_KBTreeCache(self);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCache, SWIG_POINTER_DISOWN |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_setOutputFlagDistances" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_KBTreeCache" "', argument " "1"" of type '" "KBTreeLib::KBTreeCache *""'"); 
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    ecode2 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
-    if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_setOutputFlagDistances" "', argument " "2"" of type '" "bool""'");
-    } 
-    arg2 = static_cast< bool >(val2);
-    (arg1)->setOutputFlagDistances(arg2);
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCache * >(argp1);
+    delete arg1;
     ST(argvi) = sv_newmortal();
     
-    
     XSRETURN(argvi);
   fail:
     
-    
     SWIG_croak_null();
   }
 }
 
 
-XS(_wrap_KBTree_setOutputFlagComments) {
+XS(_wrap_KBTreeCache_getShared) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-    bool arg2 ;
-    void *argp1 = 0 ;
-    int res1 = 0 ;
-    bool val2 ;
-    int ecode2 = 0 ;
     int argvi = 0;
+    KBTreeLib::KBTreeCache *result = 0 ;
     dXSARGS;
     
-    if ((items < 2) || (items > 2)) {
-      SWIG_croak("Usage: KBTree_setOutputFlagComments(self,flag);");
-    }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
-    if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_setOutputFlagComments" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    if ((items < 0) || (items > 0)) {
+      SWIG_croak("Usage: KBTreeCache_getShared();");
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    ecode2 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
-    if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_setOutputFlagComments" "', argument " "2"" of type '" "bool""'");
-    } 
-    arg2 = static_cast< bool >(val2);
-    (arg1)->setOutputFlagComments(arg2);
-    ST(argvi) = sv_newmortal();
-    
-    
+    result = (KBTreeLib::KBTreeCache *) &KBTreeLib::KBTreeCache::getShared();
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTreeCache, 0 | SWIG_SHADOW); argvi++ ;
     XSRETURN(argvi);
   fail:
-    
-    
     SWIG_croak_null();
   }
 }
 
 
-XS(_wrap_KBTree_setOutputFlagBootstrapValuesAsLabels) {
+XS(_wrap_KBTreeCache_get__SWIG_0) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-    bool arg2 ;
+    KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
+    std::string *arg2 = 0 ;
+    bool arg3 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
-    bool val2 ;
-    int ecode2 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    bool val3 ;
+    int ecode3 = 0 ;
     int argvi = 0;
+    SwigValueWrapper< KBTreeLib::KBFrozenTree > result;
     dXSARGS;
     
-    if ((items < 2) || (items > 2)) {
-      SWIG_croak("Usage: KBTree_setOutputFlagBootstrapValuesAsLabels(self,flag);");
+    if ((items < 3) || (items > 3)) {
+      SWIG_croak("Usage: KBTreeCache_get(self,newickString,assumeBootstrapNames);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCache, 0 |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_setOutputFlagBootstrapValuesAsLabels" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeCache_get" "', argument " "1"" of type '" "KBTreeLib::KBTreeCache *""'"); 
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    ecode2 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
-    if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_setOutputFlagBootstrapValuesAsLabels" "', argument " "2"" of type '" "bool""'");
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCache * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTreeCache_get" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTreeCache_get" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    ecode3 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "KBTreeCache_get" "', argument " "3"" of type '" "bool""'");
     } 
-    arg2 = static_cast< bool >(val2);
-    (arg1)->setOutputFlagBootstrapValuesAsLabels(arg2);
-    ST(argvi) = sv_newmortal();
+    arg3 = static_cast< bool >(val3);
+    result = (arg1)->get((std::string const &)*arg2,arg3);
+    ST(argvi) = SWIG_NewPointerObj((new KBTreeLib::KBFrozenTree(static_cast< const KBTreeLib::KBFrozenTree& >(result))), SWIGTYPE_p_KBTreeLib__KBFrozenTree, SWIG_POINTER_OWN | SWIG_SHADOW); argvi++ ;
     
+    if (SWIG_IsNewObj(res2)) delete arg2;
     
     XSRETURN(argvi);
   fail:
     
+    if (SWIG_IsNewObj(res2)) delete arg2;
     
     SWIG_croak_null();
   }
 }
 
 
-XS(_wrap_KBTree_toNewick__SWIG_1) {
+XS(_wrap_KBTreeCache_get__SWIG_1) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-    unsigned int arg2 ;
+    KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
+    std::string *arg2 = 0 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
-    unsigned int val2 ;
-    int ecode2 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
     int argvi = 0;
-    std::string result;
+    SwigValueWrapper< KBTreeLib::KBFrozenTree > result;
     dXSARGS;
     
     if ((items < 2) || (items > 2)) {
-      SWIG_croak("Usage: KBTree_toNewick(self,style);");
+      SWIG_croak("Usage: KBTreeCache_get(self,newickString);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCache, 0 |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_toNewick" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeCache_get" "', argument " "1"" of type '" "KBTreeLib::KBTreeCache *""'"); 
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
-    if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_toNewick" "', argument " "2"" of type '" "unsigned int""'");
-    } 
-    arg2 = static_cast< unsigned int >(val2);
-    result = (arg1)->toNewick(arg2);
-    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
-    
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCache * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTreeCache_get" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTreeCache_get" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = (arg1)->get((std::string const &)*arg2);
+    ST(argvi) = SWIG_NewPointerObj((new KBTreeLib::KBFrozenTree(static_cast< const KBTreeLib::KBFrozenTree& >(result))), SWIGTYPE_p_KBTreeLib__KBFrozenTree, SWIG_POINTER_OWN | SWIG_SHADOW); argvi++ ;
     
+    if (SWIG_IsNewObj(res2)) delete arg2;
     XSRETURN(argvi);
   fail:
     
-    
+    if (SWIG_IsNewObj(res2)) delete arg2;
     SWIG_croak_null();
   }
 }
 
 
-XS(_wrap_KBTree_toNewick) {
+XS(_wrap_KBTreeCache_get) {
   dXSARGS;
   
   {
     unsigned long _index = 0;
     SWIG_TypeRank _rank = 0; 
-    if (items == 1) {
+    if (items == 2) {
       SWIG_TypeRank _ranki = 0;
       SWIG_TypeRank _rankm = 0;
       SWIG_TypeRank _pi = 1;
       int _v = 0;
       {
         void *vptr = 0;
-        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTree, 0);
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTreeCache, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), (std::string**)(0));
         _v = SWIG_CheckState(res);
       }
       if (!_v) goto check_1;
@@ -2440,14 +9521,22 @@ XS(_wrap_KBTree_toNewick) {
     }
   check_1:
     
-    if (items == 2) {
+    if (items == 3) {
       SWIG_TypeRank _ranki = 0;
       SWIG_TypeRank _rankm = 0;
       SWIG_TypeRank _pi = 1;
       int _v = 0;
       {
         void *vptr = 0;
-        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTree, 0);
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTreeCache, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), (std::string**)(0));
         _v = SWIG_CheckState(res);
       }
       if (!_v) goto check_2;
@@ -2456,7 +9545,7 @@ XS(_wrap_KBTree_toNewick) {
       _pi *= SWIG_MAXCASTRANK;
       {
         {
-          int res = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), NULL);
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), NULL);
           _v = SWIG_CheckState(res);
         }
       }
@@ -2474,114 +9563,114 @@ XS(_wrap_KBTree_toNewick) {
   dispatch:
     switch(_index) {
     case 1:
-      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_toNewick__SWIG_0); return;
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTreeCache_get__SWIG_1); return;
     case 2:
-      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_toNewick__SWIG_1); return;
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTreeCache_get__SWIG_0); return;
     }
   }
   
-  croak("No matching function for overloaded 'KBTree_toNewick'");
+  croak("No matching function for overloaded 'KBTreeCache_get'");
   XSRETURN(0);
 }
 
 
-XS(_wrap_KBTree_writeNewickToFile__SWIG_0) {
+XS(_wrap_KBTreeCache_contains__SWIG_0) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
     std::string *arg2 = 0 ;
+    bool arg3 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
     int res2 = SWIG_OLDOBJ ;
+    bool val3 ;
+    int ecode3 = 0 ;
     int argvi = 0;
     bool result;
     dXSARGS;
     
-    if ((items < 2) || (items > 2)) {
-      SWIG_croak("Usage: KBTree_writeNewickToFile(self,filename);");
+    if ((items < 3) || (items > 3)) {
+      SWIG_croak("Usage: KBTreeCache_contains(self,newickString,assumeBootstrapNames);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCache, 0 |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_writeNewickToFile" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeCache_contains" "', argument " "1"" of type '" "KBTreeLib::KBTreeCache const *""'"); 
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCache * >(argp1);
     {
       std::string *ptr = (std::string *)0;
       res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
       if (!SWIG_IsOK(res2)) {
-        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_writeNewickToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTreeCache_contains" "', argument " "2"" of type '" "std::string const &""'"); 
       }
       if (!ptr) {
-        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_writeNewickToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTreeCache_contains" "', argument " "2"" of type '" "std::string const &""'"); 
       }
       arg2 = ptr;
     }
-    result = (bool)(arg1)->writeNewickToFile((std::string const &)*arg2);
+    ecode3 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "KBTreeCache_contains" "', argument " "3"" of type '" "bool""'");
+    } 
+    arg3 = static_cast< bool >(val3);
+    result = (bool)((KBTreeLib::KBTreeCache const *)arg1)->contains((std::string const &)*arg2,arg3);
     ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
     
     if (SWIG_IsNewObj(res2)) delete arg2;
+    
     XSRETURN(argvi);
   fail:
     
     if (SWIG_IsNewObj(res2)) delete arg2;
+    
     SWIG_croak_null();
   }
 }
 
 
-XS(_wrap_KBTree_writeNewickToFile__SWIG_1) {
+XS(_wrap_KBTreeCache_contains__SWIG_1) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
     std::string *arg2 = 0 ;
-    unsigned int arg3 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
     int res2 = SWIG_OLDOBJ ;
-    unsigned int val3 ;
-    int ecode3 = 0 ;
     int argvi = 0;
     bool result;
     dXSARGS;
     
-    if ((items < 3) || (items > 3)) {
-      SWIG_croak("Usage: KBTree_writeNewickToFile(self,filename,style);");
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTreeCache_contains(self,newickString);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCache, 0 |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_writeNewickToFile" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeCache_contains" "', argument " "1"" of type '" "KBTreeLib::KBTreeCache const *""'"); 
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCache * >(argp1);
     {
       std::string *ptr = (std::string *)0;
       res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
       if (!SWIG_IsOK(res2)) {
-        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_writeNewickToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTreeCache_contains" "', argument " "2"" of type '" "std::string const &""'"); 
       }
       if (!ptr) {
-        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_writeNewickToFile" "', argument " "2"" of type '" "std::string const &""'"); 
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTreeCache_contains" "', argument " "2"" of type '" "std::string const &""'"); 
       }
       arg2 = ptr;
     }
-    ecode3 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(2), &val3);
-    if (!SWIG_IsOK(ecode3)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "KBTree_writeNewickToFile" "', argument " "3"" of type '" "unsigned int""'");
-    } 
-    arg3 = static_cast< unsigned int >(val3);
-    result = (bool)(arg1)->writeNewickToFile((std::string const &)*arg2,arg3);
+    result = (bool)((KBTreeLib::KBTreeCache const *)arg1)->contains((std::string const &)*arg2);
     ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
     
     if (SWIG_IsNewObj(res2)) delete arg2;
-    
     XSRETURN(argvi);
   fail:
     
     if (SWIG_IsNewObj(res2)) delete arg2;
-    
     SWIG_croak_null();
   }
 }
 
 
-XS(_wrap_KBTree_writeNewickToFile) {
+XS(_wrap_KBTreeCache_contains) {
   dXSARGS;
   
   {
@@ -2594,7 +9683,7 @@ XS(_wrap_KBTree_writeNewickToFile) {
       int _v = 0;
       {
         void *vptr = 0;
-        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTree, 0);
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTreeCache, 0);
         _v = SWIG_CheckState(res);
       }
       if (!_v) goto check_1;
@@ -2623,7 +9712,7 @@ XS(_wrap_KBTree_writeNewickToFile) {
       int _v = 0;
       {
         void *vptr = 0;
-        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTree, 0);
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTreeCache, 0);
         _v = SWIG_CheckState(res);
       }
       if (!_v) goto check_2;
@@ -2640,7 +9729,7 @@ XS(_wrap_KBTree_writeNewickToFile) {
       _pi *= SWIG_MAXCASTRANK;
       {
         {
-          int res = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(2), NULL);
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), NULL);
           _v = SWIG_CheckState(res);
         }
       }
@@ -2658,188 +9747,100 @@ XS(_wrap_KBTree_writeNewickToFile) {
   dispatch:
     switch(_index) {
     case 1:
-      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_writeNewickToFile__SWIG_0); return;
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTreeCache_contains__SWIG_1); return;
     case 2:
-      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_writeNewickToFile__SWIG_1); return;
-    }
-  }
-  
-  croak("No matching function for overloaded 'KBTree_writeNewickToFile'");
-  XSRETURN(0);
-}
-
-
-XS(_wrap_KBTree_removeNodesByNameAndSimplify) {
-  {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-    std::string *arg2 = 0 ;
-    void *argp1 = 0 ;
-    int res1 = 0 ;
-    int res2 = SWIG_OLDOBJ ;
-    int argvi = 0;
-    dXSARGS;
-    
-    if ((items < 2) || (items > 2)) {
-      SWIG_croak("Usage: KBTree_removeNodesByNameAndSimplify(self,nodeNames);");
-    }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
-    if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_removeNodesByNameAndSimplify" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
-    }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    {
-      std::string *ptr = (std::string *)0;
-      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
-      if (!SWIG_IsOK(res2)) {
-        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_removeNodesByNameAndSimplify" "', argument " "2"" of type '" "std::string const &""'"); 
-      }
-      if (!ptr) {
-        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_removeNodesByNameAndSimplify" "', argument " "2"" of type '" "std::string const &""'"); 
-      }
-      arg2 = ptr;
-    }
-    (arg1)->removeNodesByNameAndSimplify((std::string const &)*arg2);
-    ST(argvi) = sv_newmortal();
-    
-    if (SWIG_IsNewObj(res2)) delete arg2;
-    XSRETURN(argvi);
-  fail:
-    
-    if (SWIG_IsNewObj(res2)) delete arg2;
-    SWIG_croak_null();
-  }
-}
-
-
-XS(_wrap_KBTree_mergeZeroDistLeaves) {
-  {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-    void *argp1 = 0 ;
-    int res1 = 0 ;
-    int argvi = 0;
-    dXSARGS;
-    
-    if ((items < 1) || (items > 1)) {
-      SWIG_croak("Usage: KBTree_mergeZeroDistLeaves(self);");
-    }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
-    if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_mergeZeroDistLeaves" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTreeCache_contains__SWIG_0); return;
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    (arg1)->mergeZeroDistLeaves();
-    ST(argvi) = sv_newmortal();
-    
-    XSRETURN(argvi);
-  fail:
-    
-    SWIG_croak_null();
   }
+  
+  croak("No matching function for overloaded 'KBTreeCache_contains'");
+  XSRETURN(0);
 }
 
 
-XS(_wrap_KBTree_replaceNodeNames) {
+XS(_wrap_KBTreeCache_clear) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-    std::string *arg2 = 0 ;
+    KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
-    int res2 = SWIG_OLDOBJ ;
     int argvi = 0;
     dXSARGS;
     
-    if ((items < 2) || (items > 2)) {
-      SWIG_croak("Usage: KBTree_replaceNodeNames(self,replacements);");
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTreeCache_clear(self);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCache, 0 |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_replaceNodeNames" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
-    }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    {
-      std::string *ptr = (std::string *)0;
-      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
-      if (!SWIG_IsOK(res2)) {
-        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_replaceNodeNames" "', argument " "2"" of type '" "std::string const &""'"); 
-      }
-      if (!ptr) {
-        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_replaceNodeNames" "', argument " "2"" of type '" "std::string const &""'"); 
-      }
-      arg2 = ptr;
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeCache_clear" "', argument " "1"" of type '" "KBTreeLib::KBTreeCache *""'"); 
     }
-    (arg1)->replaceNodeNames((std::string const &)*arg2);
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCache * >(argp1);
+    (arg1)->clear();
     ST(argvi) = sv_newmortal();
     
-    if (SWIG_IsNewObj(res2)) delete arg2;
     XSRETURN(argvi);
   fail:
     
-    if (SWIG_IsNewObj(res2)) delete arg2;
     SWIG_croak_null();
   }
 }
 
 
-XS(_wrap_KBTree_replaceNodeNamesOrMakeBlank) {
+XS(_wrap_KBTreeCache_setMemoryBudget) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-    std::string *arg2 = 0 ;
+    KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
+    size_t arg2 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
-    int res2 = SWIG_OLDOBJ ;
+    size_t val2 ;
+    int ecode2 = 0 ;
     int argvi = 0;
     dXSARGS;
     
     if ((items < 2) || (items > 2)) {
-      SWIG_croak("Usage: KBTree_replaceNodeNamesOrMakeBlank(self,replacements);");
+      SWIG_croak("Usage: KBTreeCache_setMemoryBudget(self,bytes);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCache, 0 |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_replaceNodeNamesOrMakeBlank" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
-    }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    {
-      std::string *ptr = (std::string *)0;
-      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
-      if (!SWIG_IsOK(res2)) {
-        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTree_replaceNodeNamesOrMakeBlank" "', argument " "2"" of type '" "std::string const &""'"); 
-      }
-      if (!ptr) {
-        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTree_replaceNodeNamesOrMakeBlank" "', argument " "2"" of type '" "std::string const &""'"); 
-      }
-      arg2 = ptr;
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeCache_setMemoryBudget" "', argument " "1"" of type '" "KBTreeLib::KBTreeCache *""'"); 
     }
-    (arg1)->replaceNodeNamesOrMakeBlank((std::string const &)*arg2);
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCache * >(argp1);
+    ecode2 = SWIG_AsVal_size_t SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTreeCache_setMemoryBudget" "', argument " "2"" of type '" "size_t""'");
+    } 
+    arg2 = static_cast< size_t >(val2);
+    (arg1)->setMemoryBudget(arg2);
     ST(argvi) = sv_newmortal();
     
-    if (SWIG_IsNewObj(res2)) delete arg2;
+    
     XSRETURN(argvi);
   fail:
     
-    if (SWIG_IsNewObj(res2)) delete arg2;
+    
     SWIG_croak_null();
   }
 }
 
 
-XS(_wrap_KBTree_stripReservedCharsFromLabels) {
+XS(_wrap_KBTreeCache_getMemoryBudget) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
     int argvi = 0;
+    size_t result;
     dXSARGS;
     
     if ((items < 1) || (items > 1)) {
-      SWIG_croak("Usage: KBTree_stripReservedCharsFromLabels(self);");
+      SWIG_croak("Usage: KBTreeCache_getMemoryBudget(self);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCache, 0 |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_stripReservedCharsFromLabels" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeCache_getMemoryBudget" "', argument " "1"" of type '" "KBTreeLib::KBTreeCache const *""'"); 
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    (arg1)->stripReservedCharsFromLabels();
-    ST(argvi) = sv_newmortal();
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCache * >(argp1);
+    result = (size_t)((KBTreeLib::KBTreeCache const *)arg1)->getMemoryBudget();
+    ST(argvi) = SWIG_From_size_t  SWIG_PERL_CALL_ARGS_1(static_cast< size_t >(result)); argvi++ ;
     
     XSRETURN(argvi);
   fail:
@@ -2849,24 +9850,25 @@ XS(_wrap_KBTree_stripReservedCharsFromLabels) {
 }
 
 
-XS(_wrap_KBTree_printTree) {
+XS(_wrap_KBTreeCache_getMemoryUsage) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
     int argvi = 0;
+    size_t result;
     dXSARGS;
     
     if ((items < 1) || (items > 1)) {
-      SWIG_croak("Usage: KBTree_printTree(self);");
+      SWIG_croak("Usage: KBTreeCache_getMemoryUsage(self);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCache, 0 |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_printTree" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeCache_getMemoryUsage" "', argument " "1"" of type '" "KBTreeLib::KBTreeCache const *""'"); 
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    (arg1)->printTree();
-    ST(argvi) = sv_newmortal();
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCache * >(argp1);
+    result = (size_t)((KBTreeLib::KBTreeCache const *)arg1)->getMemoryUsage();
+    ST(argvi) = SWIG_From_size_t  SWIG_PERL_CALL_ARGS_1(static_cast< size_t >(result)); argvi++ ;
     
     XSRETURN(argvi);
   fail:
@@ -2876,25 +9878,25 @@ XS(_wrap_KBTree_printTree) {
 }
 
 
-XS(_wrap_KBTree_printSimpleTreeToString) {
+XS(_wrap_KBTreeCache_getTreeCount) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
     int argvi = 0;
-    std::string result;
+    size_t result;
     dXSARGS;
     
     if ((items < 1) || (items > 1)) {
-      SWIG_croak("Usage: KBTree_printSimpleTreeToString(self);");
+      SWIG_croak("Usage: KBTreeCache_getTreeCount(self);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCache, 0 |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_printSimpleTreeToString" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeCache_getTreeCount" "', argument " "1"" of type '" "KBTreeLib::KBTreeCache const *""'"); 
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    result = (arg1)->printSimpleTreeToString();
-    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCache * >(argp1);
+    result = (size_t)((KBTreeLib::KBTreeCache const *)arg1)->getTreeCount();
+    ST(argvi) = SWIG_From_size_t  SWIG_PERL_CALL_ARGS_1(static_cast< size_t >(result)); argvi++ ;
     
     XSRETURN(argvi);
   fail:
@@ -2904,25 +9906,25 @@ XS(_wrap_KBTree_printSimpleTreeToString) {
 }
 
 
-XS(_wrap_KBTree_printTreeToString) {
+XS(_wrap_KBTreeCache_getHitCount) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
     int argvi = 0;
-    std::string result;
+    uint64_t result;
     dXSARGS;
     
     if ((items < 1) || (items > 1)) {
-      SWIG_croak("Usage: KBTree_printTreeToString(self);");
+      SWIG_croak("Usage: KBTreeCache_getHitCount(self);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCache, 0 |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_printTreeToString" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeCache_getHitCount" "', argument " "1"" of type '" "KBTreeLib::KBTreeCache const *""'"); 
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    result = (arg1)->printTreeToString();
-    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCache * >(argp1);
+    result = (uint64_t)((KBTreeLib::KBTreeCache const *)arg1)->getHitCount();
+    ST(argvi) = SWIG_From_unsigned_SS_long_SS_long  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned long long >(result)); argvi++ ;
     
     XSRETURN(argvi);
   fail:
@@ -2932,25 +9934,25 @@ XS(_wrap_KBTree_printTreeToString) {
 }
 
 
-XS(_wrap_KBTree_getNodeCount) {
+XS(_wrap_KBTreeCache_getMissCount) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
     int argvi = 0;
-    unsigned int result;
+    uint64_t result;
     dXSARGS;
     
     if ((items < 1) || (items > 1)) {
-      SWIG_croak("Usage: KBTree_getNodeCount(self);");
+      SWIG_croak("Usage: KBTreeCache_getMissCount(self);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCache, 0 |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_getNodeCount" "', argument " "1"" of type '" "KBTreeLib::KBTree const *""'"); 
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeCache_getMissCount" "', argument " "1"" of type '" "KBTreeLib::KBTreeCache const *""'"); 
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    result = (unsigned int)((KBTreeLib::KBTree const *)arg1)->getNodeCount();
-    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCache * >(argp1);
+    result = (uint64_t)((KBTreeLib::KBTreeCache const *)arg1)->getMissCount();
+    ST(argvi) = SWIG_From_unsigned_SS_long_SS_long  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned long long >(result)); argvi++ ;
     
     XSRETURN(argvi);
   fail:
@@ -2960,25 +9962,25 @@ XS(_wrap_KBTree_getNodeCount) {
 }
 
 
-XS(_wrap_KBTree_getLeafCount) {
+XS(_wrap_KBTreeCache_getEvictionCount) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
     int argvi = 0;
-    unsigned int result;
+    uint64_t result;
     dXSARGS;
     
     if ((items < 1) || (items > 1)) {
-      SWIG_croak("Usage: KBTree_getLeafCount(self);");
+      SWIG_croak("Usage: KBTreeCache_getEvictionCount(self);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCache, 0 |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_getLeafCount" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeCache_getEvictionCount" "', argument " "1"" of type '" "KBTreeLib::KBTreeCache const *""'"); 
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    result = (unsigned int)(arg1)->getLeafCount();
-    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCache * >(argp1);
+    result = (uint64_t)((KBTreeLib::KBTreeCache const *)arg1)->getEvictionCount();
+    ST(argvi) = SWIG_From_unsigned_SS_long_SS_long  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned long long >(result)); argvi++ ;
     
     XSRETURN(argvi);
   fail:
@@ -2988,25 +9990,24 @@ XS(_wrap_KBTree_getLeafCount) {
 }
 
 
-XS(_wrap_KBTree_getAllLeafNames) {
+XS(_wrap_KBTreeCache_resetCounters) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    KBTreeLib::KBTreeCache *arg1 = (KBTreeLib::KBTreeCache *) 0 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
     int argvi = 0;
-    std::string result;
     dXSARGS;
     
     if ((items < 1) || (items > 1)) {
-      SWIG_croak("Usage: KBTree_getAllLeafNames(self);");
+      SWIG_croak("Usage: KBTreeCache_resetCounters(self);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeCache, 0 |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_getAllLeafNames" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeCache_resetCounters" "', argument " "1"" of type '" "KBTreeLib::KBTreeCache *""'"); 
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    result = (arg1)->getAllLeafNames();
-    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeCache * >(argp1);
+    (arg1)->resetCounters();
+    ST(argvi) = sv_newmortal();
     
     XSRETURN(argvi);
   fail:
@@ -3016,108 +10017,170 @@ XS(_wrap_KBTree_getAllLeafNames) {
 }
 
 
-XS(_wrap_KBTree_getAllNodeNames) {
+XS(_wrap_new_KBTreeDiskCache__SWIG_0) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-    void *argp1 = 0 ;
-    int res1 = 0 ;
+    std::string *arg1 = 0 ;
+    uint64_t arg2 ;
+    int res1 = SWIG_OLDOBJ ;
+    unsigned long long val2 ;
+    int ecode2 = 0 ;
     int argvi = 0;
-    std::string result;
+    KBTreeLib::KBTreeDiskCache *result = 0 ;
     dXSARGS;
     
-    if ((items < 1) || (items > 1)) {
-      SWIG_croak("Usage: KBTree_getAllNodeNames(self);");
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: new_KBTreeDiskCache(directory,sizeLimit);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
-    if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_getAllNodeNames" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    {
+      std::string *ptr = (std::string *)0;
+      res1 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), &ptr);
+      if (!SWIG_IsOK(res1)) {
+        SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_KBTreeDiskCache" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_KBTreeDiskCache" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      arg1 = ptr;
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    result = (arg1)->getAllNodeNames();
-    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    ecode2 = SWIG_AsVal_unsigned_SS_long_SS_long SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_KBTreeDiskCache" "', argument " "2"" of type '" "uint64_t""'");
+    } 
+    arg2 = static_cast< uint64_t >(val2);
+    result = (KBTreeLib::KBTreeDiskCache *)new KBTreeLib::KBTreeDiskCache((std::string const &)*arg1,arg2);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    if (SWIG_IsNewObj(res1)) delete arg1;
     
     XSRETURN(argvi);
   fail:
+    if (SWIG_IsNewObj(res1)) delete arg1;
     
     SWIG_croak_null();
   }
 }
 
 
-XS(_wrap_KBTree_resetBreadthFirstIterToRoot) {
+XS(_wrap_new_KBTreeDiskCache__SWIG_1) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-    void *argp1 = 0 ;
-    int res1 = 0 ;
+    std::string *arg1 = 0 ;
+    int res1 = SWIG_OLDOBJ ;
     int argvi = 0;
+    KBTreeLib::KBTreeDiskCache *result = 0 ;
     dXSARGS;
     
     if ((items < 1) || (items > 1)) {
-      SWIG_croak("Usage: KBTree_resetBreadthFirstIterToRoot(self);");
+      SWIG_croak("Usage: new_KBTreeDiskCache(directory);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
-    if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_resetBreadthFirstIterToRoot" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    {
+      std::string *ptr = (std::string *)0;
+      res1 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), &ptr);
+      if (!SWIG_IsOK(res1)) {
+        SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_KBTreeDiskCache" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_KBTreeDiskCache" "', argument " "1"" of type '" "std::string const &""'"); 
+      }
+      arg1 = ptr;
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    (arg1)->resetBreadthFirstIterToRoot();
-    ST(argvi) = sv_newmortal();
-    
+    result = (KBTreeLib::KBTreeDiskCache *)new KBTreeLib::KBTreeDiskCache((std::string const &)*arg1);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    if (SWIG_IsNewObj(res1)) delete arg1;
     XSRETURN(argvi);
   fail:
-    
+    if (SWIG_IsNewObj(res1)) delete arg1;
     SWIG_croak_null();
   }
 }
 
 
-XS(_wrap_KBTree_breadthFirstIterNext) {
+XS(_wrap_new_KBTreeDiskCache) {
+  dXSARGS;
+  
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-    void *argp1 = 0 ;
-    int res1 = 0 ;
-    int argvi = 0;
-    bool result;
-    dXSARGS;
-    
-    if ((items < 1) || (items > 1)) {
-      SWIG_croak("Usage: KBTree_breadthFirstIterNext(self);");
-    }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
-    if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_breadthFirstIterNext" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+    unsigned long _index = 0;
+    SWIG_TypeRank _rank = 0; 
+    if (items == 1) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 1;
+        if (_rank == _rankm) goto dispatch;
+      }
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    result = (bool)(arg1)->breadthFirstIterNext();
-    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
+  check_1:
     
-    XSRETURN(argvi);
-  fail:
+    if (items == 2) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(0), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_unsigned_SS_long_SS_long SWIG_PERL_CALL_ARGS_2(ST(1), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 2;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_2:
     
-    SWIG_croak_null();
+  dispatch:
+    switch(_index) {
+    case 1:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_new_KBTreeDiskCache__SWIG_1); return;
+    case 2:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_new_KBTreeDiskCache__SWIG_0); return;
+    }
   }
+  
+  croak("No matching function for overloaded 'new_KBTreeDiskCache'");
+  XSRETURN(0);
 }
 
 
-XS(_wrap_KBTree_breadthFirstIterGetName__SWIG_0) {
+XS(_wrap_delete_KBTreeDiskCache) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
     int argvi = 0;
-    std::string result;
     dXSARGS;
     
     if ((items < 1) || (items > 1)) {
-      SWIG_croak("Usage: KBTree_breadthFirstIterGetName(self);");
+      SWIG_croak("Usage: delete_KBTreeDiskCache(self);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, SWIG_POINTER_DISOWN |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_breadthFirstIterGetName" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
-    }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    result = (arg1)->breadthFirstIterGetName();
-    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_KBTreeDiskCache" "', argument " "1"" of type '" "KBTreeLib::KBTreeDiskCache *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeDiskCache * >(argp1);
+    delete arg1;
+    ST(argvi) = sv_newmortal();
     
     XSRETURN(argvi);
   fail:
@@ -3127,152 +10190,308 @@ XS(_wrap_KBTree_breadthFirstIterGetName__SWIG_0) {
 }
 
 
-XS(_wrap_KBTree_breadthFirstIterGetParentName__SWIG_0) {
+XS(_wrap_KBTreeDiskCache_get__SWIG_0) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+    std::string *arg2 = 0 ;
+    bool arg3 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    bool val3 ;
+    int ecode3 = 0 ;
     int argvi = 0;
-    std::string result;
+    KBTreeLib::KBTree *result = 0 ;
     dXSARGS;
     
-    if ((items < 1) || (items > 1)) {
-      SWIG_croak("Usage: KBTree_breadthFirstIterGetParentName(self);");
+    if ((items < 3) || (items > 3)) {
+      SWIG_croak("Usage: KBTreeDiskCache_get(self,newickString,assumeBootstrapNames);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, 0 |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_breadthFirstIterGetParentName" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeDiskCache_get" "', argument " "1"" of type '" "KBTreeLib::KBTreeDiskCache *""'"); 
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    result = (arg1)->breadthFirstIterGetParentName();
-    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeDiskCache * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTreeDiskCache_get" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTreeDiskCache_get" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    ecode3 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "KBTreeDiskCache_get" "', argument " "3"" of type '" "bool""'");
+    } 
+    arg3 = static_cast< bool >(val3);
+    result = (KBTreeLib::KBTree *)(arg1)->get((std::string const &)*arg2,arg3);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTree, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
+    
+    if (SWIG_IsNewObj(res2)) delete arg2;
     
     XSRETURN(argvi);
   fail:
     
+    if (SWIG_IsNewObj(res2)) delete arg2;
+    
     SWIG_croak_null();
   }
 }
 
 
-XS(_wrap_KBTree_breadthFirstIterMarkNode) {
+XS(_wrap_KBTreeDiskCache_get__SWIG_1) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
+    KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+    std::string *arg2 = 0 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
     int argvi = 0;
-    unsigned int result;
+    KBTreeLib::KBTree *result = 0 ;
     dXSARGS;
     
-    if ((items < 1) || (items > 1)) {
-      SWIG_croak("Usage: KBTree_breadthFirstIterMarkNode(self);");
+    if ((items < 2) || (items > 2)) {
+      SWIG_croak("Usage: KBTreeDiskCache_get(self,newickString);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, 0 |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_breadthFirstIterMarkNode" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeDiskCache_get" "', argument " "1"" of type '" "KBTreeLib::KBTreeDiskCache *""'"); 
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    result = (unsigned int)(arg1)->breadthFirstIterMarkNode();
-    ST(argvi) = SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(result)); argvi++ ;
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeDiskCache * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTreeDiskCache_get" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTreeDiskCache_get" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = (KBTreeLib::KBTree *)(arg1)->get((std::string const &)*arg2);
+    ST(argvi) = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_KBTreeLib__KBTree, SWIG_OWNER | SWIG_SHADOW); argvi++ ;
     
+    if (SWIG_IsNewObj(res2)) delete arg2;
     XSRETURN(argvi);
   fail:
     
+    if (SWIG_IsNewObj(res2)) delete arg2;
     SWIG_croak_null();
   }
 }
 
 
-XS(_wrap_KBTree_breadthFirstIterSetToNode) {
+XS(_wrap_KBTreeDiskCache_get) {
+  dXSARGS;
+  
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-    unsigned int arg2 ;
+    unsigned long _index = 0;
+    SWIG_TypeRank _rank = 0; 
+    if (items == 2) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 1;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_1:
+    
+    if (items == 3) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), (std::string**)(0));
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 2;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_2:
+    
+  dispatch:
+    switch(_index) {
+    case 1:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTreeDiskCache_get__SWIG_1); return;
+    case 2:
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTreeDiskCache_get__SWIG_0); return;
+    }
+  }
+  
+  croak("No matching function for overloaded 'KBTreeDiskCache_get'");
+  XSRETURN(0);
+}
+
+
+XS(_wrap_KBTreeDiskCache_contains__SWIG_0) {
+  {
+    KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+    std::string *arg2 = 0 ;
+    bool arg3 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
-    unsigned int val2 ;
-    int ecode2 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    bool val3 ;
+    int ecode3 = 0 ;
     int argvi = 0;
     bool result;
     dXSARGS;
     
-    if ((items < 2) || (items > 2)) {
-      SWIG_croak("Usage: KBTree_breadthFirstIterSetToNode(self,nodeMarker);");
+    if ((items < 3) || (items > 3)) {
+      SWIG_croak("Usage: KBTreeDiskCache_contains(self,newickString,assumeBootstrapNames);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, 0 |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_breadthFirstIterSetToNode" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeDiskCache_contains" "', argument " "1"" of type '" "KBTreeLib::KBTreeDiskCache const *""'"); 
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
-    if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_breadthFirstIterSetToNode" "', argument " "2"" of type '" "unsigned int""'");
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeDiskCache * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTreeDiskCache_contains" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTreeDiskCache_contains" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    ecode3 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "KBTreeDiskCache_contains" "', argument " "3"" of type '" "bool""'");
     } 
-    arg2 = static_cast< unsigned int >(val2);
-    result = (bool)(arg1)->breadthFirstIterSetToNode(arg2);
+    arg3 = static_cast< bool >(val3);
+    result = (bool)((KBTreeLib::KBTreeDiskCache const *)arg1)->contains((std::string const &)*arg2,arg3);
     ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
     
+    if (SWIG_IsNewObj(res2)) delete arg2;
     
     XSRETURN(argvi);
   fail:
     
+    if (SWIG_IsNewObj(res2)) delete arg2;
     
     SWIG_croak_null();
   }
 }
 
 
-XS(_wrap_KBTree_breadthFirstIterGetName__SWIG_1) {
+XS(_wrap_KBTreeDiskCache_contains__SWIG_1) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-    unsigned int arg2 ;
+    KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+    std::string *arg2 = 0 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
-    unsigned int val2 ;
-    int ecode2 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
     int argvi = 0;
-    std::string result;
+    bool result;
     dXSARGS;
     
     if ((items < 2) || (items > 2)) {
-      SWIG_croak("Usage: KBTree_breadthFirstIterGetName(self,nodeMarker);");
+      SWIG_croak("Usage: KBTreeDiskCache_contains(self,newickString);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, 0 |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_breadthFirstIterGetName" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeDiskCache_contains" "', argument " "1"" of type '" "KBTreeLib::KBTreeDiskCache const *""'"); 
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
-    if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_breadthFirstIterGetName" "', argument " "2"" of type '" "unsigned int""'");
-    } 
-    arg2 = static_cast< unsigned int >(val2);
-    result = (arg1)->breadthFirstIterGetName(arg2);
-    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
-    
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeDiskCache * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTreeDiskCache_contains" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTreeDiskCache_contains" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = (bool)((KBTreeLib::KBTreeDiskCache const *)arg1)->contains((std::string const &)*arg2);
+    ST(argvi) = SWIG_From_bool  SWIG_PERL_CALL_ARGS_1(static_cast< bool >(result)); argvi++ ;
     
+    if (SWIG_IsNewObj(res2)) delete arg2;
     XSRETURN(argvi);
   fail:
     
-    
+    if (SWIG_IsNewObj(res2)) delete arg2;
     SWIG_croak_null();
   }
 }
 
 
-XS(_wrap_KBTree_breadthFirstIterGetName) {
+XS(_wrap_KBTreeDiskCache_contains) {
   dXSARGS;
   
   {
     unsigned long _index = 0;
     SWIG_TypeRank _rank = 0; 
-    if (items == 1) {
+    if (items == 2) {
       SWIG_TypeRank _ranki = 0;
       SWIG_TypeRank _rankm = 0;
       SWIG_TypeRank _pi = 1;
       int _v = 0;
       {
         void *vptr = 0;
-        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTree, 0);
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), (std::string**)(0));
         _v = SWIG_CheckState(res);
       }
       if (!_v) goto check_1;
@@ -3286,14 +10505,22 @@ XS(_wrap_KBTree_breadthFirstIterGetName) {
     }
   check_1:
     
-    if (items == 2) {
+    if (items == 3) {
       SWIG_TypeRank _ranki = 0;
       SWIG_TypeRank _rankm = 0;
       SWIG_TypeRank _pi = 1;
       int _v = 0;
       {
         void *vptr = 0;
-        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTree, 0);
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), (std::string**)(0));
         _v = SWIG_CheckState(res);
       }
       if (!_v) goto check_2;
@@ -3302,7 +10529,7 @@ XS(_wrap_KBTree_breadthFirstIterGetName) {
       _pi *= SWIG_MAXCASTRANK;
       {
         {
-          int res = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), NULL);
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), NULL);
           _v = SWIG_CheckState(res);
         }
       }
@@ -3320,107 +10547,135 @@ XS(_wrap_KBTree_breadthFirstIterGetName) {
   dispatch:
     switch(_index) {
     case 1:
-      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_breadthFirstIterGetName__SWIG_0); return;
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTreeDiskCache_contains__SWIG_1); return;
     case 2:
-      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_breadthFirstIterGetName__SWIG_1); return;
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTreeDiskCache_contains__SWIG_0); return;
     }
   }
   
-  croak("No matching function for overloaded 'KBTree_breadthFirstIterGetName'");
+  croak("No matching function for overloaded 'KBTreeDiskCache_contains'");
   XSRETURN(0);
 }
 
 
-XS(_wrap_KBTree_breadthFirstIterGetPathToRoot) {
+XS(_wrap_KBTreeDiskCache_getImagePath__SWIG_0) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-    unsigned int arg2 ;
+    KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+    std::string *arg2 = 0 ;
+    bool arg3 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
-    unsigned int val2 ;
-    int ecode2 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
+    bool val3 ;
+    int ecode3 = 0 ;
     int argvi = 0;
     std::string result;
     dXSARGS;
     
-    if ((items < 2) || (items > 2)) {
-      SWIG_croak("Usage: KBTree_breadthFirstIterGetPathToRoot(self,nodeMarker);");
+    if ((items < 3) || (items > 3)) {
+      SWIG_croak("Usage: KBTreeDiskCache_getImagePath(self,newickString,assumeBootstrapNames);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, 0 |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_breadthFirstIterGetPathToRoot" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeDiskCache_getImagePath" "', argument " "1"" of type '" "KBTreeLib::KBTreeDiskCache const *""'"); 
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
-    if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_breadthFirstIterGetPathToRoot" "', argument " "2"" of type '" "unsigned int""'");
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeDiskCache * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTreeDiskCache_getImagePath" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTreeDiskCache_getImagePath" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    ecode3 = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "KBTreeDiskCache_getImagePath" "', argument " "3"" of type '" "bool""'");
     } 
-    arg2 = static_cast< unsigned int >(val2);
-    result = (arg1)->breadthFirstIterGetPathToRoot(arg2);
+    arg3 = static_cast< bool >(val3);
+    result = ((KBTreeLib::KBTreeDiskCache const *)arg1)->getImagePath((std::string const &)*arg2,arg3);
     ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
     
+    if (SWIG_IsNewObj(res2)) delete arg2;
     
     XSRETURN(argvi);
   fail:
     
+    if (SWIG_IsNewObj(res2)) delete arg2;
     
     SWIG_croak_null();
   }
 }
 
 
-XS(_wrap_KBTree_breadthFirstIterGetParentName__SWIG_1) {
+XS(_wrap_KBTreeDiskCache_getImagePath__SWIG_1) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-    unsigned int arg2 ;
+    KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+    std::string *arg2 = 0 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
-    unsigned int val2 ;
-    int ecode2 = 0 ;
+    int res2 = SWIG_OLDOBJ ;
     int argvi = 0;
     std::string result;
     dXSARGS;
     
     if ((items < 2) || (items > 2)) {
-      SWIG_croak("Usage: KBTree_breadthFirstIterGetParentName(self,nodeMarker);");
+      SWIG_croak("Usage: KBTreeDiskCache_getImagePath(self,newickString);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, 0 |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_breadthFirstIterGetParentName" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeDiskCache_getImagePath" "', argument " "1"" of type '" "KBTreeLib::KBTreeDiskCache const *""'"); 
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
-    if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_breadthFirstIterGetParentName" "', argument " "2"" of type '" "unsigned int""'");
-    } 
-    arg2 = static_cast< unsigned int >(val2);
-    result = (arg1)->breadthFirstIterGetParentName(arg2);
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeDiskCache * >(argp1);
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "KBTreeDiskCache_getImagePath" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "KBTreeDiskCache_getImagePath" "', argument " "2"" of type '" "std::string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+    result = ((KBTreeLib::KBTreeDiskCache const *)arg1)->getImagePath((std::string const &)*arg2);
     ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
     
-    
+    if (SWIG_IsNewObj(res2)) delete arg2;
     XSRETURN(argvi);
   fail:
     
-    
+    if (SWIG_IsNewObj(res2)) delete arg2;
     SWIG_croak_null();
   }
 }
 
 
-XS(_wrap_KBTree_breadthFirstIterGetParentName) {
+XS(_wrap_KBTreeDiskCache_getImagePath) {
   dXSARGS;
   
   {
     unsigned long _index = 0;
     SWIG_TypeRank _rank = 0; 
-    if (items == 1) {
+    if (items == 2) {
       SWIG_TypeRank _ranki = 0;
       SWIG_TypeRank _rankm = 0;
       SWIG_TypeRank _pi = 1;
       int _v = 0;
       {
         void *vptr = 0;
-        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTree, 0);
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), (std::string**)(0));
         _v = SWIG_CheckState(res);
       }
       if (!_v) goto check_1;
@@ -3434,14 +10689,22 @@ XS(_wrap_KBTree_breadthFirstIterGetParentName) {
     }
   check_1:
     
-    if (items == 2) {
+    if (items == 3) {
       SWIG_TypeRank _ranki = 0;
       SWIG_TypeRank _rankm = 0;
       SWIG_TypeRank _pi = 1;
       int _v = 0;
       {
         void *vptr = 0;
-        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTree, 0);
+        int res = SWIG_ConvertPtr(ST(0), &vptr, SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_AsPtr_std_string SWIG_PERL_CALL_ARGS_2(ST(1), (std::string**)(0));
         _v = SWIG_CheckState(res);
       }
       if (!_v) goto check_2;
@@ -3450,7 +10713,7 @@ XS(_wrap_KBTree_breadthFirstIterGetParentName) {
       _pi *= SWIG_MAXCASTRANK;
       {
         {
-          int res = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), NULL);
+          int res = SWIG_AsVal_bool SWIG_PERL_CALL_ARGS_2(ST(2), NULL);
           _v = SWIG_CheckState(res);
         }
       }
@@ -3468,44 +10731,97 @@ XS(_wrap_KBTree_breadthFirstIterGetParentName) {
   dispatch:
     switch(_index) {
     case 1:
-      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_breadthFirstIterGetParentName__SWIG_0); return;
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTreeDiskCache_getImagePath__SWIG_1); return;
     case 2:
-      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTree_breadthFirstIterGetParentName__SWIG_1); return;
+      PUSHMARK(MARK); SWIG_CALLXS(_wrap_KBTreeDiskCache_getImagePath__SWIG_0); return;
     }
   }
   
-  croak("No matching function for overloaded 'KBTree_breadthFirstIterGetParentName'");
+  croak("No matching function for overloaded 'KBTreeDiskCache_getImagePath'");
   XSRETURN(0);
 }
 
 
-XS(_wrap_KBTree_breadthFirstIterGetAllChildrenNames) {
+XS(_wrap_KBTreeDiskCache_trim) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-    unsigned int arg2 ;
+    KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
-    unsigned int val2 ;
+    int argvi = 0;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTreeDiskCache_trim(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeDiskCache_trim" "', argument " "1"" of type '" "KBTreeLib::KBTreeDiskCache *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeDiskCache * >(argp1);
+    (arg1)->trim();
+    ST(argvi) = sv_newmortal();
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTreeDiskCache_clear) {
+  {
+    KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTreeDiskCache_clear(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeDiskCache_clear" "', argument " "1"" of type '" "KBTreeLib::KBTreeDiskCache *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeDiskCache * >(argp1);
+    (arg1)->clear();
+    ST(argvi) = sv_newmortal();
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTreeDiskCache_setSizeLimit) {
+  {
+    KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+    uint64_t arg2 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    unsigned long long val2 ;
     int ecode2 = 0 ;
     int argvi = 0;
-    std::string result;
     dXSARGS;
     
     if ((items < 2) || (items > 2)) {
-      SWIG_croak("Usage: KBTree_breadthFirstIterGetAllChildrenNames(self,nodeMarker);");
+      SWIG_croak("Usage: KBTreeDiskCache_setSizeLimit(self,bytes);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, 0 |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_breadthFirstIterGetAllChildrenNames" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeDiskCache_setSizeLimit" "', argument " "1"" of type '" "KBTreeLib::KBTreeDiskCache *""'"); 
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeDiskCache * >(argp1);
+    ecode2 = SWIG_AsVal_unsigned_SS_long_SS_long SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
     if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_breadthFirstIterGetAllChildrenNames" "', argument " "2"" of type '" "unsigned int""'");
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTreeDiskCache_setSizeLimit" "', argument " "2"" of type '" "uint64_t""'");
     } 
-    arg2 = static_cast< unsigned int >(val2);
-    result = (arg1)->breadthFirstIterGetAllChildrenNames(arg2);
-    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    arg2 = static_cast< uint64_t >(val2);
+    (arg1)->setSizeLimit(arg2);
+    ST(argvi) = sv_newmortal();
     
     
     XSRETURN(argvi);
@@ -3517,38 +10833,167 @@ XS(_wrap_KBTree_breadthFirstIterGetAllChildrenNames) {
 }
 
 
-XS(_wrap_KBTree_breadthFirstIterGetAllDescendantNames) {
+XS(_wrap_KBTreeDiskCache_getSizeLimit) {
   {
-    KBTreeLib::KBTree *arg1 = (KBTreeLib::KBTree *) 0 ;
-    unsigned int arg2 ;
+    KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
     void *argp1 = 0 ;
     int res1 = 0 ;
-    unsigned int val2 ;
-    int ecode2 = 0 ;
     int argvi = 0;
-    std::string result;
+    uint64_t result;
     dXSARGS;
     
-    if ((items < 2) || (items > 2)) {
-      SWIG_croak("Usage: KBTree_breadthFirstIterGetAllDescendantNames(self,nodeMarker);");
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTreeDiskCache_getSizeLimit(self);");
     }
-    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTree, 0 |  0 );
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, 0 |  0 );
     if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTree_breadthFirstIterGetAllDescendantNames" "', argument " "1"" of type '" "KBTreeLib::KBTree *""'"); 
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeDiskCache_getSizeLimit" "', argument " "1"" of type '" "KBTreeLib::KBTreeDiskCache const *""'"); 
     }
-    arg1 = reinterpret_cast< KBTreeLib::KBTree * >(argp1);
-    ecode2 = SWIG_AsVal_unsigned_SS_int SWIG_PERL_CALL_ARGS_2(ST(1), &val2);
-    if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "KBTree_breadthFirstIterGetAllDescendantNames" "', argument " "2"" of type '" "unsigned int""'");
-    } 
-    arg2 = static_cast< unsigned int >(val2);
-    result = (arg1)->breadthFirstIterGetAllDescendantNames(arg2);
-    ST(argvi) = SWIG_From_std_string  SWIG_PERL_CALL_ARGS_1(static_cast< std::string >(result)); argvi++ ;
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeDiskCache * >(argp1);
+    result = (uint64_t)((KBTreeLib::KBTreeDiskCache const *)arg1)->getSizeLimit();
+    ST(argvi) = SWIG_From_unsigned_SS_long_SS_long  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned long long >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTreeDiskCache_getDiskUsage) {
+  {
+    KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    uint64_t result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTreeDiskCache_getDiskUsage(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeDiskCache_getDiskUsage" "', argument " "1"" of type '" "KBTreeLib::KBTreeDiskCache const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeDiskCache * >(argp1);
+    result = (uint64_t)((KBTreeLib::KBTreeDiskCache const *)arg1)->getDiskUsage();
+    ST(argvi) = SWIG_From_unsigned_SS_long_SS_long  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned long long >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTreeDiskCache_getHitCount) {
+  {
+    KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    uint64_t result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTreeDiskCache_getHitCount(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeDiskCache_getHitCount" "', argument " "1"" of type '" "KBTreeLib::KBTreeDiskCache const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeDiskCache * >(argp1);
+    result = (uint64_t)((KBTreeLib::KBTreeDiskCache const *)arg1)->getHitCount();
+    ST(argvi) = SWIG_From_unsigned_SS_long_SS_long  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned long long >(result)); argvi++ ;
     
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTreeDiskCache_getMissCount) {
+  {
+    KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    uint64_t result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTreeDiskCache_getMissCount(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeDiskCache_getMissCount" "', argument " "1"" of type '" "KBTreeLib::KBTreeDiskCache const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeDiskCache * >(argp1);
+    result = (uint64_t)((KBTreeLib::KBTreeDiskCache const *)arg1)->getMissCount();
+    ST(argvi) = SWIG_From_unsigned_SS_long_SS_long  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned long long >(result)); argvi++ ;
+    
+    XSRETURN(argvi);
+  fail:
+    
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTreeDiskCache_getEvictionCount) {
+  {
+    KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    uint64_t result;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTreeDiskCache_getEvictionCount(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeDiskCache_getEvictionCount" "', argument " "1"" of type '" "KBTreeLib::KBTreeDiskCache const *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeDiskCache * >(argp1);
+    result = (uint64_t)((KBTreeLib::KBTreeDiskCache const *)arg1)->getEvictionCount();
+    ST(argvi) = SWIG_From_unsigned_SS_long_SS_long  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned long long >(result)); argvi++ ;
     
     XSRETURN(argvi);
   fail:
     
+    SWIG_croak_null();
+  }
+}
+
+
+XS(_wrap_KBTreeDiskCache_resetCounters) {
+  {
+    KBTreeLib::KBTreeDiskCache *arg1 = (KBTreeLib::KBTreeDiskCache *) 0 ;
+    void *argp1 = 0 ;
+    int res1 = 0 ;
+    int argvi = 0;
+    dXSARGS;
+    
+    if ((items < 1) || (items > 1)) {
+      SWIG_croak("Usage: KBTreeDiskCache_resetCounters(self);");
+    }
+    res1 = SWIG_ConvertPtr(ST(0), &argp1,SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, 0 |  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "KBTreeDiskCache_resetCounters" "', argument " "1"" of type '" "KBTreeLib::KBTreeDiskCache *""'"); 
+    }
+    arg1 = reinterpret_cast< KBTreeLib::KBTreeDiskCache * >(argp1);
+    (arg1)->resetCounters();
+    ST(argvi) = sv_newmortal();
+    
+    XSRETURN(argvi);
+  fail:
     
     SWIG_croak_null();
   }
@@ -3558,19 +11003,43 @@ XS(_wrap_KBTree_breadthFirstIterGetAllDescendantNames) {
 
 /* -------- TYPE CONVERSION AND EQUIVALENCE RULES (BEGIN) -------- */
 
+static swig_type_info _swigt__p_KBTreeLib__KBAncestorIndex = {"_p_KBTreeLib__KBAncestorIndex", "KBTreeLib::KBAncestorIndex *", 0, 0, (void*)"Bio::KBase::Tree::TreeCppUtil::KBAncestorIndex", 0};
+static swig_type_info _swigt__p_KBTreeLib__KBFrozenTree = {"_p_KBTreeLib__KBFrozenTree", "KBTreeLib::KBFrozenTree *", 0, 0, (void*)"Bio::KBase::Tree::TreeCppUtil::KBFrozenTree", 0};
 static swig_type_info _swigt__p_KBTreeLib__KBTree = {"_p_KBTreeLib__KBTree", "KBTreeLib::KBTree *", 0, 0, (void*)"Bio::KBase::Tree::TreeCppUtil::KBTree", 0};
+static swig_type_info _swigt__p_KBTreeLib__KBTreeCache = {"_p_KBTreeLib__KBTreeCache", "KBTreeLib::KBTreeCache *", 0, 0, (void*)"Bio::KBase::Tree::TreeCppUtil::KBTreeCache", 0};
+static swig_type_info _swigt__p_KBTreeLib__KBTreeCursor = {"_p_KBTreeLib__KBTreeCursor", "KBTreeLib::KBTreeCursor *", 0, 0, (void*)"Bio::KBase::Tree::TreeCppUtil::KBTreeCursor", 0};
+static swig_type_info _swigt__p_KBTreeLib__KBTreeDiskCache = {"_p_KBTreeLib__KBTreeDiskCache", "KBTreeLib::KBTreeDiskCache *", 0, 0, (void*)"Bio::KBase::Tree::TreeCppUtil::KBTreeDiskCache", 0};
+static swig_type_info _swigt__p_KBTreeLib__KBTreeStatistics = {"_p_KBTreeLib__KBTreeStatistics", "KBTreeLib::KBTreeStatistics *", 0, 0, (void*)"Bio::KBase::Tree::TreeCppUtil::KBTreeStatistics", 0};
 static swig_type_info _swigt__p_char = {"_p_char", "char *", 0, 0, (void*)0, 0};
 
 static swig_type_info *swig_type_initial[] = {
+  &_swigt__p_KBTreeLib__KBAncestorIndex,
+  &_swigt__p_KBTreeLib__KBFrozenTree,
   &_swigt__p_KBTreeLib__KBTree,
+  &_swigt__p_KBTreeLib__KBTreeCache,
+  &_swigt__p_KBTreeLib__KBTreeCursor,
+  &_swigt__p_KBTreeLib__KBTreeDiskCache,
+  &_swigt__p_KBTreeLib__KBTreeStatistics,
   &_swigt__p_char,
 };
 
+static swig_cast_info _swigc__p_KBTreeLib__KBAncestorIndex[] = {  {&_swigt__p_KBTreeLib__KBAncestorIndex, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_KBTreeLib__KBFrozenTree[] = {  {&_swigt__p_KBTreeLib__KBFrozenTree, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_KBTreeLib__KBTree[] = {  {&_swigt__p_KBTreeLib__KBTree, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_KBTreeLib__KBTreeCache[] = {  {&_swigt__p_KBTreeLib__KBTreeCache, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_KBTreeLib__KBTreeCursor[] = {  {&_swigt__p_KBTreeLib__KBTreeCursor, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_KBTreeLib__KBTreeDiskCache[] = {  {&_swigt__p_KBTreeLib__KBTreeDiskCache, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_KBTreeLib__KBTreeStatistics[] = {  {&_swigt__p_KBTreeLib__KBTreeStatistics, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_char[] = {  {&_swigt__p_char, 0, 0, 0},{0, 0, 0, 0}};
 
 static swig_cast_info *swig_cast_initial[] = {
+  _swigc__p_KBTreeLib__KBAncestorIndex,
+  _swigc__p_KBTreeLib__KBFrozenTree,
   _swigc__p_KBTreeLib__KBTree,
+  _swigc__p_KBTreeLib__KBTreeCache,
+  _swigc__p_KBTreeLib__KBTreeCursor,
+  _swigc__p_KBTreeLib__KBTreeDiskCache,
+  _swigc__p_KBTreeLib__KBTreeStatistics,
   _swigc__p_char,
 };
 
@@ -3588,24 +11057,51 @@ static swig_variable_info swig_variables[] = {
 };
 static swig_command_info swig_commands[] = {
 {"Bio::KBase::Tree::TreeCppUtilc::translateToProt", _wrap_translateToProt},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeStatistics_getNodeCount", _wrap_KBTreeStatistics_getNodeCount},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeStatistics_getLeafCount", _wrap_KBTreeStatistics_getLeafCount},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeStatistics_getMaxDepth", _wrap_KBTreeStatistics_getMaxDepth},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeStatistics_hasBranchLengths", _wrap_KBTreeStatistics_hasBranchLengths},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeStatistics_hasBootstrapValues", _wrap_KBTreeStatistics_hasBootstrapValues},
+{"Bio::KBase::Tree::TreeCppUtilc::new_KBTreeStatistics", _wrap_new_KBTreeStatistics},
+{"Bio::KBase::Tree::TreeCppUtilc::delete_KBTreeStatistics", _wrap_delete_KBTreeStatistics},
 {"Bio::KBase::Tree::TreeCppUtilc::new_KBTree", _wrap_new_KBTree},
 {"Bio::KBase::Tree::TreeCppUtilc::delete_KBTree", _wrap_delete_KBTree},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_fromFile", _wrap_KBTree_fromFile},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_toBinary", _wrap_KBTree_toBinary},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_writeBinaryToFile", _wrap_KBTree_writeBinaryToFile},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_fromBinary", _wrap_KBTree_fromBinary},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_fromBinaryFile", _wrap_KBTree_fromBinaryFile},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_scanStatistics", _wrap_KBTree_scanStatistics},
 {"Bio::KBase::Tree::TreeCppUtilc::KBTree_setOutputFlagLabel", _wrap_KBTree_setOutputFlagLabel},
 {"Bio::KBase::Tree::TreeCppUtilc::KBTree_setOutputFlagDistances", _wrap_KBTree_setOutputFlagDistances},
 {"Bio::KBase::Tree::TreeCppUtilc::KBTree_setOutputFlagComments", _wrap_KBTree_setOutputFlagComments},
 {"Bio::KBase::Tree::TreeCppUtilc::KBTree_setOutputFlagBootstrapValuesAsLabels", _wrap_KBTree_setOutputFlagBootstrapValuesAsLabels},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_setOutputPrecision", _wrap_KBTree_setOutputPrecision},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_setOutputThreadCount", _wrap_KBTree_setOutputThreadCount},
 {"Bio::KBase::Tree::TreeCppUtilc::KBTree_toNewick", _wrap_KBTree_toNewick},
 {"Bio::KBase::Tree::TreeCppUtilc::KBTree_writeNewickToFile", _wrap_KBTree_writeNewickToFile},
 {"Bio::KBase::Tree::TreeCppUtilc::KBTree_removeNodesByNameAndSimplify", _wrap_KBTree_removeNodesByNameAndSimplify},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_removeNodeByNameAndSimplify", _wrap_KBTree_removeNodeByNameAndSimplify},
 {"Bio::KBase::Tree::TreeCppUtilc::KBTree_mergeZeroDistLeaves", _wrap_KBTree_mergeZeroDistLeaves},
 {"Bio::KBase::Tree::TreeCppUtilc::KBTree_replaceNodeNames", _wrap_KBTree_replaceNodeNames},
 {"Bio::KBase::Tree::TreeCppUtilc::KBTree_replaceNodeNamesOrMakeBlank", _wrap_KBTree_replaceNodeNamesOrMakeBlank},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_replaceNodeName", _wrap_KBTree_replaceNodeName},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_getPathToRoot", _wrap_KBTree_getPathToRoot},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_getAllDescendantNames", _wrap_KBTree_getAllDescendantNames},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_getDepth", _wrap_KBTree_getDepth},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_getSubtreeSize", _wrap_KBTree_getSubtreeSize},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_getCladeLeafCount", _wrap_KBTree_getCladeLeafCount},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_getDistanceToRoot", _wrap_KBTree_getDistanceToRoot},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_extractInducedSubtree", _wrap_KBTree_extractInducedSubtree},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_writePatristicDistancesToFile", _wrap_KBTree_writePatristicDistancesToFile},
 {"Bio::KBase::Tree::TreeCppUtilc::KBTree_stripReservedCharsFromLabels", _wrap_KBTree_stripReservedCharsFromLabels},
 {"Bio::KBase::Tree::TreeCppUtilc::KBTree_printTree", _wrap_KBTree_printTree},
 {"Bio::KBase::Tree::TreeCppUtilc::KBTree_printSimpleTreeToString", _wrap_KBTree_printSimpleTreeToString},
 {"Bio::KBase::Tree::TreeCppUtilc::KBTree_printTreeToString", _wrap_KBTree_printTreeToString},
 {"Bio::KBase::Tree::TreeCppUtilc::KBTree_getNodeCount", _wrap_KBTree_getNodeCount},
 {"Bio::KBase::Tree::TreeCppUtilc::KBTree_getLeafCount", _wrap_KBTree_getLeafCount},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_getMemoryUsage", _wrap_KBTree_getMemoryUsage},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_freeze", _wrap_KBTree_freeze},
 {"Bio::KBase::Tree::TreeCppUtilc::KBTree_getAllLeafNames", _wrap_KBTree_getAllLeafNames},
 {"Bio::KBase::Tree::TreeCppUtilc::KBTree_getAllNodeNames", _wrap_KBTree_getAllNodeNames},
 {"Bio::KBase::Tree::TreeCppUtilc::KBTree_resetBreadthFirstIterToRoot", _wrap_KBTree_resetBreadthFirstIterToRoot},
@@ -3617,6 +11113,95 @@ static swig_command_info swig_commands[] = {
 {"Bio::KBase::Tree::TreeCppUtilc::KBTree_breadthFirstIterGetParentName", _wrap_KBTree_breadthFirstIterGetParentName},
 {"Bio::KBase::Tree::TreeCppUtilc::KBTree_breadthFirstIterGetAllChildrenNames", _wrap_KBTree_breadthFirstIterGetAllChildrenNames},
 {"Bio::KBase::Tree::TreeCppUtilc::KBTree_breadthFirstIterGetAllDescendantNames", _wrap_KBTree_breadthFirstIterGetAllDescendantNames},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_buildNodeIds", _wrap_KBTree_buildNodeIds},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_hasNodeIds", _wrap_KBTree_hasNodeIds},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_getNodeIdLimit", _wrap_KBTree_getNodeIdLimit},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_isValidNodeId", _wrap_KBTree_isValidNodeId},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_getNodeId", _wrap_KBTree_getNodeId},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_getParentId", _wrap_KBTree_getParentId},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_getSubtreeEndId", _wrap_KBTree_getSubtreeEndId},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_isDescendantOf", _wrap_KBTree_isDescendantOf},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_getNameById", _wrap_KBTree_getNameById},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_getChildNamesById", _wrap_KBTree_getChildNamesById},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_getDescendantNamesById", _wrap_KBTree_getDescendantNamesById},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTree_getPathToRootById", _wrap_KBTree_getPathToRootById},
+{"Bio::KBase::Tree::TreeCppUtilc::new_KBAncestorIndex", _wrap_new_KBAncestorIndex},
+{"Bio::KBase::Tree::TreeCppUtilc::delete_KBAncestorIndex", _wrap_delete_KBAncestorIndex},
+{"Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_getNodeCount", _wrap_KBAncestorIndex_getNodeCount},
+{"Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_getParent", _wrap_KBAncestorIndex_getParent},
+{"Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_getDepth", _wrap_KBAncestorIndex_getDepth},
+{"Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_getSubtreeSize", _wrap_KBAncestorIndex_getSubtreeSize},
+{"Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_getLeafCount", _wrap_KBAncestorIndex_getLeafCount},
+{"Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_isLeaf", _wrap_KBAncestorIndex_isLeaf},
+{"Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_getDistanceToRoot", _wrap_KBAncestorIndex_getDistanceToRoot},
+{"Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_getNode", _wrap_KBAncestorIndex_getNode},
+{"Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_isAncestor", _wrap_KBAncestorIndex_isAncestor},
+{"Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_getLowestCommonAncestor", _wrap_KBAncestorIndex_getLowestCommonAncestor},
+{"Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_getLowestCommonAncestorNames", _wrap_KBAncestorIndex_getLowestCommonAncestorNames},
+{"Bio::KBase::Tree::TreeCppUtilc::KBAncestorIndex_isMonophyletic", _wrap_KBAncestorIndex_isMonophyletic},
+{"Bio::KBase::Tree::TreeCppUtilc::new_KBTreeCursor", _wrap_new_KBTreeCursor},
+{"Bio::KBase::Tree::TreeCppUtilc::delete_KBTreeCursor", _wrap_delete_KBTreeCursor},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeCursor_getOrder", _wrap_KBTreeCursor_getOrder},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeCursor_reset", _wrap_KBTreeCursor_reset},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeCursor_next", _wrap_KBTreeCursor_next},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeCursor_isAtEnd", _wrap_KBTreeCursor_isAtEnd},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeCursor_getName", _wrap_KBTreeCursor_getName},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeCursor_getParentName", _wrap_KBTreeCursor_getParentName},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeCursor_getDistanceToParent", _wrap_KBTreeCursor_getDistanceToParent},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeCursor_getBootstrapValue", _wrap_KBTreeCursor_getBootstrapValue},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeCursor_isLeaf", _wrap_KBTreeCursor_isLeaf},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeCursor_getNodeId", _wrap_KBTreeCursor_getNodeId},
+{"Bio::KBase::Tree::TreeCppUtilc::new_KBFrozenTree", _wrap_new_KBFrozenTree},
+{"Bio::KBase::Tree::TreeCppUtilc::delete_KBFrozenTree", _wrap_delete_KBFrozenTree},
+{"Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_isSameSnapshot", _wrap_KBFrozenTree_isSameSnapshot},
+{"Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_getNodeCount", _wrap_KBFrozenTree_getNodeCount},
+{"Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_getLeafCount", _wrap_KBFrozenTree_getLeafCount},
+{"Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_getMemoryUsage", _wrap_KBFrozenTree_getMemoryUsage},
+{"Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_getAllLeafNames", _wrap_KBFrozenTree_getAllLeafNames},
+{"Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_getAllNodeNames", _wrap_KBFrozenTree_getAllNodeNames},
+{"Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_hasNode", _wrap_KBFrozenTree_hasNode},
+{"Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_getPathToRoot", _wrap_KBFrozenTree_getPathToRoot},
+{"Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_getDepth", _wrap_KBFrozenTree_getDepth},
+{"Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_getSubtreeSize", _wrap_KBFrozenTree_getSubtreeSize},
+{"Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_getCladeLeafCount", _wrap_KBFrozenTree_getCladeLeafCount},
+{"Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_getDistanceToRoot", _wrap_KBFrozenTree_getDistanceToRoot},
+{"Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_getLowestCommonAncestorNames", _wrap_KBFrozenTree_getLowestCommonAncestorNames},
+{"Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_isMonophyletic", _wrap_KBFrozenTree_isMonophyletic},
+{"Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_getPatristicDistance", _wrap_KBFrozenTree_getPatristicDistance},
+{"Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_writePatristicDistancesToFile", _wrap_KBFrozenTree_writePatristicDistancesToFile},
+{"Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_toNewick", _wrap_KBFrozenTree_toNewick},
+{"Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_writeNewickToFile", _wrap_KBFrozenTree_writeNewickToFile},
+{"Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_toKBTree", _wrap_KBFrozenTree_toKBTree},
+{"Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_removeNodesByNameAndSimplify", _wrap_KBFrozenTree_removeNodesByNameAndSimplify},
+{"Bio::KBase::Tree::TreeCppUtilc::KBFrozenTree_replaceNodeNames", _wrap_KBFrozenTree_replaceNodeNames},
+{"Bio::KBase::Tree::TreeCppUtilc::new_KBTreeCache", _wrap_new_KBTreeCache},
+{"Bio::KBase::Tree::TreeCppUtilc::delete_KBTreeCache", _wrap_delete_KBTreeCache},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeCache_getShared", _wrap_KBTreeCache_getShared},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeCache_get", _wrap_KBTreeCache_get},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeCache_contains", _wrap_KBTreeCache_contains},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeCache_clear", _wrap_KBTreeCache_clear},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeCache_setMemoryBudget", _wrap_KBTreeCache_setMemoryBudget},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeCache_getMemoryBudget", _wrap_KBTreeCache_getMemoryBudget},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeCache_getMemoryUsage", _wrap_KBTreeCache_getMemoryUsage},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeCache_getTreeCount", _wrap_KBTreeCache_getTreeCount},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeCache_getHitCount", _wrap_KBTreeCache_getHitCount},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeCache_getMissCount", _wrap_KBTreeCache_getMissCount},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeCache_getEvictionCount", _wrap_KBTreeCache_getEvictionCount},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeCache_resetCounters", _wrap_KBTreeCache_resetCounters},
+{"Bio::KBase::Tree::TreeCppUtilc::new_KBTreeDiskCache", _wrap_new_KBTreeDiskCache},
+{"Bio::KBase::Tree::TreeCppUtilc::delete_KBTreeDiskCache", _wrap_delete_KBTreeDiskCache},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeDiskCache_get", _wrap_KBTreeDiskCache_get},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeDiskCache_contains", _wrap_KBTreeDiskCache_contains},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeDiskCache_getImagePath", _wrap_KBTreeDiskCache_getImagePath},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeDiskCache_trim", _wrap_KBTreeDiskCache_trim},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeDiskCache_clear", _wrap_KBTreeDiskCache_clear},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeDiskCache_setSizeLimit", _wrap_KBTreeDiskCache_setSizeLimit},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeDiskCache_getSizeLimit", _wrap_KBTreeDiskCache_getSizeLimit},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeDiskCache_getDiskUsage", _wrap_KBTreeDiskCache_getDiskUsage},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeDiskCache_getHitCount", _wrap_KBTreeDiskCache_getHitCount},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeDiskCache_getMissCount", _wrap_KBTreeDiskCache_getMissCount},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeDiskCache_getEvictionCount", _wrap_KBTreeDiskCache_getEvictionCount},
+{"Bio::KBase::Tree::TreeCppUtilc::KBTreeDiskCache_resetCounters", _wrap_KBTreeDiskCache_resetCounters},
 {0,0}
 };
 /* -----------------------------------------------------------------------------
@@ -3915,7 +11500,53 @@ XS(SWIG_init) {
     SvREADONLY_on(sv);
   }
   
+  SWIG_TypeClientData(SWIGTYPE_p_KBTreeLib__KBTreeStatistics, (void*) "Bio::KBase::Tree::TreeCppUtil::KBTreeStatistics");
+  /*@SWIG:/usr/share/swig2.0/perl5/perltypemaps.swg,65,%set_constant@*/ do {
+    SV *sv = get_sv((char*) SWIG_prefix "KBTree_PHYLIP_MATRIX", TRUE | 0x2 | GV_ADDMULTI);
+    sv_setsv(sv, SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(KBTreeLib::KBTree::PHYLIP_MATRIX)));
+    SvREADONLY_on(sv);
+  } while(0) /*@SWIG@*/;
+  /*@SWIG:/usr/share/swig2.0/perl5/perltypemaps.swg,65,%set_constant@*/ do {
+    SV *sv = get_sv((char*) SWIG_prefix "KBTree_TSV_MATRIX", TRUE | 0x2 | GV_ADDMULTI);
+    sv_setsv(sv, SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(KBTreeLib::KBTree::TSV_MATRIX)));
+    SvREADONLY_on(sv);
+  } while(0) /*@SWIG@*/;
+  /*@SWIG:/usr/share/swig2.0/perl5/perltypemaps.swg,65,%set_constant@*/ do {
+    SV *sv = get_sv((char*) SWIG_prefix "KBTree_NO_NODE_ID", TRUE | 0x2 | GV_ADDMULTI);
+    sv_setsv(sv, SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(KBTreeLib::KBTree::NO_NODE_ID)));
+    SvREADONLY_on(sv);
+  } while(0) /*@SWIG@*/;
   SWIG_TypeClientData(SWIGTYPE_p_KBTreeLib__KBTree, (void*) "Bio::KBase::Tree::TreeCppUtil::KBTree");
+  /*@SWIG:/usr/share/swig2.0/perl5/perltypemaps.swg,65,%set_constant@*/ do {
+    SV *sv = get_sv((char*) SWIG_prefix "KBAncestorIndex_NONE", TRUE | 0x2 | GV_ADDMULTI);
+    sv_setsv(sv, SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(KBTreeLib::KBAncestorIndex::NONE)));
+    SvREADONLY_on(sv);
+  } while(0) /*@SWIG@*/;
+  SWIG_TypeClientData(SWIGTYPE_p_KBTreeLib__KBAncestorIndex, (void*) "Bio::KBase::Tree::TreeCppUtil::KBAncestorIndex");
+  /*@SWIG:/usr/share/swig2.0/perl5/perltypemaps.swg,65,%set_constant@*/ do {
+    SV *sv = get_sv((char*) SWIG_prefix "KBTreeCursor_PREORDER", TRUE | 0x2 | GV_ADDMULTI);
+    sv_setsv(sv, SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(KBTreeLib::KBTreeCursor::PREORDER)));
+    SvREADONLY_on(sv);
+  } while(0) /*@SWIG@*/;
+  /*@SWIG:/usr/share/swig2.0/perl5/perltypemaps.swg,65,%set_constant@*/ do {
+    SV *sv = get_sv((char*) SWIG_prefix "KBTreeCursor_POSTORDER", TRUE | 0x2 | GV_ADDMULTI);
+    sv_setsv(sv, SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(KBTreeLib::KBTreeCursor::POSTORDER)));
+    SvREADONLY_on(sv);
+  } while(0) /*@SWIG@*/;
+  /*@SWIG:/usr/share/swig2.0/perl5/perltypemaps.swg,65,%set_constant@*/ do {
+    SV *sv = get_sv((char*) SWIG_prefix "KBTreeCursor_BREADTH_FIRST", TRUE | 0x2 | GV_ADDMULTI);
+    sv_setsv(sv, SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(KBTreeLib::KBTreeCursor::BREADTH_FIRST)));
+    SvREADONLY_on(sv);
+  } while(0) /*@SWIG@*/;
+  /*@SWIG:/usr/share/swig2.0/perl5/perltypemaps.swg,65,%set_constant@*/ do {
+    SV *sv = get_sv((char*) SWIG_prefix "KBTreeCursor_LEAVES", TRUE | 0x2 | GV_ADDMULTI);
+    sv_setsv(sv, SWIG_From_unsigned_SS_int  SWIG_PERL_CALL_ARGS_1(static_cast< unsigned int >(KBTreeLib::KBTreeCursor::LEAVES)));
+    SvREADONLY_on(sv);
+  } while(0) /*@SWIG@*/;
+  SWIG_TypeClientData(SWIGTYPE_p_KBTreeLib__KBTreeCursor, (void*) "Bio::KBase::Tree::TreeCppUtil::KBTreeCursor");
+  SWIG_TypeClientData(SWIGTYPE_p_KBTreeLib__KBFrozenTree, (void*) "Bio::KBase::Tree::TreeCppUtil::KBFrozenTree");
+  SWIG_TypeClientData(SWIGTYPE_p_KBTreeLib__KBTreeCache, (void*) "Bio::KBase::Tree::TreeCppUtil::KBTreeCache");
+  SWIG_TypeClientData(SWIGTYPE_p_KBTreeLib__KBTreeDiskCache, (void*) "Bio::KBase::Tree::TreeCppUtil::KBTreeDiskCache");
   ST(0) = &PL_sv_yes;
   XSRETURN(1);
 }
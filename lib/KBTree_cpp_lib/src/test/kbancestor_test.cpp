@@ -0,0 +1,135 @@
+/**
+ * @file kbancestor_test.cpp
+ * @brief Tests of the lowest common ancestor index (kbancestor.cpp)
+ */
+
+#include "kbtest.hh"
+#include "../kbtree/kbancestor.hh"
+#include "../kbtree/kbcompact.hh"
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace KBTreeLib;
+using namespace KBTreeTest;
+
+
+/** the lowest common ancestor found by walking up from both nodes */
+static uint32_t walkToCommonAncestor(const KBCompactTree &compact, uint32_t a, uint32_t b) {
+	std::vector<bool> aboveA(compact.getNodeCount(),false);
+	for(uint32_t node=a; node!=KBCompactTree::NONE; node=compact.getParent(node)) { aboveA[node]=true; }
+	uint32_t node = b;
+	while(node!=KBCompactTree::NONE && !aboveA[node]) { node = compact.getParent(node); }
+	return node;
+}
+
+/** every query of the index gives what walking the parents of the compact tree, numbered the same way, gives */
+KBTEST(testAncestorIndex) {
+	std::mt19937 rng(18);
+	for(unsigned int t=0; t<40; t++) {
+		// enough leaves, in some of the trees, to span several levels of the table of blocks
+		const unsigned int leaves = t%4==0 ? 2000+rng()%3000 : 1+rng()%200;
+		KBTree tree(generateLeafNamedTree(rng,leaves),false,false);
+		KBCompactTree compact(tree);
+		KBAncestorIndex index(tree);
+		const uint32_t n = compact.getNodeCount();
+		CHECK(index.getNodeCount()==n);
+		if(index.getNodeCount()!=n) { continue; }
+
+		std::vector<uint32_t> depth(n,0), size(n,1), leafCount(n,0);
+		std::vector<double> distance(n,0);
+		for(uint32_t node=1; node<n; node++) {
+			depth[node] = depth[compact.getParent(node)]+1;
+			distance[node] = distance[compact.getParent(node)]+compact.getDistanceToParent(node);
+		}
+		for(uint32_t node=n-1; node<n; node--) {
+			if(compact.isLeaf(node)) { leafCount[node]++; }
+			if(node>0) { size[compact.getParent(node)] += size[node]; leafCount[compact.getParent(node)] += leafCount[node]; }
+		}
+		bool allMatch = true;
+		for(uint32_t node=0; node<n; node++) {
+			allMatch = allMatch && index.getParent(node)==compact.getParent(node) && index.getDepth(node)==depth[node]
+				&& index.getSubtreeSize(node)==size[node] && index.getLeafCount(node)==leafCount[node]
+				&& index.isLeaf(node)==compact.isLeaf(node) && index.getName(node)==compact.getName(node);
+			CHECK_NEAR(distance[node],index.getDistanceToRoot(node));
+		}
+		CHECK(allMatch);
+
+		std::vector<uint32_t> as, bs, expected;
+		for(unsigned int q=0; q<300; q++) {
+			const uint32_t a = rng()%n, b = rng()%n;
+			const uint32_t lca = walkToCommonAncestor(compact,a,b);
+			CHECK(index.getLowestCommonAncestor(a,b)==lca);
+			CHECK(index.isAncestor(a,b)==(lca==a));
+			CHECK_NEAR(distance[a]+distance[b]-2*distance[lca],index.getPatristicDistance(a,b));
+			as.push_back(a); bs.push_back(b); expected.push_back(lca);
+		}
+		std::vector<uint32_t> ancestors;
+		index.getLowestCommonAncestors(as,bs,ancestors);
+		CHECK(ancestors==expected);
+		uint32_t common = as[0];
+		for(size_t i=1; i<as.size(); i++) { common = walkToCommonAncestor(compact,common,as[i]); }
+		CHECK(index.getLowestCommonAncestor(as)==common);
+
+		// leaves are named L0, L1, ... so a name pair is a query on the nodes of the two leaves
+		std::vector<uint32_t> leafNodes;
+		index.getLeaves(leafNodes);
+		CHECK(leafNodes.size()==leaves);
+		const uint32_t a = rng()%leaves, b = rng()%leaves;
+		const std::string nameA = "L"+std::to_string(a), nameB = "L"+std::to_string(b);
+		CHECK(index.getNode(nameA)!=KBAncestorIndex::NONE && index.getName(index.getNode(nameA))==nameA);
+		CHECK(index.getLowestCommonAncestor(index.getNode(nameA),index.getNode(nameB))==walkToCommonAncestor(compact,index.getNode(nameA),index.getNode(nameB)));
+	}
+	KBTree tree("((A:1,B:2)X:0.5,(C:1,D:1,E:2)Y:1,F:4)R;",false,false);
+	KBAncestorIndex index(tree);
+	CHECK(index.getNode("Z")==KBAncestorIndex::NONE);
+	std::ostringstream reported;
+	std::streambuf *saved = cerr.rdbuf(reported.rdbuf());
+	const std::string ancestorNames = index.getLowestCommonAncestorNames("A;B;A;C;D;E;A;Z");
+	cerr.rdbuf(saved);
+	CHECK_EQUAL("X;R;Y;;",ancestorNames);
+	CHECK_NEAR(4.5,index.getPatristicDistance(index.getNode("B"),index.getNode("D")));
+	CHECK(index.getDepth(index.getNode("A"))==2 && index.getDepth(index.getNode("R"))==0);
+}
+
+/** a set of leaves is monophyletic exactly when it is every leaf below its lowest common ancestor */
+KBTEST(testMonophyly) {
+	KBTree tree("((A,B)X,(C,D,E)Y,F)R;",false,false);
+	KBAncestorIndex index(tree);
+	CHECK(index.isMonophyletic("A;B"));
+	CHECK(index.isMonophyletic("C;D;E"));
+	CHECK(!index.isMonophyletic("C;D"));
+	CHECK(!index.isMonophyletic("A;C"));
+	CHECK(index.isMonophyletic("A;B;C;D;E;F"));
+	CHECK(index.isMonophyletic("F"));
+	CHECK(!index.isMonophyletic("X;A;B"));
+	std::ostringstream reported;
+	std::streambuf *saved = cerr.rdbuf(reported.rdbuf());
+	const bool missing = index.isMonophyletic("A;Z");
+	cerr.rdbuf(saved);
+	CHECK(!missing);
+
+	std::mt19937 rng(1018);
+	for(unsigned int t=0; t<100; t++) {
+		const unsigned int leaves = 2+rng()%100;
+		KBTree random(generateLeafNamedTree(rng,leaves),false,false);
+		KBCompactTree compact(random);
+		KBAncestorIndex randomIndex(compact);
+		// the leaves of a clade are monophyletic; less one of them, they are if they are every leaf below the
+		// ancestor found by walking up from them
+		const uint32_t clade = rng()%compact.getNodeCount();
+		std::vector<std::string> names;
+		for(uint32_t node=clade; node<clade+randomIndex.getSubtreeSize(clade); node++) {
+			if(compact.isLeaf(node)) { names.push_back(std::string(compact.getName(node))); }
+		}
+		CHECK(randomIndex.isMonophyletic(names));
+		if(names.size()>1) {
+			names.erase(names.begin()+rng()%names.size());
+			uint32_t common = randomIndex.getNode(names[0]);
+			for(size_t i=1; i<names.size(); i++) { common = walkToCommonAncestor(compact,common,randomIndex.getNode(names[i])); }
+			CHECK(randomIndex.isMonophyletic(names)==(randomIndex.getLeafCount(common)==names.size()));
+		}
+	}
+}
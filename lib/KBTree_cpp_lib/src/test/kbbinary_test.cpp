@@ -0,0 +1,64 @@
+/**
+ * @file kbbinary_test.cpp
+ * @brief Tests of the binary tree format (kbbinary.cpp)
+ */
+
+#include "kbtest.hh"
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace std;
+using namespace KBTreeLib;
+using namespace KBTreeTest;
+
+
+/** a tree loaded from its binary form writes the same text, and a cut off image is rejected */
+KBTEST(testBinary) {
+	for(unsigned int seed=1; seed<=20; seed++) {
+		const std::string newick = generateTree(seed,1+seed*seed);
+		KBTree tree(newick,false,false);
+		const std::string binary = tree.toBinary();
+		CHECK(binary.size()>0);
+		KBTree *loaded = KBTree::fromBinary(binary);
+		CHECK_EQUAL(tree.toNewick(KBNode::ORIGINAL_LABEL),loaded->toNewick(KBNode::ORIGINAL_LABEL));
+		CHECK_EQUAL(tree.toNewick(KBNode::NAME_DISTANCE_AND_COMMENTS),loaded->toNewick(KBNode::NAME_DISTANCE_AND_COMMENTS));
+		CHECK_EQUAL(binary,loaded->toBinary());
+		delete loaded;
+
+		for(size_t length=0; length<binary.size(); length++) {
+			const std::string truncated = binary.substr(0,length);
+			CHECK(throwsParseException([&]() { delete KBTree::fromBinary(truncated); }));
+		}
+	}
+	CHECK(throwsParseException([]() { delete KBTree::fromBinary("(A:1,B:2);"); }));
+}
+
+/** a binary file is loaded in place, and is only the tree's storage as long as the tree needs it */
+KBTEST(testBinaryFile) {
+	const std::string filename = makeTemporaryFile("kbbinary_test");
+	for(int lazy=0; lazy<2; lazy++) {
+		KBTree tree(generateTree(30+lazy,500),false,false,1,lazy==1);
+		CHECK(tree.writeBinaryToFile(filename));
+		CHECK_EQUAL(tree.toBinary(),readFile(filename));
+		KBTree *loaded = KBTree::fromBinaryFile(filename);
+		CHECK(loaded!=NULL);
+		if(loaded==NULL) { continue; }
+		unlink(filename.c_str());
+		CHECK(loaded->getNodeCount()==tree.getNodeCount());
+		CHECK_EQUAL(tree.toNewick(KBNode::ORIGINAL_LABEL),loaded->toNewick(KBNode::ORIGINAL_LABEL));
+		// edits of the loaded tree leave the mapped file alone
+		std::vector<std::string> leafNames;
+		loaded->getAllLeafNames(leafNames);
+		loaded->replaceNodeNames(leafNames[0]+";renamed");
+		CHECK(loaded->toNewick().find("renamed")!=std::string::npos);
+		delete loaded;
+	}
+
+	std::ostringstream reported;
+	std::streambuf *saved = cerr.rdbuf(reported.rdbuf());
+	CHECK(KBTree::fromBinaryFile(filename)==NULL);
+	cerr.rdbuf(saved);
+}
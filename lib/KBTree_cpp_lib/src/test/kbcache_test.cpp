@@ -0,0 +1,119 @@
+/**
+ * @file kbcache_test.cpp
+ * @brief Tests of the cache of parsed trees (kbcache.cpp)
+ */
+
+#include "kbtest.hh"
+#include "../kbtree/kbcache.hh"
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace KBTreeLib;
+using namespace KBTreeTest;
+
+
+/** the hash is MurmurHash3 x64 128, which has published values, and reads every byte of the text */
+KBTEST(testTextHash) {
+	CHECK_EQUAL("00000000000000000000000000000000",hashText("").toString());
+	const KBTextHash fox = hashText("The quick brown fox jumps over the lazy dog");
+	CHECK(fox.low==0xe34bbc7bbc071b6cULL && fox.high==0x7a433ca9c49a9347ULL);
+	CHECK_EQUAL("7a433ca9c49a9347e34bbc7bbc071b6c",fox.toString());
+	// every length of tail after the 16 byte blocks, and a change in any byte
+	std::string text = generateTree(24,40);
+	for(size_t length=0; length<40; length++) {
+		const std::string prefix = text.substr(0,length);
+		std::string changed = prefix+"x";
+		CHECK(hashText(prefix)==hashText(std::string(prefix)));
+		CHECK(hashText(prefix)!=hashText(changed));
+		if(length>0) {
+			changed = prefix;
+			changed[length/2] ^= 1;
+			CHECK(hashText(prefix)!=hashText(changed));
+		}
+	}
+}
+
+/** a repeated text is parsed once, the parse flags are part of the key, and the counters say so */
+KBTEST(testCacheHitsAndMisses) {
+	KBTreeCache cache;
+	const std::string newick = "((A:1,B:2)95:0.5,C:3);";
+	KBFrozenTree first = cache.get(newick);
+	KBFrozenTree second = cache.get(newick);
+	CHECK(first.isSameSnapshot(second));
+	CHECK(cache.getHitCount()==1 && cache.getMissCount()==1 && cache.getTreeCount()==1);
+	CHECK(cache.contains(newick) && !cache.contains(newick,true));
+	KBFrozenTree bootstrap = cache.get(newick,true);
+	CHECK(!bootstrap.isSameSnapshot(first));
+	CHECK(cache.getTreeCount()==2 && cache.getMissCount()==2);
+	CHECK(cache.getMemoryUsage()==first.getMemoryUsage()+bootstrap.getMemoryUsage());
+	CHECK_EQUAL(KBTree(newick,false,false).toNewick(),first.toNewick());
+
+	std::ostringstream reported;
+	std::streambuf *saved = cerr.rdbuf(reported.rdbuf());
+	const bool thrown = throwsParseException([&]() { cache.get("(A:1,B:x);"); });
+	cerr.rdbuf(saved);
+	CHECK(thrown);
+	CHECK(cache.getTreeCount()==2);
+
+	cache.resetCounters();
+	CHECK(cache.getHitCount()==0 && cache.getMissCount()==0);
+	cache.clear();
+	CHECK(cache.getTreeCount()==0 && cache.getMemoryUsage()==0 && !cache.contains(newick));
+	// a tree dropped from the cache lives on in its handles
+	CHECK_EQUAL(KBTree(newick,false,false).toNewick(),second.toNewick());
+	CHECK(&KBTreeCache::getShared()==&KBTreeCache::getShared());
+}
+
+/** the least recently used trees are dropped to keep to the budget, and a tree too large for it is not kept */
+KBTEST(testCacheEviction) {
+	std::vector<std::string> texts;
+	for(unsigned int seed=1; seed<=6; seed++) { texts.push_back(generateTree(seed,200)); }
+	size_t bytes = 0;
+	for(size_t i=0; i<3; i++) { bytes += KBFrozenTree(texts[i]).getMemoryUsage(); }
+	KBTreeCache cache(bytes);
+	for(size_t i=0; i<3; i++) { cache.get(texts[i]); }
+	CHECK(cache.getTreeCount()==3 && cache.getEvictionCount()==0 && cache.getMemoryUsage()==bytes);
+	// using the first makes the second the least recently used
+	cache.get(texts[0]);
+	cache.get(texts[3]);
+	CHECK(cache.getMemoryUsage()<=cache.getMemoryBudget());
+	CHECK(cache.contains(texts[0]) && cache.contains(texts[3]) && !cache.contains(texts[1]));
+	CHECK(cache.getEvictionCount()>=1);
+
+	cache.setMemoryBudget(0);
+	CHECK(cache.getTreeCount()==0 && cache.getMemoryUsage()==0);
+	KBFrozenTree large = cache.get(texts[4]);
+	CHECK(large.getNodeCount()==KBTree(texts[4],false,false).getNodeCount());
+	CHECK(!cache.contains(texts[4]) && cache.getTreeCount()==0);
+}
+
+/** threads asking for the same trees at once all get the same snapshot of each */
+KBTEST(testCacheSharedAcrossThreads) {
+	KBTreeCache cache;
+	std::vector<std::string> texts;
+	for(unsigned int seed=1; seed<=4; seed++) { texts.push_back(generateTree(seed,3000)); }
+	std::vector<KBFrozenTree> expected;
+	for(size_t i=0; i<texts.size(); i++) { expected.push_back(KBFrozenTree(texts[i])); }
+	std::vector<int> matched(8,0);
+	std::vector<std::thread> threads;
+	for(unsigned int t=0; t<matched.size(); t++) {
+		threads.push_back(std::thread([&cache,&texts,&expected,&matched,t]() {
+			bool allMatch = true;
+			for(unsigned int round=0; round<20; round++) {
+				const size_t i = (t+round)%texts.size();
+				allMatch = allMatch && cache.get(texts[i]).toNewick()==expected[i].toNewick();
+			}
+			matched[t] = allMatch;
+		}));
+	}
+	for(size_t t=0; t<threads.size(); t++) { threads[t].join(); }
+	for(size_t t=0; t<matched.size(); t++) { CHECK(matched[t]==1); }
+	CHECK(cache.getTreeCount()==texts.size());
+	CHECK(cache.getHitCount()+cache.getMissCount()==8*20);
+	KBFrozenTree first = cache.get(texts[0]), again = cache.get(texts[0]);
+	CHECK(first.isSameSnapshot(again));
+}
@@ -0,0 +1,70 @@
+/**
+ * @file kbcompact_test.cpp
+ * @brief Tests of the compact, array based tree (kbcompact.cpp)
+ */
+
+#include "kbtest.hh"
+#include "../kbtree/kbcompact.hh"
+#include <string>
+
+using namespace std;
+using namespace KBTreeLib;
+using namespace KBTreeTest;
+
+
+/** a compact tree writes what the KBTree writes, whatever the output settings, and converts back to it */
+KBTEST(testCompactRoundTrip) {
+	for(unsigned int seed=1; seed<=40; seed++) {
+		const std::string newick = generateTree(seed,1+seed*5);
+		KBTree tree(newick,false,false);
+		KBCompactTree compact(tree,true);
+		CHECK(compact.keepsOriginalLabels());
+		CHECK(compact.getNodeCount()==tree.getNodeCount());
+		CHECK(compact.getLeafCount()==tree.getLeafCount());
+		CHECK_EQUAL(tree.getAllLeafNames(),compact.getAllLeafNames());
+		CHECK_EQUAL(tree.getAllNodeNames(),compact.getAllNodeNames());
+		for(int precision=0; precision<2; precision++) {
+			tree.setOutputPrecision(precision==0 ? DEFAULT_OUTPUT_PRECISION : SHORTEST_ROUND_TRIP);
+			compact.setOutputPrecision(precision==0 ? DEFAULT_OUTPUT_PRECISION : SHORTEST_ROUND_TRIP);
+			for(unsigned int flags=0; flags<16; flags++) {
+				tree.setOutputFlagLabel((flags&1)!=0);          compact.setOutputFlagLabel((flags&1)!=0);
+				tree.setOutputFlagDistances((flags&2)!=0);      compact.setOutputFlagDistances((flags&2)!=0);
+				tree.setOutputFlagComments((flags&4)!=0);       compact.setOutputFlagComments((flags&4)!=0);
+				tree.setOutputFlagBootstrapValuesAsLabels((flags&8)!=0); compact.setOutputFlagBootstrapValuesAsLabels((flags&8)!=0);
+				CHECK_EQUAL(tree.toNewick(),compact.toNewick());
+			}
+			for(unsigned int style=KBNode::NAME_AND_DISTANCE; style<=KBNode::ORIGINAL_LABEL; style++) {
+				CHECK_EQUAL(tree.toNewick(style),compact.toNewick(style));
+			}
+		}
+		tree.setOutputPrecision(DEFAULT_OUTPUT_PRECISION);
+
+		KBTree *converted = compact.toKBTree();
+		CHECK(converted->getNodeCount()==tree.getNodeCount());
+		CHECK_EQUAL(tree.toNewick(KBNode::ORIGINAL_LABEL),converted->toNewick(KBNode::ORIGINAL_LABEL));
+		CHECK_EQUAL(tree.toNewick(KBNode::NAME_DISTANCE_AND_COMMENTS),converted->toNewick(KBNode::NAME_DISTANCE_AND_COMMENTS));
+		delete converted;
+
+		KBCompactTree parsed(newick);
+		CHECK(!parsed.keepsOriginalLabels());
+		CHECK_EQUAL(tree.toNewick(KBNode::NAME_DISTANCE_AND_COMMENTS),parsed.toNewick(KBNode::ORIGINAL_LABEL));
+	}
+}
+
+/** the arrays describe the tree: nodes in preorder, each child after its parent and elder siblings */
+KBTEST(testCompactNavigation) {
+	KBCompactTree compact("((A:1,B:2)95:0.5,C:3);",true);
+	CHECK(compact.getNodeCount()==5 && compact.getLeafCount()==3);
+	CHECK(compact.getParent(0)==KBCompactTree::NONE);
+	const uint32_t clade = compact.getFirstChild(0);
+	CHECK(clade==1 && compact.getParent(clade)==0 && !compact.isLeaf(clade));
+	CHECK_NEAR(95,compact.getBootstrapValue(clade));
+	CHECK_NEAR(0.5,compact.getDistanceToParent(clade));
+	CHECK(compact.getFirstChild(clade)==2 && compact.getNextSibling(2)==3 && compact.getNextSibling(3)==KBCompactTree::NONE);
+	CHECK_EQUAL("A",std::string(compact.getName(2)));
+	CHECK_EQUAL("B",std::string(compact.getName(3)));
+	CHECK(compact.getNextSibling(clade)==4 && compact.isLeaf(4));
+	CHECK_EQUAL("C",std::string(compact.getName(4)));
+	CHECK_NEAR(3,compact.getDistanceToParent(4));
+	CHECK_EQUAL("",std::string(compact.getOriginalLabel(4)));
+}
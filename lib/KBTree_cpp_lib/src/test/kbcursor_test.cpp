@@ -0,0 +1,125 @@
+/**
+ * @file kbcursor_test.cpp
+ * @brief Tests of the traversal cursors (kbcursor.cpp)
+ */
+
+#include "kbtest.hh"
+#include "../kbtree/kbcompact.hh"
+#include "../kbtree/kbcursor.hh"
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace KBTreeLib;
+using namespace KBTreeTest;
+
+
+/** the names a cursor visits, from where it is to the end */
+static std::vector<std::string> walk(KBTreeCursor &cursor) {
+	std::vector<std::string> names;
+	for(bool more=!cursor.isAtEnd(); more; more=cursor.next()) { names.push_back(cursor.getName()); }
+	return names;
+}
+
+/** the same without the empty names, which getAllNodeNames and getAllLeafNames leave out */
+static std::vector<std::string> walkNamed(KBTreeCursor &cursor) {
+	std::vector<std::string> names;
+	for(bool more=!cursor.isAtEnd(); more; more=cursor.next()) {
+		if(!cursor.getName().empty()) { names.push_back(cursor.getName()); }
+	}
+	return names;
+}
+
+/** the names, in order, of the nodes visited by the tree's own breadth first iterator */
+static std::vector<std::string> breadthFirstNames(KBTree &tree) {
+	std::vector<std::string> names;
+	tree.resetBreadthFirstIterToRoot();
+	for(bool more=true; more; more=tree.breadthFirstIterNext()) { names.push_back(tree.breadthFirstIterGetName()); }
+	return names;
+}
+
+/** each order visits the nodes the tree visits in that order, with the same labels */
+KBTEST(testCursorOrders) {
+	for(unsigned int seed=1; seed<=30; seed++) {
+		for(int lazy=0; lazy<2; lazy++) {
+			const std::string newick = generateTree(seed,1+seed*7);
+			KBTree tree(newick,false,false,1,lazy==1);
+			KBTree reference(newick,false,false);
+			KBCompactTree compact(reference);
+			tree.buildNodeIds();
+
+			KBTreeCursor preorder(tree,KBTreeCursor::PREORDER);
+			bool allMatch = true;
+			for(uint32_t node=0; node<compact.getNodeCount(); node++, preorder.next()) {
+				const double distance = preorder.getDistanceToParent(), bootstrap = preorder.getBootstrapValue();
+				const uint32_t parent = compact.getParent(node);
+				allMatch = allMatch && !preorder.isAtEnd() && preorder.getName()==compact.getName(node)
+					&& preorder.getParentName()==(parent==KBCompactTree::NONE ? std::string_view() : compact.getName(parent))
+					&& (std::isnan(distance) ? std::isnan(compact.getDistanceToParent(node)) : distance==compact.getDistanceToParent(node))
+					&& (std::isnan(bootstrap) ? std::isnan(compact.getBootstrapValue(node)) : bootstrap==compact.getBootstrapValue(node))
+					&& preorder.isLeaf()==compact.isLeaf(node) && preorder.getNodeId()==node;
+			}
+			CHECK(allMatch);
+			CHECK(preorder.isAtEnd() && !preorder.next());
+			CHECK(preorder.getName()=="" && std::isnan(preorder.getDistanceToParent()) && preorder.getNodeId()==KBTree::NO_NODE_ID);
+
+			std::vector<std::string> names;
+			reference.getAllNodeNames(names);
+			KBTreeCursor postorder(tree,KBTreeCursor::POSTORDER);
+			CHECK(walkNamed(postorder)==names);
+			names.clear();
+			reference.getAllLeafNames(names);
+			KBTreeCursor leaves(tree,KBTreeCursor::LEAVES);
+			CHECK(walkNamed(leaves)==names);
+			KBTreeCursor breadthFirst(tree,KBTreeCursor::BREADTH_FIRST);
+			CHECK(walk(breadthFirst)==breadthFirstNames(reference));
+			breadthFirst.reset();
+			CHECK(walk(breadthFirst)==breadthFirstNames(reference));
+		}
+	}
+	KBTree tree("(A,B);",false,false);
+	std::ostringstream reported;
+	std::streambuf *saved = cerr.rdbuf(reported.rdbuf());
+	KBTreeCursor unknown(tree,7);
+	cerr.rdbuf(saved);
+	CHECK(unknown.isAtEnd() && !unknown.next());
+}
+
+/** cursors keep their own positions: interleaved on one thread, or walking the same tree on many at once,
+ * each sees the whole order, and the tree's own iterator is not moved */
+KBTEST(testIndependentCursors) {
+	KBTree tree(generateTree(22,5000),false,false,1,true);
+	KBTree reference(generateTree(22,5000),false,false);
+	std::vector<std::string> expected[4];
+	for(unsigned int order=0; order<4; order++) {
+		KBTreeCursor cursor(reference,order);
+		expected[order] = walk(cursor);
+	}
+
+	tree.resetBreadthFirstIterToRoot();
+	tree.breadthFirstIterNext();
+	const std::string iterated = tree.breadthFirstIterGetName();
+	KBTreeCursor first(tree,KBTreeCursor::PREORDER), second(tree,KBTreeCursor::PREORDER);
+	std::vector<std::string> firstNames, secondNames;
+	while(!first.isAtEnd() || !second.isAtEnd()) {
+		if(!first.isAtEnd()) { firstNames.push_back(first.getName()); first.next(); }
+		for(int step=0; step<2 && !second.isAtEnd(); step++) { secondNames.push_back(second.getName()); second.next(); }
+	}
+	CHECK(firstNames==expected[KBTreeCursor::PREORDER] && secondNames==expected[KBTreeCursor::PREORDER]);
+	CHECK_EQUAL(iterated,tree.breadthFirstIterGetName());
+
+	std::vector<int> matched(8,0);
+	std::vector<std::thread> threads;
+	for(unsigned int t=0; t<matched.size(); t++) {
+		threads.push_back(std::thread([&tree,&expected,&matched,t]() {
+			KBTreeCursor cursor(tree,t%4);
+			matched[t] = walk(cursor)==expected[t%4];
+		}));
+	}
+	for(size_t t=0; t<threads.size(); t++) { threads[t].join(); }
+	for(size_t t=0; t<matched.size(); t++) { CHECK(matched[t]==1); }
+}
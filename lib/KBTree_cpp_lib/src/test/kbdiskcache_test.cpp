@@ -0,0 +1,130 @@
+/**
+ * @file kbdiskcache_test.cpp
+ * @brief Tests of the directory cache of binary tree images (kbdiskcache.cpp)
+ */
+
+#include "kbtest.hh"
+#include "../kbtree/kbdiskcache.hh"
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace std;
+using namespace KBTreeLib;
+using namespace KBTreeTest;
+
+
+/** true if the tree from the cache is the tree parsed from the text */
+static bool matchesParse(KBTree *cached, const std::string &newick, bool assumeBootstrapNames=false) {
+	if(cached==NULL) { return false; }
+	KBTree parsed(newick,false,assumeBootstrapNames);
+	const bool same = cached->getNodeCount()==parsed.getNodeCount()
+		&& cached->toNewick(KBNode::ORIGINAL_LABEL)==parsed.toNewick(KBNode::ORIGINAL_LABEL)
+		&& cached->toNewick()==parsed.toNewick();
+	delete cached;
+	return same;
+}
+
+/** the first lookup parses and stores an image, and later lookups, by this cache or a new one, load it */
+KBTEST(testDiskCacheHitsAndMisses) {
+	const std::string directory = makeTemporaryDirectory("kbdiskcache_test");
+	const std::string newick = generateTree(25,500);
+	{
+		KBTreeDiskCache cache(directory+"/images");
+		CHECK(!cache.contains(newick));
+		CHECK(matchesParse(cache.get(newick),newick));
+		CHECK(cache.getMissCount()==1 && cache.getHitCount()==0);
+		CHECK(cache.contains(newick) && !cache.contains(newick,true));
+		const std::string path = cache.getImagePath(newick);
+		CHECK(path.compare(0,cache.getDirectory().size(),cache.getDirectory())==0);
+		CHECK(path.size()>=strlen(KBTreeDiskCache::IMAGE_SUFFIX) && path.compare(path.size()-strlen(KBTreeDiskCache::IMAGE_SUFFIX),std::string::npos,KBTreeDiskCache::IMAGE_SUFFIX)==0);
+		CHECK(path!=cache.getImagePath(newick,true));
+		CHECK(cache.getDiskUsage()==(uint64_t)readFile(path).size());
+		CHECK(matchesParse(cache.get(newick),newick));
+		CHECK(cache.getHitCount()==1);
+		CHECK(matchesParse(cache.get("((A:1,B:2)95:0.5,C:3);",true),"((A:1,B:2)95:0.5,C:3);",true));
+	}
+	{
+		KBTreeDiskCache restarted(directory+"/images");
+		CHECK(matchesParse(restarted.get(newick),newick));
+		CHECK(restarted.getHitCount()==1 && restarted.getMissCount()==0);
+
+		// a parse error stores nothing
+		std::ostringstream reported;
+		std::streambuf *saved = cerr.rdbuf(reported.rdbuf());
+		const bool thrown = throwsParseException([&]() { delete restarted.get("(A:1,B:x);"); });
+		cerr.rdbuf(saved);
+		CHECK(thrown && !restarted.contains("(A:1,B:x);"));
+
+		// a damaged image is removed and the tree parsed again
+		std::ofstream(restarted.getImagePath(newick).c_str(),std::ios::binary|std::ios::trunc) << "not an image";
+		saved = cerr.rdbuf(reported.rdbuf());
+		KBTree *reparsed = restarted.get(newick);
+		cerr.rdbuf(saved);
+		CHECK(matchesParse(reparsed,newick));
+		// the text that did not parse was a miss too
+		CHECK(restarted.getMissCount()==2);
+		CHECK(matchesParse(restarted.get(newick),newick));
+		CHECK(restarted.getHitCount()==2);
+
+		restarted.resetCounters();
+		CHECK(restarted.getHitCount()==0 && restarted.getMissCount()==0);
+		restarted.clear();
+		CHECK(!restarted.contains(newick) && restarted.getDiskUsage()==0);
+	}
+	rmdir((directory+"/images").c_str());
+	CHECK(rmdir(directory.c_str())==0);
+}
+
+/** the least recently loaded images are removed to keep to the size limit */
+KBTEST(testDiskCacheSizeLimit) {
+	const std::string directory = makeTemporaryDirectory("kbdiskcache_test");
+	std::vector<std::string> texts;
+	for(unsigned int seed=1; seed<=4; seed++) { texts.push_back(generateTree(seed,300)); }
+	KBTreeDiskCache cache(directory);
+	for(size_t i=0; i<3; i++) { delete cache.get(texts[i]); }
+	// make the load times plainly ordered, with the second the least recently used
+	const time_t now = time(NULL);
+	for(size_t i=0; i<3; i++) {
+		struct timespec times[2];
+		times[0].tv_sec = times[1].tv_sec = now-(i==1 ? 300 : 100-(time_t)i*10);
+		times[0].tv_nsec = times[1].tv_nsec = 0;
+		CHECK(utimensat(AT_FDCWD,cache.getImagePath(texts[i]).c_str(),times,0)==0);
+	}
+	const uint64_t used = cache.getDiskUsage();
+	cache.setSizeLimit(used-1);
+	cache.trim();
+	CHECK(!cache.contains(texts[1]) && cache.contains(texts[0]) && cache.contains(texts[2]));
+	CHECK(cache.getEvictionCount()==1 && cache.getDiskUsage()<=cache.getSizeLimit());
+
+	// storing more than the limit removes the oldest again, and a limit of 0 keeps nothing
+	delete cache.get(texts[3]);
+	CHECK(cache.getDiskUsage()<=cache.getSizeLimit() && cache.contains(texts[3]));
+	cache.setSizeLimit(0);
+	cache.trim();
+	CHECK(cache.getDiskUsage()==0);
+	CHECK(matchesParse(cache.get(texts[0]),texts[0]));
+	cache.clear();
+	CHECK(rmdir(directory.c_str())==0);
+}
+
+/** a directory that cannot be made is reported, and every tree is parsed without storing anything */
+KBTEST(testDiskCacheUnusableDirectory) {
+	const std::string file = makeTemporaryFile("kbdiskcache_test");
+	std::ostringstream reported;
+	std::streambuf *saved = cerr.rdbuf(reported.rdbuf());
+	KBTreeDiskCache cache(file+"/images");
+	KBTree *tree = cache.get("(A:1,B:2);");
+	cerr.rdbuf(saved);
+	CHECK(!reported.str().empty());
+	CHECK(matchesParse(tree,"(A:1,B:2);"));
+	CHECK(!cache.contains("(A:1,B:2);") && cache.getDiskUsage()==0);
+	unlink(file.c_str());
+}
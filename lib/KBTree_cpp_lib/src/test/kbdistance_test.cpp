@@ -0,0 +1,128 @@
+/**
+ * @file kbdistance_test.cpp
+ * @brief Tests of the patristic distance matrix (kbdistance.cpp)
+ */
+
+#include "kbtest.hh"
+#include "../kbtree/kbcompact.hh"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace std;
+using namespace KBTreeLib;
+using namespace KBTreeTest;
+
+
+/** the distance between two nodes of the compact tree, found by walking up from both to their common ancestor */
+static double walkDistance(const KBCompactTree &compact, uint32_t a, uint32_t b) {
+	std::vector<double> fromA(compact.getNodeCount(),-1);
+	double sum = 0;
+	for(uint32_t node=a; node!=KBCompactTree::NONE; node=compact.getParent(node)) {
+		fromA[node] = sum;
+		if(!std::isnan(compact.getDistanceToParent(node))) { sum += compact.getDistanceToParent(node); }
+	}
+	sum = 0;
+	for(uint32_t node=b; node!=KBCompactTree::NONE; node=compact.getParent(node)) {
+		if(fromA[node]>=0) { return sum+fromA[node]; }
+		if(!std::isnan(compact.getDistanceToParent(node))) { sum += compact.getDistanceToParent(node); }
+	}
+	return NAN;
+}
+
+/** every entry of the matrix, in preorder or in any other order of the names and on any number of threads, is
+ * the length of the path between the two nodes */
+KBTEST(testPatristicDistances) {
+	std::mt19937 rng(19);
+	for(unsigned int t=0; t<12; t++) {
+		// some with more leaves than a block of rows, so that several blocks are computed on each thread
+		const unsigned int leaves = t%3==0 ? 1500+rng()%1000 : 1+rng()%150;
+		KBTree tree(generateLeafNamedTree(rng,leaves),false,false);
+		KBCompactTree compact(tree);
+		std::vector<uint32_t> leafNodes;
+		for(uint32_t node=0; node<compact.getNodeCount(); node++) {
+			if(compact.isLeaf(node)) { leafNodes.push_back(node); }
+		}
+
+		std::vector<std::string> leafNames;
+		std::vector<double> distances;
+		tree.getPatristicDistances(leafNames,distances,4);
+		CHECK(leafNames.size()==leaves && distances.size()==(size_t)leaves*leaves);
+		if(leafNames.size()!=leaves || distances.size()!=(size_t)leaves*leaves) { continue; }
+		bool allMatch = true;
+		for(unsigned int q=0; q<2000; q++) {
+			const size_t i = rng()%leaves, j = rng()%leaves;
+			allMatch = allMatch && leafNames[i]==compact.getName(leafNodes[i])
+				&& std::fabs(distances[i*leaves+j]-walkDistance(compact,leafNodes[i],leafNodes[j]))<=1e-9;
+		}
+		CHECK(allMatch);
+
+		// a shuffled sample of names gives the rows and columns of the same matrix, on one thread or several
+		std::vector<size_t> picked;
+		for(size_t i=0; i<leaves && picked.size()<300; i++) { picked.push_back(i); }
+		std::shuffle(picked.begin(),picked.end(),rng);
+		std::vector<std::string> names;
+		for(size_t i=0; i<picked.size(); i++) { names.push_back(leafNames[picked[i]]); }
+		std::vector<double> sampled(names.size()*names.size()), threaded(names.size()*names.size());
+		CHECK(tree.getPatristicDistances(names,sampled.data(),1));
+		CHECK(tree.getPatristicDistances(names,threaded.data(),4));
+		CHECK(sampled==threaded);
+		allMatch = true;
+		for(size_t i=0; i<names.size(); i++) {
+			for(size_t j=0; j<names.size(); j++) { allMatch = allMatch && sampled[i*names.size()+j]==distances[picked[i]*leaves+picked[j]]; }
+		}
+		CHECK(allMatch);
+	}
+}
+
+/** the matrix is written in either format at the output precision, with missing lengths counted as 0 */
+KBTEST(testWritePatristicDistances) {
+	KBTree tree("((A:1,B:2)X:0.5,(C,D:1)Y:1,E:4);",false,false);
+	std::ostringstream phylip, tsv;
+	{
+		KBOutputSink out(phylip);
+		CHECK(tree.writePatristicDistances(out,"A;C;X"));
+	}
+	CHECK_EQUAL("3\nA 0 2.5 1\nC 2.5 0 1.5\nX 1 1.5 0\n",phylip.str());
+	{
+		KBOutputSink out(tsv);
+		CHECK(tree.writePatristicDistances(out,"E;D",KBTree::TSV_MATRIX));
+	}
+	CHECK_EQUAL("\tE\tD\nE\t0\t6\nD\t6\t0\n",tsv.str());
+
+	// several top level trees are apart by NaN; a missing name writes nothing
+	KBTree forest("(A:1,B:1),(C:1,D:1);",false,false);
+	std::vector<std::string> names;
+	names.push_back("A"); names.push_back("C");
+	double distances[4];
+	CHECK(forest.getPatristicDistances(names,distances));
+	CHECK(distances[0]==0 && std::isnan(distances[1]) && std::isnan(distances[2]));
+	names.push_back("Z");
+	std::ostringstream reported, missing;
+	std::streambuf *saved = cerr.rdbuf(reported.rdbuf());
+	double more[9];
+	const bool found = forest.getPatristicDistances(names,more);
+	bool written;
+	{
+		KBOutputSink out(missing);
+		written = tree.writePatristicDistances(out,"A;Z");
+	}
+	cerr.rdbuf(saved);
+	CHECK(!found && !written);
+	CHECK_EQUAL("",missing.str());
+}
+
+/** the patristic distance matrix file is only replaced once every name is found */
+KBTEST(testPatristicDistanceFile) {
+	const std::string filename = makeTemporaryFile("kbdistance_test");
+	KBTree tree("((A:1,B:2):0.5,C:3);",false,false);
+	CHECK(tree.writePatristicDistancesToFile(filename,"A;C"));
+	CHECK_EQUAL("2\nA 0 4.5\nC 4.5 0\n",readFile(filename));
+	CHECK(!tree.writePatristicDistancesToFile(filename,"A;Z"));
+	CHECK_EQUAL("2\nA 0 4.5\nC 4.5 0\n",readFile(filename));
+	unlink(filename.c_str());
+}
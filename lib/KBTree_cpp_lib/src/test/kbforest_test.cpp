@@ -0,0 +1,105 @@
+/**
+ * @file kbforest_test.cpp
+ * @brief Tests of reading many trees at once (kbforest.cpp)
+ */
+
+#include "kbtest.hh"
+#include "../kbtree/kbforest.hh"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace std;
+using namespace KBTreeLib;
+using namespace KBTreeTest;
+
+
+/** only top level semicolons end a tree, and blank text between and after trees is skipped */
+KBTEST(testSplitNewickTrees) {
+	std::vector<std::string_view> trees;
+	KBForest::splitNewickTrees(" (A,'B;C');\n\n(D[x;y],\"E\\\";\");  F;\n(G,H)\n", trees);
+	CHECK(trees.size()==4);
+	if(trees.size()!=4) { return; }
+	CHECK_EQUAL("(A,'B;C');",std::string(trees[0]));
+	CHECK_EQUAL("(D[x;y],\"E\\\";\");",std::string(trees[1]));
+	CHECK_EQUAL("F;",std::string(trees[2]));
+	CHECK_EQUAL("(G,H)\n",std::string(trees[3]));
+	trees.clear();
+	KBForest::splitNewickTrees(" \n\t",trees);
+	CHECK(trees.empty());
+}
+
+/** every tree of a forest is the tree parsed on its own, in input order, however many threads parse them */
+KBTEST(testForest) {
+	std::string forest;
+	std::vector<std::string> expected;
+	for(unsigned int seed=1; seed<=200; seed++) {
+		const std::string newick = generateTree(seed,1+seed%40);
+		forest += newick+"\n";
+		expected.push_back(KBTree(newick,false,false).toNewick(KBNode::ORIGINAL_LABEL));
+	}
+	const std::string filename = makeTemporaryFile("kbforest_test");
+	std::ofstream(filename.c_str()) << forest;
+	for(unsigned int threads=1; threads<=4; threads+=3) {
+		KBForest reader;
+		reader.setThreadCount(threads);
+		std::vector<KBTree *> trees = reader.parse(forest);
+		CHECK(trees.size()==expected.size());
+		for(size_t t=0; t<trees.size() && t<expected.size(); t++) {
+			CHECK_EQUAL(expected[t],trees[t]->toNewick(KBNode::ORIGINAL_LABEL));
+			delete trees[t];
+		}
+
+		trees.clear();
+		CHECK(reader.parseFile(filename,trees));
+		CHECK(trees.size()==expected.size());
+		for(size_t t=0; t<trees.size() && t<expected.size(); t++) {
+			CHECK_EQUAL(expected[t],trees[t]->toNewick(KBNode::ORIGINAL_LABEL));
+			delete trees[t];
+		}
+
+		size_t next = 0;
+		reader.forEach(forest,[&](size_t index, KBTree *tree) {
+			CHECK(index==next);
+			CHECK(index<expected.size() && expected[index]==tree->toNewick(KBNode::ORIGINAL_LABEL));
+			next++;
+			delete tree;
+		});
+		CHECK(next==expected.size());
+	}
+	unlink(filename.c_str());
+
+	std::ostringstream reported;
+	std::streambuf *saved = cerr.rdbuf(reported.rdbuf());
+	KBForest reader;
+	std::vector<KBTree *> trees;
+	CHECK(!reader.parseFile(filename,trees));
+	CHECK(trees.empty());
+	cerr.rdbuf(saved);
+}
+
+/** a tree that fails to parse fails the whole forest, naming the tree */
+KBTEST(testForestError) {
+	std::string forest;
+	for(unsigned int seed=1; seed<=50; seed++) { forest += generateTree(seed,10)+"\n"; }
+	forest += "(A:1,B:x);\n";
+	for(unsigned int seed=51; seed<=60; seed++) { forest += generateTree(seed,10)+"\n"; }
+	for(unsigned int threads=1; threads<=4; threads+=3) {
+		KBForest reader;
+		reader.setThreadCount(threads);
+		std::ostringstream reported;
+		std::streambuf *saved = cerr.rdbuf(reported.rdbuf());
+		std::string message;
+		try {
+			reader.parse(forest);
+		} catch (ParseException &e) {
+			message = e.getFullMessage();
+		}
+		cerr.rdbuf(saved);
+		CHECK(message.find("Cannot convert string 'x'")!=std::string::npos);
+		CHECK(message.find("tree 50")!=std::string::npos);
+	}
+}
@@ -0,0 +1,110 @@
+/**
+ * @file kbfrozen_test.cpp
+ * @brief Tests of the frozen tree snapshots (kbfrozen.cpp)
+ */
+
+#include "kbtest.hh"
+#include "../kbtree/kbfrozen.hh"
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace KBTreeLib;
+using namespace KBTreeTest;
+
+
+/** a snapshot answers every query as the tree it was frozen from does */
+KBTEST(testFrozenMatchesTree) {
+	std::mt19937 rng(23);
+	for(unsigned int seed=1; seed<=20; seed++) {
+		KBTree tree(generateTree(seed,1+seed*9),false,false);
+		tree.setOutputPrecision(SHORTEST_ROUND_TRIP);
+		KBFrozenTree frozen = tree.freeze();
+		CHECK(frozen.getNodeCount()==tree.getNodeCount());
+		CHECK(frozen.getLeafCount()==tree.getLeafCount());
+		CHECK_EQUAL(tree.toNewick(),frozen.toNewick());
+		CHECK_EQUAL(tree.toNewick(KBNode::ORIGINAL_LABEL),frozen.toNewick(KBNode::ORIGINAL_LABEL));
+		CHECK_EQUAL(tree.getAllLeafNames(),frozen.getAllLeafNames());
+		CHECK_EQUAL(tree.getAllNodeNames(),frozen.getAllNodeNames());
+
+		std::vector<std::string> names;
+		tree.getAllNodeNames(names);
+		for(size_t i=0; i<names.size(); i++) {
+			CHECK(frozen.hasNode(names[i]));
+			CHECK_EQUAL(tree.getPathToRoot(names[i]),frozen.getPathToRoot(names[i]));
+			CHECK(tree.getDepth(names[i])==frozen.getDepth(names[i]));
+			CHECK(tree.getSubtreeSize(names[i])==frozen.getSubtreeSize(names[i]));
+			CHECK(tree.getCladeLeafCount(names[i])==frozen.getCladeLeafCount(names[i]));
+			CHECK_NEAR(tree.getDistanceToRoot(names[i]),frozen.getDistanceToRoot(names[i]));
+		}
+		if(names.size()>1) {
+			std::vector<std::string> pair;
+			pair.push_back(names[rng()%names.size()]);
+			pair.push_back(names[rng()%names.size()]);
+			double distances[4];
+			CHECK(tree.getPatristicDistances(pair,distances));
+			CHECK_NEAR(distances[1],frozen.getPatristicDistance(pair[0],pair[1]));
+		}
+
+		// the snapshot is a copy: editing or deleting the tree leaves it as it was
+		const std::string before = frozen.toNewick();
+		tree.removeNodesByNameAndSimplify(names.empty() ? "" : names[0]);
+		CHECK_EQUAL(before,frozen.toNewick());
+	}
+	KBFrozenTree frozen("((A:1,B:2)X:0.5,C:3)R;");
+	CHECK(!frozen.hasNode("Z") && frozen.getNode("Z")==KBFrozenTree::NONE);
+	CHECK(frozen.getDepth("Z")==-1 && frozen.getSubtreeSize("Z")==0 && std::isnan(frozen.getDistanceToRoot("Z")));
+	CHECK(std::isnan(frozen.getPatristicDistance("A","Z")));
+	CHECK_EQUAL("X;R;",frozen.getLowestCommonAncestorNames("A;B;A;C"));
+	CHECK(frozen.isMonophyletic("A;B") && !frozen.isMonophyletic("A;C"));
+}
+
+/** handles share a snapshot, and edits give a new snapshot without changing the old one */
+KBTEST(testFrozenHandlesAndEdits) {
+	KBTree tree("((A:1,B:2)X:0.5,(C:1,D:1)Y:1,E:4)R;",false,false);
+	KBFrozenTree frozen(tree);
+	{
+		KBFrozenTree copy = frozen;
+		CHECK(copy.isSameSnapshot(frozen) && frozen.getHandleCount()==2);
+	}
+	CHECK(frozen.getHandleCount()==1);
+
+	const std::string before = frozen.toNewick();
+	KBFrozenTree removed = frozen.removeNodesByNameAndSimplify("C;A");
+	KBFrozenTree renamed = frozen.replaceNodeNames("B;W;E;V");
+	CHECK(!removed.isSameSnapshot(frozen) && !renamed.isSameSnapshot(frozen));
+	CHECK_EQUAL(before,frozen.toNewick());
+	tree.removeNodesByNameAndSimplify("C;A");
+	CHECK_EQUAL(tree.toNewick(),removed.toNewick());
+	CHECK(renamed.hasNode("W") && renamed.hasNode("V") && !renamed.hasNode("B") && frozen.hasNode("B"));
+
+	KBTree *edited = removed.toKBTree();
+	CHECK_EQUAL(removed.toNewick(),edited->toNewick());
+	delete edited;
+	CHECK(throwsParseException([&]() { frozen.removeNodesByNameAndSimplify("R"); }));
+	CHECK_EQUAL(before,frozen.toNewick());
+}
+
+/** many threads query one snapshot, each through its own copy of the handle, and all get the same answers */
+KBTEST(testFrozenSharedAcrossThreads) {
+	KBFrozenTree frozen(generateTree(5,20000));
+	std::vector<std::string> names;
+	frozen.getAllLeafNames(names);
+	std::vector<int> expectedDepths;
+	for(size_t i=0; i<names.size(); i++) { expectedDepths.push_back(frozen.getDepth(names[i])); }
+	std::vector<int> matched(8,0);
+	std::vector<std::thread> threads;
+	for(unsigned int t=0; t<matched.size(); t++) {
+		threads.push_back(std::thread([frozen,&names,&expectedDepths,&matched,t]() {
+			bool allMatch = true;
+			for(size_t i=t; i<names.size(); i+=3) { allMatch = allMatch && frozen.getDepth(names[i])==expectedDepths[i]; }
+			KBFrozenTree own = frozen;
+			matched[t] = allMatch && own.isSameSnapshot(frozen);
+		}));
+	}
+	for(size_t t=0; t<threads.size(); t++) { threads[t].join(); }
+	for(size_t t=0; t<matched.size(); t++) { CHECK(matched[t]==1); }
+	CHECK(frozen.getHandleCount()==1);
+}
@@ -0,0 +1,43 @@
+/**
+ * @file kbparallel_test.cpp
+ * @brief Tests of parallel parsing and output (kbparallel.cpp)
+ */
+
+#include "kbtest.hh"
+#include <string>
+
+using namespace std;
+using namespace KBTreeLib;
+using namespace KBTreeTest;
+
+
+/** output written on several threads must be the text written on one, whatever the output settings */
+KBTEST(testParallelOutput) {
+	// enough nodes that the parallel writer is used, and a shape deep enough to cross many windows
+	const std::string newick = generateTree(2012,70000);
+	for(int lazy=0; lazy<2; lazy++) {
+		for(int keepOriginal=0; keepOriginal<2; keepOriginal++) {
+			KBTree tree(newick,false,false,1,lazy==1,keepOriginal==1);
+			CHECK(tree.getNodeCount()>=(1<<16));
+			for(int precision=0; precision<2; precision++) {
+				tree.setOutputPrecision(precision==0 ? DEFAULT_OUTPUT_PRECISION : SHORTEST_ROUND_TRIP);
+				for(unsigned int flags=0; flags<16; flags++) {
+					tree.setOutputFlagLabel((flags&1)!=0);
+					tree.setOutputFlagDistances((flags&2)!=0);
+					tree.setOutputFlagComments((flags&4)!=0);
+					tree.setOutputFlagBootstrapValuesAsLabels((flags&8)!=0);
+					tree.setOutputThreadCount(1);
+					std::string sequential = tree.toNewick();
+					tree.setOutputThreadCount(4);
+					CHECK_EQUAL(sequential,tree.toNewick());
+				}
+				for(unsigned int style=KBNode::NAME_AND_DISTANCE; style<=KBNode::ORIGINAL_LABEL; style++) {
+					tree.setOutputThreadCount(1);
+					std::string sequential = tree.toNewick(style);
+					tree.setOutputThreadCount(4);
+					CHECK_EQUAL(sequential,tree.toNewick(style));
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,62 @@
+/**
+ * @file kbstatistics_test.cpp
+ * @brief Tests of counting the nodes of a Newick tree without building it (kbstatistics.cpp)
+ */
+
+#include "kbtest.hh"
+#include <algorithm>
+#include <string>
+
+using namespace std;
+using namespace KBTreeLib;
+using namespace KBTreeTest;
+
+
+/** the counts are those of the tree built from the same text */
+KBTEST(testStatisticsMatchTree) {
+	for(unsigned int seed=1; seed<=100; seed++) {
+		const std::string newick = generateTree(seed,1+seed*7);
+		KBTreeStatistics statistics = KBTree::scanStatistics(newick);
+		KBTree tree(newick,false,false);
+		CHECK(statistics.getNodeCount()==tree.getNodeCount());
+		CHECK(statistics.getLeafCount()==tree.getLeafCount());
+	}
+	std::mt19937 rng(8);
+	for(unsigned int t=0; t<100; t++) {
+		const unsigned int leaves = 1+rng()%200;
+		const std::string newick = generateLeafNamedTree(rng,leaves);
+		KBTreeStatistics statistics = KBTree::scanStatistics(newick);
+		KBTree tree(newick,false,false);
+		int maxDepth = 0;
+		for(unsigned int leaf=0; leaf<leaves; leaf++) {
+			maxDepth = std::max(maxDepth,tree.getDepth("L"+std::to_string(leaf)));
+		}
+		CHECK(statistics.getNodeCount()==tree.getNodeCount());
+		CHECK(statistics.getLeafCount()==leaves);
+		CHECK((int)statistics.getMaxDepth()==maxDepth);
+		CHECK(statistics.hasBranchLengths());
+		CHECK(!statistics.hasBootstrapValues());
+	}
+}
+
+/** branch lengths and bootstrap values are seen through quotes and comments */
+KBTEST(testStatisticsLabels) {
+	KBTreeStatistics statistics = KBTree::scanStatistics("(A,B);");
+	CHECK(statistics.getNodeCount()==3 && statistics.getLeafCount()==2 && statistics.getMaxDepth()==1);
+	CHECK(!statistics.hasBranchLengths() && !statistics.hasBootstrapValues());
+
+	statistics = KBTree::scanStatistics("((A:1,B:2)95:0.5,C:1)100;");
+	CHECK(statistics.getNodeCount()==5 && statistics.getLeafCount()==3 && statistics.getMaxDepth()==2);
+	CHECK(statistics.hasBranchLengths() && statistics.hasBootstrapValues());
+
+	statistics = KBTree::scanStatistics("((A,B)95,C)X;");
+	CHECK(!statistics.hasBranchLengths() && !statistics.hasBootstrapValues());
+
+	statistics = KBTree::scanStatistics("('a:(1,2)',B[x:1,(y)])'9';");
+	CHECK(statistics.getNodeCount()==3 && statistics.getLeafCount()==2 && statistics.getMaxDepth()==1);
+	CHECK(!statistics.hasBranchLengths());
+
+	statistics = KBTree::scanStatistics("A:1;");
+	CHECK(statistics.getNodeCount()==1 && statistics.getLeafCount()==1 && statistics.getMaxDepth()==0);
+	CHECK(statistics.hasBranchLengths());
+}
@@ -0,0 +1,106 @@
+/**
+ * @file kbsuccinct_test.cpp
+ * @brief Tests of the balanced parentheses tree (kbsuccinct.cpp)
+ */
+
+#include "kbtest.hh"
+#include "../kbtree/kbcompact.hh"
+#include "../kbtree/kbsuccinct.hh"
+#include <deque>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace KBTreeLib;
+using namespace KBTreeTest;
+
+
+/** the navigation of the parentheses gives the arrays of the compact tree, which numbers nodes the same way */
+static void checkTopology(const std::string &newick, std::mt19937 &rng) {
+	KBTree tree(newick,false,false);
+	KBCompactTree compact(tree);
+	KBSuccinctTree succinct(tree);
+	const KBSuccinctTopology &topology = succinct.getTopology();
+	const uint32_t n = compact.getNodeCount();
+	CHECK(topology.getNodeCount()==n);
+	if(topology.getNodeCount()!=n) { return; }
+
+	std::vector<uint32_t> depth(n,0), size(n,1);
+	for(uint32_t node=1; node<n; node++) { depth[node] = depth[compact.getParent(node)]+1; }
+	for(uint32_t node=n-1; node>0; node--) { size[compact.getParent(node)] += size[node]; }
+	bool allMatch = true;
+	for(uint32_t node=0; node<n; node++) {
+		allMatch = allMatch && topology.getParent(node)==compact.getParent(node) && topology.getFirstChild(node)==compact.getFirstChild(node)
+			&& topology.getNextSibling(node)==compact.getNextSibling(node) && topology.isLeaf(node)==compact.isLeaf(node)
+			&& topology.getDepth(node)==depth[node] && topology.getSubtreeSize(node)==size[node]
+			&& succinct.getName(node)==compact.getName(node);
+	}
+	CHECK(allMatch);
+
+	// breadth first from the root is the order of a queue over the child arrays
+	std::deque<uint32_t> queue(1,0);
+	uint32_t visited = 0;
+	for(uint32_t node=0; node!=KBSuccinctTopology::NONE; node=topology.getNextBreadthFirst(node,0)) {
+		if(queue.empty() || queue.front()!=node) { break; }
+		queue.pop_front();
+		for(uint32_t child=compact.getFirstChild(node); child!=KBCompactTree::NONE; child=compact.getNextSibling(child)) { queue.push_back(child); }
+		visited++;
+	}
+	CHECK(visited==n);
+
+	for(unsigned int q=0; q<200; q++) {
+		const uint32_t a = rng()%n, b = rng()%n;
+		std::vector<bool> aboveA(n,false);
+		for(uint32_t node=a; node!=KBCompactTree::NONE; node=compact.getParent(node)) { aboveA[node]=true; }
+		uint32_t lca = b;
+		while(!aboveA[lca]) { lca = compact.getParent(lca); }
+		CHECK(topology.getLowestCommonAncestor(a,b)==lca);
+		CHECK(topology.isAncestor(a,b)==(lca==a));
+	}
+}
+
+KBTEST(testSuccinctTopology) {
+	std::mt19937 rng(15);
+	for(unsigned int t=0; t<30; t++) { checkTopology(generateLeafNamedTree(rng,1+rng()%3000),rng); }
+	checkTopology(generateTree(15,2000),rng);
+	checkTopology("A;",rng);
+	// a caterpillar, whose excess climbs across many blocks before it comes down again
+	std::string caterpillar = "L0";
+	for(unsigned int leaf=1; leaf<5000; leaf++) { caterpillar = "("+caterpillar; caterpillar += ",L"+std::to_string(leaf)+")"; }
+	checkTopology(caterpillar+";",rng);
+}
+
+/** names and the breadth first iterator and markers give what KBTree gives */
+KBTEST(testSuccinctTree) {
+	for(unsigned int seed=1; seed<=20; seed++) {
+		const std::string newick = generateTree(seed,1+seed*11);
+		KBTree tree(newick,false,false);
+		KBSuccinctTree succinct(newick);
+		CHECK(succinct.getNodeCount()==tree.getNodeCount());
+		CHECK(succinct.getLeafCount()==tree.getLeafCount());
+		CHECK_EQUAL(tree.getAllLeafNames(),succinct.getAllLeafNames());
+		CHECK_EQUAL(tree.getAllNodeNames(),succinct.getAllNodeNames());
+
+		tree.resetBreadthFirstIterToRoot();
+		succinct.resetBreadthFirstIterToRoot();
+		std::vector<unsigned int> treeMarkers, succinctMarkers;
+		bool more = true;
+		while(more) {
+			CHECK_EQUAL(tree.breadthFirstIterGetName(),succinct.breadthFirstIterGetName());
+			CHECK_EQUAL(tree.breadthFirstIterGetParentName(),succinct.breadthFirstIterGetParentName());
+			treeMarkers.push_back(tree.breadthFirstIterMarkNode());
+			succinctMarkers.push_back(succinct.breadthFirstIterMarkNode());
+			more = tree.breadthFirstIterNext();
+			CHECK(more==succinct.breadthFirstIterNext());
+		}
+		for(size_t m=0; m<treeMarkers.size(); m+=1+m/4) {
+			CHECK_EQUAL(tree.breadthFirstIterGetName(treeMarkers[m]),succinct.breadthFirstIterGetName(succinctMarkers[m]));
+			CHECK_EQUAL(tree.breadthFirstIterGetPathToRoot(treeMarkers[m]),succinct.breadthFirstIterGetPathToRoot(succinctMarkers[m]));
+			CHECK_EQUAL(tree.breadthFirstIterGetParentName(treeMarkers[m]),succinct.breadthFirstIterGetParentName(succinctMarkers[m]));
+			CHECK_EQUAL(tree.breadthFirstIterGetAllChildrenNames(treeMarkers[m]),succinct.breadthFirstIterGetAllChildrenNames(succinctMarkers[m]));
+			CHECK_EQUAL(tree.breadthFirstIterGetAllDescendantNames(treeMarkers[m]),succinct.breadthFirstIterGetAllDescendantNames(succinctMarkers[m]));
+			CHECK(tree.breadthFirstIterSetToNode(treeMarkers[m]) && succinct.breadthFirstIterSetToNode(succinctMarkers[m]));
+			CHECK_EQUAL(tree.breadthFirstIterGetName(),succinct.breadthFirstIterGetName());
+		}
+	}
+}
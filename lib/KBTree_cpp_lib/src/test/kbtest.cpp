@@ -0,0 +1,176 @@
+/**
+ * @file kbtest.cpp
+ * @brief Runs the KBTree library tests
+ *
+ * Build and run with "make test".  Each check that fails is reported with its line, and the program
+ * exits with the number of failures (0 if everything passed).  Random trees are generated from fixed
+ * seeds, so a failure can always be reproduced.
+ */
+
+#include "kbtest.hh"
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace KBTreeLib;
+
+
+static unsigned int checks = 0;
+static unsigned int failures = 0;
+
+/** every registered test, in the order they were registered (a function, so that it exists before the
+ * static KBTestCase objects of the other files are constructed) */
+static std::vector<std::pair<const char *,void (*)()> > &getTests() {
+	static std::vector<std::pair<const char *,void (*)()> > tests;
+	return tests;
+}
+
+KBTreeTest::KBTestCase::KBTestCase(const char *name, void (*run)()) {
+	getTests().push_back(std::make_pair(name,run));
+}
+
+void KBTreeTest::check(bool passed, const char *text, const char *file, int line) {
+	checks++;
+	if(passed) { return; }
+	failures++;
+	cerr<<file<<":"<<line<<": FAILED: "<<text<<endl;
+}
+
+void KBTreeTest::checkEqual(const std::string &expected, const std::string &actual, const char *text, const char *file, int line) {
+	checks++;
+	if(expected==actual) { return; }
+	failures++;
+	// large trees are cut to the first difference, so that the output stays readable
+	size_t k=0;
+	while(k<expected.size() && k<actual.size() && expected[k]==actual[k]) { k++; }
+	size_t from = k>40 ? k-40 : 0;
+	cerr<<file<<":"<<line<<": FAILED: "<<text<<" differs at character "<<k<<endl;
+	cerr<<"  expected: ..."<<expected.substr(from,80)<<endl;
+	cerr<<"  actual:   ..."<<actual.substr(from,80)<<endl;
+}
+
+void KBTreeTest::checkNear(double expected, double actual, const char *text, const char *file, int line) {
+	checks++;
+	if(std::isnan(expected) ? std::isnan(actual) : std::fabs(expected-actual)<=1e-9*std::max(1.0,std::fabs(expected))) { return; }
+	failures++;
+	cerr<<file<<":"<<line<<": FAILED: "<<text<<" is "<<actual<<", expected "<<expected<<endl;
+}
+
+std::string KBTreeTest::readFile(const std::string &filename) {
+	std::ifstream in(filename.c_str(),std::ios::binary);
+	std::ostringstream text;
+	text<<in.rdbuf();
+	return text.str();
+}
+
+std::string KBTreeTest::makeTemporaryFile(const std::string &prefix) {
+	std::string name = "/tmp/"+prefix+"_XXXXXX";
+	std::vector<char> buf(name.begin(),name.end());
+	buf.push_back('\0');
+	int fd = mkstemp(buf.data());
+	if(fd<0) { cerr<<"cannot create a temporary file: "<<strerror(errno)<<endl; exit(1); }
+	close(fd);
+	return std::string(buf.data());
+}
+
+std::string KBTreeTest::makeTemporaryDirectory(const std::string &prefix) {
+	std::string name = "/tmp/"+prefix+"_XXXXXX";
+	std::vector<char> buf(name.begin(),name.end());
+	buf.push_back('\0');
+	if(mkdtemp(buf.data())==NULL) { cerr<<"cannot create a temporary directory: "<<strerror(errno)<<endl; exit(1); }
+	return std::string(buf.data());
+}
+
+
+static void generateSubtree(std::mt19937 &rng, unsigned int leaves, std::string &out) {
+	char buf[64];
+	if(leaves>1) {
+		unsigned int left = 1+rng()%(leaves-1);
+		out+='(';
+		generateSubtree(rng,left,out);
+		out+=',';
+		generateSubtree(rng,leaves-left,out);
+		out+=')';
+		switch(rng()%4) {
+			case 0: break;
+			case 1: snprintf(buf,sizeof(buf),"%u",(unsigned int)(rng()%101)); out+=buf; break;
+			case 2: snprintf(buf,sizeof(buf),"0.%02u",(unsigned int)(rng()%100)); out+=buf; break;
+			case 3: snprintf(buf,sizeof(buf),"clade_%u",(unsigned int)(rng()%1000)); out+=buf; break;
+		}
+	} else {
+		switch(rng()%4) {
+			case 0: snprintf(buf,sizeof(buf),"kb|g.%u.peg.%u",(unsigned int)(rng()%100000),(unsigned int)(rng()%10000)); out+=buf; break;
+			case 1: snprintf(buf,sizeof(buf),"'leaf %u, (quoted)'",(unsigned int)(rng()%1000)); out+=buf; break;
+			case 2: snprintf(buf,sizeof(buf),"'it''s %u'",(unsigned int)(rng()%1000)); out+=buf; break;
+			case 3: snprintf(buf,sizeof(buf),"L%u",(unsigned int)(rng()%1000)); out+=buf; break;
+		}
+	}
+	if(rng()%8==0) { out+="[&&NHX:S=test]"; }
+	if(rng()%8!=0) {
+		snprintf(buf,sizeof(buf),":%.9g",std::uniform_real_distribution<double>(0.0,0.2)(rng));
+		out+=buf;
+	}
+}
+
+std::string KBTreeTest::generateTree(unsigned int seed, unsigned int leaves) {
+	std::mt19937 rng(seed);
+	std::string newick;
+	generateSubtree(rng,leaves,newick);
+	newick+=';';
+	return newick;
+}
+
+static void generateLeafNamedSubtree(std::mt19937 &rng, unsigned int leaves, unsigned int &nextLeaf, std::string &out) {
+	char buf[64];
+	if(leaves>1) {
+		unsigned int children = 2+rng()%2;
+		if(children>leaves) { children=leaves; }
+		out+='(';
+		unsigned int left = leaves;
+		for(unsigned int c=0; c<children; c++) {
+			unsigned int size = c+1==children ? left : 1+rng()%(left-(children-c-1));
+			if(c>0) { out+=','; }
+			generateLeafNamedSubtree(rng,size,nextLeaf,out);
+			left -= size;
+		}
+		out+=')';
+	} else {
+		snprintf(buf,sizeof(buf),"L%u",nextLeaf++);
+		out+=buf;
+	}
+	snprintf(buf,sizeof(buf),":%.9g",std::uniform_real_distribution<double>(0.0,1.0)(rng));
+	out+=buf;
+}
+
+std::string KBTreeTest::generateLeafNamedTree(std::mt19937 &rng, unsigned int leaves) {
+	std::string newick;
+	unsigned int nextLeaf = 0;
+	generateLeafNamedSubtree(rng,leaves,nextLeaf,newick);
+	newick+=';';
+	return newick;
+}
+
+
+int main(int argc, char **argv) {
+	const std::vector<std::pair<const char *,void (*)()> > &tests = getTests();
+	for(size_t i=0; i<tests.size(); i++) {
+		bool selected = argc<2;
+		for(int a=1; a<argc; a++) { selected = selected || strcmp(argv[a],tests[i].first)==0; }
+		if(!selected) { continue; }
+		const unsigned int failuresBefore = failures;
+		tests[i].second();
+		if(failures>failuresBefore) { cerr<<tests[i].first<<": "<<(failures-failuresBefore)<<" failed"<<endl; }
+	}
+	cout<<checks<<" checks, "<<failures<<" failed"<<endl;
+	return failures>255 ? 255 : failures;
+}
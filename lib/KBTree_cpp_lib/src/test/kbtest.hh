@@ -0,0 +1,60 @@
+/**
+ * @file kbtest.hh
+ * @brief Checks and test registration for the KBTree library tests
+ *
+ * Each file in src/test holds the tests of the library source of the same name (kbbinary_test.cpp for
+ * kbbinary.cpp, and so on).  A test is declared with KBTEST(name) { ... } and registers itself, so that
+ * adding a file to TEST_MODULES in the makefile is all that is needed to run it.  "make test" builds and
+ * runs every test; lib/test/kbtree_test name1 name2 ... runs only the tests with those names.
+ */
+
+#ifndef KBTEST_HH_
+#define KBTEST_HH_
+
+#include "../kbtree/kbtree.hh"
+#include <random>
+#include <string>
+
+namespace KBTreeTest {
+
+	/** registers a test when constructed; use KBTEST rather than this directly */
+	struct KBTestCase {
+		KBTestCase(const char *name, void (*run)());
+	};
+
+	void check(bool passed, const char *text, const char *file, int line);
+	void checkEqual(const std::string &expected, const std::string &actual, const char *text, const char *file, int line);
+	void checkNear(double expected, double actual, const char *text, const char *file, int line);
+
+	/** true if the code throws a KBTreeLib::ParseException */
+	template<typename Code> bool throwsParseException(Code code) {
+		try { code(); } catch(KBTreeLib::ParseException &e) { return true; }
+		return false;
+	}
+
+	/** the contents of the file, or the empty string if it cannot be read */
+	std::string readFile(const std::string &filename);
+	/** a new, empty file in /tmp, which the caller removes; the name starts with prefix */
+	std::string makeTemporaryFile(const std::string &prefix);
+	/** a new, empty directory in /tmp, which the caller removes */
+	std::string makeTemporaryDirectory(const std::string &prefix);
+
+	/** a random Newick tree with every kind of label: quoted names, comments, bootstrap values and missing
+	 * distances.  The same seed always gives the same tree. */
+	std::string generateTree(unsigned int seed, unsigned int leaves);
+	/** a random Newick tree whose leaves are named L0, L1, ... in order, with unnamed internal nodes and
+	 * branch lengths on every edge */
+	std::string generateLeafNamedTree(std::mt19937 &rng, unsigned int leaves);
+
+};
+
+#define KBTEST(name) \
+	static void name(); \
+	static KBTreeTest::KBTestCase name##Case(#name,name); \
+	static void name()
+
+#define CHECK(condition) KBTreeTest::check((condition),#condition,__FILE__,__LINE__)
+#define CHECK_EQUAL(expected,actual) KBTreeTest::checkEqual((expected),(actual),#actual,__FILE__,__LINE__)
+#define CHECK_NEAR(expected,actual) KBTreeTest::checkNear((expected),(actual),#actual,__FILE__,__LINE__)
+
+#endif /* KBTEST_HH_ */
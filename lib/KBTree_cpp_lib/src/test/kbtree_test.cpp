@@ -0,0 +1,381 @@
+/**
+ * @file kbtree_test.cpp
+ * @brief Tests of KBTree itself (kbtree.cpp)
+ */
+
+#include "kbtest.hh"
+#include "../kbtree/kbcompact.hh"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace KBTreeLib;
+using namespace KBTreeTest;
+
+
+/** numbers are read as an istream reads them: too small for a double is zero, too large is an error */
+KBTEST(testNumbers) {
+	double x = -1;
+	CHECK(parseDouble("1e-330",x) && x==0.0);
+	CHECK(parseDouble("-1e-400",x) && x==0.0 && std::signbit(x));
+	CHECK(parseDouble("0.0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+		"0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+		"0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+		"00000000000000000000000000000000000001",x) && x==0.0);
+	CHECK(parseDouble("1e-310",x) && x==1e-310);
+	CHECK(parseDouble(" 2.5e-3",x) && x==2.5e-3);
+	CHECK(!parseDouble("1e400",x));
+	CHECK(!parseDouble("-1e400",x));
+	CHECK(!parseDouble("10000e-5x",x));
+	CHECK(!parseDouble("inf",x));
+	CHECK(!parseDouble("nan",x));
+
+	KBTree tree("(A:1e-330,B:1e-400,C:1);",false,false);
+	CHECK_EQUAL("(A:0,B:0,C:1);",tree.toNewick());
+	std::ostringstream reported;
+	std::streambuf *saved = cerr.rdbuf(reported.rdbuf());
+	CHECK(throwsParseException([]() { KBTree overflow("(A:1e400,B:1);",false,false); }));
+	cerr.rdbuf(saved);
+}
+
+/** a branch length that is not a number is reported on cerr once, as well as thrown, however it is parsed */
+KBTEST(testBadDistanceIsReported) {
+	// large enough for the parallel parser, which fails and leaves it to the sequential one
+	std::string large = generateTree(7,60000);
+	large.insert(1,"Z:1\n,");
+	const char *texts[] = { "(A:1\n,B:2);", "(A:1x,B:2);" };
+	for(int t=0; t<3; t++) {
+		for(int lazy=0; lazy<2; lazy++) {
+			const std::string newick = t<2 ? std::string(texts[t]) : large;
+			std::ostringstream captured;
+			std::streambuf *saved = cerr.rdbuf(captured.rdbuf());
+			const bool thrown = throwsParseException([&]() {
+				KBTree tree(newick,false,false,4,lazy==1);
+				tree.toNewick();
+			});
+			cerr.rdbuf(saved);
+			CHECK(thrown);
+			const std::string message = captured.str();
+			const size_t first = message.find("Cannot convert string '");
+			CHECK(first!=std::string::npos);
+			CHECK(first==std::string::npos || message.find("Cannot convert string '",first+1)==std::string::npos);
+		}
+	}
+}
+
+/** a tree loaded from a file is the tree parsed from its text, and keeps the mapped text it needs */
+KBTEST(testFromFile) {
+	const std::string filename = makeTemporaryFile("kbtree_test");
+	// large enough to be parsed on several threads
+	const std::string newick = generateTree(3,60000);
+	std::ofstream(filename.c_str()) << newick;
+	KBTree parsed(newick,false,false);
+	for(int lazy=0; lazy<2; lazy++) {
+		for(unsigned int threads=1; threads<=4; threads+=3) {
+			KBTree *loaded = KBTree::fromFile(filename,false,false,threads,lazy==1);
+			CHECK(loaded!=NULL);
+			if(loaded==NULL) { continue; }
+			CHECK(loaded->getNodeCount()==parsed.getNodeCount());
+			CHECK_EQUAL(parsed.toNewick(KBNode::ORIGINAL_LABEL),loaded->toNewick(KBNode::ORIGINAL_LABEL));
+			CHECK_EQUAL(parsed.toNewick(KBNode::NAME_DISTANCE_AND_COMMENTS),loaded->toNewick(KBNode::NAME_DISTANCE_AND_COMMENTS));
+			delete loaded;
+		}
+	}
+	// the mapping outlives the name of the file
+	KBTree *loaded = KBTree::fromFile(filename,false,false,1,true);
+	unlink(filename.c_str());
+	CHECK(loaded!=NULL);
+	if(loaded!=NULL) { CHECK_EQUAL(parsed.toNewick(),loaded->toNewick()); }
+	delete loaded;
+
+	std::ostringstream reported;
+	std::streambuf *saved = cerr.rdbuf(reported.rdbuf());
+	CHECK(KBTree::fromFile(filename)==NULL);
+	cerr.rdbuf(saved);
+	CHECK(reported.str().find("CANNOT OPEN FILE")!=std::string::npos);
+}
+
+/** a KBTree whose nodes a test can read directly, as a subclass of KBTree can */
+class KBTreeNodes : public KBTree {
+	public:
+		KBTreeNodes(const std::string &newick, bool lazyLabels) : KBTree(newick,false,false,1,lazyLabels) { };
+		KBNodeTree &getNodes() { return *tr; };
+		KBStringTable &getLabels() { return labelTable; };
+};
+
+/** the node getters without a table read the table of the tree holding the node, as the ones taking it do */
+KBTEST(testNodeGettersWithoutTable) {
+	for(unsigned int seed=1; seed<=10; seed++) {
+		for(int lazy=0; lazy<2; lazy++) {
+			KBTreeNodes tree(generateTree(seed,20),lazy==1);
+			KBStringTable &labels = tree.getLabels();
+			for(KBNodeTree::iterator it=tree.getNodes().begin(); it!=tree.getNodes().end(); it++) {
+				const KBNode &node = *it;
+				CHECK_EQUAL(node.getName(labels),node.getName());
+				CHECK_EQUAL(node.getOriginalLabel(labels),node.getOriginalLabel());
+				CHECK(std::isnan(node.getDistanceToParent()) ? std::isnan(node.getDistanceToParent(labels)) : node.getDistanceToParent()==node.getDistanceToParent(labels));
+				CHECK(std::isnan(node.getBootstrapValue()) ? std::isnan(node.getBootstrapValue(labels)) : node.getBootstrapValue()==node.getBootstrapValue(labels));
+				CHECK_EQUAL(node.getLabelFromComponents(labels,KBNode::NAME_DISTANCE_AND_COMMENTS),node.getLabelFromComponents(KBNode::NAME_DISTANCE_AND_COMMENTS));
+				CHECK_EQUAL(node.getLabelFromComponents(labels,true,false,true,false),node.getLabelFromComponents(true,false,true,false));
+			}
+		}
+	}
+	KBNode outside;
+	CHECK_EQUAL("",outside.getName());
+	CHECK_EQUAL("",outside.getOriginalLabel());
+	CHECK(std::isnan(outside.getDistanceToParent()) && std::isnan(outside.getBootstrapValue()));
+}
+
+/** a random clade with unique names for the leaves and some of the other nodes, and the leaves below each
+ * named node that is not a leaf */
+static void generateNamedSubtree(std::mt19937 &rng, unsigned int leaves, std::string &out, std::vector<std::string> &leafNames,
+		std::vector<std::pair<std::string,std::vector<std::string> > > &cladeNames) {
+	char buf[64];
+	if(leaves>1) {
+		const size_t firstLeaf = leafNames.size();
+		unsigned int children = 1+rng()%3;
+		if(children>leaves) { children=leaves; }
+		out+='(';
+		unsigned int left = leaves;
+		for(unsigned int c=0; c<children; c++) {
+			unsigned int size = c+1==children ? left : 1+rng()%(left-(children-c-1));
+			if(c>0) { out+=','; }
+			generateNamedSubtree(rng,size,out,leafNames,cladeNames);
+			left -= size;
+		}
+		out+=')';
+		if(rng()%3==0) {
+			snprintf(buf,sizeof(buf),"N%u",(unsigned int)cladeNames.size());
+			out+=buf;
+			cladeNames.push_back(std::make_pair(std::string(buf),std::vector<std::string>(leafNames.begin()+firstLeaf,leafNames.end())));
+		}
+	} else {
+		snprintf(buf,sizeof(buf),"L%u",(unsigned int)leafNames.size());
+		out+=buf;
+		leafNames.push_back(buf);
+	}
+	switch(rng()%6) {
+		case 0: break;
+		case 1: out+=":0"; break;
+		case 2: out+=":-1"; break;
+		default: snprintf(buf,sizeof(buf),":%.9g",std::uniform_real_distribution<double>(0.0,0.2)(rng)); out+=buf; break;
+	}
+}
+
+/** the induced subtree is the tree the simplify logic leaves after removing everything else */
+KBTEST(testInducedSubtree) {
+	KBTree first("((A:0,B:0)X:0,(C:0,D:0):0);",false,false);
+	KBTree *subtree = first.extractInducedSubtree("A;C");
+	CHECK_EQUAL("((A:0)X:0,C:0);",subtree->toNewick());
+	delete subtree;
+	KBTree second("(F:.5,('q,u':0,'a\\'b':0):-1)D:0;",false,false);
+	subtree = second.extractInducedSubtree("q,u");
+	CHECK_EQUAL("(\"q,u\":-1)D:0;",subtree->toNewick());
+	delete subtree;
+	CHECK(second.extractInducedSubtree("Z")==NULL);
+
+	std::mt19937 rng(2020);
+	for(unsigned int t=0; t<300; t++) {
+		std::string newick;
+		std::vector<std::string> leafNames;
+		std::vector<std::pair<std::string,std::vector<std::string> > > cladeNames;
+		generateNamedSubtree(rng,2+rng()%60,newick,leafNames,cladeNames);
+		newick+=';';
+		KBTree tree(newick,false,false);
+		tree.setOutputPrecision(SHORTEST_ROUND_TRIP);
+		for(unsigned int q=0; q<4; q++) {
+			std::set<std::string> keep;
+			const unsigned int k = 1+rng()%8;
+			for(unsigned int i=0; i<k; i++) { keep.insert(leafNames[rng()%leafNames.size()]); }
+			std::string keepList, removeList;
+			for(std::set<std::string>::iterator it=keep.begin(); it!=keep.end(); it++) { keepList += *it+";"; }
+			for(size_t i=0; i<leafNames.size(); i++) {
+				if(keep.count(leafNames[i])==0) { removeList += leafNames[i]+";"; }
+			}
+			for(size_t i=0; i<cladeNames.size(); i++) {
+				bool above=false;
+				for(size_t j=0; j<cladeNames[i].second.size(); j++) { above = above || keep.count(cladeNames[i].second[j])>0; }
+				if(!above) { removeList += cladeNames[i].first+";"; }
+			}
+			KBTree simplified(newick,false,false);
+			simplified.setOutputPrecision(SHORTEST_ROUND_TRIP);
+			simplified.removeNodesByNameAndSimplify(removeList);
+			subtree = tree.extractInducedSubtree(keepList);
+			subtree->setOutputPrecision(SHORTEST_ROUND_TRIP);
+			CHECK_EQUAL(simplified.toNewick(),subtree->toNewick());
+			CHECK(subtree->getNodeCount()==simplified.getNodeCount());
+			delete subtree;
+		}
+	}
+}
+
+/** removing the nodes with one name leaves the tree that removing them with the whole tree walk leaves, and
+ * renaming is counted and seen by the name queries */
+KBTEST(testRemoveAndRenameByName) {
+	std::mt19937 rng(2016);
+	// names already removed are warned about on cout, and queries for them on cerr
+	std::ostringstream warnings;
+	std::streambuf *savedOut = cout.rdbuf(warnings.rdbuf());
+	std::streambuf *savedErr = cerr.rdbuf(warnings.rdbuf());
+	for(unsigned int t=0; t<200; t++) {
+		std::string newick;
+		std::vector<std::string> leafNames;
+		std::vector<std::pair<std::string,std::vector<std::string> > > cladeNames;
+		generateNamedSubtree(rng,2+rng()%60,newick,leafNames,cladeNames);
+		newick = "("+newick+",Z);";
+		KBTree single(newick,false,false), walked(newick,false,false);
+		single.setOutputPrecision(SHORTEST_ROUND_TRIP);
+		walked.setOutputPrecision(SHORTEST_ROUND_TRIP);
+		// the generated clades can have one child; the walk simplifies those wherever they are, so start from
+		// trees that have none
+		single.removeNodesByNameAndSimplify("");
+		walked.removeNodesByNameAndSimplify("");
+		for(unsigned int q=0; q<5; q++) {
+			const std::string name = rng()%2==0 || cladeNames.empty() ? leafNames[rng()%leafNames.size()] : cladeNames[rng()%cladeNames.size()].first;
+			const unsigned int removed = single.removeNodeByNameAndSimplify(name);
+			walked.removeNodesByNameAndSimplify(name);
+			CHECK_EQUAL(walked.toNewick(),single.toNewick());
+			CHECK(removed<=1);
+		}
+		CHECK(single.replaceNodeName("Z","Y")==1);
+		CHECK(single.replaceNodeName("Z","Y")==0);
+		CHECK(single.getDepth("Y")==1 && single.getDepth("Z")==-1);
+	}
+	cout.rdbuf(savedOut);
+	cerr.rdbuf(savedErr);
+	KBTree shared("((A,A)B,A,C);",false,false);
+	std::string info;
+	CHECK(!shared.areAllLabelsUnique(info));
+	CHECK(shared.replaceNodeName("A","D")==3);
+	CHECK_EQUAL("((D,D)B,D,C);",shared.toNewick());
+	CHECK(shared.removeNodeByNameAndSimplify("D")==3);
+	CHECK_EQUAL("(B,C);",shared.toNewick());
+	KBTree unique("((A,B)X,C)R;",false,false);
+	CHECK(unique.areAllLabelsUnique(info));
+}
+
+/** naming the root in either removal throws before the tree is changed */
+KBTEST(testRemoveRootIsAnError) {
+	const std::string newick = "((A:1,B:2)X:0.5,C:3)R;";
+	KBTree tree(newick,false,false);
+	CHECK(throwsParseException([&]() { tree.removeNodeByNameAndSimplify("R"); }));
+	CHECK_EQUAL(newick,tree.toNewick());
+	CHECK(throwsParseException([&]() { tree.removeNodesByNameAndSimplify("A;R"); }));
+	CHECK_EQUAL(newick,tree.toNewick());
+	CHECK(tree.getDepth("A")==2);
+	tree.removeNodesByNameAndSimplify("A");
+	CHECK_EQUAL("((B:2)X:0.5,C:3)R;",tree.toNewick());
+}
+
+/** the depths, sizes and distances kept up to date through removals are those of the tree parsed again */
+KBTEST(testDerivedPropertiesAfterRemoval) {
+	std::mt19937 rng(2017);
+	std::ostringstream warnings;
+	std::streambuf *saved = cout.rdbuf(warnings.rdbuf());
+	for(unsigned int t=0; t<100; t++) {
+		std::string newick;
+		std::vector<std::string> leafNames;
+		std::vector<std::pair<std::string,std::vector<std::string> > > cladeNames;
+		generateNamedSubtree(rng,2+rng()%60,newick,leafNames,cladeNames);
+		newick = "("+newick+",Z);";
+		KBTree tree(newick,false,false);
+		tree.setOutputPrecision(SHORTEST_ROUND_TRIP);
+		for(unsigned int q=0; q<6; q++) {
+			// asked for before the removal, so that they are computed and then kept up to date
+			tree.getDistanceToRoot("Z");
+			const std::string name = rng()%2==0 || cladeNames.empty() ? leafNames[rng()%leafNames.size()] : cladeNames[rng()%cladeNames.size()].first;
+			if(q%3==2) { tree.removeNodesByNameAndSimplify(name); } else { tree.removeNodeByNameAndSimplify(name); }
+			KBTree parsed(tree.toNewick(),false,false);
+			std::vector<std::string> names;
+			parsed.getAllNodeNames(names);
+			for(size_t i=0; i<names.size(); i++) {
+				if(names[i].empty()) { continue; }
+				CHECK(tree.getDepth(names[i])==parsed.getDepth(names[i]));
+				CHECK(tree.getSubtreeSize(names[i])==parsed.getSubtreeSize(names[i]));
+				CHECK(tree.getCladeLeafCount(names[i])==parsed.getCladeLeafCount(names[i]));
+				CHECK_NEAR(parsed.getDistanceToRoot(names[i]),tree.getDistanceToRoot(names[i]));
+			}
+			CHECK(tree.getLeafCount()==parsed.getLeafCount());
+		}
+	}
+	cout.rdbuf(saved);
+}
+
+/** split name1;name2;... into its names, in order */
+static std::vector<std::string> splitNames(const std::string &names) {
+	std::vector<std::string> split;
+	size_t start = 0;
+	for(size_t end=names.find(';'); end!=std::string::npos; start=end+1, end=names.find(';',start)) { split.push_back(names.substr(start,end-start)); }
+	return split;
+}
+
+/** node IDs number the nodes in preorder, as the compact tree does, answer what the breadth first markers
+ * (which are the same IDs) answer, and are kept through removals by name */
+KBTEST(testNodeIds) {
+	std::mt19937 rng(21);
+	for(unsigned int t=0; t<60; t++) {
+		const std::string newick = t%2==0 ? generateTree(t+1,1+rng()%200) : generateLeafNamedTree(rng,1+rng()%200);
+		KBTree tree(newick,false,false);
+		CHECK(!tree.isValidNodeId(0));
+		tree.buildNodeIds();
+		CHECK(tree.hasNodeIds());
+		KBCompactTree compact(tree);
+		const unsigned int n = compact.getNodeCount();
+		CHECK(tree.getNodeIdLimit()==n);
+		std::vector<unsigned int> size(n,1);
+		for(unsigned int id=n-1; id>0; id--) {
+			if(compact.getParent(id)!=KBCompactTree::NONE) { size[compact.getParent(id)] += size[id]; }
+		}
+		bool allMatch = true;
+		for(unsigned int id=0; id<n; id++) {
+			const uint32_t parent = compact.getParent(id);
+			allMatch = allMatch && tree.getNameById(id)==compact.getName(id)
+				&& tree.getParentId(id)==(parent==KBCompactTree::NONE ? KBTree::NO_NODE_ID : parent);
+			allMatch = allMatch && tree.getSubtreeEndId(id)==id+size[id];
+			const unsigned int other = rng()%n;
+			bool below = false;
+			for(uint32_t up=compact.getParent(other); up!=KBCompactTree::NONE; up=compact.getParent(up)) { below = below || up==id; }
+			allMatch = allMatch && tree.isDescendantOf(other,id)==below;
+		}
+		CHECK(allMatch);
+
+		tree.resetBreadthFirstIterToRoot();
+		bool more = true;
+		while(more) {
+			const unsigned int marker = tree.breadthFirstIterMarkNode();
+			CHECK_EQUAL(tree.breadthFirstIterGetName(marker),tree.getNameById(marker));
+			CHECK_EQUAL(tree.breadthFirstIterGetPathToRoot(marker),tree.getPathToRootById(marker));
+			CHECK_EQUAL(tree.breadthFirstIterGetAllChildrenNames(marker),tree.getChildNamesById(marker));
+			// the same names, breadth first there and in preorder here
+			std::vector<std::string> breadthFirst = splitNames(tree.breadthFirstIterGetAllDescendantNames(marker));
+			std::vector<std::string> preorder = splitNames(tree.getDescendantNamesById(marker));
+			std::sort(breadthFirst.begin(),breadthFirst.end());
+			std::sort(preorder.begin(),preorder.end());
+			CHECK(breadthFirst==preorder);
+			more = tree.breadthFirstIterNext();
+		}
+	}
+
+	KBTree tree("((A,B)X,(C,D)Y,E)R;",false,false);
+	tree.buildNodeIds();
+	const unsigned int a = tree.getNodeId("A"), y = tree.getNodeId("Y"), d = tree.getNodeId("D");
+	CHECK(a==2 && y==4 && d==6);
+	CHECK(tree.getNodeId("Z")==KBTree::NO_NODE_ID);
+	CHECK_EQUAL("X;R;",tree.getPathToRootById(a));
+	CHECK_EQUAL("C;D;",tree.getChildNamesById(y));
+	tree.removeNodeByNameAndSimplify("C");
+	tree.replaceNodeName("D","W");
+	CHECK(tree.hasNodeIds());
+	CHECK(!tree.isValidNodeId(5) && tree.getNameById(5)=="");
+	CHECK(tree.getNodeId("W")==d && tree.getNodeId("A")==a);
+	CHECK_EQUAL("Y;R;",tree.getPathToRootById(d));
+	CHECK(tree.getParentId(d)==y && tree.isDescendantOf(d,y) && tree.getSubtreeEndId(y)==7);
+}
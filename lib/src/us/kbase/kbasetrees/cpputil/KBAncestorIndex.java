@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (http://www.swig.org).
+ * Version 2.0.8
+ *
+ * Do not make changes to this file unless you know what you are doing--modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package us.kbase.kbasetrees.cpputil;
+
+public class KBAncestorIndex {
+  private long swigCPtr;
+  protected boolean swigCMemOwn;
+
+  protected KBAncestorIndex(long cPtr, boolean cMemoryOwn) {
+    swigCMemOwn = cMemoryOwn;
+    swigCPtr = cPtr;
+  }
+
+  protected static long getCPtr(KBAncestorIndex obj) {
+    return (obj == null) ? 0 : obj.swigCPtr;
+  }
+
+  protected void finalize() {
+    delete();
+  }
+
+  public synchronized void delete() {
+    if (swigCPtr != 0) {
+      if (swigCMemOwn) {
+        swigCMemOwn = false;
+        KBTreeUtilJNI.delete_KBAncestorIndex(swigCPtr);
+      }
+      swigCPtr = 0;
+    }
+  }
+
+  public final static long NONE = KBTreeUtilJNI.KBAncestorIndex_NONE_get();
+
+  public KBAncestorIndex(KBTree tree) {
+    this(KBTreeUtilJNI.new_KBAncestorIndex(KBTree.getCPtr(tree), tree), true);
+  }
+
+  public long getNodeCount() {
+    return KBTreeUtilJNI.KBAncestorIndex_getNodeCount(swigCPtr, this);
+  }
+
+  public long getParent(long node) {
+    return KBTreeUtilJNI.KBAncestorIndex_getParent(swigCPtr, this, node);
+  }
+
+  public long getDepth(long node) {
+    return KBTreeUtilJNI.KBAncestorIndex_getDepth(swigCPtr, this, node);
+  }
+
+  public long getSubtreeSize(long node) {
+    return KBTreeUtilJNI.KBAncestorIndex_getSubtreeSize(swigCPtr, this, node);
+  }
+
+  public long getLeafCount(long node) {
+    return KBTreeUtilJNI.KBAncestorIndex_getLeafCount(swigCPtr, this, node);
+  }
+
+  public boolean isLeaf(long node) {
+    return KBTreeUtilJNI.KBAncestorIndex_isLeaf(swigCPtr, this, node);
+  }
+
+  public double getDistanceToRoot(long node) {
+    return KBTreeUtilJNI.KBAncestorIndex_getDistanceToRoot(swigCPtr, this, node);
+  }
+
+  public long getNode(String name) {
+    return KBTreeUtilJNI.KBAncestorIndex_getNode(swigCPtr, this, name);
+  }
+
+  public boolean isAncestor(long ancestor, long node) {
+    return KBTreeUtilJNI.KBAncestorIndex_isAncestor(swigCPtr, this, ancestor, node);
+  }
+
+  public long getLowestCommonAncestor(long a, long b) {
+    return KBTreeUtilJNI.KBAncestorIndex_getLowestCommonAncestor(swigCPtr, this, a, b);
+  }
+
+  public String getLowestCommonAncestorNames(String namePairs) {
+    return KBTreeUtilJNI.KBAncestorIndex_getLowestCommonAncestorNames(swigCPtr, this, namePairs);
+  }
+
+  public boolean isMonophyletic(String leafNames) {
+    return KBTreeUtilJNI.KBAncestorIndex_isMonophyletic(swigCPtr, this, leafNames);
+  }
+
+}
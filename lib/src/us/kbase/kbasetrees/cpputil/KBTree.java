@@ -47,6 +47,70 @@ public class KBTree {
     this(KBTreeUtilJNI.new_KBTree__SWIG_2(newickString, verbose, assumeBootstrapNames), true);
   }
 
+  public KBTree(String newickString, boolean verbose, boolean assumeBootstrapNames, long threadCount, boolean lazyLabels, boolean keepOriginalLabels) {
+    this(KBTreeUtilJNI.new_KBTree__SWIG_3(newickString, verbose, assumeBootstrapNames, threadCount, lazyLabels, keepOriginalLabels), true);
+  }
+
+  public KBTree(String newickString, boolean verbose, boolean assumeBootstrapNames, long threadCount, boolean lazyLabels) {
+    this(KBTreeUtilJNI.new_KBTree__SWIG_4(newickString, verbose, assumeBootstrapNames, threadCount, lazyLabels), true);
+  }
+
+  public KBTree(String newickString, boolean verbose, boolean assumeBootstrapNames, long threadCount) {
+    this(KBTreeUtilJNI.new_KBTree__SWIG_5(newickString, verbose, assumeBootstrapNames, threadCount), true);
+  }
+
+  public static KBTree fromFile(String filename, boolean verbose, boolean assumeBootstrapNames, long threadCount, boolean lazyLabels, boolean keepOriginalLabels) {
+    long cPtr = KBTreeUtilJNI.KBTree_fromFile__SWIG_0(filename, verbose, assumeBootstrapNames, threadCount, lazyLabels, keepOriginalLabels);
+    return (cPtr == 0) ? null : new KBTree(cPtr, true);
+  }
+
+  public static KBTree fromFile(String filename, boolean verbose, boolean assumeBootstrapNames, long threadCount, boolean lazyLabels) {
+    long cPtr = KBTreeUtilJNI.KBTree_fromFile__SWIG_1(filename, verbose, assumeBootstrapNames, threadCount, lazyLabels);
+    return (cPtr == 0) ? null : new KBTree(cPtr, true);
+  }
+
+  public static KBTree fromFile(String filename, boolean verbose, boolean assumeBootstrapNames, long threadCount) {
+    long cPtr = KBTreeUtilJNI.KBTree_fromFile__SWIG_2(filename, verbose, assumeBootstrapNames, threadCount);
+    return (cPtr == 0) ? null : new KBTree(cPtr, true);
+  }
+
+  public static KBTree fromFile(String filename, boolean verbose, boolean assumeBootstrapNames) {
+    long cPtr = KBTreeUtilJNI.KBTree_fromFile__SWIG_3(filename, verbose, assumeBootstrapNames);
+    return (cPtr == 0) ? null : new KBTree(cPtr, true);
+  }
+
+  public static KBTree fromFile(String filename, boolean verbose) {
+    long cPtr = KBTreeUtilJNI.KBTree_fromFile__SWIG_4(filename, verbose);
+    return (cPtr == 0) ? null : new KBTree(cPtr, true);
+  }
+
+  public static KBTree fromFile(String filename) {
+    long cPtr = KBTreeUtilJNI.KBTree_fromFile__SWIG_5(filename);
+    return (cPtr == 0) ? null : new KBTree(cPtr, true);
+  }
+
+  public String toBinary() {
+    return KBTreeUtilJNI.KBTree_toBinary(swigCPtr, this);
+  }
+
+  public boolean writeBinaryToFile(String filename) {
+    return KBTreeUtilJNI.KBTree_writeBinaryToFile(swigCPtr, this, filename);
+  }
+
+  public static KBTree fromBinary(String binary) {
+    long cPtr = KBTreeUtilJNI.KBTree_fromBinary(binary);
+    return (cPtr == 0) ? null : new KBTree(cPtr, true);
+  }
+
+  public static KBTree fromBinaryFile(String filename) {
+    long cPtr = KBTreeUtilJNI.KBTree_fromBinaryFile(filename);
+    return (cPtr == 0) ? null : new KBTree(cPtr, true);
+  }
+
+  public static KBTreeStatistics scanStatistics(String newickString) {
+    return new KBTreeStatistics(KBTreeUtilJNI.KBTree_scanStatistics(newickString), true);
+  }
+
   public String toNewick() {
     return KBTreeUtilJNI.KBTree_toNewick__SWIG_0(swigCPtr, this);
   }
@@ -67,6 +131,14 @@ public class KBTree {
     KBTreeUtilJNI.KBTree_setOutputFlagBootstrapValuesAsLabels(swigCPtr, this, flag);
   }
 
+  public void setOutputPrecision(int precision) {
+    KBTreeUtilJNI.KBTree_setOutputPrecision(swigCPtr, this, precision);
+  }
+
+  public void setOutputThreadCount(long threadCount) {
+    KBTreeUtilJNI.KBTree_setOutputThreadCount(swigCPtr, this, threadCount);
+  }
+
   public String toNewick(long style) {
     return KBTreeUtilJNI.KBTree_toNewick__SWIG_1(swigCPtr, this, style);
   }
@@ -83,6 +155,10 @@ public class KBTree {
     KBTreeUtilJNI.KBTree_removeNodesByNameAndSimplify(swigCPtr, this, nodeNames);
   }
 
+  public long removeNodeByNameAndSimplify(String name) {
+    return KBTreeUtilJNI.KBTree_removeNodeByNameAndSimplify(swigCPtr, this, name);
+  }
+
   public void mergeZeroDistLeaves() {
     KBTreeUtilJNI.KBTree_mergeZeroDistLeaves(swigCPtr, this);
   }
@@ -95,6 +171,58 @@ public class KBTree {
     KBTreeUtilJNI.KBTree_replaceNodeNamesOrMakeBlank(swigCPtr, this, replacements);
   }
 
+  public long replaceNodeName(String name, String newName) {
+    return KBTreeUtilJNI.KBTree_replaceNodeName(swigCPtr, this, name, newName);
+  }
+
+  public String getPathToRoot(String name) {
+    return KBTreeUtilJNI.KBTree_getPathToRoot(swigCPtr, this, name);
+  }
+
+  public String getAllDescendantNames(String name) {
+    return KBTreeUtilJNI.KBTree_getAllDescendantNames(swigCPtr, this, name);
+  }
+
+  public int getDepth(String name) {
+    return KBTreeUtilJNI.KBTree_getDepth(swigCPtr, this, name);
+  }
+
+  public long getSubtreeSize(String name) {
+    return KBTreeUtilJNI.KBTree_getSubtreeSize(swigCPtr, this, name);
+  }
+
+  public long getCladeLeafCount(String name) {
+    return KBTreeUtilJNI.KBTree_getCladeLeafCount(swigCPtr, this, name);
+  }
+
+  public double getDistanceToRoot(String name) {
+    return KBTreeUtilJNI.KBTree_getDistanceToRoot(swigCPtr, this, name);
+  }
+
+  public KBTree extractInducedSubtree(String names) {
+    long cPtr = KBTreeUtilJNI.KBTree_extractInducedSubtree(swigCPtr, this, names);
+    return (cPtr == 0) ? null : new KBTree(cPtr, true);
+  }
+
+  public final static long PHYLIP_MATRIX = KBTreeUtilJNI.KBTree_PHYLIP_MATRIX_get();
+  public final static long TSV_MATRIX = KBTreeUtilJNI.KBTree_TSV_MATRIX_get();
+
+  public boolean writePatristicDistancesToFile(String filename, String names, long format, long threadCount) {
+    return KBTreeUtilJNI.KBTree_writePatristicDistancesToFile__SWIG_0(swigCPtr, this, filename, names, format, threadCount);
+  }
+
+  public boolean writePatristicDistancesToFile(String filename, String names, long format) {
+    return KBTreeUtilJNI.KBTree_writePatristicDistancesToFile__SWIG_1(swigCPtr, this, filename, names, format);
+  }
+
+  public boolean writePatristicDistancesToFile(String filename, String names) {
+    return KBTreeUtilJNI.KBTree_writePatristicDistancesToFile__SWIG_2(swigCPtr, this, filename, names);
+  }
+
+  public boolean writePatristicDistancesToFile(String filename) {
+    return KBTreeUtilJNI.KBTree_writePatristicDistancesToFile__SWIG_3(swigCPtr, this, filename);
+  }
+
   public void stripReservedCharsFromLabels() {
     KBTreeUtilJNI.KBTree_stripReservedCharsFromLabels(swigCPtr, this);
   }
@@ -119,6 +247,14 @@ public class KBTree {
     return KBTreeUtilJNI.KBTree_getLeafCount(swigCPtr, this);
   }
 
+  public long getMemoryUsage() {
+    return KBTreeUtilJNI.KBTree_getMemoryUsage(swigCPtr, this);
+  }
+
+  public KBFrozenTree freeze() {
+    return new KBFrozenTree(KBTreeUtilJNI.KBTree_freeze(swigCPtr, this), true);
+  }
+
   public String getAllLeafNames() {
     return KBTreeUtilJNI.KBTree_getAllLeafNames(swigCPtr, this);
   }
@@ -171,4 +307,54 @@ public class KBTree {
     return KBTreeUtilJNI.KBTree_breadthFirstIterGetAllDescendantNames(swigCPtr, this, nodeMarker);
   }
 
+  public final static long NO_NODE_ID = KBTreeUtilJNI.KBTree_NO_NODE_ID_get();
+
+  public void buildNodeIds() {
+    KBTreeUtilJNI.KBTree_buildNodeIds(swigCPtr, this);
+  }
+
+  public boolean hasNodeIds() {
+    return KBTreeUtilJNI.KBTree_hasNodeIds(swigCPtr, this);
+  }
+
+  public long getNodeIdLimit() {
+    return KBTreeUtilJNI.KBTree_getNodeIdLimit(swigCPtr, this);
+  }
+
+  public boolean isValidNodeId(long id) {
+    return KBTreeUtilJNI.KBTree_isValidNodeId(swigCPtr, this, id);
+  }
+
+  public long getNodeId(String name) {
+    return KBTreeUtilJNI.KBTree_getNodeId(swigCPtr, this, name);
+  }
+
+  public long getParentId(long id) {
+    return KBTreeUtilJNI.KBTree_getParentId(swigCPtr, this, id);
+  }
+
+  public long getSubtreeEndId(long id) {
+    return KBTreeUtilJNI.KBTree_getSubtreeEndId(swigCPtr, this, id);
+  }
+
+  public boolean isDescendantOf(long id, long ancestorId) {
+    return KBTreeUtilJNI.KBTree_isDescendantOf(swigCPtr, this, id, ancestorId);
+  }
+
+  public String getNameById(long id) {
+    return KBTreeUtilJNI.KBTree_getNameById(swigCPtr, this, id);
+  }
+
+  public String getChildNamesById(long id) {
+    return KBTreeUtilJNI.KBTree_getChildNamesById(swigCPtr, this, id);
+  }
+
+  public String getDescendantNamesById(long id) {
+    return KBTreeUtilJNI.KBTree_getDescendantNamesById(swigCPtr, this, id);
+  }
+
+  public String getPathToRootById(long id) {
+    return KBTreeUtilJNI.KBTree_getPathToRootById(swigCPtr, this, id);
+  }
+
 }
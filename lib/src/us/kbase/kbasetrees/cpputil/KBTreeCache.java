@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (http://www.swig.org).
+ * Version 2.0.8
+ *
+ * Do not make changes to this file unless you know what you are doing--modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package us.kbase.kbasetrees.cpputil;
+
+public class KBTreeCache {
+  private long swigCPtr;
+  protected boolean swigCMemOwn;
+
+  protected KBTreeCache(long cPtr, boolean cMemoryOwn) {
+    swigCMemOwn = cMemoryOwn;
+    swigCPtr = cPtr;
+  }
+
+  protected static long getCPtr(KBTreeCache obj) {
+    return (obj == null) ? 0 : obj.swigCPtr;
+  }
+
+  protected void finalize() {
+    delete();
+  }
+
+  public synchronized void delete() {
+    if (swigCPtr != 0) {
+      if (swigCMemOwn) {
+        swigCMemOwn = false;
+        KBTreeUtilJNI.delete_KBTreeCache(swigCPtr);
+      }
+      swigCPtr = 0;
+    }
+  }
+
+  public KBTreeCache(long memoryBudget) {
+    this(KBTreeUtilJNI.new_KBTreeCache__SWIG_0(memoryBudget), true);
+  }
+
+  public KBTreeCache() {
+    this(KBTreeUtilJNI.new_KBTreeCache__SWIG_1(), true);
+  }
+
+  public static KBTreeCache getShared() {
+    return new KBTreeCache(KBTreeUtilJNI.KBTreeCache_getShared(), false);
+  }
+
+  public KBFrozenTree get(String newickString, boolean assumeBootstrapNames) {
+    return new KBFrozenTree(KBTreeUtilJNI.KBTreeCache_get__SWIG_0(swigCPtr, this, newickString, assumeBootstrapNames), true);
+  }
+
+  public KBFrozenTree get(String newickString) {
+    return new KBFrozenTree(KBTreeUtilJNI.KBTreeCache_get__SWIG_1(swigCPtr, this, newickString), true);
+  }
+
+  public boolean contains(String newickString, boolean assumeBootstrapNames) {
+    return KBTreeUtilJNI.KBTreeCache_contains__SWIG_0(swigCPtr, this, newickString, assumeBootstrapNames);
+  }
+
+  public boolean contains(String newickString) {
+    return KBTreeUtilJNI.KBTreeCache_contains__SWIG_1(swigCPtr, this, newickString);
+  }
+
+  public void clear() {
+    KBTreeUtilJNI.KBTreeCache_clear(swigCPtr, this);
+  }
+
+  public void setMemoryBudget(long bytes) {
+    KBTreeUtilJNI.KBTreeCache_setMemoryBudget(swigCPtr, this, bytes);
+  }
+
+  public long getMemoryBudget() {
+    return KBTreeUtilJNI.KBTreeCache_getMemoryBudget(swigCPtr, this);
+  }
+
+  public long getMemoryUsage() {
+    return KBTreeUtilJNI.KBTreeCache_getMemoryUsage(swigCPtr, this);
+  }
+
+  public long getTreeCount() {
+    return KBTreeUtilJNI.KBTreeCache_getTreeCount(swigCPtr, this);
+  }
+
+  public java.math.BigInteger getHitCount() {
+    return KBTreeUtilJNI.KBTreeCache_getHitCount(swigCPtr, this);
+  }
+
+  public java.math.BigInteger getMissCount() {
+    return KBTreeUtilJNI.KBTreeCache_getMissCount(swigCPtr, this);
+  }
+
+  public java.math.BigInteger getEvictionCount() {
+    return KBTreeUtilJNI.KBTreeCache_getEvictionCount(swigCPtr, this);
+  }
+
+  public void resetCounters() {
+    KBTreeUtilJNI.KBTreeCache_resetCounters(swigCPtr, this);
+  }
+
+}
@@ -0,0 +1,62 @@
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (http://www.swig.org).
+ * Version 2.0.8
+ *
+ * Do not make changes to this file unless you know what you are doing--modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package us.kbase.kbasetrees.cpputil;
+
+public class KBTreeStatistics {
+  private long swigCPtr;
+  protected boolean swigCMemOwn;
+
+  protected KBTreeStatistics(long cPtr, boolean cMemoryOwn) {
+    swigCMemOwn = cMemoryOwn;
+    swigCPtr = cPtr;
+  }
+
+  protected static long getCPtr(KBTreeStatistics obj) {
+    return (obj == null) ? 0 : obj.swigCPtr;
+  }
+
+  protected void finalize() {
+    delete();
+  }
+
+  public synchronized void delete() {
+    if (swigCPtr != 0) {
+      if (swigCMemOwn) {
+        swigCMemOwn = false;
+        KBTreeUtilJNI.delete_KBTreeStatistics(swigCPtr);
+      }
+      swigCPtr = 0;
+    }
+  }
+
+  public long getNodeCount() {
+    return KBTreeUtilJNI.KBTreeStatistics_getNodeCount(swigCPtr, this);
+  }
+
+  public long getLeafCount() {
+    return KBTreeUtilJNI.KBTreeStatistics_getLeafCount(swigCPtr, this);
+  }
+
+  public long getMaxDepth() {
+    return KBTreeUtilJNI.KBTreeStatistics_getMaxDepth(swigCPtr, this);
+  }
+
+  public boolean hasBranchLengths() {
+    return KBTreeUtilJNI.KBTreeStatistics_hasBranchLengths(swigCPtr, this);
+  }
+
+  public boolean hasBootstrapValues() {
+    return KBTreeUtilJNI.KBTreeStatistics_hasBootstrapValues(swigCPtr, this);
+  }
+
+  public KBTreeStatistics() {
+    this(KBTreeUtilJNI.new_KBTreeStatistics(), true);
+  }
+
+}
@@ -10,28 +10,68 @@ package us.kbase.kbasetrees.cpputil;
 
 public class KBTreeUtilJNI {
   public final static native String translateToProt(String jarg1);
+  public final static native long KBTreeStatistics_getNodeCount(long jarg1, KBTreeStatistics jarg1_);
+  public final static native long KBTreeStatistics_getLeafCount(long jarg1, KBTreeStatistics jarg1_);
+  public final static native long KBTreeStatistics_getMaxDepth(long jarg1, KBTreeStatistics jarg1_);
+  public final static native boolean KBTreeStatistics_hasBranchLengths(long jarg1, KBTreeStatistics jarg1_);
+  public final static native boolean KBTreeStatistics_hasBootstrapValues(long jarg1, KBTreeStatistics jarg1_);
+  public final static native long new_KBTreeStatistics();
+  public final static native void delete_KBTreeStatistics(long jarg1);
   public final static native long new_KBTree__SWIG_0(String jarg1);
   public final static native long new_KBTree__SWIG_1(String jarg1, boolean jarg2);
   public final static native long new_KBTree__SWIG_2(String jarg1, boolean jarg2, boolean jarg3);
+  public final static native long new_KBTree__SWIG_3(String jarg1, boolean jarg2, boolean jarg3, long jarg4, boolean jarg5, boolean jarg6);
+  public final static native long new_KBTree__SWIG_4(String jarg1, boolean jarg2, boolean jarg3, long jarg4, boolean jarg5);
+  public final static native long new_KBTree__SWIG_5(String jarg1, boolean jarg2, boolean jarg3, long jarg4);
   public final static native void delete_KBTree(long jarg1);
+  public final static native long KBTree_fromFile__SWIG_0(String jarg1, boolean jarg2, boolean jarg3, long jarg4, boolean jarg5, boolean jarg6);
+  public final static native long KBTree_fromFile__SWIG_1(String jarg1, boolean jarg2, boolean jarg3, long jarg4, boolean jarg5);
+  public final static native long KBTree_fromFile__SWIG_2(String jarg1, boolean jarg2, boolean jarg3, long jarg4);
+  public final static native long KBTree_fromFile__SWIG_3(String jarg1, boolean jarg2, boolean jarg3);
+  public final static native long KBTree_fromFile__SWIG_4(String jarg1, boolean jarg2);
+  public final static native long KBTree_fromFile__SWIG_5(String jarg1);
+  public final static native String KBTree_toBinary(long jarg1, KBTree jarg1_);
+  public final static native boolean KBTree_writeBinaryToFile(long jarg1, KBTree jarg1_, String jarg2);
+  public final static native long KBTree_fromBinary(String jarg1);
+  public final static native long KBTree_fromBinaryFile(String jarg1);
+  public final static native long KBTree_scanStatistics(String jarg1);
   public final static native String KBTree_toNewick__SWIG_0(long jarg1, KBTree jarg1_);
   public final static native void KBTree_setOutputFlagLabel(long jarg1, KBTree jarg1_, boolean jarg2);
   public final static native void KBTree_setOutputFlagDistances(long jarg1, KBTree jarg1_, boolean jarg2);
   public final static native void KBTree_setOutputFlagComments(long jarg1, KBTree jarg1_, boolean jarg2);
   public final static native void KBTree_setOutputFlagBootstrapValuesAsLabels(long jarg1, KBTree jarg1_, boolean jarg2);
+  public final static native void KBTree_setOutputPrecision(long jarg1, KBTree jarg1_, int jarg2);
+  public final static native void KBTree_setOutputThreadCount(long jarg1, KBTree jarg1_, long jarg2);
   public final static native String KBTree_toNewick__SWIG_1(long jarg1, KBTree jarg1_, long jarg2);
   public final static native boolean KBTree_writeNewickToFile__SWIG_0(long jarg1, KBTree jarg1_, String jarg2);
   public final static native boolean KBTree_writeNewickToFile__SWIG_1(long jarg1, KBTree jarg1_, String jarg2, long jarg3);
   public final static native void KBTree_removeNodesByNameAndSimplify(long jarg1, KBTree jarg1_, String jarg2);
+  public final static native long KBTree_removeNodeByNameAndSimplify(long jarg1, KBTree jarg1_, String jarg2);
   public final static native void KBTree_mergeZeroDistLeaves(long jarg1, KBTree jarg1_);
   public final static native void KBTree_replaceNodeNames(long jarg1, KBTree jarg1_, String jarg2);
   public final static native void KBTree_replaceNodeNamesOrMakeBlank(long jarg1, KBTree jarg1_, String jarg2);
+  public final static native long KBTree_replaceNodeName(long jarg1, KBTree jarg1_, String jarg2, String jarg3);
+  public final static native String KBTree_getPathToRoot(long jarg1, KBTree jarg1_, String jarg2);
+  public final static native String KBTree_getAllDescendantNames(long jarg1, KBTree jarg1_, String jarg2);
+  public final static native int KBTree_getDepth(long jarg1, KBTree jarg1_, String jarg2);
+  public final static native long KBTree_getSubtreeSize(long jarg1, KBTree jarg1_, String jarg2);
+  public final static native long KBTree_getCladeLeafCount(long jarg1, KBTree jarg1_, String jarg2);
+  public final static native double KBTree_getDistanceToRoot(long jarg1, KBTree jarg1_, String jarg2);
+  public final static native long KBTree_extractInducedSubtree(long jarg1, KBTree jarg1_, String jarg2);
+  public final static native long KBTree_PHYLIP_MATRIX_get();
+  public final static native long KBTree_TSV_MATRIX_get();
+  public final static native boolean KBTree_writePatristicDistancesToFile__SWIG_0(long jarg1, KBTree jarg1_, String jarg2, String jarg3, long jarg4, long jarg5);
+  public final static native boolean KBTree_writePatristicDistancesToFile__SWIG_1(long jarg1, KBTree jarg1_, String jarg2, String jarg3, long jarg4);
+  public final static native boolean KBTree_writePatristicDistancesToFile__SWIG_2(long jarg1, KBTree jarg1_, String jarg2, String jarg3);
+  public final static native boolean KBTree_writePatristicDistancesToFile__SWIG_3(long jarg1, KBTree jarg1_, String jarg2);
   public final static native void KBTree_stripReservedCharsFromLabels(long jarg1, KBTree jarg1_);
   public final static native void KBTree_printTree(long jarg1, KBTree jarg1_);
   public final static native String KBTree_printSimpleTreeToString(long jarg1, KBTree jarg1_);
   public final static native String KBTree_printTreeToString(long jarg1, KBTree jarg1_);
   public final static native long KBTree_getNodeCount(long jarg1, KBTree jarg1_);
   public final static native long KBTree_getLeafCount(long jarg1, KBTree jarg1_);
+  public final static native long KBTree_getMemoryUsage(long jarg1, KBTree jarg1_);
+  public final static native long KBTree_freeze(long jarg1, KBTree jarg1_);
   public final static native String KBTree_getAllLeafNames(long jarg1, KBTree jarg1_);
   public final static native String KBTree_getAllNodeNames(long jarg1, KBTree jarg1_);
   public final static native void KBTree_resetBreadthFirstIterToRoot(long jarg1, KBTree jarg1_);
@@ -45,4 +85,114 @@ public class KBTreeUtilJNI {
   public final static native String KBTree_breadthFirstIterGetParentName__SWIG_1(long jarg1, KBTree jarg1_, long jarg2);
   public final static native String KBTree_breadthFirstIterGetAllChildrenNames(long jarg1, KBTree jarg1_, long jarg2);
   public final static native String KBTree_breadthFirstIterGetAllDescendantNames(long jarg1, KBTree jarg1_, long jarg2);
+  public final static native long KBTree_NO_NODE_ID_get();
+  public final static native void KBTree_buildNodeIds(long jarg1, KBTree jarg1_);
+  public final static native boolean KBTree_hasNodeIds(long jarg1, KBTree jarg1_);
+  public final static native long KBTree_getNodeIdLimit(long jarg1, KBTree jarg1_);
+  public final static native boolean KBTree_isValidNodeId(long jarg1, KBTree jarg1_, long jarg2);
+  public final static native long KBTree_getNodeId(long jarg1, KBTree jarg1_, String jarg2);
+  public final static native long KBTree_getParentId(long jarg1, KBTree jarg1_, long jarg2);
+  public final static native long KBTree_getSubtreeEndId(long jarg1, KBTree jarg1_, long jarg2);
+  public final static native boolean KBTree_isDescendantOf(long jarg1, KBTree jarg1_, long jarg2, long jarg3);
+  public final static native String KBTree_getNameById(long jarg1, KBTree jarg1_, long jarg2);
+  public final static native String KBTree_getChildNamesById(long jarg1, KBTree jarg1_, long jarg2);
+  public final static native String KBTree_getDescendantNamesById(long jarg1, KBTree jarg1_, long jarg2);
+  public final static native String KBTree_getPathToRootById(long jarg1, KBTree jarg1_, long jarg2);
+  public final static native long KBAncestorIndex_NONE_get();
+  public final static native long new_KBAncestorIndex(long jarg1, KBTree jarg1_);
+  public final static native void delete_KBAncestorIndex(long jarg1);
+  public final static native long KBAncestorIndex_getNodeCount(long jarg1, KBAncestorIndex jarg1_);
+  public final static native long KBAncestorIndex_getParent(long jarg1, KBAncestorIndex jarg1_, long jarg2);
+  public final static native long KBAncestorIndex_getDepth(long jarg1, KBAncestorIndex jarg1_, long jarg2);
+  public final static native long KBAncestorIndex_getSubtreeSize(long jarg1, KBAncestorIndex jarg1_, long jarg2);
+  public final static native long KBAncestorIndex_getLeafCount(long jarg1, KBAncestorIndex jarg1_, long jarg2);
+  public final static native boolean KBAncestorIndex_isLeaf(long jarg1, KBAncestorIndex jarg1_, long jarg2);
+  public final static native double KBAncestorIndex_getDistanceToRoot(long jarg1, KBAncestorIndex jarg1_, long jarg2);
+  public final static native long KBAncestorIndex_getNode(long jarg1, KBAncestorIndex jarg1_, String jarg2);
+  public final static native boolean KBAncestorIndex_isAncestor(long jarg1, KBAncestorIndex jarg1_, long jarg2, long jarg3);
+  public final static native long KBAncestorIndex_getLowestCommonAncestor(long jarg1, KBAncestorIndex jarg1_, long jarg2, long jarg3);
+  public final static native String KBAncestorIndex_getLowestCommonAncestorNames(long jarg1, KBAncestorIndex jarg1_, String jarg2);
+  public final static native boolean KBAncestorIndex_isMonophyletic(long jarg1, KBAncestorIndex jarg1_, String jarg2);
+  public final static native long KBTreeCursor_PREORDER_get();
+  public final static native long KBTreeCursor_POSTORDER_get();
+  public final static native long KBTreeCursor_BREADTH_FIRST_get();
+  public final static native long KBTreeCursor_LEAVES_get();
+  public final static native long new_KBTreeCursor__SWIG_0(long jarg1, KBTree jarg1_, long jarg2);
+  public final static native long new_KBTreeCursor__SWIG_1(long jarg1, KBTree jarg1_);
+  public final static native void delete_KBTreeCursor(long jarg1);
+  public final static native long KBTreeCursor_getOrder(long jarg1, KBTreeCursor jarg1_);
+  public final static native void KBTreeCursor_reset(long jarg1, KBTreeCursor jarg1_);
+  public final static native boolean KBTreeCursor_next(long jarg1, KBTreeCursor jarg1_);
+  public final static native boolean KBTreeCursor_isAtEnd(long jarg1, KBTreeCursor jarg1_);
+  public final static native String KBTreeCursor_getName(long jarg1, KBTreeCursor jarg1_);
+  public final static native String KBTreeCursor_getParentName(long jarg1, KBTreeCursor jarg1_);
+  public final static native double KBTreeCursor_getDistanceToParent(long jarg1, KBTreeCursor jarg1_);
+  public final static native double KBTreeCursor_getBootstrapValue(long jarg1, KBTreeCursor jarg1_);
+  public final static native boolean KBTreeCursor_isLeaf(long jarg1, KBTreeCursor jarg1_);
+  public final static native long KBTreeCursor_getNodeId(long jarg1, KBTreeCursor jarg1_);
+  public final static native long new_KBFrozenTree__SWIG_0(long jarg1, KBTree jarg1_);
+  public final static native long new_KBFrozenTree__SWIG_1(String jarg1, boolean jarg2);
+  public final static native long new_KBFrozenTree__SWIG_2(String jarg1);
+  public final static native void delete_KBFrozenTree(long jarg1);
+  public final static native boolean KBFrozenTree_isSameSnapshot(long jarg1, KBFrozenTree jarg1_, long jarg2, KBFrozenTree jarg2_);
+  public final static native long KBFrozenTree_getNodeCount(long jarg1, KBFrozenTree jarg1_);
+  public final static native long KBFrozenTree_getLeafCount(long jarg1, KBFrozenTree jarg1_);
+  public final static native long KBFrozenTree_getMemoryUsage(long jarg1, KBFrozenTree jarg1_);
+  public final static native String KBFrozenTree_getAllLeafNames(long jarg1, KBFrozenTree jarg1_);
+  public final static native String KBFrozenTree_getAllNodeNames(long jarg1, KBFrozenTree jarg1_);
+  public final static native boolean KBFrozenTree_hasNode(long jarg1, KBFrozenTree jarg1_, String jarg2);
+  public final static native String KBFrozenTree_getPathToRoot(long jarg1, KBFrozenTree jarg1_, String jarg2);
+  public final static native int KBFrozenTree_getDepth(long jarg1, KBFrozenTree jarg1_, String jarg2);
+  public final static native long KBFrozenTree_getSubtreeSize(long jarg1, KBFrozenTree jarg1_, String jarg2);
+  public final static native long KBFrozenTree_getCladeLeafCount(long jarg1, KBFrozenTree jarg1_, String jarg2);
+  public final static native double KBFrozenTree_getDistanceToRoot(long jarg1, KBFrozenTree jarg1_, String jarg2);
+  public final static native String KBFrozenTree_getLowestCommonAncestorNames(long jarg1, KBFrozenTree jarg1_, String jarg2);
+  public final static native boolean KBFrozenTree_isMonophyletic(long jarg1, KBFrozenTree jarg1_, String jarg2);
+  public final static native double KBFrozenTree_getPatristicDistance(long jarg1, KBFrozenTree jarg1_, String jarg2, String jarg3);
+  public final static native boolean KBFrozenTree_writePatristicDistancesToFile__SWIG_0(long jarg1, KBFrozenTree jarg1_, String jarg2, String jarg3, long jarg4, long jarg5);
+  public final static native boolean KBFrozenTree_writePatristicDistancesToFile__SWIG_1(long jarg1, KBFrozenTree jarg1_, String jarg2, String jarg3, long jarg4);
+  public final static native boolean KBFrozenTree_writePatristicDistancesToFile__SWIG_2(long jarg1, KBFrozenTree jarg1_, String jarg2, String jarg3);
+  public final static native boolean KBFrozenTree_writePatristicDistancesToFile__SWIG_3(long jarg1, KBFrozenTree jarg1_, String jarg2);
+  public final static native String KBFrozenTree_toNewick__SWIG_0(long jarg1, KBFrozenTree jarg1_);
+  public final static native String KBFrozenTree_toNewick__SWIG_1(long jarg1, KBFrozenTree jarg1_, long jarg2);
+  public final static native boolean KBFrozenTree_writeNewickToFile__SWIG_0(long jarg1, KBFrozenTree jarg1_, String jarg2);
+  public final static native boolean KBFrozenTree_writeNewickToFile__SWIG_1(long jarg1, KBFrozenTree jarg1_, String jarg2, long jarg3);
+  public final static native long KBFrozenTree_toKBTree(long jarg1, KBFrozenTree jarg1_);
+  public final static native long KBFrozenTree_removeNodesByNameAndSimplify(long jarg1, KBFrozenTree jarg1_, String jarg2);
+  public final static native long KBFrozenTree_replaceNodeNames(long jarg1, KBFrozenTree jarg1_, String jarg2);
+  public final static native long new_KBTreeCache__SWIG_0(long jarg1);
+  public final static native long new_KBTreeCache__SWIG_1();
+  public final static native void delete_KBTreeCache(long jarg1);
+  public final static native long KBTreeCache_getShared();
+  public final static native long KBTreeCache_get__SWIG_0(long jarg1, KBTreeCache jarg1_, String jarg2, boolean jarg3);
+  public final static native long KBTreeCache_get__SWIG_1(long jarg1, KBTreeCache jarg1_, String jarg2);
+  public final static native boolean KBTreeCache_contains__SWIG_0(long jarg1, KBTreeCache jarg1_, String jarg2, boolean jarg3);
+  public final static native boolean KBTreeCache_contains__SWIG_1(long jarg1, KBTreeCache jarg1_, String jarg2);
+  public final static native void KBTreeCache_clear(long jarg1, KBTreeCache jarg1_);
+  public final static native void KBTreeCache_setMemoryBudget(long jarg1, KBTreeCache jarg1_, long jarg2);
+  public final static native long KBTreeCache_getMemoryBudget(long jarg1, KBTreeCache jarg1_);
+  public final static native long KBTreeCache_getMemoryUsage(long jarg1, KBTreeCache jarg1_);
+  public final static native long KBTreeCache_getTreeCount(long jarg1, KBTreeCache jarg1_);
+  public final static native java.math.BigInteger KBTreeCache_getHitCount(long jarg1, KBTreeCache jarg1_);
+  public final static native java.math.BigInteger KBTreeCache_getMissCount(long jarg1, KBTreeCache jarg1_);
+  public final static native java.math.BigInteger KBTreeCache_getEvictionCount(long jarg1, KBTreeCache jarg1_);
+  public final static native void KBTreeCache_resetCounters(long jarg1, KBTreeCache jarg1_);
+  public final static native long new_KBTreeDiskCache__SWIG_0(String jarg1, java.math.BigInteger jarg2);
+  public final static native long new_KBTreeDiskCache__SWIG_1(String jarg1);
+  public final static native void delete_KBTreeDiskCache(long jarg1);
+  public final static native long KBTreeDiskCache_get__SWIG_0(long jarg1, KBTreeDiskCache jarg1_, String jarg2, boolean jarg3);
+  public final static native long KBTreeDiskCache_get__SWIG_1(long jarg1, KBTreeDiskCache jarg1_, String jarg2);
+  public final static native boolean KBTreeDiskCache_contains__SWIG_0(long jarg1, KBTreeDiskCache jarg1_, String jarg2, boolean jarg3);
+  public final static native boolean KBTreeDiskCache_contains__SWIG_1(long jarg1, KBTreeDiskCache jarg1_, String jarg2);
+  public final static native String KBTreeDiskCache_getImagePath__SWIG_0(long jarg1, KBTreeDiskCache jarg1_, String jarg2, boolean jarg3);
+  public final static native String KBTreeDiskCache_getImagePath__SWIG_1(long jarg1, KBTreeDiskCache jarg1_, String jarg2);
+  public final static native void KBTreeDiskCache_trim(long jarg1, KBTreeDiskCache jarg1_);
+  public final static native void KBTreeDiskCache_clear(long jarg1, KBTreeDiskCache jarg1_);
+  public final static native void KBTreeDiskCache_setSizeLimit(long jarg1, KBTreeDiskCache jarg1_, java.math.BigInteger jarg2);
+  public final static native java.math.BigInteger KBTreeDiskCache_getSizeLimit(long jarg1, KBTreeDiskCache jarg1_);
+  public final static native java.math.BigInteger KBTreeDiskCache_getDiskUsage(long jarg1, KBTreeDiskCache jarg1_);
+  public final static native java.math.BigInteger KBTreeDiskCache_getHitCount(long jarg1, KBTreeDiskCache jarg1_);
+  public final static native java.math.BigInteger KBTreeDiskCache_getMissCount(long jarg1, KBTreeDiskCache jarg1_);
+  public final static native java.math.BigInteger KBTreeDiskCache_getEvictionCount(long jarg1, KBTreeDiskCache jarg1_);
+  public final static native void KBTreeDiskCache_resetCounters(long jarg1, KBTreeDiskCache jarg1_);
 }